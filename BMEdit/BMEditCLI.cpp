@@ -0,0 +1,1043 @@
+#include <Include/IO/ZIPLevelAssetProvider.h>
+#include <GameLib/PRP/PRPReader.h>
+#include <GameLib/PRM/PRMReader.h>
+#include <GameLib/PRM/PRMMeshExporter.h>
+#include <GameLib/IO/AssetCache.h>
+#include <GameLib/IO/DeflateCodec.h>
+#include <GameLib/TypeRegistry.h>
+#include <GameLib/Workers.h>
+#include <GameLib/Profiler.h>
+#include <GameLib/Scene/SceneQueryException.h>
+#include <GameLib/LevelSnapshot.h>
+#include <GameLib/LevelMerge.h>
+#include <GameLib/LevelDiff.h>
+#include <GameLib/Workspace.h>
+#include <GameLib/Level.h>
+#include <nlohmann/json.hpp>
+#include <unordered_map>
+#include <string_view>
+#include <filesystem>
+#include <algorithm>
+#include <fstream>
+#include <cstdlib>
+#include <cstdio>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <map>
+
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	enum class Command
+	{
+		LOAD,       ///< Load levels only
+		VERIFY,     ///< Load levels, write PRP & PRM back and check that they are the same
+		EXPORT_PRP, ///< Load levels and save PRP of each level to output folder
+		EXPORT_MESH, ///< Load levels and save geoms of each level (placed by world transform) as glTF binary or OBJ to output folder
+		STATS,      ///< Load levels and collect counters
+		MEMORY,     ///< Load levels and report memory owned by each level
+		QUERY,      ///< Load levels into single workspace and find objects by scene query in all of them
+		DIFF,       ///< Load two levels into single workspace and report structural difference between them
+		MERGE       ///< Load three levels (base, ours, theirs), merge property changes of theirs into ours and report conflicts
+	};
+
+	struct Options
+	{
+		Command command { Command::LOAD };
+		std::filesystem::path typesRegistryPath {};
+		std::filesystem::path outputPath {};
+		std::filesystem::path reportPath {};
+		std::filesystem::path tracePath {}; ///< Chrome trace of GameLib hot paths (empty - profiler disabled)
+		std::filesystem::path snapshotsPath {}; ///< Folder of level snapshots (empty - levels are always loaded from assets)
+		std::filesystem::path assetCachePath {}; ///< Folder of persisted inflated assets (empty - assets are cached in memory only)
+		std::string query {}; ///< Scene query (see SceneQuery)
+		editor::ZIPCompressionBackend zipBackend { editor::ZIPCompressionBackend::ZCB_LIBZIP };
+		gamelib::prm::PRMExportFormat meshFormat { gamelib::prm::PRMExportFormat::EF_GLTF_BINARY }; ///< Format of export-mesh output
+		bool isDiffByInstanceId { false }; ///< Match objects by instance id instead of path (diff only)
+		std::vector<std::filesystem::path> inputPaths {};
+		int threadsCount { 0 };
+	};
+
+	struct LevelReport
+	{
+		std::filesystem::path path {};
+		std::string levelName {};
+		std::string error {};
+		bool isOk { false };
+		bool isLoadedFromSnapshot { false };
+		nlohmann::json phases = nlohmann::json::object(); ///< Phase name -> milliseconds
+		nlohmann::json stats = nlohmann::json::object();
+	};
+
+	bool parseCommand(std::string_view name, Command &command)
+	{
+		static const std::unordered_map<std::string_view, Command> kCommands = {
+			{ "load", Command::LOAD },
+			{ "verify", Command::VERIFY },
+			{ "export-prp", Command::EXPORT_PRP },
+			{ "export-mesh", Command::EXPORT_MESH },
+			{ "stats", Command::STATS },
+			{ "memory", Command::MEMORY },
+			{ "query", Command::QUERY },
+			{ "diff", Command::DIFF },
+			{ "merge", Command::MERGE }
+		};
+
+		auto it = kCommands.find(name);
+		if (it == kCommands.end())
+		{
+			return false;
+		}
+
+		command = it->second;
+		return true;
+	}
+
+	bool parseZipBackend(std::string_view name, editor::ZIPCompressionBackend &backend)
+	{
+		if (name == "libzip")
+		{
+			backend = editor::ZIPCompressionBackend::ZCB_LIBZIP;
+			return true;
+		}
+
+		if (name == "parallel")
+		{
+			backend = editor::ZIPCompressionBackend::ZCB_PARALLEL;
+			return true;
+		}
+
+		return false;
+	}
+
+	const char *zipBackendToString(editor::ZIPCompressionBackend backend)
+	{
+		switch (backend)
+		{
+			case editor::ZIPCompressionBackend::ZCB_LIBZIP: return "libzip";
+			case editor::ZIPCompressionBackend::ZCB_PARALLEL: return "parallel";
+		}
+
+		return "unknown";
+	}
+
+	const char *commandToString(Command command)
+	{
+		switch (command)
+		{
+			case Command::LOAD: return "load";
+			case Command::VERIFY: return "verify";
+			case Command::EXPORT_PRP: return "export-prp";
+			case Command::EXPORT_MESH: return "export-mesh";
+			case Command::STATS: return "stats";
+			case Command::MEMORY: return "memory";
+			case Command::QUERY: return "query";
+			case Command::DIFF: return "diff";
+			case Command::MERGE: return "merge";
+		}
+
+		return "unknown";
+	}
+
+	bool hasExtension(const std::filesystem::path &path, std::string_view extension)
+	{
+		auto pathExtension = path.extension().string();
+		std::transform(pathExtension.begin(), pathExtension.end(), pathExtension.begin(), [](unsigned char ch) { return static_cast<char>(std::toupper(ch)); });
+		return pathExtension == extension;
+	}
+
+	void collectLevels(const std::filesystem::path &path, std::vector<std::filesystem::path> &levels)
+	{
+		std::error_code ec;
+
+		if (std::filesystem::is_regular_file(path, ec))
+		{
+			levels.push_back(path);
+			return;
+		}
+
+		std::vector<std::filesystem::path> found;
+		for (const auto &entry : std::filesystem::recursive_directory_iterator(path, std::filesystem::directory_options::skip_permission_denied, ec))
+		{
+			if (entry.is_regular_file(ec) && hasExtension(entry.path(), ".ZIP"))
+			{
+				found.push_back(entry.path());
+			}
+		}
+
+		std::sort(found.begin(), found.end());
+		levels.insert(levels.end(), found.begin(), found.end());
+	}
+
+	/**
+	 * @brief Load types database (the same format as editor uses: { "inc": <folder with type declarations>, "db": { <hash>: <type name> } })
+	 * @note Relative 'inc' folder is looked up in working directory first, then next to the registry file
+	 */
+	bool loadTypesRegistry(const std::filesystem::path &registryPath, std::string &error)
+	{
+		std::ifstream registryStream(registryPath);
+		if (!registryStream)
+		{
+			error = "unable to open types database " + registryPath.string();
+			return false;
+		}
+
+		auto registryFile = nlohmann::json::parse(registryStream, nullptr, false, true);
+		if (registryFile.is_discarded() || !registryFile.contains("inc") || !registryFile.contains("db"))
+		{
+			error = "invalid types database format";
+			return false;
+		}
+
+		std::unordered_map<std::string, std::string> typesToHashes;
+		for (const auto &[hash, typeNameObj]: registryFile["db"].items())
+		{
+			typesToHashes[typeNameObj.get<std::string>()] = hash;
+		}
+
+		std::filesystem::path incPath { registryFile["inc"].get<std::string>() };
+		std::error_code ec;
+		if (incPath.is_relative() && !std::filesystem::is_directory(incPath, ec))
+		{
+			incPath = registryPath.parent_path() / incPath;
+		}
+
+		std::vector<nlohmann::json> typeInfos;
+		for (const auto &entry : std::filesystem::directory_iterator(incPath, ec))
+		{
+			if (!entry.is_regular_file(ec) || entry.path().extension() != ".json")
+			{
+				continue;
+			}
+
+			std::ifstream typeDescriptionStream(entry.path());
+			auto &jsonContents = typeInfos.emplace_back();
+			jsonContents = nlohmann::json::parse(typeDescriptionStream, nullptr, false, true);
+			if (jsonContents.is_discarded())
+			{
+				error = "failed to parse file " + entry.path().string();
+				return false;
+			}
+		}
+
+		if (ec || typeInfos.empty())
+		{
+			error = "no type declarations found in " + incPath.string();
+			return false;
+		}
+
+		try
+		{
+			gamelib::TypeRegistry::getInstance().registerTypes(std::move(typeInfos), std::move(typesToHashes));
+		}
+		catch (const std::exception &ex)
+		{
+			error = std::string("unable to load types database: ") + ex.what();
+			return false;
+		}
+
+		return true;
+	}
+
+	double toMilliseconds(Clock::duration duration)
+	{
+		return std::chrono::duration<double, std::milli>(duration).count();
+	}
+
+	/**
+	 * @brief Run phase and save its duration into report
+	 */
+	template <typename TPhase>
+	auto measure(LevelReport &report, const char *phaseName, TPhase &&phase)
+	{
+		struct PhaseGuard
+		{
+			LevelReport &report;
+			const char *phaseName;
+			Clock::time_point startedAt { Clock::now() };
+
+			~PhaseGuard() { report.phases[phaseName] = toMilliseconds(Clock::now() - startedAt); }
+		} guard { report, phaseName };
+
+		return phase();
+	}
+
+	bool verifyProperties(const gamelib::Level &level, LevelReport &report)
+	{
+		std::vector<uint8_t> buffer;
+		measure(report, "exportPRP", [&level, &buffer]() { level.dumpAsset(gamelib::io::AssetKind::PROPERTIES, buffer); });
+
+		gamelib::prp::PRPReader reader;
+		if (!measure(report, "readExportedPRP", [&reader, &buffer]() { return reader.parse(buffer.data(), static_cast<int64_t>(buffer.size())); }))
+		{
+			report.error = "exported PRP is not readable";
+			return false;
+		}
+
+		const auto &original = level.getLevelProperties()->rawProperties;
+		const auto &restored = reader.getByteCode().getInstructions();
+		const auto [originalIt, restoredIt] = std::mismatch(original.begin(), original.end(), restored.begin(), restored.end());
+
+		if (originalIt != original.end() || restoredIt != restored.end())
+		{
+			report.error = "PRP round trip mismatch at instruction #" + std::to_string(std::distance(original.begin(), originalIt)) +
+				" (" + std::to_string(original.size()) + " instructions in original, " + std::to_string(restored.size()) + " in exported)";
+			return false;
+		}
+
+		return true;
+	}
+
+	bool verifyGeometry(const gamelib::Level &level, LevelReport &report)
+	{
+		std::vector<uint8_t> buffer;
+		measure(report, "exportPRM", [&level, &buffer]() { level.dumpAsset(gamelib::io::AssetKind::GEOMETRY, buffer); });
+
+		gamelib::LevelGeometry restored;
+		gamelib::prm::PRMReader reader { restored.header, restored.chunkDescriptors, restored.chunks };
+		if (!measure(report, "readExportedPRM", [&reader, &buffer]() { return reader.read(gamelib::Span(buffer.data(), static_cast<int64_t>(buffer.size()))); }))
+		{
+			report.error = "exported PRM is not readable";
+			return false;
+		}
+
+		const auto &original = level.getLevelGeometry()->chunks;
+		if (original.size() != restored.chunks.size())
+		{
+			report.error = "PRM round trip mismatch: " + std::to_string(original.size()) + " chunks in original, " + std::to_string(restored.chunks.size()) + " in exported";
+			return false;
+		}
+
+		for (std::size_t chunkIndex = 0; chunkIndex < original.size(); ++chunkIndex)
+		{
+			const auto originalBuffer = original[chunkIndex].getBuffer();
+			const auto restoredBuffer = restored.chunks[chunkIndex].getBuffer();
+
+			if (originalBuffer.size() != restoredBuffer.size() || !std::equal(originalBuffer.cbegin(), originalBuffer.cend(), restoredBuffer.cbegin()))
+			{
+				report.error = "PRM round trip mismatch at chunk #" + std::to_string(chunkIndex);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool exportProperties(const gamelib::Level &level, const std::filesystem::path &outputPath, LevelReport &report)
+	{
+		std::vector<uint8_t> buffer;
+		measure(report, "exportPRP", [&level, &buffer]() { level.dumpAsset(gamelib::io::AssetKind::PROPERTIES, buffer); });
+
+		auto outputFilePath = outputPath / report.levelName;
+		outputFilePath.replace_extension(".PRP");
+
+		const bool isSaved = measure(report, "writePRP", [&outputFilePath, &buffer]()
+		{
+			std::ofstream outputFile(outputFilePath, std::ios::binary | std::ios::trunc);
+			outputFile.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+			return static_cast<bool>(outputFile);
+		});
+
+		if (!isSaved)
+		{
+			report.error = "unable to write " + outputFilePath.string();
+			return false;
+		}
+
+		report.stats["output"] = outputFilePath.string();
+		report.stats["outputBytes"] = buffer.size();
+		return true;
+	}
+
+	bool exportMeshes(const gamelib::Level &level, const Options &options, LevelReport &report)
+	{
+		const auto &chunks = level.getLevelGeometry()->chunks;
+		const auto entries = measure(report, "collectGeoms", [&level, &chunks]() { return gamelib::prm::PRMMeshExporter::collectGeoms(level.getSceneObjects(), chunks); });
+
+		auto outputFilePath = options.outputPath / report.levelName;
+		outputFilePath.replace_extension(options.meshFormat == gamelib::prm::PRMExportFormat::EF_WAVEFRONT_OBJ ? ".obj" : ".glb");
+
+		gamelib::prm::PRMMeshExporter::Options exportOptions;
+		exportOptions.format = options.meshFormat;
+		exportOptions.threadsCount = options.threadsCount;
+
+		gamelib::prm::PRMMeshExporter::Stats exportStats;
+		const bool isSaved = measure(report, "exportMesh", [&chunks, &entries, &exportOptions, &outputFilePath, &exportStats]()
+		{
+			return gamelib::prm::PRMMeshExporter::exportToFile(chunks, entries, exportOptions, outputFilePath.string(), &exportStats);
+		});
+
+		if (!isSaved)
+		{
+			report.error = entries.empty() ? "no geoms with primitives found" : "unable to write " + outputFilePath.string();
+			return false;
+		}
+
+		report.stats["output"] = outputFilePath.string();
+		report.stats["outputBytes"] = exportStats.bytesWritten;
+		report.stats["exportedGeoms"] = exportStats.exportedEntries;
+		report.stats["skippedGeoms"] = exportStats.skippedEntries;
+		report.stats["vertices"] = exportStats.verticesCount;
+		report.stats["triangles"] = exportStats.trianglesCount;
+		return true;
+	}
+
+	void collectStats(const gamelib::Level &level, LevelReport &report)
+	{
+		std::size_t controllersCount = 0;
+		std::size_t propertyInstructionsCount = 0;
+		std::map<std::string, std::size_t> objectsByType {};
+
+		for (const auto &sceneObject : level.getSceneObjects())
+		{
+			controllersCount += sceneObject->getControllers().size();
+			propertyInstructionsCount += sceneObject->getProperties().getInstructions().size();
+			++objectsByType[sceneObject->getType() ? sceneObject->getType()->getName() : std::string("<unknown>")];
+		}
+
+		std::size_t geometryBytes = 0;
+		for (const auto &chunk : level.getLevelGeometry()->chunks)
+		{
+			geometryBytes += static_cast<std::size_t>(chunk.getBuffer().size());
+		}
+
+		const auto *properties = level.getLevelProperties();
+
+		report.stats["sceneObjects"] = level.getSceneObjects().size();
+		report.stats["controllers"] = controllersCount;
+		report.stats["propertyInstructions"] = propertyInstructionsCount;
+		report.stats["prpInstructions"] = properties->rawProperties.size();
+		report.stats["prpObjects"] = properties->objectsCount;
+		report.stats["zdefines"] = properties->ZDefines.getDefinitions().size();
+		report.stats["geometryChunks"] = level.getLevelGeometry()->chunks.size();
+		report.stats["geometryBytes"] = geometryBytes;
+		report.stats["objectsByType"] = objectsByType;
+	}
+
+	void collectMemoryUsage(const gamelib::Level &level, LevelReport &report)
+	{
+		const auto memoryReport = level.memoryReport();
+		nlohmann::json categories = nlohmann::json::object();
+
+		auto toJson = [](const gamelib::MemoryUsage &usage) -> nlohmann::json
+		{
+			return nlohmann::json { { "bytes", usage.bytes }, { "allocations", usage.allocations } };
+		};
+
+		for (int category = 0; category < static_cast<int>(gamelib::MemoryCategory::LAST_CATEGORY); ++category)
+		{
+			const auto memoryCategory = static_cast<gamelib::MemoryCategory>(category);
+			categories[gamelib::MemoryReport::getCategoryName(memoryCategory)] = toJson(memoryReport.get(memoryCategory));
+		}
+
+		report.stats["memory"] = std::move(categories);
+		report.stats["memoryTotal"] = toJson(memoryReport.getTotal());
+	}
+
+	void processLevel(const Options &options, LevelReport &report)
+	{
+		try
+		{
+			auto assetProvider = measure(report, "open", [&report]() { return std::make_unique<editor::ZIPLevelAssetProvider>(report.path.string()); });
+			if (!assetProvider->isValid())
+			{
+				report.error = "unable to open level archive";
+				return;
+			}
+
+			gamelib::Level level { std::move(assetProvider) };
+			const gamelib::LevelSnapshotCache snapshotCache { options.snapshotsPath.string() };
+
+			if (!measure(report, "load", [&level, &options, &snapshotCache]() { return options.snapshotsPath.empty() ? level.loadSceneData() : level.loadSceneData(snapshotCache); }))
+			{
+				report.error = "unable to load level";
+				return;
+			}
+
+			report.levelName = level.getLevelName();
+			report.isLoadedFromSnapshot = level.isLoadedFromSnapshot();
+
+			switch (options.command)
+			{
+				case Command::LOAD:
+					report.isOk = true;
+					break;
+				case Command::VERIFY:
+					report.isOk = verifyProperties(level, report) && verifyGeometry(level, report);
+					break;
+				case Command::EXPORT_PRP:
+					report.isOk = exportProperties(level, options.outputPath, report);
+					break;
+				case Command::EXPORT_MESH:
+					report.isOk = exportMeshes(level, options, report);
+					break;
+				case Command::STATS:
+					collectStats(level, report);
+					report.isOk = true;
+					break;
+				case Command::MEMORY:
+					collectMemoryUsage(level, report);
+					report.isOk = true;
+					break;
+				case Command::QUERY:
+				case Command::DIFF:
+				case Command::MERGE:
+					break; // Levels are processed together (see processWorkspace, processDiff & processMerge)
+			}
+		}
+		catch (const std::exception &ex)
+		{
+			report.error = ex.what();
+			report.isOk = false;
+		}
+	}
+
+	/**
+	 * @brief Load all levels into workspace (they share PRM chunks with the same content)
+	 * @param reportByLevel - index of report of each workspace level
+	 */
+	void loadWorkspace(const Options &options, std::vector<LevelReport> &reports, gamelib::Workspace &workspace, std::vector<std::size_t> &reportByLevel)
+	{
+		for (std::size_t reportIndex = 0; reportIndex < reports.size(); ++reportIndex)
+		{
+			auto assetProvider = std::make_unique<editor::ZIPLevelAssetProvider>(reports[reportIndex].path.string());
+			if (!assetProvider->isValid())
+			{
+				reports[reportIndex].error = "unable to open level archive";
+				continue;
+			}
+
+			workspace.addLevel(std::move(assetProvider));
+			reportByLevel.push_back(reportIndex);
+		}
+
+		const gamelib::LevelSnapshotCache snapshotCache { options.snapshotsPath.string() };
+		const auto startedAt = Clock::now();
+
+		(void)workspace.loadLevels(options.threadsCount, options.snapshotsPath.empty() ? nullptr : &snapshotCache);
+
+		const double loadingTime = toMilliseconds(Clock::now() - startedAt);
+
+		for (std::uint32_t levelIndex = 0; levelIndex < reportByLevel.size(); ++levelIndex)
+		{
+			auto &report = reports[reportByLevel[levelIndex]];
+			report.phases["load"] = loadingTime;
+
+			if (!workspace.isLevelLoaded(levelIndex))
+			{
+				report.error = workspace.getLoadError(levelIndex);
+				continue;
+			}
+
+			report.levelName = workspace.getLevel(levelIndex)->getLevelName();
+			report.isLoadedFromSnapshot = workspace.getLevel(levelIndex)->isLoadedFromSnapshot();
+			report.isOk = true;
+		}
+	}
+
+	nlohmann::json toJson(const gamelib::Workspace &workspace)
+	{
+		nlohmann::json result = nlohmann::json::object();
+		result["sharedChunks"] = workspace.getSharedChunksCount();
+		result["sharedBytes"] = workspace.getSharedBytes();
+		result["memoryBytes"] = workspace.memoryReport().getTotal().bytes;
+		return result;
+	}
+
+	/**
+	 * @brief Load all levels into workspace and run query against all of them
+	 * @return workspace summary (shared chunks & memory)
+	 */
+	nlohmann::json processWorkspace(const Options &options, std::vector<LevelReport> &reports)
+	{
+		gamelib::Workspace workspace;
+		std::vector<std::size_t> reportByLevel;
+		loadWorkspace(options, reports, workspace, reportByLevel);
+
+		for (const auto reportIndex : reportByLevel)
+		{
+			if (reports[reportIndex].isOk)
+			{
+				reports[reportIndex].stats["matches"] = nlohmann::json::array();
+			}
+		}
+
+		try
+		{
+			std::vector<gamelib::Workspace::ObjectRef> matches;
+			workspace.findObjects(gamelib::scene::SceneQuery::parse(options.query), matches);
+
+			for (const auto &match : matches)
+			{
+				const auto &sceneObject = workspace.getLevel(match.levelIndex)->getSceneObjects()[match.objectIndex];
+				reports[reportByLevel[match.levelIndex]].stats["matches"].push_back(sceneObject->getName());
+			}
+		}
+		catch (const gamelib::scene::SceneQueryException &queryException)
+		{
+			for (auto &report : reports)
+			{
+				report.error = queryException.what();
+				report.isOk = false;
+			}
+		}
+
+		return toJson(workspace);
+	}
+
+	const char *diffKindToString(gamelib::DiffKind kind)
+	{
+		switch (kind)
+		{
+			case gamelib::DiffKind::DK_ADDED: return "added";
+			case gamelib::DiffKind::DK_REMOVED: return "removed";
+			case gamelib::DiffKind::DK_CHANGED: return "changed";
+		}
+
+		return "unknown";
+	}
+
+	const char *conflictKindToString(gamelib::MergeConflictKind kind)
+	{
+		switch (kind)
+		{
+			case gamelib::MergeConflictKind::MCK_PROPERTY: return "property";
+			case gamelib::MergeConflictKind::MCK_REMOVED_OBJECT: return "removedObject";
+			case gamelib::MergeConflictKind::MCK_STRUCTURE: return "structure";
+			case gamelib::MergeConflictKind::MCK_NOT_APPLIED: return "notApplied";
+		}
+
+		return "unknown";
+	}
+
+	nlohmann::json toJson(const gamelib::LevelDiff &diff)
+	{
+		nlohmann::json objects = nlohmann::json::array();
+		for (const auto &object : diff.getObjects())
+		{
+			auto &entry = objects.emplace_back(nlohmann::json::object());
+			entry["kind"] = diffKindToString(object.kind);
+			entry["path"] = object.path;
+
+			if (object.kind != gamelib::DiffKind::DK_CHANGED)
+			{
+				continue;
+			}
+
+			entry["typeChanged"] = object.isTypeChanged;
+			entry["parentChanged"] = object.isParentChanged;
+			entry["childrenChanged"] = object.isChildrenChanged;
+			entry["properties"] = nlohmann::json::array();
+
+			for (const auto &property : object.properties)
+			{
+				entry["properties"].push_back({ { "kind", diffKindToString(property.kind) }, { "name", property.name } });
+			}
+		}
+
+		nlohmann::json definitions = nlohmann::json::array();
+		for (const auto &definition : diff.getDefinitions())
+		{
+			definitions.push_back({ { "kind", diffKindToString(definition.kind) }, { "name", definition.name } });
+		}
+
+		nlohmann::json result = nlohmann::json::object();
+		result["added"] = diff.getObjectsCount(gamelib::DiffKind::DK_ADDED);
+		result["removed"] = diff.getObjectsCount(gamelib::DiffKind::DK_REMOVED);
+		result["changed"] = diff.getObjectsCount(gamelib::DiffKind::DK_CHANGED);
+		result["unchanged"] = diff.getUnchangedObjectsCount();
+		result["objects"] = std::move(objects);
+		result["definitions"] = std::move(definitions);
+		return result;
+	}
+
+	/**
+	 * @brief Load old & new levels into workspace and compare them
+	 * @return diff report (or null when any of levels is not loaded)
+	 */
+	nlohmann::json processDiff(const Options &options, std::vector<LevelReport> &reports)
+	{
+		gamelib::Workspace workspace;
+		std::vector<std::size_t> reportByLevel;
+		loadWorkspace(options, reports, workspace, reportByLevel);
+
+		if (reportByLevel.size() != 2 || !workspace.isLevelLoaded(0) || !workspace.isLevelLoaded(1))
+		{
+			return {};
+		}
+
+		gamelib::DiffOptions diffOptions;
+		diffOptions.objectKey = options.isDiffByInstanceId ? gamelib::DiffObjectKey::DOK_INSTANCE_ID : gamelib::DiffObjectKey::DOK_PATH;
+		diffOptions.threadsCount = options.threadsCount;
+
+		const auto startedAt = Clock::now();
+		const auto diff = gamelib::LevelDiff::compare(*workspace.getLevel(0), *workspace.getLevel(1), diffOptions);
+		const double diffTime = toMilliseconds(Clock::now() - startedAt);
+
+		auto result = toJson(diff);
+		result["diffMs"] = diffTime;
+		return result;
+	}
+
+	/**
+	 * @brief Load base, ours & theirs levels into workspace, merge changes of theirs into ours and save PRP of ours into output folder (when set)
+	 * @return merge report (or null when any of levels is not loaded)
+	 */
+	nlohmann::json processMerge(const Options &options, std::vector<LevelReport> &reports)
+	{
+		gamelib::Workspace workspace;
+		std::vector<std::size_t> reportByLevel;
+		loadWorkspace(options, reports, workspace, reportByLevel);
+
+		if (reportByLevel.size() != 3 || !workspace.isLevelLoaded(0) || !workspace.isLevelLoaded(1) || !workspace.isLevelLoaded(2))
+		{
+			return {};
+		}
+
+		gamelib::DiffOptions diffOptions;
+		diffOptions.objectKey = options.isDiffByInstanceId ? gamelib::DiffObjectKey::DOK_INSTANCE_ID : gamelib::DiffObjectKey::DOK_PATH;
+		diffOptions.threadsCount = options.threadsCount;
+
+		const auto &ours = *workspace.getLevel(1);
+		const auto startedAt = Clock::now();
+		const auto merge = gamelib::LevelMerge::merge(*workspace.getLevel(0), ours, *workspace.getLevel(2), diffOptions);
+		std::vector<gamelib::MergeConflict> failedChanges;
+		const auto appliedCount = merge.apply(ours.getSceneObjects(), failedChanges);
+		const double mergeTime = toMilliseconds(Clock::now() - startedAt);
+
+		nlohmann::json changes = nlohmann::json::array();
+		for (const auto &change : merge.getChanges())
+		{
+			changes.push_back({ { "path", change.path }, { "property", change.property } });
+		}
+
+		nlohmann::json conflicts = nlohmann::json::array();
+		for (const auto &conflict : merge.getConflicts())
+		{
+			conflicts.push_back({ { "kind", conflictKindToString(conflict.kind) }, { "path", conflict.path }, { "property", conflict.property } });
+		}
+
+		// Changes which are not written into ours are reported with conflicts, so they are not lost silently
+		for (const auto &failedChange : failedChanges)
+		{
+			conflicts.push_back({ { "kind", conflictKindToString(failedChange.kind) }, { "path", failedChange.path }, { "property", failedChange.property } });
+		}
+
+		if (!options.outputPath.empty())
+		{
+			auto &oursReport = reports[reportByLevel[1]];
+			oursReport.isOk = exportProperties(ours, options.outputPath, oursReport);
+		}
+
+		nlohmann::json result = nlohmann::json::object();
+		result["applied"] = appliedCount;
+		result["notApplied"] = failedChanges.size();
+		result["alreadyMerged"] = merge.getAlreadyMergedCount();
+		result["changes"] = std::move(changes);
+		result["conflicts"] = std::move(conflicts);
+		result["mergeMs"] = mergeTime;
+		return result;
+	}
+
+	nlohmann::json toJson(const LevelReport &report)
+	{
+		nlohmann::json result = nlohmann::json::object();
+
+		result["path"] = report.path.string();
+		result["level"] = report.levelName;
+		result["ok"] = report.isOk;
+		result["fromSnapshot"] = report.isLoadedFromSnapshot;
+		result["phases"] = report.phases;
+
+		if (!report.error.empty())
+		{
+			result["error"] = report.error;
+		}
+
+		if (!report.stats.empty())
+		{
+			result["stats"] = report.stats;
+		}
+
+		return result;
+	}
+
+	void printUsage(const char *programName)
+	{
+		printf("Usage: %s <load|verify|export-prp|export-mesh|stats|memory|query|diff|merge> --types <TypesRegistry.json> [--threads N] [--output <folder>] [--report <file>] [--trace <file>] [--snapshots <folder>] [--asset-cache <folder>] [--zip-backend <libzip|parallel>] [--mesh-format <glb|obj>] [--query <text>] [--by-instance] <level ZIP or folder>...\n", programName);
+		printf("\tload        - load levels\n");
+		printf("\tverify      - load levels, export PRP & PRM and check that exported files are the same\n");
+		printf("\texport-prp  - load levels and save PRP of each level into output folder\n");
+		printf("\texport-mesh - load levels and save geoms of each level (placed by world transform of geom) into output folder as glTF binary or OBJ (--mesh-format)\n");
+		printf("\tstats       - load levels and report counters of each level\n");
+		printf("\tmemory      - load levels and report memory (bytes & allocations per category) owned by each level\n");
+		printf("\tquery       - load all levels together and report objects which match --query (eg. \"type:ZHM3Actor controller:CPatrol\")\n");
+		printf("\tdiff        - load two levels (old & new) and report added, removed & changed objects (matched by path or by instance id when --by-instance is set)\n");
+		printf("\tmerge       - load three levels (base, ours & theirs), merge property changes of theirs into ours, report conflicts and save PRP of ours into output folder (when set)\n");
+		printf("Report (JSON) is printed to stdout when --report is not set\n");
+		printf("Trace (Chrome trace JSON) of GameLib hot paths is saved when --trace is set\n");
+		printf("Snapshots of levels are read from (and saved into) folder when --snapshots is set\n");
+		printf("Inflated assets are cached in memory and persisted into folder when --asset-cache is set\n");
+		printf("Large ZIP entries are deflated by blocks on all threads and inflated at once when --zip-backend is parallel (default: libzip)\n");
+	}
+}
+
+
+int main(int argc, char** argv)
+{
+	Options options;
+
+	if (argc < 3 || !parseCommand(argv[1], options.command))
+	{
+		printUsage(argv[0]);
+		return -1;
+	}
+
+	for (int i = 2; i < argc; ++i)
+	{
+		const std::string_view arg { argv[i] };
+
+		if (arg == "--types" && i + 1 < argc)
+		{
+			options.typesRegistryPath = argv[++i];
+		}
+		else if (arg == "--threads" && i + 1 < argc)
+		{
+			options.threadsCount = std::atoi(argv[++i]);
+		}
+		else if (arg == "--output" && i + 1 < argc)
+		{
+			options.outputPath = argv[++i];
+		}
+		else if (arg == "--report" && i + 1 < argc)
+		{
+			options.reportPath = argv[++i];
+		}
+		else if (arg == "--trace" && i + 1 < argc)
+		{
+			options.tracePath = argv[++i];
+		}
+		else if (arg == "--snapshots" && i + 1 < argc)
+		{
+			options.snapshotsPath = argv[++i];
+		}
+		else if (arg == "--asset-cache" && i + 1 < argc)
+		{
+			options.assetCachePath = argv[++i];
+		}
+		else if (arg == "--zip-backend" && i + 1 < argc)
+		{
+			if (!parseZipBackend(argv[++i], options.zipBackend))
+			{
+				printUsage(argv[0]);
+				return -1;
+			}
+		}
+		else if (arg == "--mesh-format" && i + 1 < argc)
+		{
+			const std::string_view format { argv[++i] };
+			if (format != "glb" && format != "obj")
+			{
+				printUsage(argv[0]);
+				return -1;
+			}
+
+			options.meshFormat = format == "obj" ? gamelib::prm::PRMExportFormat::EF_WAVEFRONT_OBJ : gamelib::prm::PRMExportFormat::EF_GLTF_BINARY;
+		}
+		else if (arg == "--query" && i + 1 < argc)
+		{
+			options.query = argv[++i];
+		}
+		else if (arg == "--by-instance")
+		{
+			options.isDiffByInstanceId = true;
+		}
+		else
+		{
+			options.inputPaths.emplace_back(arg);
+		}
+	}
+
+	if (options.typesRegistryPath.empty() || options.inputPaths.empty() || ((options.command == Command::EXPORT_PRP || options.command == Command::EXPORT_MESH) && options.outputPath.empty()) || (options.command == Command::QUERY && options.query.empty()) || (options.command == Command::DIFF && options.inputPaths.size() != 2) || (options.command == Command::MERGE && options.inputPaths.size() != 3))
+	{
+		printUsage(argv[0]);
+		return -1;
+	}
+
+	const auto startedAt = Clock::now();
+
+	std::string error;
+	if (!loadTypesRegistry(options.typesRegistryPath, error))
+	{
+		fprintf(stderr, "ERROR: %s\n", error.c_str());
+		return -1;
+	}
+
+	const double typesLoadingTime = toMilliseconds(Clock::now() - startedAt);
+
+	std::vector<std::filesystem::path> levels;
+	for (const auto &inputPath : options.inputPaths)
+	{
+		collectLevels(inputPath, levels);
+	}
+
+	if (levels.empty())
+	{
+		fprintf(stderr, "ERROR: no level archives found\n");
+		return -1;
+	}
+
+	if (!options.outputPath.empty())
+	{
+		std::error_code ec;
+		std::filesystem::create_directories(options.outputPath, ec);
+	}
+
+	editor::ZIPLevelAssetProvider::setCompressionBackend(options.zipBackend);
+
+	if (!options.assetCachePath.empty())
+	{
+		gamelib::io::AssetCache::getInstance().setPersistentFolder(options.assetCachePath.string());
+	}
+
+	if (!options.tracePath.empty())
+	{
+		gamelib::Profiler::getInstance().reset();
+		gamelib::Profiler::getInstance().setEnabled(true);
+	}
+
+	std::vector<LevelReport> reports(levels.size());
+	std::mutex logLock;
+
+	auto printLevelResult = [&logLock](LevelReport &report)
+	{
+		std::lock_guard<std::mutex> guard { logLock };
+		fprintf(stderr, "[%s] %s (%.2f ms)%s%s\n",
+				report.isOk ? " OK " : "FAIL",
+				report.path.string().c_str(),
+				report.phases.value("total", report.phases.value("load", 0.0)),
+				report.error.empty() ? "" : ": ",
+				report.error.c_str());
+	};
+
+	for (std::size_t levelIndex = 0; levelIndex < levels.size(); ++levelIndex)
+	{
+		reports[levelIndex].path = levels[levelIndex];
+	}
+
+	nlohmann::json workspaceReport {};
+	nlohmann::json diffReport {};
+	nlohmann::json mergeReport {};
+
+	if (options.command == Command::QUERY)
+	{
+		workspaceReport = processWorkspace(options, reports);
+
+		for (auto &report : reports)
+		{
+			printLevelResult(report);
+		}
+	}
+	else if (options.command == Command::DIFF)
+	{
+		diffReport = processDiff(options, reports);
+
+		for (auto &report : reports)
+		{
+			printLevelResult(report);
+		}
+	}
+	else if (options.command == Command::MERGE)
+	{
+		mergeReport = processMerge(options, reports);
+
+		for (auto &report : reports)
+		{
+			printLevelResult(report);
+		}
+	}
+	else
+	{
+		// Each level is processed by a single worker (level loading is not shared between workers)
+		gamelib::runParallelFor(0, levels.size(), options.threadsCount, [&](std::size_t levelIndex)
+		{
+			auto &report = reports[levelIndex];
+			measure(report, "total", [&options, &report]() { processLevel(options, report); });
+			printLevelResult(report);
+		});
+	}
+
+	if (!options.tracePath.empty())
+	{
+		gamelib::Profiler::getInstance().setEnabled(false);
+
+		if (!gamelib::Profiler::getInstance().writeChromeTrace(options.tracePath.string()))
+		{
+			fprintf(stderr, "ERROR: unable to write trace to %s\n", options.tracePath.string().c_str());
+		}
+	}
+
+	// Report
+	nlohmann::json result = nlohmann::json::object();
+	nlohmann::json levelReports = nlohmann::json::array();
+	std::size_t failedLevels = 0;
+
+	for (const auto &report : reports)
+	{
+		failedLevels += report.isOk ? 0 : 1;
+		levelReports.push_back(toJson(report));
+	}
+
+	result["command"] = commandToString(options.command);
+	result["threads"] = gamelib::resolveWorkersCount(options.threadsCount, levels.size());
+	result["typesLoadingMs"] = typesLoadingTime;
+	result["totalMs"] = toMilliseconds(Clock::now() - startedAt);
+	result["levels"] = std::move(levelReports);
+	result["failed"] = failedLevels;
+	result["zip"] = {
+		{ "backend", zipBackendToString(options.zipBackend) },
+		{ "inflate", gamelib::io::DeflateCodec::getInflateBackendName() }
+	};
+
+	const auto assetCacheStats = gamelib::io::AssetCache::getInstance().getStats();
+	result["assetCache"] = {
+		{ "hits", assetCacheStats.hits },
+		{ "diskHits", assetCacheStats.diskHits },
+		{ "misses", assetCacheStats.misses },
+		{ "evictions", assetCacheStats.evictions },
+		{ "bytes", assetCacheStats.bytes }
+	};
+
+	if (!workspaceReport.is_null())
+	{
+		result["workspace"] = std::move(workspaceReport);
+	}
+
+	if (!diffReport.is_null())
+	{
+		result["diff"] = std::move(diffReport);
+	}
+
+	if (!mergeReport.is_null())
+	{
+		result["merge"] = std::move(mergeReport);
+	}
+
+	const auto reportContents = result.dump(4);
+
+	if (options.reportPath.empty())
+	{
+		printf("%s\n", reportContents.c_str());
+	}
+	else
+	{
+		std::ofstream reportFile(options.reportPath, std::ios::trunc);
+		reportFile << reportContents;
+	}
+
+	return failedLevels ? 1 : 0;
+}
\ No newline at end of file
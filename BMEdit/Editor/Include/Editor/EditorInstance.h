@@ -1,8 +1,10 @@
 #pragma once
 
 #include <QObject>
+#include <QString>
 
 #include <GameLib/Level.h>
+#include <GameLib/EditJournal.h>
 
 
 namespace editor {
@@ -26,21 +28,43 @@ namespace editor {
 
 		const gamelib::Level *getActiveLevel();
 
+		/**
+		 * @fn getLastLoadTracePath
+		 * @brief Chrome trace of the last successful level load (empty when profiler is not available or trace was not saved)
+		 */
+		[[nodiscard]] const QString &getLastLoadTracePath() const;
+
 		[[nodiscard]] std::unique_ptr<gamelib::Level> takeLevel();
 		void restoreLevel(std::unique_ptr<gamelib::Level> &&level);
 
 		void exportAsset(gamelib::io::AssetKind assetKind);
 		bool exportPRP(const QString &filePath);
 
+		/**
+		 * @fn getEditJournal
+		 * @brief History of property edits of active level (cleared when level closed or loaded)
+		 */
+		gamelib::EditJournal &getEditJournal();
+		bool undo();
+		bool redo();
+
 	signals:
 		void levelLoadSuccess();
 		void levelLoadProgressChanged(int totalPercentsProgress, const QString &currentOperationTag);
 		void levelLoadFailed(const QString &reason);
 		void exportAssetSuccess(gamelib::io::AssetKind assetKind, const QString &assetName);
 		void exportAssetFailed(const QString &reason);
+		void entryRestored(const gamelib::Value *value, int entryIndex);
+
+		/**
+		 * @brief Emitted for each change applied by edit journal (edits, undo & redo) whatever value is selected now
+		 */
+		void entryChanged(const gamelib::Value *value, int entryIndex);
 
 	private:
 		std::unique_ptr<gamelib::Level> m_currentLevel;
 		std::string m_currentLevelPath;
+		QString m_lastLoadTracePath;
+		gamelib::EditJournal m_editJournal;
 	};
 }
\ No newline at end of file
@@ -4,15 +4,31 @@
 #include <GameLib/Span.h>
 #include <unordered_map>
 #include <memory>
+#include <cstdint>
 
 namespace editor
 {
+	enum class ZIPCompressionBackend : std::uint8_t
+	{
+		ZCB_LIBZIP,  ///< Entries are inflated & deflated by libzip (single thread per entry)
+		ZCB_PARALLEL ///< Large entries are deflated by blocks on all threads and inflated at once (see gamelib::io::DeflateCodec)
+	};
+
 	class ZIPLevelAssetProvider : public gamelib::io::IOLevelAssetsProvider
 	{
 	public:
+		static constexpr std::int64_t kParallelCodecThreshold = 4 * 1024 * 1024; ///< Smaller entries are always processed by libzip
+
 		explicit ZIPLevelAssetProvider(std::string containerPath);
 		~ZIPLevelAssetProvider() override;
 
+		/**
+		 * @fn setCompressionBackend
+		 * @brief Select backend of all providers (affects next reads & saves)
+		 */
+		static void setCompressionBackend(ZIPCompressionBackend backend);
+		[[nodiscard]] static ZIPCompressionBackend getCompressionBackend();
+
 		// Read API
 		[[nodiscard]] const std::string &getLevelName() const override;
 		[[nodiscard]] std::unique_ptr<uint8_t[]> getAsset(gamelib::io::AssetKind kind, int64_t &bufferSize) const override;
@@ -24,6 +40,7 @@ namespace editor
 		// Etc
 		[[nodiscard]] bool isEditable() const override;
 		[[nodiscard]] bool isValid() const override;
+		[[nodiscard]] std::uint64_t getContentHash() const override;
 
 	private:
 		std::string getAssetFileName(gamelib::io::AssetKind kind) const;
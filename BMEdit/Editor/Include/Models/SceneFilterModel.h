@@ -2,25 +2,62 @@
 
 #include <QSortFilterProxyModel>
 #include <QString>
-#include <QMap>
 
+#include <GameLib/Scene/SceneSearchIndex.h>
+#include <memory>
+#include <vector>
+
+
+namespace gamelib
+{
+	class Level;
+}
 
 namespace models
 {
+	/**
+	 * @brief Filters scene tree by case insensitive regular expression over object name (or over object path when query contains '\').
+	 * @details Search index is built on worker thread after level assigned. Each query computes the match set and its ancestors closure once,
+	 *          so filterAcceptsRow is a lookup. Query without regex metacharacters is a plain substring, it is searched by index
+	 *          (when new query extends previous one, only previous matches are checked). Other queries are matched by QRegularExpression.
+	 * @note In path queries with metacharacters '\' is an escape, so separator of path should be written as '\\'.
+	 */
 	class SceneFilterModel : public QSortFilterProxyModel
 	{
 		Q_OBJECT
 	public:
 		SceneFilterModel(QObject* parent = nullptr);
+		~SceneFilterModel() override;
+
+		void setLevel(const gamelib::Level *level);
+		void resetLevel();
 
 		void setQuery(const QString& query);
 		[[nodiscard]] const QString& getQuery() const;
+		[[nodiscard]] bool isSearchIndexReady() const;
+
+	signals:
+		void searchIndexReady();
 
 	protected:
 		bool filterAcceptsRow(int sourceRow, const QModelIndex& sourceParent) const override;
 
+	private:
+		void onSearchIndexBuilt(std::uint64_t generation, std::shared_ptr<const gamelib::scene::SceneSearchIndex> searchIndex);
+		void applyQuery();
+		void findByRegex(const QString &pattern, gamelib::scene::SceneSearchField fields, std::vector<std::uint32_t> &matches) const;
+		[[nodiscard]] static bool isPlainSubstring(const QString &query);
+
 	private:
 		QString m_query {};
-		mutable QMap<QModelIndex, bool> m_filterResultsCache;
+		std::shared_ptr<const gamelib::scene::SceneSearchIndex> m_searchIndex { nullptr };
+		std::uint64_t m_generation { 0 }; ///< Incremented on each level change, so results of outdated builds are dropped
+
+		// Results of last query
+		std::string m_appliedQuery {};
+		bool m_appliedRegex { false };
+		gamelib::scene::SceneSearchField m_appliedFields { gamelib::scene::SceneSearchField::SSF_NAME };
+		std::vector<std::uint32_t> m_matches {};
+		std::vector<bool> m_visible {};
 	};
 }
\ No newline at end of file
@@ -18,9 +18,6 @@ namespace models
 		void setControllerIndex(int controllerIndex);
 		void resetController();
 
-	private slots:
-		void onValueChanged();
-
 	private:
 		gamelib::scene::SceneObject *m_geom { nullptr };
 		int m_currentControllerIndex = -1;
@@ -23,9 +23,6 @@ namespace models
 		void resetLevel();
 		void resetGeom();
 
-	private slots:
-		void onValueChanged();
-
 	private:
 		std::optional<std::size_t> m_geomIndex {};
 		gamelib::scene::SceneObject* m_geom { nullptr };
@@ -27,6 +27,7 @@ namespace models
 
 	private:
 		[[nodiscard]] bool isValidLevel() const;
+		[[nodiscard]] const gamelib::scene::SceneObject *getObject(const QModelIndex &index) const; ///< Object of index (root object for invalid index)
 
 	private:
 		const gamelib::Level *m_level { nullptr };
@@ -1,7 +1,19 @@
 #pragma once
 
 #include <QAbstractTableModel>
+#include <QPixmap>
+#include <QHash>
 #include <GameLib/Level.h>
+#include <future>
+#include <memory>
+#include <string>
+
+
+namespace rasterizer
+{
+	class ThumbnailAtlas;
+	class ThumbnailCache;
+}
 
 
 namespace models
@@ -28,6 +40,7 @@ namespace models
 
 	public:
 		ScenePrimitivesModel(QObject *parent = nullptr);
+		~ScenePrimitivesModel() override;
 
 		int rowCount(const QModelIndex &parent) const override;
 		int columnCount(const QModelIndex &parent) const override;
@@ -40,7 +53,33 @@ namespace models
 		void setLevel(gamelib::Level* level);
 		void resetLevel();
 
+	signals:
+		void thumbnailsReady();
+
+		/**
+		 * @brief Emitted by thumbnails job (worker thread), delivered to model by queued connection
+		 */
+		void thumbnailsBuilt(const std::shared_ptr<rasterizer::ThumbnailAtlas> &atlas, int generation);
+
+	private slots:
+		void onThumbnailsBuilt(const std::shared_ptr<rasterizer::ThumbnailAtlas> &atlas, int generation);
+
 	private:
+		void startThumbnailsBuild();
+		void waitThumbnailsBuild();
+
+	private:
+		static constexpr int kThumbnailSize = 64;
+
 		gamelib::Level* m_level { nullptr };
+
+		// Thumbnails
+		std::future<void> m_thumbnailsJob {}; ///< Only one job at time, level change while job is running restarts build when job is finished
+		int m_thumbnailsGeneration { 0 };
+		std::shared_ptr<rasterizer::ThumbnailCache> m_thumbnailsCache {}; ///< Loaded by first job, shared by next ones
+		std::string m_thumbnailsCachePath {};
+		QHash<std::uint32_t, QPixmap> m_thumbnails {};
 	};
-}
\ No newline at end of file
+}
+
+Q_DECLARE_METATYPE(std::shared_ptr<rasterizer::ThumbnailAtlas>)
\ No newline at end of file
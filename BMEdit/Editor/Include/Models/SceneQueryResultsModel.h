@@ -0,0 +1,46 @@
+#pragma once
+
+#include <QAbstractTableModel>
+
+#include <GameLib/Scene/SceneQueryEngine.h>
+#include <memory>
+#include <vector>
+
+
+namespace models
+{
+	/**
+	 * @brief Flat list of objects found by scene query (name, type & path of each object)
+	 */
+	class SceneQueryResultsModel : public QAbstractTableModel
+	{
+		Q_OBJECT
+
+	public:
+		enum Column : int
+		{
+			NAME = 0,
+			TYPE,
+			PATH,
+
+			// Total
+			COLUMNS_COUNT
+		};
+
+		SceneQueryResultsModel(QObject *parent = nullptr);
+
+		QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+		QVariant headerData(int section, Qt::Orientation orientation, int role) const override;
+		int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+		int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+
+		void setResults(std::shared_ptr<const gamelib::scene::SceneQueryEngine> engine, std::vector<std::uint32_t> &&results);
+		void resetResults();
+
+		[[nodiscard]] const gamelib::scene::SceneObject *getObject(const QModelIndex &index) const;
+
+	private:
+		std::shared_ptr<const gamelib::scene::SceneQueryEngine> m_engine { nullptr };
+		std::vector<std::uint32_t> m_results {};
+	};
+}
\ No newline at end of file
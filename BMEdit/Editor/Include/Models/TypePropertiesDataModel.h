@@ -5,9 +5,14 @@
 #include <QObject>
 #include <QString>
 
+#include <GameLib/TypeRegistry.h>
+
 
 namespace models
 {
+	/**
+	 * @brief Properties of type (including inherited ones). Rows are taken from cached properties table of TypeRegistry
+	 */
 	class TypePropertiesDataModel : public QAbstractTableModel
 	{
 		Q_OBJECT
@@ -25,5 +30,7 @@ namespace models
 
 	private:
 		QString m_currentTypeName;
+		const gamelib::Type *m_type { nullptr };
+		const gamelib::TypeRegistry::PropertiesTable *m_properties { nullptr };
 	};
 }
\ No newline at end of file
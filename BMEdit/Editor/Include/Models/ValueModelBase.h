@@ -2,11 +2,17 @@
 
 #include <QAbstractTableModel>
 #include <GameLib/Value.h>
-#include <optional>
+#include <Types/QGlacierValue.h>
+#include <vector>
 
 
 namespace models
 {
+	/**
+	 * @brief Table of entries (name, value) of gamelib::Value.
+	 * @details Model edits assigned value in place (through edit journal of editor, so each edit could be undone). Each VALUE cell hands out types::QGlacierValue which shares buffer with model cache,
+	 *          so repaint of the table does not allocate anything (buffer of entry made once on first access and dropped on entry change).
+	 */
 	class ValueModelBase : public QAbstractTableModel
 	{
 		Q_OBJECT
@@ -20,7 +26,7 @@ namespace models
 		};
 
 	public:
-		using QAbstractTableModel::QAbstractTableModel;
+		explicit ValueModelBase(QObject *parent = nullptr);
 
 		int rowCount(const QModelIndex &parent) const override;
 		int columnCount(const QModelIndex &parent) const override;
@@ -30,9 +36,13 @@ namespace models
 		                    int role = Qt::DisplayRole) const override;
 		Qt::ItemFlags flags(const QModelIndex &index) const override;
 
-		void setValue(const gamelib::Value &value);
+		/**
+		 * @fn setValue
+		 * @param value - value to present & edit (must be alive until resetValue or next setValue call)
+		 */
+		void setValue(gamelib::Value *value);
 		void resetValue();
-		[[nodiscard]] const std::optional<gamelib::Value> &getValue() const;
+		[[nodiscard]] const gamelib::Value *getValue() const;
 
 	signals:
 		void valueChanged();
@@ -41,6 +51,11 @@ namespace models
 		[[nodiscard]] bool isReady() const;
 
 	private:
-		std::optional<gamelib::Value> m_value;
+		[[nodiscard]] const types::QGlacierValue &getEntryValue(int entryIndex) const;
+		void onEntryRestored(const gamelib::Value *value, int entryIndex);
+
+	private:
+		gamelib::Value *m_value { nullptr };
+		mutable std::vector<types::QGlacierValue> m_entryValues {}; ///< Cached buffers of entries (null until first access)
 	};
 }
\ No newline at end of file
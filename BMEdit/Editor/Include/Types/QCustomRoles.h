@@ -8,5 +8,6 @@ namespace types {
 	constexpr int kChunkIndexRole        = Qt::UserRole + 9;
 	constexpr int kChunkKindRole         = Qt::UserRole + 10;
 	constexpr int kChunkVertexFormatRole = Qt::UserRole + 11;
-	// +12 .. - free
-}
+	constexpr int kChunkThumbnailRole    = Qt::UserRole + 12;
+	// +13 .. - free
+}
\ No newline at end of file
@@ -2,18 +2,56 @@
 
 #include <QMetaType>
 #include <GameLib/Value.h>
+#include <memory>
+#include <vector>
 
 
 namespace types
 {
 	/**
-	 * Just hold a gamelib::Value thing
+	 * @brief Instructions & views of single value entry.
+	 * @details Buffer is shared between copies (copy is a reference counter increment, so QVariant holds it without allocations).
+	 *          First mutable access of shared buffer makes own copy of it (copy-on-write).
 	 */
-	struct QGlacierValue
+	class QGlacierValue
 	{
-		std::vector<gamelib::prp::PRPInstruction> instructions;
-		std::vector<gamelib::ValueView> views;
+	public:
+		QGlacierValue() = default;
+		QGlacierValue(std::vector<gamelib::prp::PRPInstruction> instructions, std::vector<gamelib::ValueView> views);
+
+		/**
+		 * @fn fromEntry
+		 * @param value - source value
+		 * @param entry - entry of source value
+		 * @return new value with own copy of entry instructions & views
+		 */
+		static QGlacierValue fromEntry(const gamelib::Value &value, const gamelib::ValueEntry &entry);
+
+		[[nodiscard]] const std::vector<gamelib::prp::PRPInstruction> &getInstructions() const;
+		[[nodiscard]] const std::vector<gamelib::ValueView> &getViews() const;
+
+		/**
+		 * @fn getMutableInstructions
+		 * @return instructions which could be changed (buffer will be detached when it shared with another value)
+		 */
+		[[nodiscard]] std::vector<gamelib::prp::PRPInstruction> &getMutableInstructions();
+
+		[[nodiscard]] bool isNull() const;
+
+	private:
+		struct Buffer
+		{
+			std::vector<gamelib::prp::PRPInstruction> instructions {};
+			std::vector<gamelib::ValueView> views {};
+		};
+
+		void detach();
+
+	private:
+		std::shared_ptr<Buffer> m_buffer { nullptr };
 	};
 }
 
+// shared_ptr is fine to be moved by memcpy, so QVariant will store value in place
+Q_DECLARE_TYPEINFO(types::QGlacierValue, Q_RELOCATABLE_TYPE);
 Q_DECLARE_METATYPE(types::QGlacierValue)
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <QOpenGLWidget>
 #include <QOpenGLVertexArrayObject> // VAO
 #include <QOpenGLBuffer> // Generic buffer
+#include <QImage>
 #include <cstdint>
 
 
@@ -37,5 +38,6 @@ namespace widgets
 		const gamelib::Level *m_level { nullptr };
 		std::uint32_t m_primitiveIndex { 0 };
 		bool m_doPreloadNewPrimitive { false };
+		QImage m_primitivePreview {};
 	};
 }
\ No newline at end of file
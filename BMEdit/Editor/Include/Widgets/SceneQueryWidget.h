@@ -0,0 +1,59 @@
+#pragma once
+
+#include <QWidget>
+
+#include <GameLib/Scene/SceneQueryEngine.h>
+#include <memory>
+
+
+class QLineEdit;
+class QLabel;
+class QTableView;
+
+namespace gamelib
+{
+	class Level;
+}
+
+namespace models
+{
+	class SceneQueryResultsModel;
+}
+
+namespace widgets
+{
+	/**
+	 * @brief Runs structured scene queries (see gamelib::scene::SceneQuery) and shows found objects as flat list.
+	 * @details Query engine indexes are built on worker thread after level assigned. Results are taken from engine directly, scene tree model is not touched.
+	 *          Each change of edit journal drops cached property columns of edited object.
+	 */
+	class SceneQueryWidget : public QWidget
+	{
+		Q_OBJECT
+
+	public:
+		SceneQueryWidget(QWidget *parent = nullptr);
+		~SceneQueryWidget() override;
+
+		void setLevel(const gamelib::Level *level);
+		void resetLevel();
+
+	signals:
+		void sceneObjectSelected(const gamelib::scene::SceneObject *sceneObject);
+
+	private:
+		void setup();
+		void onEngineBuilt(std::uint64_t generation, std::shared_ptr<gamelib::scene::SceneQueryEngine> engine);
+		void onRunQuery();
+		void onEntryChanged(const gamelib::Value *value);
+
+	private:
+		QLineEdit *m_queryInput { nullptr };
+		QLabel *m_statusLabel { nullptr };
+		QTableView *m_resultsView { nullptr };
+		models::SceneQueryResultsModel *m_resultsModel { nullptr };
+
+		std::shared_ptr<gamelib::scene::SceneQueryEngine> m_engine { nullptr };
+		std::uint64_t m_generation { 0 }; ///< Incremented on each level change, so results of outdated builds are dropped
+	};
+}
\ No newline at end of file
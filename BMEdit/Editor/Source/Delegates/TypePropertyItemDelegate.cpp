@@ -6,6 +6,7 @@
 #include <Widgets/TypePropertyWidget.h>
 #include <GameLib/PRP/PRPInstruction.h>
 #include <Types/QGlacierValue.h>
+#include <Editor/EditorInstance.h>
 #include <GameLib/Type.h>
 #include <QVBoxLayout>
 #include <QLabel>
@@ -21,9 +22,9 @@ namespace delegates
 
 	static bool isValueCouldBePresentedBySimpleView(const types::QGlacierValue &data)
 	{
-		if (data.instructions.size() == 1)
+		if (data.getInstructions().size() == 1)
 		{
-			const auto& instruction = data.instructions[0];
+			const auto& instruction = data.getInstructions()[0];
 			return instruction.isEnum() || instruction.isTrivialValue();
 		}
 
@@ -32,9 +33,9 @@ namespace delegates
 
 	static bool isValueCouldBePresentedAsSimpleVectorWidget(const types::QGlacierValue &data)
 	{
-		if (data.instructions.size() == 5)
+		if (data.getInstructions().size() == 5)
 		{
-			return data.instructions.front().isBeginArray() && data.instructions.back().isEndArray() && data.instructions.front().getOperand().trivial.i32 == 3;
+			return data.getInstructions().front().isBeginArray() && data.getInstructions().back().isEndArray() && data.getInstructions().front().getOperand().trivial.i32 == 3;
 		}
 
 		return false;
@@ -42,9 +43,9 @@ namespace delegates
 
 	static bool isValueCouldBePresentedAsSimpleMatrixWidget(const types::QGlacierValue &data, int rows, int columns)
 	{
-		if (data.instructions.size() == (2 + (rows * columns)))
+		if (data.getInstructions().size() == (2 + (rows * columns)))
 		{
-			return data.instructions.front().isBeginArray() && data.instructions.back().isEndArray() && data.instructions.front().getOperand().trivial.i32 == (rows * columns);
+			return data.getInstructions().front().isBeginArray() && data.getInstructions().back().isEndArray() && data.getInstructions().front().getOperand().trivial.i32 == (rows * columns);
 		}
 
 		return false;
@@ -52,10 +53,10 @@ namespace delegates
 
 	static bool isRefTab(const types::QGlacierValue &data)
 	{
-		if (data.views.empty())
+		if (data.getViews().empty())
 			return false;
 
-		const gamelib::ValueView& view = data.views.at(0);
+		const gamelib::ValueView& view = data.getViews().at(0);
 		if (auto type = view.getType())
 		{
 			return (type->getKind() == gamelib::TypeKind::CONTAINER) && (type->getName().find("ZREFTAB") != std::string::npos);
@@ -66,6 +67,11 @@ namespace delegates
 
 	TypePropertyItemDelegate::TypePropertyItemDelegate(QObject *parent) : QStyledItemDelegate(parent)
 	{
+		// Editor closed (submitted, focus lost or cancelled): next edit of the same entry is a new history record
+		connect(this, &QAbstractItemDelegate::closeEditor, [=]()
+		{
+			editor::EditorInstance::getInstance().getEditJournal().seal();
+		});
 	}
 
 	QWidget *TypePropertyItemDelegate::createEditor(QWidget *parent, const QStyleOptionViewItem &option, const QModelIndex &index) const
@@ -75,7 +81,7 @@ namespace delegates
 			widgets::TypePropertyWidget *editor = nullptr;
 
 			auto data = index.data(Qt::EditRole).value<types::QGlacierValue>();
-			if (data.instructions.empty())
+			if (data.getInstructions().empty())
 			{
 				// Empty widget
 				editor = new widgets::TypePropertyWidget(parent);
@@ -149,9 +155,10 @@ namespace delegates
 
 	void TypePropertyItemDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const
 	{
-		if (index.data(Qt::EditRole).canConvert<types::QGlacierValue>())
+		// NOTE: Value shares buffer with model, so here we only ask model once and don't copy instructions
+		if (const QVariant value = index.data(Qt::EditRole); value.canConvert<types::QGlacierValue>())
 		{
-			auto data = index.data(Qt::EditRole).value<types::QGlacierValue>();
+			const auto data = value.value<types::QGlacierValue>();
 			if (isValueCouldBePresentedBySimpleView(data))
 			{
 				painter->save();
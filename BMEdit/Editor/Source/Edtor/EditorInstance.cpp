@@ -4,10 +4,14 @@
 #include <GameLib/PRP/PRPStructureError.h>
 #include <GameLib/Scene/SceneObjectVisitorException.h>
 #include <GameLib/TypeNotFoundException.h>
+#include <GameLib/LevelSnapshot.h>
+#include <GameLib/Profiler.h>
 #include <BMEditMainWindow.h>
 
 #include <QApplication>
+#include <QStandardPaths>
 #include <QFile>
+#include <QDir>
 
 
 namespace editor {
@@ -52,8 +56,48 @@ namespace editor {
 		}
 	};
 
+	class LoadProfilerSession
+	{
+	public:
+		LoadProfilerSession()
+		{
+			gamelib::Profiler::getInstance().reset();
+			gamelib::Profiler::getInstance().setEnabled(true);
+		}
+
+		~LoadProfilerSession()
+		{
+			gamelib::Profiler::getInstance().setEnabled(false);
+		}
+
+		LoadProfilerSession(const LoadProfilerSession&) = delete;
+		LoadProfilerSession(LoadProfilerSession&&) = delete;
+		LoadProfilerSession& operator=(const LoadProfilerSession&) = delete;
+		LoadProfilerSession& operator=(LoadProfilerSession&&) = delete;
+
+		/**
+		 * Stop collecting and save trace, returns path to trace file (empty when trace was not saved)
+		 */
+		QString finish()
+		{
+			gamelib::Profiler::getInstance().setEnabled(false);
+
+			const QString tracePath = QDir::temp().filePath("BMEdit_LoadTrace.json");
+			if (!gamelib::Profiler::getInstance().writeChromeTrace(tracePath.toStdString()))
+			{
+				return QString();
+			}
+
+			return tracePath;
+		}
+	};
+
 	EditorInstance::EditorInstance() : QObject(nullptr)
 	{
+		m_editJournal.setChangeListener([this](const gamelib::EditJournal::Change &change)
+		{
+			emit entryChanged(change.value, change.entryIndex);
+		});
 	}
 
 	EditorInstance &EditorInstance::getInstance()
@@ -77,6 +121,7 @@ namespace editor {
 	void EditorInstance::openLevelFromZIP(const std::string &path)
 	{
 		LevelBackup levelBackup { &m_currentLevel, &m_currentLevelPath };
+		LoadProfilerSession profilerSession {};
 
 		auto provider = std::make_unique<ZIPLevelAssetProvider>(path);
 		if (!provider)
@@ -102,7 +147,11 @@ namespace editor {
 		try
 #endif
 		{
-			if (!m_currentLevel->loadSceneData())
+			// Snapshot of level is made on first open, next opens of the same archive read it instead of assets
+			const QString snapshotsFolder = QDir(QStandardPaths::writableLocation(QStandardPaths::CacheLocation)).filePath("LevelSnapshots");
+			const gamelib::LevelSnapshotCache snapshotCache { snapshotsFolder.toStdString() };
+
+			if (!m_currentLevel->loadSceneData(snapshotCache))
 			{
 				levelLoadFailed(QString("Unable to load scene data!"));
 				return;
@@ -110,6 +159,8 @@ namespace editor {
 
 			levelBackup.decline(); // Destroy previous instance of level
 			m_currentLevelPath = path; // Store path to level
+			m_editJournal.clear(); // Journal refers to values of previous level
+			m_lastLoadTracePath = profilerSession.finish();
 			levelLoadSuccess();
 		}
 #ifndef BMEDIT_DEBUG
@@ -136,6 +187,11 @@ namespace editor {
 #endif
 	}
 
+	const QString &EditorInstance::getLastLoadTracePath() const
+	{
+		return m_lastLoadTracePath;
+	}
+
 	const gamelib::Level *EditorInstance::getActiveLevel()
 	{
 		return m_currentLevel.get();
@@ -143,6 +199,7 @@ namespace editor {
 
 	void EditorInstance::closeLevel()
 	{
+		m_editJournal.clear();
 		m_currentLevel = nullptr;
 	}
 
@@ -215,4 +272,33 @@ namespace editor {
 
 		return true;
 	}
+
+	gamelib::EditJournal &EditorInstance::getEditJournal()
+	{
+		return m_editJournal;
+	}
+
+	bool EditorInstance::undo()
+	{
+		const auto change = m_editJournal.undo();
+		if (!change.has_value())
+		{
+			return false;
+		}
+
+		emit entryRestored(change->value, change->entryIndex);
+		return true;
+	}
+
+	bool EditorInstance::redo()
+	{
+		const auto change = m_editJournal.redo();
+		if (!change.has_value())
+		{
+			return false;
+		}
+
+		emit entryRestored(change->value, change->entryIndex);
+		return true;
+	}
 }
\ No newline at end of file
@@ -1,7 +1,15 @@
 #include <Include/IO/ZIPLevelAssetProvider.h>
+#include <GameLib/IO/DeflateCodec.h>
+#include <GameLib/IO/AssetCache.h>
+#include <GameLib/ContentHash.h>
+#include <GameLib/Profiler.h>
 #include <string_view>
 #include <filesystem>
+#include <optional>
 #include <cassert>
+#include <cstring>
+#include <atomic>
+#include <vector>
 
 extern "C"
 {
@@ -29,6 +37,7 @@ namespace editor
 		std::string m_path {};
 		std::string m_levelName;
 		std::unordered_map<gamelib::io::AssetKind, std::string> m_assetNamesCache;
+		std::optional<std::uint64_t> m_archiveId {}; // content hash of archive (see AssetCache), resolved on first read
 		bool m_isOk { true };
 
 		~Context()
@@ -84,6 +93,142 @@ namespace editor
 		return true;
 	}
 
+	static std::atomic<ZIPCompressionBackend> g_compressionBackend { ZIPCompressionBackend::ZCB_LIBZIP };
+
+	/**
+	 * @brief Read raw deflate stream of entry and inflate it at once (libzip inflates entry by small chunks)
+	 * @return nullptr when entry is not deflated (or encrypted) or when stream is broken
+	 */
+	static std::unique_ptr<uint8_t[]> readDeflatedEntry(zip_t *archive, zip_int64_t entryIndex, const zip_stat_t &entryInfo)
+	{
+		const auto requiredFields = ZIP_STAT_SIZE | ZIP_STAT_COMP_SIZE | ZIP_STAT_COMP_METHOD | ZIP_STAT_ENCRYPTION_METHOD | ZIP_STAT_CRC;
+		if ((entryInfo.valid & requiredFields) != requiredFields || entryInfo.comp_method != ZIP_CM_DEFLATE || entryInfo.encryption_method != ZIP_EM_NONE)
+		{
+			return nullptr;
+		}
+
+		auto compressed = std::make_unique<uint8_t[]>(entryInfo.comp_size);
+
+		zip_file_t *zipFile = zip_fopen_index(archive, entryIndex, ZIP_FL_COMPRESSED);
+		if (!zipFile)
+		{
+			return nullptr;
+		}
+
+		const zip_int64_t readyBytes = zip_fread(zipFile, compressed.get(), entryInfo.comp_size);
+		zip_fclose(zipFile);
+
+		if (readyBytes < 0 || static_cast<zip_uint64_t>(readyBytes) != entryInfo.comp_size)
+		{
+			return nullptr;
+		}
+
+		auto buffer = std::make_unique<uint8_t[]>(entryInfo.size);
+		const gamelib::Span<uint8_t> compressedStream { compressed.get(), static_cast<int64_t>(entryInfo.comp_size) };
+
+		if (!gamelib::io::DeflateCodec::decompress(compressedStream, buffer.get(), entryInfo.size) ||
+			gamelib::io::DeflateCodec::computeCRC32(gamelib::Span<uint8_t>(buffer.get(), static_cast<int64_t>(entryInfo.size))) != entryInfo.crc)
+		{
+			return nullptr;
+		}
+
+		GAMELIB_PROFILE_COUNTER("ZIP inflated bytes", static_cast<std::int64_t>(entryInfo.size));
+		return buffer;
+	}
+
+	/**
+	 * @brief Source of already deflated entry: libzip takes data as is (it doesn't compress data again when compression method of source is the same)
+	 */
+	struct DeflatedSource
+	{
+		std::vector<uint8_t> stream {};
+		std::uint32_t crc { 0 };
+		std::uint64_t size { 0 };
+		std::size_t offset { 0 };
+		zip_error_t error {};
+	};
+
+	static zip_int64_t deflatedSourceCallback(void *userdata, void *data, zip_uint64_t len, zip_source_cmd_t cmd)
+	{
+		auto *source = static_cast<DeflatedSource *>(userdata);
+
+		switch (cmd)
+		{
+			case ZIP_SOURCE_OPEN:
+				source->offset = 0;
+				return 0;
+			case ZIP_SOURCE_READ:
+			{
+				const auto readyBytes = std::min<std::size_t>(static_cast<std::size_t>(len), source->stream.size() - source->offset);
+				std::memcpy(data, source->stream.data() + source->offset, readyBytes);
+				source->offset += readyBytes;
+				return static_cast<zip_int64_t>(readyBytes);
+			}
+			case ZIP_SOURCE_CLOSE:
+				return 0;
+			case ZIP_SOURCE_STAT:
+			{
+				auto *stat = ZIP_SOURCE_GET_ARGS(zip_stat_t, data, len, &source->error);
+				if (!stat)
+				{
+					return -1;
+				}
+
+				zip_stat_init(stat);
+				stat->valid = ZIP_STAT_SIZE | ZIP_STAT_COMP_SIZE | ZIP_STAT_COMP_METHOD | ZIP_STAT_ENCRYPTION_METHOD | ZIP_STAT_CRC;
+				stat->size = source->size;
+				stat->comp_size = source->stream.size();
+				stat->comp_method = ZIP_CM_DEFLATE;
+				stat->encryption_method = ZIP_EM_NONE;
+				stat->crc = source->crc;
+				return sizeof(zip_stat_t);
+			}
+			case ZIP_SOURCE_ERROR:
+				return zip_error_to_data(&source->error, data, len);
+			case ZIP_SOURCE_FREE:
+				delete source;
+				return 0;
+			case ZIP_SOURCE_SUPPORTS:
+				return zip_source_make_command_bitmap(ZIP_SOURCE_OPEN, ZIP_SOURCE_READ, ZIP_SOURCE_CLOSE, ZIP_SOURCE_STAT, ZIP_SOURCE_ERROR, ZIP_SOURCE_FREE, -1);
+			default:
+				zip_error_set(&source->error, ZIP_ER_OPNOTSUPP, 0);
+				return -1;
+		}
+	}
+
+	/**
+	 * @return source of deflated asset (owned by archive after replace) or nullptr when asset could not be deflated
+	 */
+	static zip_source_t *createDeflatedSource(zip_t *archive, gamelib::Span<uint8_t> assetBody)
+	{
+		auto source = std::make_unique<DeflatedSource>();
+		source->size = static_cast<std::uint64_t>(assetBody.size());
+		zip_error_init(&source->error);
+
+		if (!gamelib::io::DeflateCodec::compress(assetBody, source->stream, source->crc))
+		{
+			return nullptr;
+		}
+
+		zip_source_t *zipSource = zip_source_function(archive, &deflatedSourceCallback, source.get());
+		if (zipSource)
+		{
+			(void)source.release(); // Released by ZIP_SOURCE_FREE
+		}
+
+		return zipSource;
+	}
+
+	void ZIPLevelAssetProvider::setCompressionBackend(ZIPCompressionBackend backend)
+	{
+		g_compressionBackend = backend;
+	}
+
+	ZIPCompressionBackend ZIPLevelAssetProvider::getCompressionBackend()
+	{
+		return g_compressionBackend;
+	}
+
 	ZIPLevelAssetProvider::ZIPLevelAssetProvider(std::string containerPath)
 	{
 		m_ctx = std::make_unique<Context>();
@@ -113,6 +258,8 @@ namespace editor
 
 	std::unique_ptr<uint8_t []> ZIPLevelAssetProvider::getAsset(gamelib::io::AssetKind kind, int64_t &bufferSize) const
 	{
+		GAMELIB_PROFILE_SCOPE("ZIPLevelAssetProvider::getAsset");
+
 		zip_int64_t numEntries = zip_get_num_entries(m_ctx->m_archive, 0);
 		if (numEntries <= 0)
 		{
@@ -141,7 +288,7 @@ namespace editor
 				// File found! Need to read it
 				zip_stat_t zipFileInfo;
 
-				int res = zip_stat_index(m_ctx->m_archive, entryIndex, ZIP_STAT_NAME | ZIP_STAT_SIZE | ZIP_STAT_COMP_SIZE | ZIP_STAT_FLAGS, &zipFileInfo);
+				int res = zip_stat_index(m_ctx->m_archive, entryIndex, ZIP_STAT_NAME | ZIP_STAT_SIZE | ZIP_STAT_COMP_SIZE | ZIP_STAT_COMP_METHOD | ZIP_STAT_ENCRYPTION_METHOD | ZIP_STAT_CRC | ZIP_STAT_FLAGS, &zipFileInfo);
 				if (res < 0)
 				{
 					assert(false && "Failed to extract zip index!");
@@ -149,6 +296,38 @@ namespace editor
 				}
 
 				bufferSize = static_cast<int64_t>(zipFileInfo.size);
+
+				// Inflated asset could be cached already (replaced entries have no CRC until archive is saved, so they are never cached)
+				if (!m_ctx->m_archiveId.has_value())
+				{
+					m_ctx->m_archiveId = getContentHash();
+				}
+
+				const bool isCacheable = m_ctx->m_archiveId.value() != 0 && (zipFileInfo.valid & ZIP_STAT_CRC) && (zipFileInfo.valid & ZIP_STAT_SIZE);
+				const gamelib::io::AssetCacheKey cacheKey { m_ctx->m_archiveId.value(), zipFileInfo.crc, zipFileInfo.size };
+
+				if (isCacheable)
+				{
+					if (auto cachedBuffer = gamelib::io::AssetCache::getInstance().get(cacheKey))
+					{
+						return cachedBuffer;
+					}
+				}
+
+				// Large entry is inflated at once (libzip is used when entry is stored or encrypted)
+				if (getCompressionBackend() == ZIPCompressionBackend::ZCB_PARALLEL && bufferSize >= kParallelCodecThreshold)
+				{
+					if (auto inflatedBuffer = readDeflatedEntry(m_ctx->m_archive, entryIndex, zipFileInfo))
+					{
+						if (isCacheable)
+						{
+							gamelib::io::AssetCache::getInstance().put(cacheKey, inflatedBuffer.get(), static_cast<std::size_t>(bufferSize));
+						}
+
+						return inflatedBuffer;
+					}
+				}
+
 				auto buffer = std::make_unique<uint8_t[]>(bufferSize);
 				if (!buffer)
 				{
@@ -173,6 +352,13 @@ namespace editor
 				}
 
 				zip_fclose(zipFile);
+				GAMELIB_PROFILE_COUNTER("ZIP inflated bytes", readyBytes);
+
+				if (isCacheable)
+				{
+					gamelib::io::AssetCache::getInstance().put(cacheKey, buffer.get(), static_cast<std::size_t>(bufferSize));
+				}
+
 				return buffer;
 			}
 		}
@@ -190,9 +376,11 @@ namespace editor
 
 		if (m_ctx->m_levelName.empty() && m_ctx->isValid())
 		{
-			// Try to locate & cache actual value
-			int64_t bs = 0;
-			(void)getAsset(gamelib::io::AssetKind::ZGF, bs);
+			// Name of level is the name of ZGF entry, it's not required to inflate it
+			if (const auto zgfFileName = getAssetFileName(gamelib::io::AssetKind::ZGF); !zgfFileName.empty())
+			{
+				m_ctx->m_levelName = std::filesystem::path(zgfFileName).stem().string();
+			}
 		}
 
 		return m_ctx->m_levelName;
@@ -223,7 +411,21 @@ namespace editor
 			std::string_view entryName { entryNameRaw };
 			if (filePathEndsWith(entryName, kAssetExtensions[kind]))
 			{
-				auto fileSource = zip_source_buffer(m_ctx->m_archive, assetBody.data(), static_cast<zip_int64_t>(assetBody.size()), 0);
+				// Large asset is deflated by blocks on all threads, libzip stores it as is
+				zip_source_t *fileSource = nullptr;
+				bool isDeflated = false;
+
+				if (getCompressionBackend() == ZIPCompressionBackend::ZCB_PARALLEL && assetBody.size() >= kParallelCodecThreshold)
+				{
+					fileSource = createDeflatedSource(m_ctx->m_archive, assetBody);
+					isDeflated = fileSource != nullptr;
+				}
+
+				if (!fileSource)
+				{
+					fileSource = zip_source_buffer(m_ctx->m_archive, assetBody.data(), static_cast<zip_int64_t>(assetBody.size()), 0);
+				}
+
 				if (!fileSource)
 				{
 					assert(false);
@@ -238,6 +440,13 @@ namespace editor
 					return false;
 				}
 
+				if (isDeflated)
+				{
+					zip_set_file_compression(m_ctx->m_archive, entryIndex, ZIP_CM_DEFLATE, 0);
+				}
+
+				m_ctx->m_archiveId.reset(); // Content of archive changed
+
 				return true;
 			}
 		}
@@ -255,6 +464,39 @@ namespace editor
 		return isValid();
 	}
 
+	std::uint64_t ZIPLevelAssetProvider::getContentHash() const
+	{
+		if (!isValid())
+		{
+			return 0;
+		}
+
+		zip_int64_t numEntries = zip_get_num_entries(m_ctx->m_archive, 0);
+		if (numEntries <= 0)
+		{
+			return 0;
+		}
+
+		// Central directory already contains CRC32 of each uncompressed file, so we don't need to inflate anything
+		std::uint64_t hash = gamelib::ContentHash::kDefaultSeed;
+
+		for (zip_int64_t entryIndex = 0; entryIndex < numEntries; ++entryIndex)
+		{
+			zip_stat_t zipFileInfo;
+			if (zip_stat_index(m_ctx->m_archive, entryIndex, 0, &zipFileInfo) < 0 || !(zipFileInfo.valid & ZIP_STAT_CRC) || !(zipFileInfo.valid & ZIP_STAT_NAME))
+			{
+				return 0;
+			}
+
+			const std::string_view entryName { zipFileInfo.name };
+			hash = gamelib::ContentHash::combine(hash, gamelib::ContentHash::compute(reinterpret_cast<const uint8_t*>(entryName.data()), entryName.size()));
+			hash = gamelib::ContentHash::combine(hash, static_cast<std::uint64_t>(zipFileInfo.size));
+			hash = gamelib::ContentHash::combine(hash, static_cast<std::uint64_t>(zipFileInfo.crc));
+		}
+
+		return hash;
+	}
+
 	std::string ZIPLevelAssetProvider::getAssetFileName(gamelib::io::AssetKind kind) const
 	{
 		if (!isValid()) return {};
@@ -47,11 +47,7 @@ namespace models
 		}
 
 		auto val = value.value<types::QGlacierController>();
-		auto &toEdit = m_sceneObject->getControllers().at(index.row());
-		toEdit.name = val.name.toStdString();
-		toEdit.properties = val.data;
-
-		return true;
+		return m_sceneObject->updateController(static_cast<gamelib::scene::SceneObject::ControllerHandle>(index.row()), val.name.toStdString(), val.data);
 	}
 
 	int GeomControllerListModel::rowCount(const QModelIndex &parent) const
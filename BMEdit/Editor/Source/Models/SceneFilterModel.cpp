@@ -1,19 +1,65 @@
 #include <Models/SceneFilterModel.h>
+#include <GameLib/Level.h>
+#include <QRegularExpression>
+#include <QThread>
 
 namespace models
 {
+	using gamelib::scene::SceneSearchIndex;
+	using gamelib::scene::SceneSearchField;
+	using gamelib::scene::SceneObject;
+
 	SceneFilterModel::SceneFilterModel(QObject* parent) : QSortFilterProxyModel(parent)
 	{
 	}
 
-	void SceneFilterModel::setQuery(const QString& query)
+	SceneFilterModel::~SceneFilterModel()
+	{
+		// Workers refer to this model, wait for them
+		for (auto *worker : findChildren<QThread*>(Qt::FindDirectChildrenOnly))
+		{
+			worker->wait();
+		}
+	}
+
+	void SceneFilterModel::setLevel(const gamelib::Level *level)
 	{
-		beginResetModel();
+		resetLevel();
+
+		if (!level || level->getSceneObjects().empty())
 		{
-			m_query = query;
-			m_filterResultsCache.clear();
+			return;
 		}
-		endResetModel();
+
+		// Objects are shared with worker, so they are alive even if level will be closed before index is built
+		const std::uint64_t generation = m_generation;
+		QThread *worker = QThread::create([this, generation, sceneObjects = level->getSceneObjects()]()
+		{
+			auto searchIndex = std::make_shared<SceneSearchIndex>();
+			searchIndex->build(sceneObjects);
+
+			QMetaObject::invokeMethod(this, [this, generation, searchIndex]() { onSearchIndexBuilt(generation, searchIndex); }, Qt::QueuedConnection);
+		});
+
+		worker->setParent(this);
+		connect(worker, &QThread::finished, worker, &QObject::deleteLater);
+		worker->start(QThread::LowPriority);
+	}
+
+	void SceneFilterModel::resetLevel()
+	{
+		++m_generation;
+		m_searchIndex = nullptr;
+		m_appliedQuery.clear();
+		m_matches.clear();
+		m_visible.clear();
+		invalidateFilter();
+	}
+
+	void SceneFilterModel::setQuery(const QString& query)
+	{
+		m_query = query;
+		applyQuery();
 	}
 
 	const QString &SceneFilterModel::getQuery() const
@@ -21,44 +67,118 @@ namespace models
 		return m_query;
 	}
 
-	bool SceneFilterModel::filterAcceptsRow(int sourceRow, const QModelIndex& sourceParent) const
+	bool SceneFilterModel::isSearchIndexReady() const
 	{
-		if (m_query.isEmpty())
-			return true; // Allow all
+		return m_searchIndex != nullptr;
+	}
 
-		QAbstractItemModel *srcModel = sourceModel();
+	bool SceneFilterModel::filterAcceptsRow(int sourceRow, const QModelIndex& sourceParent) const
+	{
+		if (m_query.isEmpty() || !m_searchIndex)
+			return true; // Allow all (or until index is not ready)
 
-		if (sourceParent.isValid() && sourceRow >= srcModel->rowCount(sourceParent))
+		QModelIndex index = sourceModel()->index(sourceRow, filterKeyColumn(), sourceParent);
+		if (!index.isValid())
 		{
 			return false;
 		}
 
-		QModelIndex index = srcModel->index(sourceRow, filterKeyColumn(), sourceParent);
+		const auto objectIndex = m_searchIndex->getObjectIndex(static_cast<const SceneObject*>(index.constInternalPointer()));
+		return objectIndex < m_visible.size() && m_visible[objectIndex];
+	}
 
-		if (m_filterResultsCache.contains(index))
+	void SceneFilterModel::onSearchIndexBuilt(std::uint64_t generation, std::shared_ptr<const SceneSearchIndex> searchIndex)
+	{
+		if (generation != m_generation)
 		{
-			return m_filterResultsCache[index];
+			return; // Level was changed
 		}
 
-		QRegularExpression regex(m_query, QRegularExpression::CaseInsensitiveOption);
-		QString text = srcModel->data(index, Qt::DisplayRole).toString();
-		if (regex.match(text).hasMatch())
+		m_searchIndex = std::move(searchIndex);
+		applyQuery();
+
+		emit searchIndexReady();
+	}
+
+	void SceneFilterModel::applyQuery()
+	{
+		if (!m_searchIndex)
 		{
-			m_filterResultsCache[index] = true;
-			return true;
+			return; // Query will be applied when index is ready
 		}
 
-		int childrenNr = srcModel->rowCount(index);
-		for (int i = 0; i < childrenNr; ++i)
+		const std::string query = SceneSearchIndex::toLower(m_query.toStdString());
+		const SceneSearchField fields = m_query.contains('\\') ? SceneSearchField::SSF_PATH : SceneSearchField::SSF_NAME;
+		const bool isRegex = !isPlainSubstring(m_query);
+
+		if (query.empty())
+		{
+			m_appliedQuery.clear();
+			m_matches.clear();
+			m_visible.clear();
+		}
+		else if (query != m_appliedQuery || fields != m_appliedFields || isRegex != m_appliedRegex)
+		{
+			std::vector<std::uint32_t> matches;
+
+			if (isRegex)
+			{
+				findByRegex(m_query, fields, matches);
+			}
+			else
+			{
+				// Extended query could match only objects matched by previous query
+				const bool canRefine = !m_appliedQuery.empty() && !m_appliedRegex && fields == m_appliedFields && query.find(m_appliedQuery) != std::string::npos;
+
+				m_searchIndex->find(query, fields, matches, canRefine ? &m_matches : nullptr);
+			}
+
+			m_searchIndex->collectVisible(matches, m_visible);
+
+			m_matches = std::move(matches);
+			m_appliedQuery = query;
+			m_appliedFields = fields;
+			m_appliedRegex = isRegex;
+		}
+
+		invalidateFilter();
+	}
+
+	void SceneFilterModel::findByRegex(const QString &pattern, SceneSearchField fields, std::vector<std::uint32_t> &matches) const
+	{
+		matches.clear();
+
+		const QRegularExpression regex(pattern, QRegularExpression::CaseInsensitiveOption);
+		if (!regex.isValid())
+		{
+			return; // Incomplete expression (user still typing) matches nothing
+		}
+
+		const auto objectsCount = static_cast<std::uint32_t>(m_searchIndex->getObjectsCount());
+		for (std::uint32_t objectIndex = 0; objectIndex < objectsCount; ++objectIndex)
+		{
+			const std::string &text = (fields & SceneSearchField::SSF_PATH) ? m_searchIndex->getPath(objectIndex) : m_searchIndex->getName(objectIndex);
+
+			if (regex.match(QString::fromStdString(text)).hasMatch())
+			{
+				matches.push_back(objectIndex);
+			}
+		}
+	}
+
+	bool SceneFilterModel::isPlainSubstring(const QString &query)
+	{
+		// '\' is not here: in plain query it is separator of path
+		static const QString kRegexMetacharacters = QStringLiteral(".^$*+?()[]{}|");
+
+		for (const QChar ch : query)
 		{
-			if (filterAcceptsRow(i, index))
+			if (kRegexMetacharacters.contains(ch))
 			{
-				m_filterResultsCache[index] = true;
-				return true;
+				return false;
 			}
 		}
 
-		m_filterResultsCache[index] = false;
-		return false;
+		return true;
 	}
 }
\ No newline at end of file
@@ -6,7 +6,6 @@ using namespace models;
 SceneObjectControllerModel::SceneObjectControllerModel(QObject *parent)
 	: ValueModelBase(parent)
 {
-	connect(this, &ValueModelBase::valueChanged, [=]() { onValueChanged(); });
 }
 
 void SceneObjectControllerModel::setGeom(gamelib::scene::SceneObject *geom)
@@ -44,7 +43,7 @@ void SceneObjectControllerModel::setControllerIndex(int controllerIndex)
 	m_currentControllerIndex = controllerIndex;
 	endResetModel();
 
-	setValue(m_geom->getControllers().at(controllerIndex).properties);
+	setValue(&m_geom->getControllers().at(controllerIndex).properties);
 }
 
 void SceneObjectControllerModel::resetController()
@@ -54,12 +53,4 @@ void SceneObjectControllerModel::resetController()
 	endResetModel();
 
 	resetValue();
-}
-
-void SceneObjectControllerModel::onValueChanged()
-{
-	if (m_geom && m_currentControllerIndex != -1 && m_currentControllerIndex >= 0 && m_currentControllerIndex < m_geom->getControllers().size() && getValue().has_value())
-	{
-		m_geom->getControllers().at(m_currentControllerIndex).properties = getValue().value();
-	}
 }
\ No newline at end of file
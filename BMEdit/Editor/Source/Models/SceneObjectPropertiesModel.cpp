@@ -12,7 +12,6 @@ namespace models
 	SceneObjectPropertiesModel::SceneObjectPropertiesModel(QObject *parent)
 		: ValueModelBase(parent)
 	{
-		connect(this, &ValueModelBase::valueChanged, [=]() { onValueChanged(); });
 	}
 
 	void SceneObjectPropertiesModel::setLevel(const gamelib::Level *level)
@@ -46,7 +45,7 @@ namespace models
 
 		if (m_geom && isNewGeom)
 		{
-			setValue(m_geom->getProperties());
+			setValue(&m_geom->getProperties());
 		}
 	}
 
@@ -68,15 +67,4 @@ namespace models
 
 		resetValue();
 	}
-
-	void SceneObjectPropertiesModel::onValueChanged()
-	{
-		const auto& value = getValue();
-		if (!value.has_value()) return;
-
-		if (value.value() != m_geom->getProperties())
-		{
-			m_geom->getProperties() = value.value();
-		}
-	}
 }
\ No newline at end of file
@@ -147,27 +147,18 @@ namespace models
 
 	QModelIndex SceneObjectsTreeModel::index(int row, int column, const QModelIndex &parent) const
 	{
-		if (!hasIndex(row, column, parent) || !isValidLevel())
+		if (!isValidLevel() || row < 0 || column != 0)
 		{
 			return QModelIndex {};
 		}
 
-		SceneObject* so = nullptr;
-		if (!parent.isValid())
+		const SceneObject* so = getObject(parent);
+		if (!so || row >= static_cast<int>(so->getChildren().size()))
 		{
-			so = m_level->getSceneObjects()[0].get();
-		}
-		else
-		{
-			so = static_cast<SceneObject*>(parent.internalPointer());
-		}
-
-		if (row >= 0 && row < so->getChildren().size())
-		{
-			return createIndex(row, column, (const void*)so->getChildren()[row].lock().get());
+			return {};
 		}
 
-		return {};
+		return createIndex(row, column, (const void*)so->getChildren()[row].lock().get());
 	}
 
 	QModelIndex SceneObjectsTreeModel::parent(const QModelIndex &index) const
@@ -177,28 +168,15 @@ namespace models
 			return {};
 		}
 
-		auto* child = static_cast<SceneObject*>(index.internalPointer());
+		const auto* child = static_cast<const SceneObject*>(index.constInternalPointer());
 		if (auto parent = child->getParent().lock())
 		{
-			if (parent == m_level->getSceneObjects()[0])
+			if (parent == m_level->getSceneObjects()[0] || parent->getSiblingIndex() == SceneObject::kNoSiblingIndex)
 			{
 				return {};
 			}
-			else
-			{
-				int row = 0;
-
-				for (int i = 0; i < parent->getChildren().size(); ++i)
-				{
-					if (parent->getChildren()[i].lock().get() == child)
-					{
-						row = i;
-						break;
-					}
-				}
-
-				return createIndex(row, 0, (const void*)parent.get());
-			}
+
+			return createIndex(parent->getSiblingIndex(), 0, (const void*)parent.get());
 		}
 
 		return {};
@@ -206,12 +184,10 @@ namespace models
 
 	int SceneObjectsTreeModel::rowCount(const QModelIndex &parent) const
 	{
-		if (!isValidLevel()) return 0;
-
-		if (!parent.isValid())
-			return m_level && !m_level->getSceneObjects().empty() ? static_cast<int>(m_level->getSceneObjects()[0]->getChildren().size()) : 0;
+		if (!isValidLevel() || parent.column() > 0) return 0;
 
-		return static_cast<int>(static_cast<SceneObject*>(parent.internalPointer())->getChildren().size());
+		const SceneObject* so = getObject(parent);
+		return so ? static_cast<int>(so->getChildren().size()) : 0;
 	}
 
 	int SceneObjectsTreeModel::columnCount(const QModelIndex &parent) const
@@ -255,6 +231,16 @@ namespace models
 		return createIndex(0, 0, (const void*)m_level->getSceneObjects()[0].get());
 	}
 
+	const SceneObject *SceneObjectsTreeModel::getObject(const QModelIndex &index) const
+	{
+		if (index.isValid())
+		{
+			return static_cast<const SceneObject*>(index.constInternalPointer());
+		}
+
+		return m_level->getSceneObjects().empty() ? nullptr : m_level->getSceneObjects()[0].get();
+	}
+
 	bool SceneObjectsTreeModel::isValidLevel() const
 	{
 		return m_level && m_level->getSceneProperties();
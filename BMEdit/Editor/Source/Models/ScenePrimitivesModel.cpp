@@ -1,12 +1,26 @@
 #include <Models/ScenePrimitivesModel.h>
 #include <Types/QCustomRoles.h>
 #include <Types/QPrimType.h>
+#include <Rasterizer/ThumbnailAtlas.h>
+#include <Rasterizer/ThumbnailCache.h>
+
+#include <QStandardPaths>
+#include <QDir>
+#include <utility>
 
 
 using namespace models;
 
 ScenePrimitivesModel::ScenePrimitivesModel(QObject *parent) : QAbstractTableModel(parent)
 {
+	qRegisterMetaType<std::shared_ptr<rasterizer::ThumbnailAtlas>>();
+
+	connect(this, &ScenePrimitivesModel::thumbnailsBuilt, this, &ScenePrimitivesModel::onThumbnailsBuilt, Qt::QueuedConnection);
+}
+
+ScenePrimitivesModel::~ScenePrimitivesModel()
+{
+	waitThumbnailsBuild();
 }
 
 int ScenePrimitivesModel::rowCount(const QModelIndex &parent) const
@@ -59,7 +73,8 @@ QVariant ScenePrimitivesModel::data(const QModelIndex &index, int role) const
 		return {};
 	}
 
-	auto& chk = m_level->getLevelGeometry()->chunks.at(index.row());
+	// Const access: non-const getBuffer() would unshare chunk buffer
+	const auto& chk = std::as_const(*m_level).getLevelGeometry()->chunks.at(index.row());
 
 	if (role == Qt::DisplayRole)
 	{
@@ -118,6 +133,13 @@ QVariant ScenePrimitivesModel::data(const QModelIndex &index, int role) const
 			return QVariant::fromValue<gamelib::prm::PRMVertexBufferFormat>(chkVertexBufferHeader->vertexFormat);
 		}
 	}
+	else if (role == types::kChunkThumbnailRole || (role == Qt::DecorationRole && index.column() == ColumnID::CID_INDEX))
+	{
+		if (auto it = m_thumbnails.find(chk.getIndex()); it != m_thumbnails.end())
+		{
+			return it.value();
+		}
+	}
 
 	return {};
 }
@@ -156,7 +178,10 @@ void ScenePrimitivesModel::setLevel(gamelib::Level* level)
 	{
 		beginResetModel();
 		m_level = level;
+		m_thumbnails.clear();
 		endResetModel();
+
+		startThumbnailsBuild();
 	}
 }
 
@@ -164,5 +189,115 @@ void ScenePrimitivesModel::resetLevel()
 {
 	beginResetModel();
 	m_level = nullptr;
+	m_thumbnails.clear();
 	endResetModel();
+
+	// Results of running job (if any) must be ignored
+	++m_thumbnailsGeneration;
+}
+
+void ScenePrimitivesModel::startThumbnailsBuild()
+{
+	const int generation = ++m_thumbnailsGeneration;
+
+	if (!m_level || m_thumbnailsJob.valid())
+	{
+		// Running job restarts build when it's finished (see onThumbnailsBuilt)
+		return;
+	}
+
+	const bool shouldLoadCache = !m_thumbnailsCache;
+	if (shouldLoadCache)
+	{
+		// Thumbnails are shared between levels & editor sessions (keyed by content hash of primitive)
+		const QString cacheFolder = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+		QDir().mkpath(cacheFolder);
+
+		m_thumbnailsCachePath = QDir(cacheFolder).filePath("PrimitiveThumbnails.cache").toStdString();
+		m_thumbnailsCache = std::make_shared<rasterizer::ThumbnailCache>();
+	}
+
+	// Job works with copy of chunks (buffers are shared, copy on write), so level could be closed while job is running
+	auto chunks = std::make_shared<std::vector<gamelib::prm::PRMChunk>>(m_level->getLevelGeometry()->chunks);
+
+	m_thumbnailsJob = std::async(std::launch::async, [this, chunks, cache = m_thumbnailsCache, cachePath = m_thumbnailsCachePath, shouldLoadCache, generation]()
+	{
+		auto atlas = std::make_shared<rasterizer::ThumbnailAtlas>();
+
+		try
+		{
+			if (shouldLoadCache)
+			{
+				cache->loadFromFile(cachePath);
+			}
+
+			rasterizer::RenderOptions options;
+			options.width = options.height = kThumbnailSize;
+
+			atlas->build(*chunks, options, cache.get());
+
+			// File is written only when thumbnails were rendered or evicted
+			if (cache->isDirty())
+			{
+				cache->saveToFile(cachePath);
+			}
+		}
+		catch (...)
+		{
+			// Empty atlas is reported anyway, so the job is consumed and thumbnails could be built again
+			atlas = std::make_shared<rasterizer::ThumbnailAtlas>();
+		}
+
+		emit thumbnailsBuilt(atlas, generation);
+	});
+}
+
+void ScenePrimitivesModel::waitThumbnailsBuild()
+{
+	if (m_thumbnailsJob.valid())
+	{
+		m_thumbnailsJob.wait();
+	}
+
+	// Results of previous job (if they still in queue) must be ignored
+	++m_thumbnailsGeneration;
+}
+
+void ScenePrimitivesModel::onThumbnailsBuilt(const std::shared_ptr<rasterizer::ThumbnailAtlas> &atlas, int generation)
+{
+	if (m_thumbnailsJob.valid())
+	{
+		m_thumbnailsJob.get(); // Signal is the last statement of job
+	}
+
+	if (generation != m_thumbnailsGeneration)
+	{
+		// Level was changed while job was running
+		startThumbnailsBuild();
+		return;
+	}
+
+	const auto &atlasImage = atlas->getImage();
+	if (atlasImage.empty())
+	{
+		return;
+	}
+
+	// QImage does not own this buffer, but we make a copy of every cell anyway
+	const QImage atlasView(atlasImage.pixels.data(), atlasImage.width, atlasImage.height, atlasImage.width * rasterizer::Image::kBytesPerPixel, QImage::Format_RGBA8888);
+
+	m_thumbnails.clear();
+	m_thumbnails.reserve(static_cast<qsizetype>(atlas->getCells().size()));
+
+	for (const auto &[primitiveIndex, cell] : atlas->getCells())
+	{
+		m_thumbnails.insert(primitiveIndex, QPixmap::fromImage(atlasView.copy(cell.x, cell.y, cell.width, cell.height)));
+	}
+
+	if (const int rows = rowCount({}); rows > 0)
+	{
+		emit dataChanged(index(0, ColumnID::CID_INDEX), index(rows - 1, ColumnID::CID_INDEX), { Qt::DecorationRole, types::kChunkThumbnailRole });
+	}
+
+	emit thumbnailsReady();
 }
\ No newline at end of file
@@ -0,0 +1,90 @@
+#include <Models/SceneQueryResultsModel.h>
+#include <Types/QCustomRoles.h>
+#include <GameLib/Type.h>
+
+
+namespace models
+{
+	SceneQueryResultsModel::SceneQueryResultsModel(QObject *parent) : QAbstractTableModel(parent)
+	{
+	}
+
+	QVariant SceneQueryResultsModel::data(const QModelIndex &index, int role) const
+	{
+		const gamelib::scene::SceneObject *sceneObject = getObject(index);
+		if (!sceneObject)
+		{
+			return {};
+		}
+
+		if (role == types::kSceneObjectRole)
+		{
+			return reinterpret_cast<std::intptr_t>(sceneObject);
+		}
+
+		if (role != Qt::DisplayRole && role != Qt::ToolTipRole)
+		{
+			return {};
+		}
+
+		switch (index.column())
+		{
+			case Column::NAME: return QString::fromStdString(sceneObject->getName());
+			case Column::TYPE: return sceneObject->getType() ? QString::fromStdString(sceneObject->getType()->getName()) : QString {};
+			case Column::PATH: return QString::fromStdString(m_engine->getSearchIndex().getPath(m_results[index.row()]));
+			default: return {};
+		}
+	}
+
+	QVariant SceneQueryResultsModel::headerData(int section, Qt::Orientation orientation, int role) const
+	{
+		if (orientation != Qt::Horizontal || role != Qt::DisplayRole)
+		{
+			return {};
+		}
+
+		switch (section)
+		{
+			case Column::NAME: return QString("Name");
+			case Column::TYPE: return QString("Type");
+			case Column::PATH: return QString("Path");
+			default: return {};
+		}
+	}
+
+	int SceneQueryResultsModel::rowCount(const QModelIndex &parent) const
+	{
+		return parent.isValid() ? 0 : static_cast<int>(m_results.size());
+	}
+
+	int SceneQueryResultsModel::columnCount(const QModelIndex &parent) const
+	{
+		return parent.isValid() ? 0 : Column::COLUMNS_COUNT;
+	}
+
+	void SceneQueryResultsModel::setResults(std::shared_ptr<const gamelib::scene::SceneQueryEngine> engine, std::vector<std::uint32_t> &&results)
+	{
+		beginResetModel();
+		m_engine = std::move(engine);
+		m_results = std::move(results);
+		endResetModel();
+	}
+
+	void SceneQueryResultsModel::resetResults()
+	{
+		beginResetModel();
+		m_engine = nullptr;
+		m_results.clear();
+		endResetModel();
+	}
+
+	const gamelib::scene::SceneObject *SceneQueryResultsModel::getObject(const QModelIndex &index) const
+	{
+		if (!m_engine || !index.isValid() || index.row() < 0 || index.row() >= static_cast<int>(m_results.size()))
+		{
+			return nullptr;
+		}
+
+		return m_engine->getObject(m_results[index.row()]).get();
+	}
+}
\ No newline at end of file
@@ -1,8 +1,6 @@
 #include <Models/TypePropertiesDataModel.h>
 #include <GameLib/TypeRegistry.h>
-#include <GameLib/TypeComplex.h>
 #include <GameLib/Type.h>
-#include <deque>
 
 
 namespace models
@@ -18,68 +16,6 @@ namespace models
 		TOTAL_COLUMNS
 	};
 
-	int calculateFieldsCountRecursive(const Type *type)
-	{
-		int count = 0;
-		if (!type)
-		{
-			return 0;
-		}
-
-		if (type->getKind() == TypeKind::COMPLEX)
-		{
-			auto complexType = reinterpret_cast<const TypeComplex *>(type);
-			count += complexType->getInstructionViews().size();
-			count += calculateFieldsCountRecursive(complexType->getParent());
-		}
-		else if (type->getKind() == TypeKind::ENUM)
-		{
-			return 1;
-		}
-
-		return count;
-	}
-
-	const ValueView *locatePropertyInfoByIndexInHierarchy(int index, const TypeComplex *type)
-	{
-		// Here we need save list of parent classes to locate mapping between them
-		std::deque<const TypeComplex *> parentClassList { type };
-
-		const Type *parent = type->getParent();
-		while (parent)
-		{
-			if (parent->getKind() == TypeKind::COMPLEX)
-			{
-				auto parentComplex = reinterpret_cast<const TypeComplex *>(parent);
-				if (!parentComplex->getInstructionViews().empty())
-				{
-					parentClassList.push_front(parentComplex);
-				}
-
-				parent = parentComplex->getParent();
-			}
-			else
-			{
-				break;
-			}
-		}
-
-		int propertyIndex = 0;
-		for (const auto& parentClass: parentClassList)
-		{
-			if (index >= propertyIndex && index < propertyIndex + parentClass->getInstructionViews().size())
-			{
-				// It's here
-				int localIndex = index - propertyIndex;
-				return &parentClass->getInstructionViews()[localIndex];
-			}
-
-			propertyIndex += parentClass->getInstructionViews().size();
-		}
-
-		return nullptr;
-	}
-
 
 	TypePropertiesDataModel::TypePropertiesDataModel(QObject *parent) : QAbstractTableModel(parent)
 	{
@@ -87,70 +23,56 @@ namespace models
 
 	int TypePropertiesDataModel::rowCount(const QModelIndex &parent) const
 	{
-		using namespace gamelib;
-
 		Q_UNUSED(parent);
 
-		if (m_currentTypeName.isEmpty())
+		if (!m_type)
 		{
 			return 0;
 		}
 
-		// So, here we need to recognize how much fields here
-		auto type = TypeRegistry::getInstance().findTypeByName(m_currentTypeName.toStdString());
-		if (!type)
+		if (m_type->getKind() == TypeKind::ENUM)
 		{
-			return 0;
+			return 1;
 		}
 
-		return calculateFieldsCountRecursive(type);
+		return static_cast<int>(m_properties->size());
 	}
 
 	int TypePropertiesDataModel::columnCount(const QModelIndex &parent) const
 	{
 		Q_UNUSED(parent);
-		if (m_currentTypeName.isEmpty())
+
+		if (!m_type)
 		{
 			return 0;
 		}
 
-		auto type = TypeRegistry::getInstance().findTypeByName(m_currentTypeName.toStdString());
-		if (type)
+		if (m_type->getKind() == TypeKind::COMPLEX)
 		{
-			if (type->getKind() == TypeKind::COMPLEX)
-			{
-				return ColumnID::TOTAL_COLUMNS;
-			}
-
-			return 2; // Only name + value
+			return ColumnID::TOTAL_COLUMNS;
 		}
 
-		return 0;
+		return 2; // Only name + value
 	}
 
 	QVariant TypePropertiesDataModel::data(const QModelIndex &index, int role) const
 	{
-		if (role != Qt::DisplayRole)
+		if (role != Qt::DisplayRole || !m_type)
 			return QVariant();
 
 		const int row = index.row();
-		auto type = TypeRegistry::getInstance().findTypeByName(m_currentTypeName.toStdString());
-		if (!type)
-		{
-			return QVariant();
-		}
-
-		const auto typeKind = type->getKind();
+		const auto typeKind = m_type->getKind();
 
 		if (typeKind == TypeKind::COMPLEX)
 		{
 			// Good, process complex property here
-			auto info = locatePropertyInfoByIndexInHierarchy(row, reinterpret_cast<const TypeComplex *>(type));
-			if (!info)
+			if (row < 0 || row >= static_cast<int>(m_properties->size()))
 			{
 				return QVariant();
 			}
 
+			const ValueView *info = (*m_properties)[row];
+
 			if (index.column() == ColumnID::NAME)
 			{
 				return QVariant(QString::fromStdString(info->getName()));
@@ -196,6 +118,8 @@ namespace models
 	{
 		beginResetModel();
 		m_currentTypeName = typeName;
+		m_type = typeName.isEmpty() ? nullptr : TypeRegistry::getInstance().findTypeByName(typeName.toStdString());
+		m_properties = m_type ? &TypeRegistry::getInstance().getPropertiesTable(m_type) : nullptr;
 		endResetModel();
 	}
 
@@ -1,15 +1,22 @@
 #include <Models/ValueModelBase.h>
-#include <Types/QGlacierValue.h>
+#include <Editor/EditorInstance.h>
 #include <GameLib/Type.h>
+#include <algorithm>
+#include <stdexcept>
 
 using namespace models;
 
 
+ValueModelBase::ValueModelBase(QObject *parent) : QAbstractTableModel(parent)
+{
+	connect(&editor::EditorInstance::getInstance(), &editor::EditorInstance::entryRestored, this, &ValueModelBase::onEntryRestored);
+}
+
 int ValueModelBase::rowCount(const QModelIndex &parent) const
 {
 	if (!isReady()) return 0;
 
-	return static_cast<int>(m_value.value().getEntries().size());
+	return static_cast<int>(m_value->getEntries().size());
 }
 
 int ValueModelBase::columnCount(const QModelIndex &parent) const
@@ -23,7 +30,7 @@ QVariant ValueModelBase::data(const QModelIndex &index, int role) const
 {
 	if (!isReady()) return {};
 
-	const auto &entList = m_value.value().getEntries();;
+	const auto &entList = m_value->getEntries();
 	const auto& currentEnt = entList[index.row()];
 
 	if (index.column() == ColumnID::NAME)
@@ -43,13 +50,9 @@ QVariant ValueModelBase::data(const QModelIndex &index, int role) const
 	}
 	else if (index.column() == ColumnID::VALUE)
 	{
-		types::QGlacierValue value;
-		value.instructions = gamelib::Span(m_value->getInstructions()).slice(currentEnt.instructions).as<std::vector<gamelib::prp::PRPInstruction>>();
-		value.views = currentEnt.views;
-
 		if (role == Qt::EditRole)
 		{
-			return QVariant::fromValue<types::QGlacierValue>(value);
+			return QVariant::fromValue<types::QGlacierValue>(getEntryValue(index.row()));
 		}
 		else return {};
 	}
@@ -67,29 +70,37 @@ bool ValueModelBase::setData(const QModelIndex &index, const QVariant &value, in
 			return false;
 
 		const auto val = value.value<types::QGlacierValue>();
+		const auto& newInstructions = val.getInstructions();
 
-		// Here we need to check that we have same (by size) containers
-		const auto& [off, sz] = m_value.value().getEntries()[index.row()].instructions;
-		const bool isDynamicDataType = !val.instructions.empty() && val.instructions.at(0).isContainer();
+		// Size of entry could be changed only for containers (value verifies new data by type of property)
+		const auto sz = m_value->getEntries()[index.row()].instructions.size();
+		const bool isDynamicDataType = !newInstructions.empty() && newInstructions.at(0).isContainer();
+
+		if (sz != newInstructions.size() && !isDynamicDataType)
+		{
+			return false;
+		}
 
-		if (sz == val.instructions.size())
+		try
 		{
-			for (auto i = off; i < off + sz; ++i)
+			if (!editor::EditorInstance::getInstance().getEditJournal().setEntry(*m_value, index.row(), newInstructions))
 			{
-				m_value.value().getInstructions()[i] = val.instructions[i - off];
+				return true; // Nothing changed
 			}
-
-			emit valueChanged();
-
-			return true;
 		}
-		else if (isDynamicDataType && val.instructions.at(0).isContainer())
+		catch (const std::runtime_error &)
 		{
-			m_value.value().updateContainer(static_cast<int>(off), val.instructions);
-			return true;
+			// New data is not valid for type of property, keep old one
+			return false;
 		}
 
-		return false;
+		// Entry buffer is the same as editor's one now (editor will detach it on next change)
+		m_entryValues[index.row()] = val;
+
+		emit dataChanged(index, index, { Qt::EditRole });
+		emit valueChanged();
+
+		return true;
 	}
 
 	return QAbstractItemModel::setData(index, value, role);
@@ -120,10 +131,12 @@ Qt::ItemFlags ValueModelBase::flags(const QModelIndex &index) const
 	return Qt::NoItemFlags;
 }
 
-void ValueModelBase::setValue(const gamelib::Value &value)
+void ValueModelBase::setValue(gamelib::Value *value)
 {
 	beginResetModel();
 	m_value = value;
+	m_entryValues.clear();
+	m_entryValues.resize(value ? value->getEntries().size() : 0);
 	endResetModel();
 
 	emit valueChanged();
@@ -132,18 +145,46 @@ void ValueModelBase::setValue(const gamelib::Value &value)
 void ValueModelBase::resetValue()
 {
 	beginResetModel();
-	m_value = std::nullopt;
+	m_value = nullptr;
+	m_entryValues.clear();
 	endResetModel();
 
 	emit valueChanged();
 }
 
-const std::optional<gamelib::Value> &ValueModelBase::getValue() const
+const gamelib::Value *ValueModelBase::getValue() const
 {
 	return m_value;
 }
 
 bool ValueModelBase::isReady() const
 {
-	return m_value.has_value();
+	return m_value != nullptr;
+}
+
+const types::QGlacierValue &ValueModelBase::getEntryValue(int entryIndex) const
+{
+	auto &entryValue = m_entryValues[entryIndex];
+
+	if (entryValue.isNull())
+	{
+		entryValue = types::QGlacierValue::fromEntry(*m_value, m_value->getEntries()[entryIndex]);
+	}
+
+	return entryValue;
+}
+
+void ValueModelBase::onEntryRestored(const gamelib::Value *value, int entryIndex)
+{
+	if (!isReady() || value != m_value || entryIndex < 0 || entryIndex >= static_cast<int>(m_entryValues.size()))
+	{
+		return;
+	}
+
+	// Drop cached buffer, it will be made again from restored instructions
+	m_entryValues[entryIndex] = types::QGlacierValue {};
+
+	const QModelIndex changedIndex = index(entryIndex, ColumnID::VALUE);
+	emit dataChanged(changedIndex, changedIndex, { Qt::EditRole });
+	emit valueChanged();
 }
\ No newline at end of file
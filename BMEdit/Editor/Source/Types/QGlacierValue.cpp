@@ -2,4 +2,51 @@
 
 namespace types
 {
+	QGlacierValue::QGlacierValue(std::vector<gamelib::prp::PRPInstruction> instructions, std::vector<gamelib::ValueView> views)
+		: m_buffer(std::make_shared<Buffer>(Buffer { std::move(instructions), std::move(views) }))
+	{
+	}
+
+	QGlacierValue QGlacierValue::fromEntry(const gamelib::Value &value, const gamelib::ValueEntry &entry)
+	{
+		return QGlacierValue {
+			gamelib::Span(value.getInstructions()).slice(entry.instructions).as<std::vector<gamelib::prp::PRPInstruction>>(),
+			entry.views
+		};
+	}
+
+	const std::vector<gamelib::prp::PRPInstruction> &QGlacierValue::getInstructions() const
+	{
+		static const std::vector<gamelib::prp::PRPInstruction> kEmpty {};
+		return m_buffer ? m_buffer->instructions : kEmpty;
+	}
+
+	const std::vector<gamelib::ValueView> &QGlacierValue::getViews() const
+	{
+		static const std::vector<gamelib::ValueView> kEmpty {};
+		return m_buffer ? m_buffer->views : kEmpty;
+	}
+
+	std::vector<gamelib::prp::PRPInstruction> &QGlacierValue::getMutableInstructions()
+	{
+		detach();
+		return m_buffer->instructions;
+	}
+
+	bool QGlacierValue::isNull() const
+	{
+		return m_buffer == nullptr;
+	}
+
+	void QGlacierValue::detach()
+	{
+		if (!m_buffer)
+		{
+			m_buffer = std::make_shared<Buffer>();
+		}
+		else if (m_buffer.use_count() > 1)
+		{
+			m_buffer = std::make_shared<Buffer>(*m_buffer);
+		}
+	}
 }
\ No newline at end of file
@@ -1,8 +1,7 @@
 #include <Widgets/PrimitivePreviewWidget.h>
+#include <Rasterizer/PrimitiveRenderer.h>
 
-#include <QOpenGLVersionFunctionsFactory>
-#include <QOpenGLFunctions_3_3_Core>
-#include <QOpenGLVersionFunctions>
+#include <QPainter>
 
 
 using namespace widgets;
@@ -19,6 +18,8 @@ void PrimitivePreviewWidget::resetLevel()
 {
 	m_level = nullptr;
 	m_primitiveIndex = 0u;
+	m_primitivePreview = QImage();
+	update();
 }
 
 void PrimitivePreviewWidget::setPrimitiveIndex(std::uint32_t primitiveIndex)
@@ -27,12 +28,15 @@ void PrimitivePreviewWidget::setPrimitiveIndex(std::uint32_t primitiveIndex)
 	{
 		m_primitiveIndex = primitiveIndex;
 		m_doPreloadNewPrimitive = true;
+		update();
 	}
 }
 
 void PrimitivePreviewWidget::resetPrimitiveIndex()
 {
 	m_primitiveIndex = 0u;
+	m_primitivePreview = QImage();
+	update();
 }
 
 void PrimitivePreviewWidget::initializeGL()
@@ -53,12 +57,7 @@ void PrimitivePreviewWidget::paintGL()
 
 	if (!m_level || !m_primitiveIndex) return;
 
-    auto glFunctions = QOpenGLVersionFunctionsFactory::get<QOpenGLFunctions_3_3_Core>(QOpenGLContext::currentContext());
-	if (!glFunctions)
-	{
-		throw std::runtime_error { "Current GPU does not support OpenGL 3.3 Core Profile" };
-	}
-
+	// Preview is rendered by software rasterizer, so we don't depend on OpenGL version (and it works on headless machines)
 	if (m_doPreloadNewPrimitive)
 	{
 		doPreloadNewPrimitive();
@@ -71,22 +70,47 @@ void PrimitivePreviewWidget::paintGL()
 void PrimitivePreviewWidget::resizeGL(int w, int h)
 {
 	Base::resizeGL(w, h);
+
+	// Preview must be re-rendered with new size
+	m_doPreloadNewPrimitive = true;
 }
 
 void PrimitivePreviewWidget::doPreloadNewPrimitive()
 {
-	auto& chk = m_level->getLevelGeometry()->chunks.at(m_primitiveIndex);
-	if (chk.getKind() != gamelib::prm::PRMChunkRecognizedKind::CRK_DESCRIPTION_BUFFER)
+	m_primitivePreview = QImage();
+
+	const auto& chunks = m_level->getLevelGeometry()->chunks;
+	if (m_primitiveIndex >= chunks.size() || chunks[m_primitiveIndex].getKind() != gamelib::prm::PRMChunkRecognizedKind::CRK_DESCRIPTION_BUFFER)
 	{
 		// Invalid case: we've unable to draw model by non-descriptor index
 		m_primitiveIndex = 0u;
 		return;
 	}
 
-	const auto descriptionHeader = chk.getDescriptionBufferHeader();
-	//TODO: Extract index buffer, extract vertex buffer, validate index buffer, validate vertex buffer.
+	const qreal dpr = devicePixelRatioF();
+
+	rasterizer::RenderOptions options;
+	options.width = std::max(1, static_cast<int>(width() * dpr));
+	options.height = std::max(1, static_cast<int>(height() * dpr));
+
+	rasterizer::Image image;
+	if (!rasterizer::PrimitiveRenderer::render(chunks, m_primitiveIndex, options, image))
+	{
+		return;
+	}
+
+	// QImage does not own external buffer, so make a deep copy
+	m_primitivePreview = QImage(image.pixels.data(), image.width, image.height, image.width * rasterizer::Image::kBytesPerPixel, QImage::Format_RGBA8888).copy();
+	m_primitivePreview.setDevicePixelRatio(dpr);
 }
 
 void PrimitivePreviewWidget::doDrawCurrentPrimitive()
 {
+	if (m_primitivePreview.isNull())
+	{
+		return;
+	}
+
+	QPainter painter(this);
+	painter.drawImage(QPoint(0, 0), m_primitivePreview);
 }
\ No newline at end of file
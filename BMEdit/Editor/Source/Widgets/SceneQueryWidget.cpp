@@ -0,0 +1,156 @@
+#include <Widgets/SceneQueryWidget.h>
+#include <Models/SceneQueryResultsModel.h>
+#include <Editor/EditorInstance.h>
+
+#include <GameLib/Scene/SceneQueryException.h>
+#include <GameLib/Level.h>
+
+#include <QElapsedTimer>
+#include <QHeaderView>
+#include <QVBoxLayout>
+#include <QTableView>
+#include <QLineEdit>
+#include <QThread>
+#include <QLabel>
+
+using namespace widgets;
+
+
+SceneQueryWidget::SceneQueryWidget(QWidget *parent)
+	: QWidget(parent)
+	, m_resultsModel(new models::SceneQueryResultsModel(this))
+{
+	setup();
+}
+
+SceneQueryWidget::~SceneQueryWidget()
+{
+	++m_generation;
+
+	for (auto *worker : findChildren<QThread*>(Qt::FindDirectChildrenOnly))
+	{
+		worker->wait();
+	}
+}
+
+void SceneQueryWidget::setLevel(const gamelib::Level *level)
+{
+	resetLevel();
+
+	if (!level)
+	{
+		return;
+	}
+
+	m_statusLabel->setText("Building query indexes...");
+
+	const std::uint64_t generation = m_generation;
+	QThread *worker = QThread::create([this, generation, sceneObjects = level->getSceneObjects()]()
+	{
+		auto engine = std::make_shared<gamelib::scene::SceneQueryEngine>();
+		engine->build(sceneObjects);
+
+		QMetaObject::invokeMethod(this, [this, generation, engine]() { onEngineBuilt(generation, engine); }, Qt::QueuedConnection);
+	});
+
+	worker->setParent(this);
+	connect(worker, &QThread::finished, worker, &QObject::deleteLater);
+	worker->start(QThread::LowPriority);
+}
+
+void SceneQueryWidget::resetLevel()
+{
+	++m_generation;
+	m_engine = nullptr;
+	m_resultsModel->resetResults();
+
+	m_queryInput->setEnabled(false);
+	m_statusLabel->setText("(No level)");
+}
+
+void SceneQueryWidget::setup()
+{
+	m_queryInput = new QLineEdit(this);
+	m_queryInput->setPlaceholderText("type:ZGROUP controller:Patrol prop:PrimId>0 under:\"ROOT\\Outside\" -name:Light");
+	m_queryInput->setClearButtonEnabled(true);
+
+	m_statusLabel = new QLabel(this);
+
+	m_resultsView = new QTableView(this);
+	m_resultsView->setModel(m_resultsModel);
+	m_resultsView->setSelectionBehavior(QAbstractItemView::SelectRows);
+	m_resultsView->setSelectionMode(QAbstractItemView::SingleSelection);
+	m_resultsView->setEditTriggers(QAbstractItemView::NoEditTriggers);
+	m_resultsView->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+	m_resultsView->verticalHeader()->setVisible(false);
+
+	auto *layout = new QVBoxLayout(this);
+	layout->addWidget(m_queryInput);
+	layout->addWidget(m_statusLabel);
+	layout->addWidget(m_resultsView);
+
+	connect(m_queryInput, &QLineEdit::returnPressed, this, &SceneQueryWidget::onRunQuery);
+	connect(&editor::EditorInstance::getInstance(), &editor::EditorInstance::entryChanged, this, [this](const gamelib::Value *value, int) { onEntryChanged(value); });
+	connect(m_resultsView->selectionModel(), &QItemSelectionModel::currentRowChanged, [this](const QModelIndex &current, const QModelIndex &) {
+		if (const auto *sceneObject = m_resultsModel->getObject(current))
+		{
+			emit sceneObjectSelected(sceneObject);
+		}
+	});
+
+	resetLevel();
+}
+
+void SceneQueryWidget::onEngineBuilt(std::uint64_t generation, std::shared_ptr<gamelib::scene::SceneQueryEngine> engine)
+{
+	if (generation != m_generation)
+	{
+		return; // Level was changed
+	}
+
+	m_engine = std::move(engine);
+	m_queryInput->setEnabled(true);
+	m_statusLabel->setText(QString("Ready (%1 objects)").arg(m_engine->getObjectsCount()));
+}
+
+void SceneQueryWidget::onRunQuery()
+{
+	if (!m_engine)
+	{
+		return;
+	}
+
+	gamelib::scene::SceneQuery query;
+
+	try
+	{
+		query = gamelib::scene::SceneQuery::parse(m_queryInput->text().toStdString());
+	}
+	catch (const gamelib::scene::SceneQueryException &badQuery)
+	{
+		m_resultsModel->resetResults();
+		m_statusLabel->setText(QString("Error at %1: %2").arg(badQuery.getPosition()).arg(QString::fromStdString(badQuery.getDescription())));
+		m_queryInput->setCursorPosition(static_cast<int>(badQuery.getPosition()));
+		return;
+	}
+
+	QElapsedTimer timer;
+	timer.start();
+
+	std::vector<std::uint32_t> results;
+	m_engine->execute(query, results);
+
+	const qint64 elapsed = timer.elapsed();
+	const auto resultsCount = results.size();
+
+	m_resultsModel->setResults(m_engine, std::move(results));
+	m_statusLabel->setText(QString("%1 objects found in %2 ms").arg(resultsCount).arg(elapsed));
+}
+
+void SceneQueryWidget::onEntryChanged(const gamelib::Value *value)
+{
+	if (m_engine)
+	{
+		m_engine->invalidateValue(value);
+	}
+}
\ No newline at end of file
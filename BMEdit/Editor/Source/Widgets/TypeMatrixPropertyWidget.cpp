@@ -32,13 +32,13 @@ void TypeMatrixPropertyWidget::buildLayout(const types::QGlacierValue &data)
 	{
 		for (int column = 0; column < m_columns; ++column)
 		{
-			switch (data.instructions[total].getOpCode())
+			switch (data.getInstructions()[total].getOpCode())
 			{
 				case PRPOpCode::Int8:
 				case PRPOpCode::NamedInt8:
 			    {
 				    auto onDataChanged = [this](int entryIdx, int8_t newValue) {
-					    m_value.instructions[entryIdx] = PRPInstruction(m_value.instructions[entryIdx].getOpCode(), PRPOperandVal(newValue));
+					    m_value.getMutableInstructions()[entryIdx] = PRPInstruction(m_value.getInstructions()[entryIdx].getOpCode(), PRPOperandVal(newValue));
 					    valueChanged();
 				    };
 				    auto widget = utils::TSpinboxFactory<int8_t>::create(QString(MATRIX_COMPONENT_ID).arg(total), data, total, this, onDataChanged);
@@ -49,7 +49,7 @@ void TypeMatrixPropertyWidget::buildLayout(const types::QGlacierValue &data)
 				case PRPOpCode::NamedInt16:
 			    {
 				    auto onDataChanged = [this](int entryIdx, int16_t newValue) {
-					    m_value.instructions[entryIdx] = PRPInstruction(m_value.instructions[entryIdx].getOpCode(), PRPOperandVal(newValue));
+					    m_value.getMutableInstructions()[entryIdx] = PRPInstruction(m_value.getInstructions()[entryIdx].getOpCode(), PRPOperandVal(newValue));
 					    valueChanged();
 				    };
 				    auto widget = utils::TSpinboxFactory<int16_t>::create(QString(MATRIX_COMPONENT_ID).arg(total), data, total, this, onDataChanged);
@@ -59,7 +59,7 @@ void TypeMatrixPropertyWidget::buildLayout(const types::QGlacierValue &data)
 				case PRPOpCode::NamedInt32:
 			    {
 				    auto onDataChanged = [this](int entryIdx, int32_t newValue) {
-					    m_value.instructions[entryIdx] = PRPInstruction(m_value.instructions[entryIdx].getOpCode(), PRPOperandVal(newValue));
+					    m_value.getMutableInstructions()[entryIdx] = PRPInstruction(m_value.getInstructions()[entryIdx].getOpCode(), PRPOperandVal(newValue));
 					    valueChanged();
 				    };
 				    auto widget = utils::TSpinboxFactory<int32_t>::create(QString(MATRIX_COMPONENT_ID).arg(total), data, total, this, onDataChanged);
@@ -70,7 +70,7 @@ void TypeMatrixPropertyWidget::buildLayout(const types::QGlacierValue &data)
 				case PRPOpCode::NamedFloat32:
 			    {
 				    auto onDataChanged = [this](int entryIdx, float newValue) {
-					    m_value.instructions[entryIdx] = PRPInstruction(m_value.instructions[entryIdx].getOpCode(), PRPOperandVal(newValue));
+					    m_value.getMutableInstructions()[entryIdx] = PRPInstruction(m_value.getInstructions()[entryIdx].getOpCode(), PRPOperandVal(newValue));
 					    valueChanged();
 				    };
 				    auto widget = utils::TSpinboxFactory<float>::create(QString(MATRIX_COMPONENT_ID).arg(total), data, total, this, onDataChanged);
@@ -81,7 +81,7 @@ void TypeMatrixPropertyWidget::buildLayout(const types::QGlacierValue &data)
 				case PRPOpCode::NamedFloat64:
 			    {
 				    auto onDataChanged = [this](int entryIdx, double newValue) {
-					    m_value.instructions[entryIdx] = PRPInstruction(m_value.instructions[entryIdx].getOpCode(), PRPOperandVal(newValue));
+					    m_value.getMutableInstructions()[entryIdx] = PRPInstruction(m_value.getInstructions()[entryIdx].getOpCode(), PRPOperandVal(newValue));
 					    valueChanged();
 				    };
 				    auto widget = utils::TSpinboxFactory<double>::create(QString(MATRIX_COMPONENT_ID).arg(total), data, total, this, onDataChanged);
@@ -104,7 +104,7 @@ void TypeMatrixPropertyWidget::updateLayout(const types::QGlacierValue &data)
 	{
 		for (int column = 0; column < m_columns; ++column)
 		{
-			switch (data.instructions[total].getOpCode())
+			switch (data.getInstructions()[total].getOpCode())
 			{
 				case PRPOpCode::Int8:
 				case PRPOpCode::NamedInt8:
@@ -155,7 +155,7 @@ void TypeMatrixPropertyWidget::paintPreview(int rows, int columns, QPainter *pai
 	{
 		for (int j = 0; j < columns; ++j)
 		{
-			switch (data.instructions[total].getOpCode())
+			switch (data.getInstructions()[total].getOpCode())
 			{
 				case PRPOpCode::Int8:
 				case PRPOpCode::NamedInt8:
@@ -163,15 +163,15 @@ void TypeMatrixPropertyWidget::paintPreview(int rows, int columns, QPainter *pai
 				case PRPOpCode::NamedInt16:
 				case PRPOpCode::Int32:
 				case PRPOpCode::NamedInt32:
-				    text.push_back(QString("%1 ").arg(data.instructions[total].getOperand().get<int32_t>()));
+				    text.push_back(QString("%1 ").arg(data.getInstructions()[total].getOperand().get<int32_t>()));
 					break;
 				case PRPOpCode::Float32:
 				case PRPOpCode::NamedFloat32:
-				    text.push_back(QString("%1 ").arg(data.instructions[total].getOperand().get<float>()));
+				    text.push_back(QString("%1 ").arg(data.getInstructions()[total].getOperand().get<float>()));
 					break;
 				case PRPOpCode::Float64:
 				case PRPOpCode::NamedFloat64:
-					text.push_back(QString("%1 ").arg(data.instructions[total].getOperand().get<double>()));
+					text.push_back(QString("%1 ").arg(data.getInstructions()[total].getOperand().get<double>()));
 					break;
 				default:
 				    assert(false);
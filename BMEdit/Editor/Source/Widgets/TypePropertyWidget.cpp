@@ -31,12 +31,12 @@ namespace widgets {
 
 	bool TypePropertyWidget::areSame(const types::QGlacierValue &current, const types::QGlacierValue &value)
 	{
-		if (current.instructions.size() != value.instructions.size()) return false;
+		if (current.getInstructions().size() != value.getInstructions().size()) return false;
 
-		for (auto instructionIndex = 0; instructionIndex < current.instructions.size(); ++instructionIndex)
+		for (auto instructionIndex = 0; instructionIndex < current.getInstructions().size(); ++instructionIndex)
 		{
-			const auto& c = current.instructions[instructionIndex];
-			const auto& n = value.instructions[instructionIndex];
+			const auto& c = current.getInstructions()[instructionIndex];
+			const auto& n = value.getInstructions()[instructionIndex];
 
 			if (c.getOpCode() != n.getOpCode()) return false;
 		}
@@ -60,7 +60,7 @@ enum class IntegerSubClass
 namespace {
 	std::optional<InternalDataClass> getContainerEntryClass(const types::QGlacierValue& gVal)
 	{
-		const auto& instructions = gVal.instructions;
+		const auto& instructions = gVal.getInstructions();
 
 		if (instructions.size() <= 1 || !instructions.at(0).isContainer())
 		{
@@ -113,7 +113,7 @@ namespace {
 
 	std::optional<IntegerSubClass> getContainerEntryClassOfIntegerSubClass(const types::QGlacierValue& gVal)
 	{
-		const auto& instructions = gVal.instructions;
+		const auto& instructions = gVal.getInstructions();
 
 		if (instructions.size() <= 1 || !instructions.at(0).isContainer())
 		{
@@ -198,7 +198,7 @@ namespace {
 
 void TypeRefTabPropertyWidget::buildLayout(const types::QGlacierValue &value)
 {
-	const bool isEmpty = value.instructions.empty() || value.instructions.size() == 1;
+	const bool isEmpty = value.getInstructions().empty() || value.getInstructions().size() == 1;
 	if (!isEmpty)
 	{
 		createLayout(value);
@@ -218,17 +218,17 @@ void TypeRefTabPropertyWidget::buildLayout(const types::QGlacierValue &value)
 
 void TypeRefTabPropertyWidget::updateLayout(const types::QGlacierValue &value)
 {
-	if (value.instructions.empty() || value.instructions.size() == 1) return;
+	if (value.getInstructions().empty() || value.getInstructions().size() == 1) return;
 
-	if (value.instructions.size() != m_value.instructions.size())
+	if (value.getInstructions().size() != m_value.getInstructions().size())
 	{
-		const bool hasNewData = value.instructions.size() > m_value.instructions.size();
+		const bool hasNewData = value.getInstructions().size() > m_value.getInstructions().size();
 
 		if (hasNewData)
 		{
 			// Create new elements
 			auto rootLayout = qobject_cast<QVBoxLayout*>(layout());
-			rootLayout->insertLayout(static_cast<int>(rootLayout->children().size()), createLayoutForEntry(value, static_cast<int>(value.instructions.size() - 1)));
+			rootLayout->insertLayout(static_cast<int>(rootLayout->children().size()), createLayoutForEntry(value, static_cast<int>(value.getInstructions().size() - 1)));
 		}
 		// else we made removal actions, that case was skipped before
 	}
@@ -247,42 +247,42 @@ void TypeRefTabPropertyWidget::updateLayout(const types::QGlacierValue &value)
 		{
 			case InternalDataClass::String:
 			{
-			    for (int i = 0; i < value.instructions.size() - 1; ++i)
+			    for (int i = 0; i < value.getInstructions().size() - 1; ++i)
 			    {
 				    auto id = QString(STRING_ENTRY_ELEMENT_TEMPLATE_ID).arg(i);
 
 				    if (auto entryEditor = layout()->findChild<QLineEdit*>(id); entryEditor != nullptr)
 				    {
 					    QSignalBlocker blocker { entryEditor };
-					    entryEditor->setText(QString::fromStdString(value.instructions.at(i + 1).getOperand().get<const std::string&>()));
+					    entryEditor->setText(QString::fromStdString(value.getInstructions().at(i + 1).getOperand().get<const std::string&>()));
 				    }
 			    }
 		    }
 			break;
 			case InternalDataClass::Char:
 		    {
-			    for (int i = 0; i < value.instructions.size() - 1; ++i)
+			    for (int i = 0; i < value.getInstructions().size() - 1; ++i)
 			    {
 				    auto id = QString(CHAR_ENTRY_ELEMENT_TEMPLATE_ID).arg(i);
 
 				    if (auto entryEditor = layout()->findChild<QLineEdit*>(id); entryEditor != nullptr)
 				    {
 					    QSignalBlocker blocker { entryEditor };
-					    entryEditor->setText(QString(value.instructions.at(i + 1).getOperand().get<char>()));
+					    entryEditor->setText(QString(value.getInstructions().at(i + 1).getOperand().get<char>()));
 				    }
 			    }
 		    }
 		    break;
 		    case InternalDataClass::Boolean:
 		    {
-			    for (int i = 0; i < value.instructions.size() - 1; ++i)
+			    for (int i = 0; i < value.getInstructions().size() - 1; ++i)
 			    {
 				    auto id = QString(BOOL_ENTRY_ELEMENT_TEMPLATE_ID).arg(i);
 
 				    if (auto entryEditor = layout()->findChild<QCheckBox*>(id); entryEditor != nullptr)
 				    {
 					    QSignalBlocker blocker { entryEditor };
-					    entryEditor->setChecked(value.instructions.at(i + 1).getOperand().get<bool>());
+					    entryEditor->setChecked(value.getInstructions().at(i + 1).getOperand().get<bool>());
 				    }
 			    }
 		    }
@@ -296,7 +296,7 @@ void TypeRefTabPropertyWidget::updateLayout(const types::QGlacierValue &value)
 				    return;
 			    }
 
-			    for (int i = 0; i < value.instructions.size() - 1; ++i)
+			    for (int i = 0; i < value.getInstructions().size() - 1; ++i)
 			    {
 				    switch (intSubClassOpt.value())
 				    {
@@ -324,7 +324,7 @@ void TypeRefTabPropertyWidget::updateLayout(const types::QGlacierValue &value)
 		    break;
 			case InternalDataClass::Float32:
 		    {
-			    for (int i = 0; i < value.instructions.size() - 1; ++i)
+			    for (int i = 0; i < value.getInstructions().size() - 1; ++i)
 			    {
 				    auto id = QString(F32_ENTRY_ELEMENT_TEMPLATE_ID).arg(i);
 				    utils::TSpinboxFactory<float>::updateValue(id, value, i + 1, this);
@@ -333,7 +333,7 @@ void TypeRefTabPropertyWidget::updateLayout(const types::QGlacierValue &value)
 		    break;
 			case InternalDataClass::Float64:
 		    {
-			    for (int i = 0; i < value.instructions.size() - 1; ++i)
+			    for (int i = 0; i < value.getInstructions().size() - 1; ++i)
 			    {
 				    auto id = QString(F64_ENTRY_ELEMENT_TEMPLATE_ID).arg(i);
 				    utils::TSpinboxFactory<double>::updateValue(id, value, i + 1, this);
@@ -347,7 +347,7 @@ void TypeRefTabPropertyWidget::updateLayout(const types::QGlacierValue &value)
 void TypeRefTabPropertyWidget::createLayout(const types::QGlacierValue &value)
 {
 	auto layout = new QVBoxLayout(this);
-	const auto capacity = value.instructions.at(0).getOperand().get<std::int32_t>();
+	const auto capacity = value.getInstructions().at(0).getOperand().get<std::int32_t>();
 
 	const auto entryKindOpt = getContainerEntryClass(value);
 	if (!entryKindOpt.has_value())
@@ -380,7 +380,7 @@ void TypeRefTabPropertyWidget::createLayoutForEmptyContainer(const types::QGlaci
 
 void TypeRefTabPropertyWidget::paintPreview(QPainter *painter, const QStyleOptionViewItem &option, const types::QGlacierValue &data)
 {
-	if (data.instructions.empty() || data.instructions.at(0).getOperand().get<std::int32_t>() == 0u)
+	if (data.getInstructions().empty() || data.getInstructions().at(0).getOperand().get<std::int32_t>() == 0u)
 	{
 		QTextOption textOptions;
 		textOptions.setAlignment(Qt::AlignCenter);
@@ -389,7 +389,7 @@ void TypeRefTabPropertyWidget::paintPreview(QPainter *painter, const QStyleOptio
 	}
 
 	// Container of strings
-	auto capacity = data.instructions.at(0).getOperand().get<std::int32_t>();
+	auto capacity = data.getInstructions().at(0).getOperand().get<std::int32_t>();
 	QStringList stringList;
 	stringList.reserve(capacity);
 
@@ -404,31 +404,31 @@ void TypeRefTabPropertyWidget::paintPreview(QPainter *painter, const QStyleOptio
 
 	for (int i = 0; i < capacity; ++i)
 	{
-		const auto& ip = data.instructions.at(1);
+		const auto& ip = data.getInstructions().at(1);
 
 		if (entKind == InternalDataClass::String)
 		{
-			stringList.push_back(QString("[%1] '%2'").arg(i + 1).arg(QString::fromStdString(data.instructions.at(i + 1).getOperand().get<const std::string&>())));
+			stringList.push_back(QString("[%1] '%2'").arg(i + 1).arg(QString::fromStdString(data.getInstructions().at(i + 1).getOperand().get<const std::string&>())));
 		}
 		else if (entKind == InternalDataClass::Char)
 		{
-			stringList.push_back(QString("[%1] '%2'").arg(i + 1).arg(data.instructions.at(i + 1).getOperand().get<char>()));
+			stringList.push_back(QString("[%1] '%2'").arg(i + 1).arg(data.getInstructions().at(i + 1).getOperand().get<char>()));
 		}
 		else if (entKind == InternalDataClass::Float32)
 		{
-			stringList.push_back(QString("[%1] %2").arg(i + 1).arg(data.instructions.at(i + 1).getOperand().get<float>()));
+			stringList.push_back(QString("[%1] %2").arg(i + 1).arg(data.getInstructions().at(i + 1).getOperand().get<float>()));
 		}
 		else if (entKind == InternalDataClass::Float64)
 		{
-			stringList.push_back(QString("[%1] %2").arg(i + 1).arg(data.instructions.at(i + 1).getOperand().get<double>()));
+			stringList.push_back(QString("[%1] %2").arg(i + 1).arg(data.getInstructions().at(i + 1).getOperand().get<double>()));
 		}
 		else if (entKind == InternalDataClass::Integer)
 		{
-			stringList.push_back(QString("[%1] %2").arg(i + 1).arg(data.instructions.at(i + 1).getOperand().get<std::int32_t>()));
+			stringList.push_back(QString("[%1] %2").arg(i + 1).arg(data.getInstructions().at(i + 1).getOperand().get<std::int32_t>()));
 		}
 		else if (entKind == InternalDataClass::Boolean)
 		{
-			stringList.push_back(QString("[%1] %2").arg(i + 1).arg(data.instructions.at(i + 1).getOperand().get<bool>()));
+			stringList.push_back(QString("[%1] %2").arg(i + 1).arg(data.getInstructions().at(i + 1).getOperand().get<bool>()));
 		}
 	}
 
@@ -447,7 +447,7 @@ QLayout *TypeRefTabPropertyWidget::createLayoutForFooter()
 		auto newSnapshot = m_value;
 
 		// Add value
-		const auto& firstEntryInstruction = newSnapshot.instructions.at(1);
+		const auto& firstEntryInstruction = newSnapshot.getInstructions().at(1);
 		const auto newInstructionOpt = constructDefaultInstructionForContainerEntry(newSnapshot);
 		if (!newInstructionOpt.has_value())
 		{
@@ -455,12 +455,12 @@ QLayout *TypeRefTabPropertyWidget::createLayoutForFooter()
 			return;
 		}
 
-		newSnapshot.instructions.push_back(newInstructionOpt.value());
+		newSnapshot.getMutableInstructions().push_back(newInstructionOpt.value());
 
 		// Update capacity
-		const auto oldOpCode   = m_value.instructions.at(0).getOpCode();
-		const auto newCapacity = m_value.instructions.at(0).getOperand().get<std::int32_t>() + 1;
-		newSnapshot.instructions[0] = gamelib::prp::PRPInstruction(oldOpCode, gamelib::prp::PRPOperandVal(newCapacity));
+		const auto oldOpCode   = m_value.getInstructions().at(0).getOpCode();
+		const auto newCapacity = m_value.getInstructions().at(0).getOperand().get<std::int32_t>() + 1;
+		newSnapshot.getMutableInstructions()[0] = gamelib::prp::PRPInstruction(oldOpCode, gamelib::prp::PRPOperandVal(newCapacity));
 
 		// Update & sync data
 		m_value = newSnapshot;
@@ -498,9 +498,9 @@ QLayout *TypeRefTabPropertyWidget::createLayoutForEntry(const types::QGlacierVal
 		{
 			case InternalDataClass::String:
 			{
-			    auto entryEditorWidget = new QLineEdit(QString::fromStdString(value.instructions.at(i).getOperand().get<const std::string&>()), this);
+			    auto entryEditorWidget = new QLineEdit(QString::fromStdString(value.getInstructions().at(i).getOperand().get<const std::string&>()), this);
 			    connect(entryEditorWidget, &QLineEdit::textChanged, [this, instructionIndex = i](const QString& newStr) {
-				    m_value.instructions[instructionIndex] = gamelib::prp::PRPInstruction(PRPOpCode::String, PRPOperandVal(newStr.toStdString()));
+				    m_value.getMutableInstructions()[instructionIndex] = gamelib::prp::PRPInstruction(PRPOpCode::String, PRPOperandVal(newStr.toStdString()));
 				    emit valueChanged();
 			    });
 			    entryEditorWidget->setAccessibleName(QString(STRING_ENTRY_ELEMENT_TEMPLATE_ID).arg(i));
@@ -509,7 +509,7 @@ QLayout *TypeRefTabPropertyWidget::createLayoutForEntry(const types::QGlacierVal
 			break;
 		    case InternalDataClass::Char:
 		    {
-			    auto entryEditorWidget = new QLineEdit(QString::fromStdString(value.instructions.at(i).getOperand().get<const std::string&>()), this);
+			    auto entryEditorWidget = new QLineEdit(QString::fromStdString(value.getInstructions().at(i).getOperand().get<const std::string&>()), this);
 			    entryEditorWidget->setMaxLength(1);
 			    connect(entryEditorWidget, &QLineEdit::textChanged, [this, instructionIndex = i](const QString& newStr) {
 				    if (newStr.length() < 1)
@@ -517,7 +517,7 @@ QLayout *TypeRefTabPropertyWidget::createLayoutForEntry(const types::QGlacierVal
 					    return;
 				    }
 
-				    m_value.instructions[instructionIndex] = gamelib::prp::PRPInstruction(PRPOpCode::String, PRPOperandVal(newStr.toStdString()[0]));
+				    m_value.getMutableInstructions()[instructionIndex] = gamelib::prp::PRPInstruction(PRPOpCode::String, PRPOperandVal(newStr.toStdString()[0]));
 				    emit valueChanged();
 			    });
 			    entryEditorWidget->setAccessibleName(QString(CHAR_ENTRY_ELEMENT_TEMPLATE_ID).arg(i));
@@ -527,9 +527,9 @@ QLayout *TypeRefTabPropertyWidget::createLayoutForEntry(const types::QGlacierVal
 		    case InternalDataClass::Boolean:
 		    {
 			    auto entryEditorWidget = new QCheckBox(QString("Value #%1").arg(i), this);
-			    entryEditorWidget->setChecked(value.instructions.at(i).getOperand().get<bool>());
+			    entryEditorWidget->setChecked(value.getInstructions().at(i).getOperand().get<bool>());
 			    connect(entryEditorWidget, &QCheckBox::stateChanged, [this, i](int state) {
-				    m_value.instructions[i] = gamelib::prp::PRPInstruction(PRPOpCode::Bool, PRPOperandVal(state == Qt::CheckState::Checked));
+				    m_value.getMutableInstructions()[i] = gamelib::prp::PRPInstruction(PRPOpCode::Bool, PRPOperandVal(state == Qt::CheckState::Checked));
 				    emit valueChanged();
 			    });
 			    entryEditorWidget->setAccessibleName(QString(BOOL_ENTRY_ELEMENT_TEMPLATE_ID).arg(i));
@@ -551,20 +551,20 @@ QLayout *TypeRefTabPropertyWidget::createLayoutForEntry(const types::QGlacierVal
 				    case IntegerSubClass::I8:
 			        {
 				        utils::TSpinboxFactory<std::int8_t>::createAndSetup(QString(I8_ENTRY_ELEMENT_TEMPLATE_ID).arg(i), value, i, this, localLayout, [this](int entryIdx, int8_t newValue) {
-					        m_value.instructions[entryIdx] = PRPInstruction(m_value.instructions[entryIdx].getOpCode(), PRPOperandVal(newValue));
+					        m_value.getMutableInstructions()[entryIdx] = PRPInstruction(m_value.getInstructions()[entryIdx].getOpCode(), PRPOperandVal(newValue));
 					        emit valueChanged();
 				        });
 			        }
 			        break;
 				    case IntegerSubClass::I16:
 				        utils::TSpinboxFactory<std::int16_t>::createAndSetup(QString(I16_ENTRY_ELEMENT_TEMPLATE_ID).arg(i), value, i, this, localLayout, [this](int entryIdx, int16_t newValue) {
-					        m_value.instructions[entryIdx] = PRPInstruction(m_value.instructions[entryIdx].getOpCode(), PRPOperandVal(newValue));
+					        m_value.getMutableInstructions()[entryIdx] = PRPInstruction(m_value.getInstructions()[entryIdx].getOpCode(), PRPOperandVal(newValue));
 					        emit valueChanged();
 				        });
 			        break;
 				    case IntegerSubClass::I32:
 				        utils::TSpinboxFactory<std::int32_t>::createAndSetup(QString(I32_ENTRY_ELEMENT_TEMPLATE_ID).arg(i), value, i, this, localLayout, [this](int entryIdx, int32_t newValue) {
-					        m_value.instructions[entryIdx] = PRPInstruction(m_value.instructions[entryIdx].getOpCode(), PRPOperandVal(newValue));
+					        m_value.getMutableInstructions()[entryIdx] = PRPInstruction(m_value.getInstructions()[entryIdx].getOpCode(), PRPOperandVal(newValue));
 					        emit valueChanged();
 				        });
 			        break;
@@ -573,13 +573,13 @@ QLayout *TypeRefTabPropertyWidget::createLayoutForEntry(const types::QGlacierVal
 		    break;
 			case InternalDataClass::Float32:
 			    utils::TSpinboxFactory<float>::createAndSetup(QString(F32_ENTRY_ELEMENT_TEMPLATE_ID).arg(i), value, i, this, localLayout, [this](int entryIdx, float newValue) {
-				    m_value.instructions[entryIdx] = PRPInstruction(m_value.instructions[entryIdx].getOpCode(), PRPOperandVal(newValue));
+				    m_value.getMutableInstructions()[entryIdx] = PRPInstruction(m_value.getInstructions()[entryIdx].getOpCode(), PRPOperandVal(newValue));
 				    emit valueChanged();
 			    });
 		    break;
 			case InternalDataClass::Float64:
 			    utils::TSpinboxFactory<double>::createAndSetup(QString(F32_ENTRY_ELEMENT_TEMPLATE_ID).arg(i), value, i, this, localLayout, [this](int entryIdx, double newValue) {
-				    m_value.instructions[entryIdx] = PRPInstruction(m_value.instructions[entryIdx].getOpCode(), PRPOperandVal(newValue));
+				    m_value.getMutableInstructions()[entryIdx] = PRPInstruction(m_value.getInstructions()[entryIdx].getOpCode(), PRPOperandVal(newValue));
 				    emit valueChanged();
 			    });
 		    break;
@@ -596,12 +596,12 @@ QLayout *TypeRefTabPropertyWidget::createLayoutForEntry(const types::QGlacierVal
 			auto newSnapshot = m_value;
 
 			// Remove entry
-			newSnapshot.instructions.erase(newSnapshot.instructions.begin() + instructionIndex);
+			newSnapshot.getMutableInstructions().erase(newSnapshot.getMutableInstructions().begin() + instructionIndex);
 
 			// Update capacity
-			const auto oldOpCode   = m_value.instructions.at(0).getOpCode();
-			const auto newCapacity = m_value.instructions.at(0).getOperand().get<std::int32_t>() - 1;
-			newSnapshot.instructions[0] = gamelib::prp::PRPInstruction(oldOpCode, gamelib::prp::PRPOperandVal(newCapacity));
+			const auto oldOpCode   = m_value.getInstructions().at(0).getOpCode();
+			const auto newCapacity = m_value.getInstructions().at(0).getOperand().get<std::int32_t>() - 1;
+			newSnapshot.getMutableInstructions()[0] = gamelib::prp::PRPInstruction(oldOpCode, gamelib::prp::PRPOperandVal(newCapacity));
 
 			// Update & sync data
 			m_value = newSnapshot;
@@ -653,18 +653,18 @@ void TypeRefTabPropertyWidget::addEntryFromContextMenu()
 
 	// Increase capacity
 	{
-		if (newSnapshot.instructions.empty())
+		if (newSnapshot.getInstructions().empty())
 		{
-			newSnapshot.instructions.emplace_back(gamelib::prp::PRPOpCode::Container, gamelib::prp::PRPOperandVal(int32_t(1)));
+			newSnapshot.getMutableInstructions().emplace_back(gamelib::prp::PRPOpCode::Container, gamelib::prp::PRPOperandVal(int32_t(1)));
 		}
 		else
 		{
-			const auto capacity = newSnapshot.instructions.at(0).getOperand().get<std::int32_t>() + 1;
-			newSnapshot.instructions[0] = gamelib::prp::PRPInstruction(gamelib::prp::PRPOpCode::Container, gamelib::prp::PRPOperandVal(capacity));
+			const auto capacity = newSnapshot.getInstructions().at(0).getOperand().get<std::int32_t>() + 1;
+			newSnapshot.getMutableInstructions()[0] = gamelib::prp::PRPInstruction(gamelib::prp::PRPOpCode::Container, gamelib::prp::PRPOperandVal(capacity));
 		}
 	}
 
-#define PREPARE_TYPE_ACTION_DECL(type, prpType, val) (actionId == (type)) { newSnapshot.instructions.emplace_back(gamelib::prp::PRPInstruction((prpType), gamelib::prp::PRPOperandVal((val)))); }
+#define PREPARE_TYPE_ACTION_DECL(type, prpType, val) (actionId == (type)) { newSnapshot.getMutableInstructions().emplace_back(gamelib::prp::PRPInstruction((prpType), gamelib::prp::PRPOperandVal((val)))); }
 
 	if      PREPARE_TYPE_ACTION_DECL(Action_Bool,    gamelib::prp::PRPOpCode::Bool,  false)
 	else if PREPARE_TYPE_ACTION_DECL(Action_Char,    gamelib::prp::PRPOpCode::Char,  ' ')
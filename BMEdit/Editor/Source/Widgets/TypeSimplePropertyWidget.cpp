@@ -38,19 +38,19 @@ constexpr const char* ENUM_COMBOBOX_ID = "EnumEditorID";
 
 void TypeSimplePropertyWidget::buildLayout(const types::QGlacierValue &value)
 {
-	if (value.instructions[0].isBool())
+	if (value.getInstructions()[0].isBool())
 	{
 		createCheckBoxLayout(value);
 	}
-	else if (value.instructions[0].isNumber())
+	else if (value.getInstructions()[0].isNumber())
 	{
 		createNumberLayout(value);
 	}
-	else if (value.instructions[0].isString())
+	else if (value.getInstructions()[0].isString())
 	{
 		createStringLayout(value);
 	}
-	else if (value.instructions[0].isEnum())
+	else if (value.getInstructions()[0].isEnum())
 	{
 		createEnumLayout(value);
 	}
@@ -77,19 +77,19 @@ void TypeSimplePropertyWidget::buildLayout(const types::QGlacierValue &value)
 
 void TypeSimplePropertyWidget::updateLayout(const types::QGlacierValue &value)
 {
-	if (value.instructions[0].isBool())
+	if (value.getInstructions()[0].isBool())
 	{
 		updateCheckBoxLayout(value);
 	}
-	else if (value.instructions[0].isNumber())
+	else if (value.getInstructions()[0].isNumber())
 	{
 		updateNumberLayout(value);
 	}
-	else if (value.instructions[0].isString())
+	else if (value.getInstructions()[0].isString())
 	{
 		updateStringLayout(value);
 	}
-	else if (value.instructions[0].isEnum())
+	else if (value.getInstructions()[0].isEnum())
 	{
 		updateEnumLayout(value);
 	}
@@ -100,15 +100,15 @@ void TypeSimplePropertyWidget::createCheckBoxLayout(const types::QGlacierValue &
 	auto layout = new QHBoxLayout(this);
 	auto checkbox = new QCheckBox(this);
 
-	checkbox->setChecked(value.instructions[0].getOperand().trivial.b);
+	checkbox->setChecked(value.getInstructions()[0].getOperand().trivial.b);
 	connect(checkbox, &QCheckBox::stateChanged, [this](int state) {
 		if (state == Qt::CheckState::Checked)
 		{
-			m_value.instructions[0] = PRPInstruction(m_value.instructions[0].getOpCode(), PRPOperandVal(true));
+			m_value.getMutableInstructions()[0] = PRPInstruction(m_value.getInstructions()[0].getOpCode(), PRPOperandVal(true));
 		}
 		else if (state == Qt::CheckState::Unchecked)
 		{
-			m_value.instructions[0] = PRPInstruction(m_value.instructions[0].getOpCode(), PRPOperandVal(false));
+			m_value.getMutableInstructions()[0] = PRPInstruction(m_value.getInstructions()[0].getOpCode(), PRPOperandVal(false));
 		}
 
 		valueChanged();
@@ -124,7 +124,7 @@ void TypeSimplePropertyWidget::updateCheckBoxLayout(const types::QGlacierValue &
 	if (auto checkbox = findChild<QCheckBox*>(BOOL_CHECKBOX_ID))
 	{
 		QSignalBlocker blocker(checkbox);
-		checkbox->setChecked(value.instructions[0].getOperand().trivial.b);
+		checkbox->setChecked(value.getInstructions()[0].getOperand().trivial.b);
 	}
 }
 
@@ -132,7 +132,7 @@ void TypeSimplePropertyWidget::createNumberLayout(const types::QGlacierValue &va
 {
 	auto layout = new QHBoxLayout(this);
 
-	switch (value.instructions[0].getOpCode())
+	switch (value.getInstructions()[0].getOpCode())
 	{
 		case PRPOpCode::Int8:
 		case PRPOpCode::NamedInt8:
@@ -140,10 +140,10 @@ void TypeSimplePropertyWidget::createNumberLayout(const types::QGlacierValue &va
 		    auto spinBox = new QSpinBox(this);
 		    spinBox->setMinimum(std::numeric_limits<int8_t>::lowest());
 		    spinBox->setMaximum(std::numeric_limits<int8_t>::max());
-		    spinBox->setValue(value.instructions[0].getOperand().trivial.i8);
+		    spinBox->setValue(value.getInstructions()[0].getOperand().trivial.i8);
 		    spinBox->setAccessibleName(INT_SPINBOX_ID);
 		    connect(spinBox, &QSpinBox::valueChanged, [this](int newValue) {
-			    m_value.instructions[0] = PRPInstruction(m_value.instructions[0].getOpCode(), PRPOperandVal(static_cast<int8_t>(newValue)));
+			    m_value.getMutableInstructions()[0] = PRPInstruction(m_value.getInstructions()[0].getOpCode(), PRPOperandVal(static_cast<int8_t>(newValue)));
 			    valueChanged();
 		    });
 		    layout->addWidget(spinBox);
@@ -155,10 +155,10 @@ void TypeSimplePropertyWidget::createNumberLayout(const types::QGlacierValue &va
 		    auto spinBox = new QSpinBox(this);
 		    spinBox->setMinimum(std::numeric_limits<int16_t>::lowest());
 		    spinBox->setMaximum(std::numeric_limits<int16_t>::max());
-		    spinBox->setValue(value.instructions[0].getOperand().trivial.i16);
+		    spinBox->setValue(value.getInstructions()[0].getOperand().trivial.i16);
 		    spinBox->setAccessibleName(INT_SPINBOX_ID);
 		    connect(spinBox, &QSpinBox::valueChanged, [this](int newValue) {
-			    m_value.instructions[0] = PRPInstruction(m_value.instructions[0].getOpCode(), PRPOperandVal(static_cast<int16_t>(newValue)));
+			    m_value.getMutableInstructions()[0] = PRPInstruction(m_value.getInstructions()[0].getOpCode(), PRPOperandVal(static_cast<int16_t>(newValue)));
 			    valueChanged();
 		    });
 		    layout->addWidget(spinBox);
@@ -170,10 +170,10 @@ void TypeSimplePropertyWidget::createNumberLayout(const types::QGlacierValue &va
 		    auto spinBox = new QSpinBox(this);
 		    spinBox->setMinimum(std::numeric_limits<int32_t>::lowest());
 		    spinBox->setMaximum(std::numeric_limits<int32_t>::max());
-		    spinBox->setValue(value.instructions[0].getOperand().trivial.i32);
+		    spinBox->setValue(value.getInstructions()[0].getOperand().trivial.i32);
 		    spinBox->setAccessibleName(INT_SPINBOX_ID);
 		    connect(spinBox, &QSpinBox::valueChanged, [this](int newValue) {
-			    m_value.instructions[0] = PRPInstruction(m_value.instructions[0].getOpCode(), PRPOperandVal(static_cast<int32_t>(newValue)));
+			    m_value.getMutableInstructions()[0] = PRPInstruction(m_value.getInstructions()[0].getOpCode(), PRPOperandVal(static_cast<int32_t>(newValue)));
 			    valueChanged();
 		    });
 		    layout->addWidget(spinBox);
@@ -185,10 +185,10 @@ void TypeSimplePropertyWidget::createNumberLayout(const types::QGlacierValue &va
 		    auto spinBox = new QDoubleSpinBox(this);
 		    spinBox->setMinimum(std::numeric_limits<float>::lowest());
 		    spinBox->setMaximum(std::numeric_limits<float>::max());
-		    spinBox->setValue(value.instructions[0].getOperand().trivial.f32);
+		    spinBox->setValue(value.getInstructions()[0].getOperand().trivial.f32);
 		    spinBox->setAccessibleName(F32_SPINBOX_ID);
 		    connect(spinBox, &QDoubleSpinBox::valueChanged, [this](double newValue) {
-			    m_value.instructions[0] = PRPInstruction(m_value.instructions[0].getOpCode(), PRPOperandVal(static_cast<float>(newValue)));
+			    m_value.getMutableInstructions()[0] = PRPInstruction(m_value.getInstructions()[0].getOpCode(), PRPOperandVal(static_cast<float>(newValue)));
 			    valueChanged();
 		    });
 		    layout->addWidget(spinBox);
@@ -200,10 +200,10 @@ void TypeSimplePropertyWidget::createNumberLayout(const types::QGlacierValue &va
 		    auto spinBox = new QDoubleSpinBox(this);
 		    spinBox->setMinimum(std::numeric_limits<double>::lowest());
 		    spinBox->setMaximum(std::numeric_limits<double>::max());
-		    spinBox->setValue(value.instructions[0].getOperand().trivial.f64);
+		    spinBox->setValue(value.getInstructions()[0].getOperand().trivial.f64);
 		    spinBox->setAccessibleName(F64_SPINBOX_ID);
 		    connect(spinBox, &QDoubleSpinBox::valueChanged, [this](double newValue) {
-			    m_value.instructions[0] = PRPInstruction(m_value.instructions[0].getOpCode(), PRPOperandVal(newValue));
+			    m_value.getMutableInstructions()[0] = PRPInstruction(m_value.getInstructions()[0].getOpCode(), PRPOperandVal(newValue));
 			    valueChanged();
 		    });
 		    layout->addWidget(spinBox);
@@ -219,7 +219,7 @@ void TypeSimplePropertyWidget::createNumberLayout(const types::QGlacierValue &va
 
 void TypeSimplePropertyWidget::updateNumberLayout(const types::QGlacierValue &value)
 {
-	switch (value.instructions[0].getOpCode())
+	switch (value.getInstructions()[0].getOpCode())
 	{
 		case PRPOpCode::Int8:
 		case PRPOpCode::NamedInt8:
@@ -231,7 +231,7 @@ void TypeSimplePropertyWidget::updateNumberLayout(const types::QGlacierValue &va
 		    if (auto spinBox = findChild<QSpinBox*>(INT_SPINBOX_ID))
 		    {
 			    QSignalBlocker blocker(spinBox);
-			    spinBox->setValue(value.instructions[0].getOperand().trivial.i32);
+			    spinBox->setValue(value.getInstructions()[0].getOperand().trivial.i32);
 		    }
 		}
 		break;
@@ -241,7 +241,7 @@ void TypeSimplePropertyWidget::updateNumberLayout(const types::QGlacierValue &va
 		    if (auto spinBox = findChild<QDoubleSpinBox*>(F32_SPINBOX_ID))
 		    {
 			    QSignalBlocker blocker(spinBox);
-			    spinBox->setValue(value.instructions[0].getOperand().trivial.f32);
+			    spinBox->setValue(value.getInstructions()[0].getOperand().trivial.f32);
 		    }
 	    }
 	    break;
@@ -251,7 +251,7 @@ void TypeSimplePropertyWidget::updateNumberLayout(const types::QGlacierValue &va
 		    if (auto spinBox = findChild<QDoubleSpinBox*>(F64_SPINBOX_ID))
 		    {
 			    QSignalBlocker blocker(spinBox);
-			    spinBox->setValue(value.instructions[0].getOperand().trivial.f64);
+			    spinBox->setValue(value.getInstructions()[0].getOperand().trivial.f64);
 		    }
 		}
 		break;
@@ -266,9 +266,9 @@ void TypeSimplePropertyWidget::createStringLayout(const types::QGlacierValue &va
 	auto layout = new QHBoxLayout(this);
 
 	auto lineEdit = new QLineEdit(this);
-	lineEdit->setText(QString::fromStdString(value.instructions[0].getOperand().str));
+	lineEdit->setText(QString::fromStdString(value.getInstructions()[0].getOperand().str));
 	connect(lineEdit, &QLineEdit::textChanged, [this](const QString &newValue) {
-		m_value.instructions[0] = PRPInstruction(m_value.instructions[0].getOpCode(), PRPOperandVal(newValue.toStdString()));
+		m_value.getMutableInstructions()[0] = PRPInstruction(m_value.getInstructions()[0].getOpCode(), PRPOperandVal(newValue.toStdString()));
 		valueChanged();
 	});
 
@@ -281,13 +281,13 @@ void TypeSimplePropertyWidget::updateStringLayout(const types::QGlacierValue &va
 	if (auto lineEdit = findChild<QLineEdit*>(STR_LINE_EDIT_ID))
 	{
 		QSignalBlocker blocker(lineEdit);
-		lineEdit->setText(QString::fromStdString(value.instructions[0].getOperand().str));
+		lineEdit->setText(QString::fromStdString(value.getInstructions()[0].getOperand().str));
 	}
 }
 
 void TypeSimplePropertyWidget::createEnumLayout(const types::QGlacierValue &value)
 {
-	if (value.views.empty() || value.views[0].getType()->getKind() != gamelib::TypeKind::ENUM)
+	if (value.getViews().empty() || value.getViews()[0].getType()->getKind() != gamelib::TypeKind::ENUM)
 	{
 		assert(false && "Wrong view");
 		return;
@@ -295,7 +295,7 @@ void TypeSimplePropertyWidget::createEnumLayout(const types::QGlacierValue &valu
 
 	QStringList possibleValues;
 
-	for (const auto& entry: reinterpret_cast<const gamelib::TypeEnum*>(value.views[0].getType())->getPossibleValues())
+	for (const auto& entry: reinterpret_cast<const gamelib::TypeEnum*>(value.getViews()[0].getType())->getPossibleValues())
 	{
 		possibleValues.push_back(QString::fromStdString(entry.name));
 	}
@@ -304,11 +304,11 @@ void TypeSimplePropertyWidget::createEnumLayout(const types::QGlacierValue &valu
 
 	auto comboBox = new QComboBox(this);
 	comboBox->setModel(new QStringListModel(possibleValues, comboBox));
-	comboBox->setCurrentText(QString::fromStdString(value.instructions[0].getOperand().str));
+	comboBox->setCurrentText(QString::fromStdString(value.getInstructions()[0].getOperand().str));
 	comboBox->setAccessibleName(ENUM_COMBOBOX_ID);
 	comboBox->setEditable(false);
 	connect(comboBox, &QComboBox::currentTextChanged, [this](const QString& newValue) {
-		m_value.instructions[0] = PRPInstruction(m_value.instructions[0].getOpCode(), PRPOperandVal(newValue.toStdString()));
+		m_value.getMutableInstructions()[0] = PRPInstruction(m_value.getInstructions()[0].getOpCode(), PRPOperandVal(newValue.toStdString()));
 		valueChanged();
 	});
 
@@ -320,7 +320,7 @@ void TypeSimplePropertyWidget::updateEnumLayout(const types::QGlacierValue &valu
 	if (auto comboBox = findChild<QComboBox*>(ENUM_COMBOBOX_ID))
 	{
 		QSignalBlocker blocker(comboBox);
-		comboBox->setCurrentText(QString::fromStdString(value.instructions[0].getOperand().str));
+		comboBox->setCurrentText(QString::fromStdString(value.getInstructions()[0].getOperand().str));
 	}
 }
 
@@ -329,25 +329,25 @@ void TypeSimplePropertyWidget::paintPreview(QPainter *painter, const QStyleOptio
 	QTextOption textOptions;
 	textOptions.setAlignment(Qt::AlignCenter);
 
-	if (value.instructions[0].isBool())
+	if (value.getInstructions()[0].isBool())
 	{
-		painter->drawText(option.rect, QString("%1").arg(value.instructions[0].getOperand().trivial.b ? "YES": "NO"), textOptions);
+		painter->drawText(option.rect, QString("%1").arg(value.getInstructions()[0].getOperand().trivial.b ? "YES": "NO"), textOptions);
 
 #if 0 // NOTE: This part of code works well, but it looks not good enough
 		painter->translate(option.rect.center());
 
 		QStyleOptionButton checkbox;
-		checkbox.state |= value.instructions[0].getOperand().trivial.b ? QStyle::State_On : QStyle::State_Off;
+		checkbox.state |= value.getInstructions()[0].getOperand().trivial.b ? QStyle::State_On : QStyle::State_Off;
 		checkbox.state |= QStyle::State_Enabled;
 
 		QApplication::style()->drawControl(QStyle::ControlElement::CE_CheckBox, &checkbox, painter);
 #endif
 	}
-	else if (value.instructions[0].isNumber())
+	else if (value.getInstructions()[0].isNumber())
 	{
 		QString text;
 
-		switch (value.instructions[0].getOpCode())
+		switch (value.getInstructions()[0].getOpCode())
 		{
 			case PRPOpCode::Int8:
 			case PRPOpCode::NamedInt8:
@@ -355,15 +355,15 @@ void TypeSimplePropertyWidget::paintPreview(QPainter *painter, const QStyleOptio
 			case PRPOpCode::NamedInt16:
 			case PRPOpCode::Int32:
 			case PRPOpCode::NamedInt32:
-			    text = QString("%1").arg(value.instructions[0].getOperand().trivial.i32);
+			    text = QString("%1").arg(value.getInstructions()[0].getOperand().trivial.i32);
 				break;
 		    case PRPOpCode::Float32:
 		    case PRPOpCode::NamedFloat32:
-			    text = QString("%1").arg(value.instructions[0].getOperand().trivial.f32);
+			    text = QString("%1").arg(value.getInstructions()[0].getOperand().trivial.f32);
 			    break;
 		    case PRPOpCode::Float64:
 		    case PRPOpCode::NamedFloat64:
-			    text = QString("%1").arg(value.instructions[0].getOperand().trivial.f64);
+			    text = QString("%1").arg(value.getInstructions()[0].getOperand().trivial.f64);
 			    break;
 		    default:
 			    return;
@@ -371,14 +371,14 @@ void TypeSimplePropertyWidget::paintPreview(QPainter *painter, const QStyleOptio
 
 		painter->drawText(option.rect, text, textOptions);
 	}
-	else if (value.instructions[0].isString())
+	else if (value.getInstructions()[0].isString())
 	{
-		painter->drawText(option.rect, QString::fromStdString(value.instructions[0].getOperand().str), textOptions);
+		painter->drawText(option.rect, QString::fromStdString(value.getInstructions()[0].getOperand().str), textOptions);
 	}
-	else if (value.instructions[0].isEnum())
+	else if (value.getInstructions()[0].isEnum())
 	{
 		QStyleOptionComboBox comboBox;
-		comboBox.currentText = QString::fromStdString(value.instructions[0].getOperand().str);
+		comboBox.currentText = QString::fromStdString(value.getInstructions()[0].getOperand().str);
 		comboBox.editable = false;
 		comboBox.state = option.state;
 		comboBox.state |= QStyle::State_Enabled;
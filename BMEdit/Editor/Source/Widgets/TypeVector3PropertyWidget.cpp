@@ -21,14 +21,14 @@ void TypeVector3PropertyWidget::buildLayout(const types::QGlacierValue &value)
 {
 	auto layout = new QHBoxLayout(this);
 
-	switch (value.instructions[1].getOpCode())
+	switch (value.getInstructions()[1].getOpCode())
 	{
 		case PRPOpCode::Int8:
 		case PRPOpCode::NamedInt8:
 	    {
 		    auto onValueChanged = [this](int entryIdx, int8_t newValue)
 		    {
-			    m_value.instructions[entryIdx] = PRPInstruction(m_value.instructions[entryIdx].getOpCode(), PRPOperandVal(newValue));
+			    m_value.getMutableInstructions()[entryIdx] = PRPInstruction(m_value.getInstructions()[entryIdx].getOpCode(), PRPOperandVal(newValue));
 			    valueChanged();
 		    };
 
@@ -42,7 +42,7 @@ void TypeVector3PropertyWidget::buildLayout(const types::QGlacierValue &value)
 	    {
 		    auto onValueChanged = [this](int entryIdx, int16_t newValue)
 		    {
-			    m_value.instructions[entryIdx] = PRPInstruction(m_value.instructions[entryIdx].getOpCode(), PRPOperandVal(newValue));
+			    m_value.getMutableInstructions()[entryIdx] = PRPInstruction(m_value.getInstructions()[entryIdx].getOpCode(), PRPOperandVal(newValue));
 			    valueChanged();
 		    };
 
@@ -56,7 +56,7 @@ void TypeVector3PropertyWidget::buildLayout(const types::QGlacierValue &value)
 	    {
 		    auto onValueChanged = [this](int entryIdx, int32_t newValue)
 		    {
-			    m_value.instructions[entryIdx] = PRPInstruction(m_value.instructions[entryIdx].getOpCode(), PRPOperandVal(newValue));
+			    m_value.getMutableInstructions()[entryIdx] = PRPInstruction(m_value.getInstructions()[entryIdx].getOpCode(), PRPOperandVal(newValue));
 			    valueChanged();
 		    };
 
@@ -70,7 +70,7 @@ void TypeVector3PropertyWidget::buildLayout(const types::QGlacierValue &value)
 	    {
 		    auto onValueChanged = [this](int entryIdx, float newValue)
 		    {
-			    m_value.instructions[entryIdx] = PRPInstruction(m_value.instructions[entryIdx].getOpCode(), PRPOperandVal(newValue));
+			    m_value.getMutableInstructions()[entryIdx] = PRPInstruction(m_value.getInstructions()[entryIdx].getOpCode(), PRPOperandVal(newValue));
 			    valueChanged();
 		    };
 
@@ -84,7 +84,7 @@ void TypeVector3PropertyWidget::buildLayout(const types::QGlacierValue &value)
 	    {
 		    auto onValueChanged = [this](int entryIdx, double newValue)
 		    {
-			    m_value.instructions[entryIdx] = PRPInstruction(m_value.instructions[entryIdx].getOpCode(), PRPOperandVal(newValue));
+			    m_value.getMutableInstructions()[entryIdx] = PRPInstruction(m_value.getInstructions()[entryIdx].getOpCode(), PRPOperandVal(newValue));
 			    valueChanged();
 		    };
 
@@ -102,7 +102,7 @@ void TypeVector3PropertyWidget::buildLayout(const types::QGlacierValue &value)
 
 void TypeVector3PropertyWidget::updateLayout(const types::QGlacierValue &value)
 {
-	switch (value.instructions[1].getOpCode())
+	switch (value.getInstructions()[1].getOpCode())
 	{
 	case PRPOpCode::Int8:
 	case PRPOpCode::NamedInt8:
@@ -157,11 +157,11 @@ void TypeVector3PropertyWidget::paintPreview(QPainter *painter, const QStyleOpti
 
 	QString text;
 	const QString format("(%1; %2; %3)");
-	const auto& x = data.instructions[1].getOperand();
-	const auto& y = data.instructions[2].getOperand();
-	const auto& z = data.instructions[3].getOperand();
+	const auto& x = data.getInstructions()[1].getOperand();
+	const auto& y = data.getInstructions()[2].getOperand();
+	const auto& z = data.getInstructions()[3].getOperand();
 
-	switch (data.instructions[1].getOpCode())
+	switch (data.getInstructions()[1].getOpCode())
 	{
 		case PRPOpCode::Int8:
 		case PRPOpCode::NamedInt8:
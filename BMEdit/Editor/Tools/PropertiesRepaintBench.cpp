@@ -0,0 +1,179 @@
+#include <Models/ValueModelBase.h>
+#include <Delegates/TypePropertyItemDelegate.h>
+#include <Types/QGlacierValue.h>
+#include <GameLib/Value.h>
+
+#include <QElapsedTimer>
+#include <QApplication>
+#include <QHeaderView>
+#include <QTableView>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstdio>
+#include <limits>
+#include <new>
+#include <string>
+
+
+namespace
+{
+	std::atomic<std::size_t> g_allocationsCount { 0 };
+
+	double toMilliseconds(qint64 nanoseconds)
+	{
+		return static_cast<double>(nanoseconds) / 1'000'000.0;
+	}
+
+	/**
+	 * Build value which looks like properties of big actor: numbers, flags, strings and vectors
+	 */
+	gamelib::Value makeActorProperties(int propertiesCount)
+	{
+		using gamelib::prp::PRPInstruction;
+		using gamelib::prp::PRPOperandVal;
+		using gamelib::prp::PRPOpCode;
+
+		gamelib::Value result;
+
+		for (int i = 0; i < propertiesCount; ++i)
+		{
+			const std::string name = "Property" + std::to_string(i);
+			std::vector<PRPInstruction> instructions;
+			PRPOpCode viewType = PRPOpCode::Int32;
+
+			switch (i % 4)
+			{
+				case 0:
+					instructions.emplace_back(PRPOpCode::Int32, PRPOperandVal(static_cast<int32_t>(i)));
+					viewType = PRPOpCode::Int32;
+					break;
+				case 1:
+					instructions.emplace_back(PRPOpCode::Bool, PRPOperandVal((i & 2) != 0));
+					viewType = PRPOpCode::Bool;
+					break;
+				case 2:
+					instructions.emplace_back(PRPOpCode::String, PRPOperandVal(std::string("Value of ") + name));
+					viewType = PRPOpCode::String;
+					break;
+				default:
+					instructions.emplace_back(PRPOpCode::Array, PRPOperandVal(static_cast<int32_t>(3)));
+					instructions.emplace_back(PRPOpCode::Float32, PRPOperandVal(static_cast<float>(i)));
+					instructions.emplace_back(PRPOpCode::Float32, PRPOperandVal(static_cast<float>(i) * 0.5f));
+					instructions.emplace_back(PRPOpCode::Float32, PRPOperandVal(static_cast<float>(i) * 0.25f));
+					instructions.emplace_back(PRPOpCode::EndArray);
+					viewType = PRPOpCode::Array;
+					break;
+			}
+
+			std::vector<gamelib::ValueView> views { gamelib::ValueView(name, viewType, nullptr) };
+			result += std::make_pair(name, gamelib::Value(nullptr, std::move(instructions), std::move(views)));
+		}
+
+		return result;
+	}
+
+	/**
+	 * Ask model for each VALUE cell (the same requests delegate does on paint)
+	 * @return count of allocations
+	 */
+	std::size_t queryValues(const QAbstractItemModel &model)
+	{
+		const std::size_t allocationsBefore = g_allocationsCount.load();
+
+		for (int row = 0; row < model.rowCount(QModelIndex {}); ++row)
+		{
+			const QVariant value = model.index(row, 1).data(Qt::EditRole);
+			const auto glacierValue = value.value<types::QGlacierValue>();
+
+			if (glacierValue.getInstructions().empty())
+			{
+				std::abort();
+			}
+		}
+
+		return g_allocationsCount.load() - allocationsBefore;
+	}
+}
+
+void* operator new(std::size_t size)
+{
+	++g_allocationsCount;
+
+	if (void *ptr = std::malloc(size ? size : 1))
+	{
+		return ptr;
+	}
+
+	throw std::bad_alloc {};
+}
+
+void operator delete(void *ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+
+int main(int argc, char** argv)
+{
+	const int propertiesCount = argc > 1 ? std::max(1, std::atoi(argv[1])) : 500;
+	const int iterations = argc > 2 ? std::max(1, std::atoi(argv[2])) : 10;
+
+	QApplication app(argc, argv);
+
+	gamelib::Value properties = makeActorProperties(propertiesCount);
+
+	models::ValueModelBase model;
+	model.setValue(&properties);
+
+	QElapsedTimer timer;
+
+	// First pass makes buffers of entries, next passes must share them
+	timer.start();
+	const std::size_t coldAllocations = queryValues(model);
+	const qint64 coldTime = timer.nsecsElapsed();
+
+	std::size_t warmAllocations = 0;
+	qint64 bestWarmTime = std::numeric_limits<qint64>::max();
+
+	for (int iteration = 0; iteration < iterations; ++iteration)
+	{
+		timer.restart();
+		warmAllocations = queryValues(model);
+		bestWarmTime = std::min(bestWarmTime, timer.nsecsElapsed());
+	}
+
+	printf("data(EditRole), %d properties: first pass %.3f ms (%zu allocations), best of %d: %.3f ms (%.1f ns, %.2f allocations per cell)\n",
+		   propertiesCount, toMilliseconds(coldTime), coldAllocations, iterations, toMilliseconds(bestWarmTime),
+		   static_cast<double>(bestWarmTime) / propertiesCount, static_cast<double>(warmAllocations) / propertiesCount);
+
+	// Repaint whole grid (view is tall enough to show each row)
+	QTableView view;
+	delegates::TypePropertyItemDelegate delegate;
+	view.setModel(&model);
+	view.setItemDelegateForColumn(1, &delegate);
+	view.horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+	view.resize(600, view.verticalHeader()->defaultSectionSize() * propertiesCount + view.horizontalHeader()->height() + 8);
+	view.show();
+	QApplication::processEvents();
+
+	qint64 bestRepaintTime = std::numeric_limits<qint64>::max();
+
+	for (int iteration = 0; iteration < iterations; ++iteration)
+	{
+		timer.restart();
+		view.viewport()->repaint();
+		bestRepaintTime = std::min(bestRepaintTime, timer.nsecsElapsed());
+	}
+
+	printf("QTableView repaint, %d rows: best of %d: %.2f ms (%.1f us per row)\n",
+		   propertiesCount, iterations, toMilliseconds(bestRepaintTime), static_cast<double>(bestRepaintTime) / 1000.0 / propertiesCount);
+
+	return 0;
+}
\ No newline at end of file
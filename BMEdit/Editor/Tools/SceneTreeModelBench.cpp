@@ -0,0 +1,148 @@
+#include <Models/SceneObjectsTreeModel.h>
+#include <IO/ZIPLevelAssetProvider.h>
+#include <GameLib/Level.h>
+
+#include <QAbstractItemModelTester>
+#include <QElapsedTimer>
+#include <QApplication>
+#include <QTreeView>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <string_view>
+
+
+namespace
+{
+	struct WalkStats
+	{
+		std::size_t visited { 0 };
+		std::size_t mismatches { 0 }; ///< index(row, parent).parent() != parent
+	};
+
+	void walk(const QAbstractItemModel &model, const QModelIndex &parent, WalkStats &stats) // NOLINT(misc-no-recursion)
+	{
+		const int rowCount = model.rowCount(parent);
+
+		for (int row = 0; row < rowCount; ++row)
+		{
+			const QModelIndex child = model.index(row, 0, parent);
+			++stats.visited;
+
+			if (model.parent(child) != parent || child.row() != row)
+			{
+				++stats.mismatches;
+			}
+
+			walk(model, child, stats);
+		}
+	}
+
+	double toMilliseconds(qint64 nanoseconds)
+	{
+		return static_cast<double>(nanoseconds) / 1'000'000.0;
+	}
+}
+
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		printf("Usage: %s <level ZIP> [iterations] [--skip-model-test]\n", argv[0]);
+		return -1;
+	}
+
+	const std::string levelPath { argv[1] };
+	int iterations = 5;
+	bool runModelTest = true;
+
+	for (int i = 2; i < argc; ++i)
+	{
+		if (std::string_view(argv[i]) == "--skip-model-test")
+		{
+			runModelTest = false;
+		}
+		else
+		{
+			iterations = std::max(1, std::atoi(argv[i]));
+		}
+	}
+
+	QApplication app(argc, argv);
+
+	auto provider = std::make_unique<editor::ZIPLevelAssetProvider>(levelPath);
+	if (!provider->isValid())
+	{
+		printf("Invalid ZIP file %s\n", levelPath.c_str());
+		return -1;
+	}
+
+	gamelib::Level level { std::move(provider) };
+
+	QElapsedTimer timer;
+	timer.start();
+
+	if (!level.loadSceneData())
+	{
+		printf("Unable to load scene data of %s\n", levelPath.c_str());
+		return -1;
+	}
+
+	printf("Level %s: %zu scene objects, loaded in %.2f ms\n", level.getLevelName().c_str(), level.getSceneObjects().size(), toMilliseconds(timer.nsecsElapsed()));
+
+	models::SceneObjectsTreeModel model { &level };
+
+	if (runModelTest)
+	{
+		// Checks consistency of index/parent/rowCount on each node (fatal on failure)
+		timer.restart();
+		QAbstractItemModelTester tester { &model, QAbstractItemModelTester::FailureReportingMode::Fatal };
+		printf("QAbstractItemModelTester: passed in %.2f ms\n", toMilliseconds(timer.nsecsElapsed()));
+	}
+
+	// Walk over whole tree through the model API (the same calls view does while expanding & scrolling)
+	WalkStats stats;
+	qint64 bestWalkTime = std::numeric_limits<qint64>::max();
+
+	for (int iteration = 0; iteration < iterations; ++iteration)
+	{
+		stats = {};
+		timer.restart();
+		walk(model, QModelIndex {}, stats);
+		bestWalkTime = std::min(bestWalkTime, timer.nsecsElapsed());
+	}
+
+	printf("Walk: %zu nodes, %zu mismatches, best of %d: %.2f ms (%.1f ns per node)\n",
+		   stats.visited, stats.mismatches, iterations, toMilliseconds(bestWalkTime),
+		   stats.visited ? static_cast<double>(bestWalkTime) / static_cast<double>(stats.visited) : 0.0);
+
+	// Expand whole tree in real view
+	QTreeView view;
+	view.setUniformRowHeights(true);
+	view.setModel(&model);
+	view.resize(600, 800);
+	view.show();
+	QApplication::processEvents();
+
+	qint64 bestExpandTime = std::numeric_limits<qint64>::max();
+
+	for (int iteration = 0; iteration < iterations; ++iteration)
+	{
+		view.collapseAll();
+		QApplication::processEvents();
+
+		timer.restart();
+		view.expandAll();
+		view.scrollToBottom();
+		QApplication::processEvents();
+		bestExpandTime = std::min(bestExpandTime, timer.nsecsElapsed());
+	}
+
+	printf("QTreeView::expandAll: best of %d: %.2f ms\n", iterations, toMilliseconds(bestExpandTime));
+
+	return stats.mismatches ? 1 : 0;
+}
\ No newline at end of file
@@ -54,6 +54,8 @@ private:
 	void connectEditorSignals();
 	void loadTypesDataBase();
 	void resetStatusToDefault();
+	void updateUndoRedoActions();
+	void updateLoadProfileSummary();
 	void initSceneTree();
 	void initProperties();
 	void initSceneProperties();
@@ -67,6 +69,7 @@ public slots:
 	void onOpenLevel();
 	void onRestoreLayout();
 	void onShowTypesViewer();
+	void onShowMemoryReport();
 	void onLevelLoadSuccess();
 	void onLevelLoadFailed(const QString &reason);
 	void onLevelLoadProgressChanged(int totalPercentsProgress, const QString &currentOperationTag);
@@ -89,6 +92,7 @@ private:
     QLabel* m_operationLabel;
     QLabel* m_operationCommentLabel;
     QProgressBar* m_operationProgress;
+	QLabel* m_loadProfileLabel { nullptr };
 
 	// Models
 	QStringListModel *m_geomTypesModel { nullptr };
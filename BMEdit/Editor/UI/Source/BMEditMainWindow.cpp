@@ -12,6 +12,7 @@
 
 #include <GameLib/TypeRegistry.h>
 #include <GameLib/TypeNotFoundException.h>
+#include <GameLib/Profiler.h>
 
 #include <Editor/EditorInstance.h>
 
@@ -26,6 +27,7 @@
 #include <Delegates/ScenePropertyTypeDelegate.h>
 
 #include <Widgets/GeomControllersWidget.h>
+#include <Widgets/SceneQueryWidget.h>
 #include <Types/QCustomRoles.h>
 
 #include <LoadSceneProgressDialog.h>
@@ -76,6 +78,7 @@ BMEditMainWindow::~BMEditMainWindow()
 	delete m_operationProgress;
 	delete m_operationLabel;
 	delete m_operationCommentLabel;
+	delete m_loadProfileLabel;
 	delete ui;
 }
 
@@ -84,12 +87,14 @@ void BMEditMainWindow::initStatusBar()
 	m_operationProgress = new QProgressBar(statusBar());
 	m_operationLabel = new QLabel(statusBar());
 	m_operationCommentLabel = new QLabel(statusBar());
+	m_loadProfileLabel = new QLabel(statusBar());
 
 	resetStatusToDefault();
 
 	statusBar()->insertWidget(0, m_operationLabel);
 	statusBar()->insertWidget(1, m_operationProgress);
 	statusBar()->insertWidget(2, m_operationCommentLabel);
+	statusBar()->addPermanentWidget(m_loadProfileLabel);
 }
 
 void BMEditMainWindow::initSearchInput()
@@ -103,8 +108,11 @@ void BMEditMainWindow::connectActions()
 	connect(ui->actionOpen_level, &QAction::triggered, [=]() { onOpenLevel(); });
 	connect(ui->actionRestore_layout, &QAction::triggered, [=]() { onRestoreLayout(); });
 	connect(ui->actionTypes_Viewer, &QAction::triggered, [=]() { onShowTypesViewer(); });
+	connect(ui->actionMemory_report, &QAction::triggered, [=]() { onShowMemoryReport(); });
 	connect(ui->actionSave_properties, &QAction::triggered, [=]() { onExportProperties(); });
 	connect(ui->actionExport_PRP_properties, &QAction::triggered, [=]() { onExportPRP(); });
+	connect(ui->actionUndo, &QAction::triggered, [=]() { editor::EditorInstance::getInstance().undo(); updateUndoRedoActions(); });
+	connect(ui->actionRedo, &QAction::triggered, [=]() { editor::EditorInstance::getInstance().redo(); updateUndoRedoActions(); });
 }
 
 void BMEditMainWindow::connectDockWidgetActions()
@@ -165,6 +173,7 @@ void BMEditMainWindow::connectEditorSignals()
 	connect(&instance, &EditorInstance::levelLoadFailed, [=](const QString &reason) { onLevelLoadFailed(reason); });
 	connect(&instance, &EditorInstance::exportAssetSuccess, [=](gamelib::io::AssetKind assetKind, const QString &assetName) { onAssetExportedSuccessfully(assetKind, assetName); });
 	connect(&instance, &EditorInstance::exportAssetFailed, [=](const QString &reason) { onAssetExportFailed(reason); });
+	connect(&instance, &EditorInstance::entryChanged, [=]() { updateUndoRedoActions(); });
 }
 
 void BMEditMainWindow::onExit()
@@ -204,12 +213,49 @@ void BMEditMainWindow::onShowTypesViewer()
 	viewerWindow.exec();
 }
 
+void BMEditMainWindow::onShowMemoryReport()
+{
+	auto currentLevel = editor::EditorInstance::getInstance().getActiveLevel();
+	if (!currentLevel)
+	{
+		return;
+	}
+
+	const auto report = currentLevel->memoryReport();
+
+	auto formatBytes = [](std::size_t bytes) -> QString
+	{
+		return QString("%1 KiB").arg(static_cast<double>(bytes) / 1024.0, 0, 'f', 1);
+	};
+
+	QString table = "<table><tr><th align=\"left\">Category</th><th>Size</th><th>Allocations</th></tr>";
+
+	for (int category = 0; category < static_cast<int>(gamelib::MemoryCategory::LAST_CATEGORY); ++category)
+	{
+		const auto memoryCategory = static_cast<gamelib::MemoryCategory>(category);
+		const auto &usage = report.get(memoryCategory);
+
+		table += QString("<tr><td>%1</td><td align=\"right\">%2</td><td align=\"right\">%3</td></tr>")
+		             .arg(gamelib::MemoryReport::getCategoryName(memoryCategory))
+		             .arg(formatBytes(usage.bytes))
+		             .arg(usage.allocations);
+	}
+
+	const auto total = report.getTotal();
+	table += QString("<tr><td><b>Total</b></td><td align=\"right\"><b>%1</b></td><td align=\"right\"><b>%2</b></td></tr></table>")
+	             .arg(formatBytes(total.bytes))
+	             .arg(total.allocations);
+
+	QMessageBox::information(this, QString("Memory report: %1").arg(QString::fromStdString(currentLevel->getLevelName())), table);
+}
+
 void BMEditMainWindow::onLevelLoadSuccess()
 {
 	auto currentLevel = editor::EditorInstance::getInstance().getActiveLevel();
 	setWindowTitle(QString("BMEdit - %1").arg(QString::fromStdString(currentLevel->getLevelName())));
 
 	resetStatusToDefault();
+	updateLoadProfileSummary();
 
 	// Level loaded, show objects tree
 	ui->searchInputField->clear();
@@ -219,6 +265,13 @@ void BMEditMainWindow::onLevelLoadSuccess()
 		m_sceneTreeModel->setLevel(currentLevel);
 	}
 
+	if (m_sceneTreeFilterModel)
+	{
+		m_sceneTreeFilterModel->setLevel(currentLevel);
+	}
+
+	ui->sceneQuery->setLevel(currentLevel);
+
 	if (m_sceneObjectPropertiesModel)
 	{
 		m_sceneObjectPropertiesModel->setLevel(currentLevel);
@@ -247,6 +300,8 @@ void BMEditMainWindow::onLevelLoadSuccess()
 	// Export action
 	ui->menuExport->setEnabled(true);
 	ui->actionExport_PRP_properties->setEnabled(true);
+	updateUndoRedoActions();
+	ui->actionMemory_report->setEnabled(true);
 
 	//ui->actionSave_properties->setEnabled(true); //TODO: Uncomment when exporter to ZIP will be done
 	ui->searchInputField->setEnabled(true);
@@ -345,6 +400,7 @@ void BMEditMainWindow::onCloseLevel()
 {
 	// Cleanup models
 	if (m_sceneTreeModel) m_sceneTreeModel->resetLevel();
+	if (m_sceneTreeFilterModel) m_sceneTreeFilterModel->resetLevel();
 	if (m_sceneObjectPropertiesModel) m_sceneObjectPropertiesModel->resetLevel();
 	if (m_scenePropertiesModel) m_scenePropertiesModel->resetLevel();
 	if (m_scenePrimitivesModel) m_scenePrimitivesModel->resetLevel();
@@ -357,10 +413,16 @@ void BMEditMainWindow::onCloseLevel()
 
 	// Reset widget states
 	ui->geomControllers->resetGeom();
+	ui->sceneQuery->resetLevel();
+	m_loadProfileLabel->clear();
+	m_loadProfileLabel->setToolTip(QString());
 
 	// Reset export menu
 	ui->menuExport->setEnabled(false);
 	ui->actionExport_PRP_properties->setEnabled(false);
+	ui->actionUndo->setEnabled(false);
+	ui->actionRedo->setEnabled(false);
+	ui->actionMemory_report->setEnabled(false);
 
 	// Reset primitives counter
 	ui->primitivesCountLabel->setText("0");
@@ -569,6 +631,71 @@ void BMEditMainWindow::resetStatusToDefault()
 	m_operationProgress->setValue(0);
 }
 
+void BMEditMainWindow::updateUndoRedoActions()
+{
+	const auto &journal = editor::EditorInstance::getInstance().getEditJournal();
+
+	ui->actionUndo->setEnabled(journal.canUndo());
+	ui->actionRedo->setEnabled(journal.canRedo());
+}
+
+void BMEditMainWindow::updateLoadProfileSummary()
+{
+	const auto summary = gamelib::Profiler::getInstance().getSummary();
+	if (summary.empty())
+	{
+		m_loadProfileLabel->clear();
+		m_loadProfileLabel->setToolTip(QString());
+		return;
+	}
+
+	// Short form: total time and 3 slowest phases, whole table goes to tooltip
+	constexpr int kPhasesInStatusBar = 3;
+	constexpr const char *kTotalScopeName = "Level::loadSceneData";
+	constexpr const char *kSnapshotTotalScopeName = "Level::loadSceneData (snapshot cache)";
+
+	double totalMs = 0.0;
+	QStringList slowestPhases;
+	QString table = "<table><tr><th align=\"left\">Scope / Counter</th><th>Calls</th><th>Total</th><th>Max</th></tr>";
+
+	for (const auto &entry : summary)
+	{
+		const QString name = QString::fromStdString(entry.name).toHtmlEscaped();
+
+		if (entry.isCounter)
+		{
+			table += QString("<tr><td>%1</td><td align=\"right\">%2</td><td align=\"right\">%3</td><td></td></tr>").arg(name).arg(entry.callsCount).arg(entry.total);
+			continue;
+		}
+
+		table += QString("<tr><td>%1</td><td align=\"right\">%2</td><td align=\"right\">%3 ms</td><td align=\"right\">%4 ms</td></tr>")
+		             .arg(name).arg(entry.callsCount).arg(entry.totalMs, 0, 'f', 1).arg(entry.maxMs, 0, 'f', 1);
+
+		if (entry.name == kTotalScopeName || entry.name == kSnapshotTotalScopeName)
+		{
+			totalMs = std::max(totalMs, entry.totalMs);
+		}
+		else if (slowestPhases.size() < kPhasesInStatusBar)
+		{
+			slowestPhases.append(QString("%1 %2 ms").arg(QString::fromStdString(entry.name)).arg(entry.totalMs, 0, 'f', 0));
+		}
+	}
+
+	table += "</table>";
+
+	const QString &tracePath = editor::EditorInstance::getInstance().getLastLoadTracePath();
+	if (!tracePath.isEmpty())
+	{
+		table += QString("<br/>Chrome trace: %1").arg(QDir::toNativeSeparators(tracePath).toHtmlEscaped());
+	}
+
+	const auto *level = editor::EditorInstance::getInstance().getActiveLevel();
+	const QString loadedFrom = (level && level->isLoadedFromSnapshot()) ? QString(" from snapshot") : QString();
+
+	m_loadProfileLabel->setText(QString("Loaded%1 in %2 ms (%3)").arg(loadedFrom).arg(totalMs, 0, 'f', 0).arg(slowestPhases.join(", ")));
+	m_loadProfileLabel->setToolTip(table);
+}
+
 void BMEditMainWindow::initSceneTree()
 {
 	// Main model
@@ -599,6 +726,7 @@ void BMEditMainWindow::initSceneTree()
 	});
 
 	connect(ui->sceneTreeView, &QTreeView::customContextMenuRequested, this, &BMEditMainWindow::onContextMenuRequestedForSceneTreeNode);
+	connect(ui->sceneQuery, &widgets::SceneQueryWidget::sceneObjectSelected, [=](const gamelib::scene::SceneObject *sceneObject) { onSelectedSceneObject(sceneObject); });
 }
 
 void BMEditMainWindow::initProperties()
@@ -640,6 +768,7 @@ void BMEditMainWindow::initScenePrimitives()
 	ui->scenePrimitivesTable->setSelectionMode(QAbstractItemView::SingleSelection);
 	ui->scenePrimitivesTable->horizontalHeader()->setContextMenuPolicy(Qt::CustomContextMenu);
 	ui->scenePrimitivesTable->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeMode::Stretch);
+	ui->scenePrimitivesTable->setIconSize(QSize(32, 32));
 
 	connect(ui->scenePrimitivesTable->selectionModel(), &QItemSelectionModel::selectionChanged, [=](const QItemSelection &selected, const QItemSelection &deselected) {
 		if ((selected.indexes().size() == 1 && selected.indexes().at(0).row() != 0) || (!selected.indexes().empty()))
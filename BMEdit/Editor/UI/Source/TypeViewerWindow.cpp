@@ -11,6 +11,8 @@
 #include <GameLib/TypeEnum.h>
 #include <GameLib/Type.h>
 
+#include <set>
+
 
 
 TypeViewerWindow::TypeViewerWindow(QWidget *parent) :
@@ -31,7 +33,8 @@ TypeViewerWindow::TypeViewerWindow(QWidget *parent) :
 	///--------------------------------------
 	/// INIT WIDGETS
 	///--------------------------------------
-	ui->typesListView->setModel(new QStringListModel(allAvailableTypes, this));
+	auto typesListModel = new QStringListModel(allAvailableTypes, this);
+	ui->typesListView->setModel(typesListModel);
 	ui->typesListView->setEditTriggers(QAbstractItemView::EditTrigger::NoEditTriggers);
 
 	ui->typePropertiesView->setModel(new models::TypePropertiesDataModel(this));
@@ -44,6 +47,34 @@ TypeViewerWindow::TypeViewerWindow(QWidget *parent) :
 	/// SIGNALS
 	///--------------------------------------
     connect(ui->closeButton, &QPushButton::clicked, [=]() { close(); });
+	connect(ui->propertySearchField, &QLineEdit::textChanged, [=](const QString &query) {
+		if (query.isEmpty())
+		{
+			typesListModel->setStringList(allAvailableTypes);
+			return;
+		}
+
+		// Show only types which declares matched properties
+		std::vector<const gamelib::ValueView *> properties;
+		gamelib::TypeRegistry::getInstance().findProperties(query.toStdString(), properties);
+
+		std::set<std::string> declaredAt;
+		for (const auto *property: properties)
+		{
+			if (property->getOwnerType())
+			{
+				declaredAt.insert(property->getOwnerType()->getName());
+			}
+		}
+
+		QStringList foundTypes;
+		for (const auto &typeName: declaredAt)
+		{
+			foundTypes.push_back(QString::fromStdString(typeName));
+		}
+
+		typesListModel->setStringList(foundTypes);
+	});
     connect(ui->typesListView, &QListView::activated, [=](const QModelIndex &newIndex) {
     	auto model = reinterpret_cast<models::TypePropertiesDataModel *>(ui->typePropertiesView->model());
 
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <GameLib/IO/IOLevelAssetsProvider.h>
+#include <GameLib/PRP/PRPInstruction.h>
+#include <GameLib/PRP/PRPZDefines.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace bench
+{
+	/**
+	 * @brief Shape of generated level.
+	 * @details Scene is ROOT -> groupsCount groups (ZGROUP) -> objectsPerGroup objects (ZSyntheticObject).
+	 *          Every controllersInterval-th object has one controller (CSyntheticController), 0 - no controllers.
+	 *          Same options always produce same bytes.
+	 */
+	struct SyntheticLevelOptions
+	{
+		std::uint32_t groupsCount { 16 };
+		std::uint32_t objectsPerGroup { 64 };
+		std::uint32_t controllersInterval { 4 };
+		std::uint32_t primitivesCount { 256 };
+		bool isSceneCompressed { false };
+
+		[[nodiscard]] std::uint32_t getObjectsCount() const; ///< Count of scene objects including ROOT
+	};
+
+	/**
+	 * @brief Raw level assets
+	 */
+	struct SyntheticLevel
+	{
+		std::vector<uint8_t> properties {}; ///< PRP
+		std::vector<uint8_t> scene {};      ///< GMS
+		std::vector<uint8_t> buffer {};     ///< BUF
+		std::vector<uint8_t> geometry {};   ///< PRM
+	};
+
+	/**
+	 * @fn registerSyntheticTypes
+	 * @brief Replace contents of TypeRegistry by types which are used in synthetic levels
+	 */
+	void registerSyntheticTypes();
+
+	/**
+	 * @fn generatePRPInstructions
+	 * @brief Generate properties of whole scene (objects in DFS order, like the game stores them)
+	 */
+	void generatePRPInstructions(const SyntheticLevelOptions &options, std::vector<gamelib::prp::PRPInstruction> &instructions);
+
+	/**
+	 * @fn generatePRPDefinitions
+	 */
+	[[nodiscard]] gamelib::prp::PRPZDefines generatePRPDefinitions();
+
+	/**
+	 * @fn generatePRPFile
+	 * @note Token table is always presented (non raw PRP)
+	 */
+	[[nodiscard]] std::vector<uint8_t> generatePRPFile(const SyntheticLevelOptions &options);
+
+	/**
+	 * @fn generateGMSFile
+	 * @param options - level options (isSceneCompressed controls compression of GMS body)
+	 * @param buffer - BUF file with names of geoms
+	 * @return GMS file
+	 */
+	[[nodiscard]] std::vector<uint8_t> generateGMSFile(const SyntheticLevelOptions &options, std::vector<uint8_t> &buffer);
+
+	/**
+	 * @fn generatePRMFile
+	 * @brief Generate PRM file with zero chunk and primitivesCount triples (description, vertex buffer, index buffer).
+	 * @note Every 4th triple repeats buffers of the previous one (like the game levels do) to give some work to deduplication.
+	 */
+	[[nodiscard]] std::vector<uint8_t> generatePRMFile(std::uint32_t primitivesCount);
+
+	/**
+	 * @fn generateLevel
+	 */
+	[[nodiscard]] SyntheticLevel generateLevel(const SyntheticLevelOptions &options);
+
+	/**
+	 * @brief Read only assets provider over generated level (every getAsset call makes a copy, like ZIP provider does)
+	 */
+	class SyntheticLevelAssetsProvider : public gamelib::io::IOLevelAssetsProvider
+	{
+	public:
+		explicit SyntheticLevelAssetsProvider(const SyntheticLevel *level);
+
+		[[nodiscard]] const std::string &getLevelName() const override;
+		[[nodiscard]] std::unique_ptr<uint8_t[]> getAsset(gamelib::io::AssetKind kind, int64_t &bufferSize) const override;
+		[[nodiscard]] bool hasAssetOfKind(gamelib::io::AssetKind kind) const override;
+		bool saveAsset(gamelib::io::AssetKind kind, gamelib::Span<uint8_t> assetBody) override;
+		[[nodiscard]] bool isValid() const override;
+		[[nodiscard]] bool isEditable() const override;
+		[[nodiscard]] std::uint64_t getContentHash() const override;
+
+	private:
+		[[nodiscard]] const std::vector<uint8_t> *getAssetBody(gamelib::io::AssetKind kind) const;
+
+	private:
+		const SyntheticLevel *m_level { nullptr };
+		std::string m_levelName { "SyntheticLevel" };
+	};
+}
\ No newline at end of file
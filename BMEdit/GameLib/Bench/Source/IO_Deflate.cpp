@@ -0,0 +1,198 @@
+#include <benchmark/benchmark.h>
+
+#include <GameLib/IO/DeflateCodec.h>
+#include <stdexcept>
+#include <cstring>
+#include <vector>
+#include <zlib.h>
+
+// Usage
+using gamelib::Span;
+using gamelib::io::DeflateCodec;
+using gamelib::io::DeflateOptions;
+
+// Helpers
+namespace
+{
+	constexpr std::size_t kMegabyte = 1024u * 1024u;
+	constexpr std::size_t kStreamChunkSize = 64u * 1024u; // libzip reads entry by small chunks
+
+	/**
+	 * Entry like vertex buffer of PRM: records of positions (slowly changing floats), UVs & indices
+	 */
+	std::vector<uint8_t> makeEntry(std::size_t size)
+	{
+		struct Record
+		{
+			float position[3];
+			float uv[2];
+			std::uint16_t indices[6];
+		};
+
+		std::vector<uint8_t> entry(size);
+		std::uint32_t seed = 0xC0FFEEu;
+		Record record {};
+
+		for (std::size_t offset = 0; offset < size; offset += sizeof(Record))
+		{
+			seed = seed * 1103515245u + 12345u;
+
+			const auto recordIndex = static_cast<float>(offset / sizeof(Record));
+			record.position[0] = recordIndex * 0.25f;
+			record.position[1] = static_cast<float>((seed >> 16) & 0xFFu) * 0.125f;
+			record.position[2] = 1.0f;
+			record.uv[0] = static_cast<float>((seed >> 8) & 0x3u) * 0.5f;
+			record.uv[1] = 0.0f;
+
+			for (std::uint16_t index = 0; index < 6; ++index)
+			{
+				record.indices[index] = static_cast<std::uint16_t>(offset / sizeof(Record) + index);
+			}
+
+			std::memcpy(entry.data() + offset, &record, std::min(sizeof(Record), size - offset));
+		}
+
+		return entry;
+	}
+
+	std::vector<uint8_t> makeCompressedEntry(const std::vector<uint8_t> &entry)
+	{
+		std::vector<uint8_t> compressed;
+		std::uint32_t crc = 0;
+
+		if (!DeflateCodec::compress(Span(entry), compressed, crc))
+		{
+			throw std::runtime_error("Unable to deflate generated entry");
+		}
+
+		return compressed;
+	}
+}
+
+// Benchmarks
+/**
+ * Regular deflate of entry as single stream on one thread (the same as libzip does)
+ */
+static void IO_DeflateSingleStream(benchmark::State &state)
+{
+	const auto entry = makeEntry(static_cast<std::size_t>(state.range(0)) * kMegabyte);
+
+	DeflateOptions options;
+	options.blockSize = entry.size();
+	options.threadsCount = 1;
+
+	std::vector<uint8_t> compressed;
+	std::uint32_t crc = 0;
+
+	for (auto _ : state)
+	{
+		if (!DeflateCodec::compress(Span(entry), compressed, crc, options))
+		{
+			throw std::runtime_error("Unable to deflate generated entry");
+		}
+
+		benchmark::DoNotOptimize(compressed.data());
+	}
+
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(entry.size()));
+	state.counters["Ratio"] = static_cast<double>(entry.size()) / static_cast<double>(compressed.size());
+}
+
+static void IO_DeflateParallel(benchmark::State &state)
+{
+	const auto entry = makeEntry(static_cast<std::size_t>(state.range(0)) * kMegabyte);
+
+	std::vector<uint8_t> compressed;
+	std::uint32_t crc = 0;
+
+	for (auto _ : state)
+	{
+		if (!DeflateCodec::compress(Span(entry), compressed, crc))
+		{
+			throw std::runtime_error("Unable to deflate generated entry");
+		}
+
+		benchmark::DoNotOptimize(compressed.data());
+	}
+
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(entry.size()));
+	state.counters["Ratio"] = static_cast<double>(entry.size()) / static_cast<double>(compressed.size());
+}
+
+/**
+ * Inflate by small chunks into intermediate buffer (the same as zip_fread does)
+ */
+static void IO_InflateStream(benchmark::State &state)
+{
+	const auto entry = makeEntry(static_cast<std::size_t>(state.range(0)) * kMegabyte);
+	const auto compressed = makeCompressedEntry(entry);
+
+	std::vector<uint8_t> output(entry.size());
+	std::vector<uint8_t> chunk(kStreamChunkSize);
+
+	for (auto _ : state)
+	{
+		z_stream stream {};
+		if (inflateInit2(&stream, -15) != Z_OK)
+		{
+			throw std::runtime_error("Unable to init inflate stream");
+		}
+
+		stream.next_in = const_cast<uint8_t *>(compressed.data());
+		stream.avail_in = static_cast<uInt>(compressed.size());
+
+		std::size_t outputOffset = 0;
+		int status = Z_OK;
+
+		while (status == Z_OK)
+		{
+			stream.next_out = chunk.data();
+			stream.avail_out = static_cast<uInt>(chunk.size());
+			status = inflate(&stream, Z_NO_FLUSH);
+
+			const auto readyBytes = chunk.size() - stream.avail_out;
+			std::memcpy(output.data() + outputOffset, chunk.data(), readyBytes);
+			outputOffset += readyBytes;
+		}
+
+		inflateEnd(&stream);
+
+		if (status != Z_STREAM_END || outputOffset != output.size())
+		{
+			throw std::runtime_error("Unable to inflate generated entry");
+		}
+
+		benchmark::DoNotOptimize(output.data());
+	}
+
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(entry.size()));
+}
+
+/**
+ * Inflate at once into buffer of known size (+ CRC check, the same as ZIP provider does)
+ */
+static void IO_InflateAtOnce(benchmark::State &state)
+{
+	const auto entry = makeEntry(static_cast<std::size_t>(state.range(0)) * kMegabyte);
+	const auto compressed = makeCompressedEntry(entry);
+
+	std::vector<uint8_t> output(entry.size());
+
+	for (auto _ : state)
+	{
+		if (!DeflateCodec::decompress(Span(compressed), output.data(), output.size()))
+		{
+			throw std::runtime_error("Unable to inflate generated entry");
+		}
+
+		benchmark::DoNotOptimize(DeflateCodec::computeCRC32(Span(output)));
+	}
+
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(entry.size()));
+	state.SetLabel(DeflateCodec::getInflateBackendName());
+}
+
+BENCHMARK(IO_DeflateSingleStream)->Arg(64)->Arg(512)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(IO_DeflateParallel)->Arg(64)->Arg(512)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(IO_InflateStream)->Arg(64)->Arg(512)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(IO_InflateAtOnce)->Arg(64)->Arg(512)->Unit(benchmark::kMillisecond)->UseRealTime();
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include <benchmark/benchmark.h>
+
+#include <GameLib/GMS/GMSReader.h>
+#include <GameLib/LevelSnapshot.h>
+#include <GameLib/Level.h>
+#include <SyntheticLevel.h>
+#include <filesystem>
+#include <stdexcept>
+
+// Usage
+using gamelib::Level;
+using gamelib::LevelSnapshotCache;
+using gamelib::gms::GMSHeader;
+using gamelib::gms::GMSReader;
+using bench::SyntheticLevel;
+using bench::SyntheticLevelOptions;
+using bench::SyntheticLevelAssetsProvider;
+
+// Helpers
+namespace
+{
+	SyntheticLevelOptions makeOptions(const benchmark::State &state, bool isSceneCompressed)
+	{
+		SyntheticLevelOptions options;
+		options.groupsCount = static_cast<std::uint32_t>(state.range(0));
+		options.objectsPerGroup = static_cast<std::uint32_t>(state.range(1));
+		options.isSceneCompressed = isSceneCompressed;
+		return options;
+	}
+
+	void setObjectsCounter(benchmark::State &state, const SyntheticLevelOptions &options)
+	{
+		state.counters["Objects"] = benchmark::Counter(
+			static_cast<double>(options.getObjectsCount()) * static_cast<double>(state.iterations()),
+			benchmark::Counter::kIsRate);
+	}
+}
+
+// Benchmarks
+static void GMS_Read(benchmark::State &state, bool isSceneCompressed)
+{
+	const auto options = makeOptions(state, isSceneCompressed);
+	bench::registerSyntheticTypes();
+
+	std::vector<uint8_t> buffer;
+	const auto scene = bench::generateGMSFile(options, buffer);
+
+	for (auto _ : state)
+	{
+		GMSHeader header;
+		GMSReader reader;
+
+		if (!reader.parse(&header, scene.data(), static_cast<int64_t>(scene.size()), buffer.data(), static_cast<int64_t>(buffer.size())))
+		{
+			throw std::runtime_error("Unable to read generated GMS file");
+		}
+
+		benchmark::DoNotOptimize(header.getEntries().getGeomEntities().data());
+	}
+
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(scene.size() + buffer.size()));
+	setObjectsCounter(state, options);
+}
+
+/**
+ * Whole load path: PRP, GMS + BUF, scene objects & properties, PRM
+ */
+static void Level_LoadSceneData(benchmark::State &state, bool isSceneCompressed)
+{
+	auto options = makeOptions(state, isSceneCompressed);
+	options.primitivesCount = static_cast<std::uint32_t>(state.range(0) * 16);
+	bench::registerSyntheticTypes();
+
+	const SyntheticLevel level = bench::generateLevel(options);
+
+	for (auto _ : state)
+	{
+		Level instance { std::make_unique<SyntheticLevelAssetsProvider>(&level) };
+
+		if (!instance.loadSceneData())
+		{
+			throw std::runtime_error("Unable to load generated level");
+		}
+
+		benchmark::DoNotOptimize(instance.getSceneObjects().data());
+	}
+
+	const auto totalSize = level.properties.size() + level.scene.size() + level.buffer.size() + level.geometry.size();
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(totalSize));
+	setObjectsCounter(state, options);
+}
+
+/**
+ * Reopen of level from snapshot cache (snapshot is made before measurement)
+ */
+static void Level_LoadSnapshot(benchmark::State &state)
+{
+	auto options = makeOptions(state, false);
+	options.primitivesCount = static_cast<std::uint32_t>(state.range(0) * 16);
+	bench::registerSyntheticTypes();
+
+	const SyntheticLevel level = bench::generateLevel(options);
+	const auto cacheFolder = std::filesystem::temp_directory_path() / "GameLib_Bench_LevelSnapshots";
+	const LevelSnapshotCache snapshotCache { cacheFolder.string() };
+
+	{
+		Level instance { std::make_unique<SyntheticLevelAssetsProvider>(&level) };
+		if (!instance.loadSceneData() || !snapshotCache.save(instance))
+		{
+			throw std::runtime_error("Unable to make snapshot of generated level");
+		}
+	}
+
+	for (auto _ : state)
+	{
+		Level instance { std::make_unique<SyntheticLevelAssetsProvider>(&level) };
+
+		if (!snapshotCache.load(instance))
+		{
+			throw std::runtime_error("Unable to load snapshot of generated level");
+		}
+
+		benchmark::DoNotOptimize(instance.getSceneObjects().data());
+	}
+
+	std::filesystem::remove_all(cacheFolder);
+	setObjectsCounter(state, options);
+}
+
+BENCHMARK_CAPTURE(GMS_Read, Uncompressed, false)->Args({ 16, 64 })->Args({ 64, 256 });
+BENCHMARK_CAPTURE(GMS_Read, Compressed, true)->Args({ 16, 64 })->Args({ 64, 256 });
+BENCHMARK_CAPTURE(Level_LoadSceneData, Uncompressed, false)->Args({ 16, 64 })->Args({ 64, 256 })->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Level_LoadSceneData, Compressed, true)->Args({ 16, 64 })->Args({ 64, 256 })->Unit(benchmark::kMillisecond);
+BENCHMARK(Level_LoadSnapshot)->Args({ 16, 64 })->Args({ 64, 256 })->Unit(benchmark::kMillisecond);
\ No newline at end of file
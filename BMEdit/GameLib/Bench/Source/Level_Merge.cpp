@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+
+#include <GameLib/LevelMerge.h>
+#include <GameLib/LevelDiff.h>
+#include <GameLib/Level.h>
+#include <GameLib/Value.h>
+#include <SyntheticLevel.h>
+#include <stdexcept>
+#include <algorithm>
+#include <memory>
+
+// Usage
+using gamelib::Level;
+using gamelib::LevelDiff;
+using gamelib::LevelMerge;
+using gamelib::prp::PRPOpCode;
+using gamelib::prp::PRPOperandVal;
+using gamelib::prp::PRPInstruction;
+using bench::SyntheticLevel;
+using bench::SyntheticLevelOptions;
+using bench::SyntheticLevelAssetsProvider;
+
+// Helpers
+namespace
+{
+	std::unique_ptr<Level> loadLevel(const SyntheticLevel &level)
+	{
+		auto instance = std::make_unique<Level>(std::make_unique<SyntheticLevelAssetsProvider>(&level));
+		if (!instance->loadSceneData())
+		{
+			throw std::runtime_error("Unable to load generated level");
+		}
+
+		return instance;
+	}
+
+	/**
+	 * Change first Int32 property of each N-th object (like designer edits of the same level)
+	 */
+	void editObjects(Level &level, std::size_t step, std::int32_t seed)
+	{
+		const auto &objects = level.getSceneObjects();
+
+		for (std::size_t objectIndex = 1; objectIndex < objects.size(); objectIndex += step)
+		{
+			auto &value = objects[objectIndex]->getProperties();
+			auto &instructions = value.getInstructions();
+
+			auto it = std::find_if(instructions.begin(), instructions.end(), [](const PRPInstruction &instruction) { return instruction.getOpCode() == PRPOpCode::Int32; });
+			if (it != instructions.end())
+			{
+				*it = PRPInstruction(PRPOpCode::Int32, PRPOperandVal(static_cast<int32_t>(seed + objectIndex)));
+				value.markChanged();
+			}
+		}
+	}
+
+	SyntheticLevelOptions makeOptions(const benchmark::State &state)
+	{
+		SyntheticLevelOptions options;
+		options.groupsCount = static_cast<std::uint32_t>(state.range(0));
+		options.objectsPerGroup = static_cast<std::uint32_t>(state.range(1));
+		return options;
+	}
+}
+
+// Benchmarks
+static void Level_Diff(benchmark::State &state)
+{
+	const auto options = makeOptions(state);
+	bench::registerSyntheticTypes();
+
+	const SyntheticLevel level = bench::generateLevel(options);
+	const auto oldLevel = loadLevel(level);
+	const auto newLevel = loadLevel(level);
+	editObjects(*newLevel, 8, 1000);
+
+	for (auto _ : state)
+	{
+		const auto diff = LevelDiff::compare(*oldLevel, *newLevel);
+		benchmark::DoNotOptimize(diff.getObjects().data());
+	}
+
+	state.counters["Objects"] = benchmark::Counter(static_cast<double>(options.getObjectsCount()) * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+
+/**
+ * Merge of two edited copies of the same level (some objects are changed in both copies)
+ */
+static void Level_Merge(benchmark::State &state)
+{
+	const auto options = makeOptions(state);
+	bench::registerSyntheticTypes();
+
+	const SyntheticLevel level = bench::generateLevel(options);
+	const auto base = loadLevel(level);
+	const auto ours = loadLevel(level);
+	const auto theirs = loadLevel(level);
+	editObjects(*ours, 8, 1000);
+	editObjects(*theirs, 5, 2000);
+
+	for (auto _ : state)
+	{
+		const auto merge = LevelMerge::merge(*base, *ours, *theirs);
+		benchmark::DoNotOptimize(merge.getChanges().data());
+	}
+
+	state.counters["Objects"] = benchmark::Counter(static_cast<double>(options.getObjectsCount()) * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(Level_Diff)->Args({ 16, 64 })->Args({ 64, 256 })->Unit(benchmark::kMillisecond);
+BENCHMARK(Level_Merge)->Args({ 16, 64 })->Args({ 64, 256 })->Unit(benchmark::kMillisecond);
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+
+#include <GameLib/PRM/PRMReader.h>
+#include <GameLib/PRM/PRMWriter.h>
+#include <GameLib/PRM/PRMChunkIndex.h>
+#include <GameLib/Level.h>
+#include <SyntheticLevel.h>
+#include <stdexcept>
+#include <cstring>
+
+// Usage
+using gamelib::LevelGeometry;
+using gamelib::prm::PRMReader;
+using gamelib::prm::PRMWriter;
+using gamelib::prm::PRMWriterLayout;
+using gamelib::prm::PRMWriterOptions;
+using gamelib::prm::PRMChunkIndex;
+using bench::generatePRMFile;
+
+// Helpers
+namespace
+{
+	void readGeometry(std::vector<uint8_t> &file, LevelGeometry &geometry)
+	{
+		PRMReader reader { geometry.header, geometry.chunkDescriptors, geometry.chunks };
+		if (!reader.read(gamelib::Span<uint8_t>(file.data(), static_cast<int64_t>(file.size()))))
+		{
+			throw std::runtime_error("Unable to read generated PRM file");
+		}
+	}
+}
+
+// Benchmarks
+static void PRM_Read(benchmark::State &state)
+{
+	auto file = generatePRMFile(static_cast<std::uint32_t>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		LevelGeometry geometry;
+		readGeometry(file, geometry);
+		benchmark::DoNotOptimize(geometry.chunks.data());
+	}
+
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(file.size()));
+}
+
+static void PRM_Write(benchmark::State &state, PRMWriterLayout layout, bool isDeduplicated, bool isCompacted)
+{
+	auto file = generatePRMFile(static_cast<std::uint32_t>(state.range(0)));
+
+	LevelGeometry geometry;
+	readGeometry(file, geometry);
+
+	PRMChunkIndex index;
+	if (isDeduplicated)
+	{
+		index.build(geometry.chunks);
+	}
+
+	PRMWriterOptions options;
+	options.layout = layout;
+	options.compactUnusedChunks = isCompacted;
+	options.deduplicationIndex = isDeduplicated ? &index : nullptr;
+
+	std::vector<uint8_t> result;
+
+	for (auto _ : state)
+	{
+		PRMWriter::write(geometry.header, geometry.chunkDescriptors, geometry.chunks, options, result);
+		benchmark::DoNotOptimize(result.data());
+	}
+
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(file.size()));
+}
+
+static void PRM_BuildChunkIndex(benchmark::State &state)
+{
+	auto file = generatePRMFile(static_cast<std::uint32_t>(state.range(0)));
+
+	LevelGeometry geometry;
+	readGeometry(file, geometry);
+
+	for (auto _ : state)
+	{
+		PRMChunkIndex index;
+		index.build(geometry.chunks);
+		benchmark::DoNotOptimize(index.getReclaimableBytes());
+	}
+
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(file.size()));
+}
+
+BENCHMARK(PRM_Read)->Arg(256)->Arg(4096);
+BENCHMARK_CAPTURE(PRM_Write, PreserveOriginal, PRMWriterLayout::WL_PRESERVE_ORIGINAL, false, false)->Arg(256)->Arg(4096);
+BENCHMARK_CAPTURE(PRM_Write, Sequential, PRMWriterLayout::WL_SEQUENTIAL, false, false)->Arg(256)->Arg(4096);
+BENCHMARK_CAPTURE(PRM_Write, Deduplicated, PRMWriterLayout::WL_SEQUENTIAL, true, false)->Arg(256)->Arg(4096);
+BENCHMARK_CAPTURE(PRM_Write, DeduplicatedCompacted, PRMWriterLayout::WL_SEQUENTIAL, true, true)->Arg(256)->Arg(4096);
+BENCHMARK(PRM_BuildChunkIndex)->Arg(256)->Arg(4096);
\ No newline at end of file
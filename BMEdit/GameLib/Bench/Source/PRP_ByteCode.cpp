@@ -0,0 +1,142 @@
+#include <benchmark/benchmark.h>
+
+#include <GameLib/PRP/PRPReader.h>
+#include <GameLib/PRP/PRPWriter.h>
+#include <GameLib/TypeRegistry.h>
+#include <GameLib/Type.h>
+#include <SyntheticLevel.h>
+#include <stdexcept>
+
+// Usage
+using gamelib::Span;
+using gamelib::Type;
+using gamelib::TypeRegistry;
+using gamelib::prp::PRPOpCode;
+using gamelib::prp::PRPReader;
+using gamelib::prp::PRPWriter;
+using gamelib::prp::PRPByteCode;
+using gamelib::prp::PRPInstruction;
+using bench::SyntheticLevelOptions;
+
+// Helpers
+namespace
+{
+	SyntheticLevelOptions makeOptions(const benchmark::State &state)
+	{
+		SyntheticLevelOptions options;
+		options.groupsCount = static_cast<std::uint32_t>(state.range(0));
+		options.objectsPerGroup = static_cast<std::uint32_t>(state.range(1));
+		return options;
+	}
+
+	void setObjectsCounter(benchmark::State &state, const SyntheticLevelOptions &options)
+	{
+		state.counters["Objects"] = benchmark::Counter(
+			static_cast<double>(options.getObjectsCount()) * static_cast<double>(state.iterations()),
+			benchmark::Counter::kIsRate);
+	}
+}
+
+// Benchmarks
+static void PRP_ParseByteCode(benchmark::State &state)
+{
+	const auto options = makeOptions(state);
+	const auto file = bench::generatePRPFile(options);
+
+	PRPReader reader;
+	if (!reader.parse(file.data(), static_cast<int64_t>(file.size())))
+	{
+		throw std::runtime_error("Unable to read generated PRP file");
+	}
+
+	const auto offset = reader.getByteCodeOffset();
+
+	for (auto _ : state)
+	{
+		PRPByteCode byteCode;
+		benchmark::DoNotOptimize(byteCode.parse(&file[offset], static_cast<int64_t>(file.size()) - offset, &reader.getHeader(), &reader.getTokenTable()));
+	}
+
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * (static_cast<int64_t>(file.size()) - offset));
+	setObjectsCounter(state, options);
+}
+
+static void PRP_Write(benchmark::State &state)
+{
+	const auto options = makeOptions(state);
+	const auto definitions = bench::generatePRPDefinitions();
+
+	std::vector<PRPInstruction> instructions;
+	bench::generatePRPInstructions(options, instructions);
+
+	std::vector<uint8_t> result;
+
+	for (auto _ : state)
+	{
+		result.clear(); // Writer appends to buffer
+		PRPWriter::write(definitions, instructions, false, result);
+		benchmark::DoNotOptimize(result.data());
+	}
+
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(result.size()));
+	setObjectsCounter(state, options);
+}
+
+/**
+ * Map properties of every object (stage 1 of SceneObjectPropertiesLoader)
+ */
+static void PRP_MapObjects(benchmark::State &state)
+{
+	const auto options = makeOptions(state);
+	bench::registerSyntheticTypes();
+
+	const auto &registry = TypeRegistry::getInstance();
+	const Type *rootType = registry.findTypeByName("ZROOM");
+	const Type *groupType = registry.findTypeByName("ZGROUP");
+	const Type *objectType = registry.findTypeByName("ZSyntheticObject");
+
+	std::vector<PRPInstruction> instructions;
+	bench::generatePRPInstructions(options, instructions);
+
+	// Objects are stored in DFS order: ROOT, group, objects of group, next group...
+	std::vector<std::pair<const Type *, Span<PRPInstruction>>> objects;
+	objects.reserve(options.getObjectsCount());
+
+	for (size_t i = 0; i < instructions.size(); ++i)
+	{
+		const bool isController = i > 0 && instructions[i - 1].getOpCode() == PRPOpCode::String;
+		if (instructions[i].getOpCode() != PRPOpCode::BeginObject || isController)
+		{
+			continue;
+		}
+
+		const auto objectIndex = static_cast<std::uint32_t>(objects.size());
+		const Type *type = objectType;
+
+		if (objectIndex == 0)
+		{
+			type = rootType;
+		}
+		else if (((objectIndex - 1) % (options.objectsPerGroup + 1)) == 0)
+		{
+			type = groupType;
+		}
+
+		objects.emplace_back(type, Span<PRPInstruction>(&instructions[i + 1], static_cast<int64_t>(instructions.size() - i - 1)));
+	}
+
+	for (auto _ : state)
+	{
+		for (const auto &[type, ip] : objects)
+		{
+			auto [value, nextIP] = type->map(ip);
+			benchmark::DoNotOptimize(value);
+		}
+	}
+
+	setObjectsCounter(state, options);
+}
+
+BENCHMARK(PRP_ParseByteCode)->Args({ 16, 64 })->Args({ 64, 256 });
+BENCHMARK(PRP_Write)->Args({ 16, 64 })->Args({ 64, 256 });
+BENCHMARK(PRP_MapObjects)->Args({ 16, 64 })->Args({ 64, 256 });
\ No newline at end of file
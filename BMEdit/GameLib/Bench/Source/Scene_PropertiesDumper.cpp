@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include <GameLib/Scene/SceneObjectPropertiesDumper.h>
+#include <GameLib/PRP/PRPZDefines.h>
+#include <GameLib/TypeComplex.h>
+#include <string>
+
+// Usage
+using gamelib::Value;
+using gamelib::ValueView;
+using gamelib::TypeComplex;
+using gamelib::prp::PRPOpCode;
+using gamelib::prp::PRPZDefines;
+using gamelib::prp::PRPOperandVal;
+using gamelib::prp::PRPInstruction;
+using gamelib::prp::PRPDefinitionType;
+using gamelib::prp::StringRef;
+using gamelib::scene::SceneObject;
+using gamelib::scene::SceneObjectPropertiesDumper;
+
+// Helpers
+namespace
+{
+	constexpr int kGroupsCount = 200;
+	constexpr int kObjectsPerGroup = 100;
+	constexpr int kPropertiesCount = 32;
+
+	/**
+	 * Level-like scene: ROOT -> kGroupsCount groups -> kObjectsPerGroup objects, each object has kPropertiesCount properties (ints, floats & strings)
+	 */
+	struct LevelScene
+	{
+		std::unique_ptr<TypeComplex> geomType;
+		std::vector<SceneObject::Ptr> objects;
+		PRPZDefines definitions;
+
+		LevelScene()
+		{
+			geomType = std::make_unique<TypeComplex>("ZGEOM", std::vector<ValueView> {}, nullptr, true);
+			definitions.getDefinitions().emplace_back("DefaultName", PRPDefinitionType::StringRef_1, StringRef("Object"));
+
+			objects.reserve(1 + kGroupsCount * (kObjectsPerGroup + 1));
+
+			auto root = add("ROOT", nullptr);
+			for (int groupIndex = 0; groupIndex < kGroupsCount; ++groupIndex)
+			{
+				auto group = add("Group" + std::to_string(groupIndex), root);
+
+				for (int objectIndex = 0; objectIndex < kObjectsPerGroup; ++objectIndex)
+				{
+					add("Object" + std::to_string(groupIndex * kObjectsPerGroup + objectIndex), group);
+				}
+			}
+		}
+
+		SceneObject::Ptr add(const std::string &name, const SceneObject::Ptr &parent)
+		{
+			auto object = objects.emplace_back(std::make_shared<SceneObject>(name, 0u, geomType.get(), gamelib::gms::GMSGeomEntity {}, SceneObject::Instructions {}));
+
+			if (parent)
+			{
+				object->setParent(parent);
+				parent->addChild(object);
+			}
+
+			for (int i = 0; i < kPropertiesCount; ++i)
+			{
+				PRPInstruction instruction;
+
+				switch (i % 3)
+				{
+				case 0: instruction = PRPInstruction(PRPOpCode::Int32, PRPOperandVal(static_cast<int32_t>(i))); break;
+				case 1: instruction = PRPInstruction(PRPOpCode::Float32, PRPOperandVal(static_cast<float>(i) * 0.5f)); break;
+				default: instruction = PRPInstruction(PRPOpCode::String, PRPOperandVal(name)); break;
+				}
+
+				object->getProperties() += std::make_pair("Property" + std::to_string(i), Value(nullptr, { instruction }));
+			}
+
+			return object;
+		}
+	};
+}
+
+// Benchmarks
+static void Scene_EditPropertyAndExport(benchmark::State &state)
+{
+	// Arg: 1 - keep dumper between exports (incremental), 0 - new dumper for each export
+	LevelScene scene;
+	SceneObjectPropertiesDumper dumper;
+	std::vector<uint8_t> buffer;
+	dumper.dump(scene.objects, scene.definitions, false, &buffer);
+
+	float radius = 0.f;
+
+	for (auto _ : state)
+	{
+		auto &properties = scene.objects[scene.objects.size() / 2]->getProperties();
+		properties.getInstructions()[1] = PRPInstruction(PRPOpCode::Float32, PRPOperandVal(radius += 1.f));
+		properties.markChanged();
+
+		if (!state.range(0))
+		{
+			dumper.reset();
+		}
+
+		buffer.clear();
+		dumper.dump(scene.objects, scene.definitions, false, &buffer);
+		benchmark::DoNotOptimize(buffer.data());
+	}
+
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(buffer.size()));
+}
+
+BENCHMARK(Scene_EditPropertyAndExport)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
\ No newline at end of file
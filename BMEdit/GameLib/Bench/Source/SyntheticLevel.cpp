@@ -0,0 +1,473 @@
+#include <SyntheticLevel.h>
+
+#include <GameLib/PRP/PRPWriter.h>
+#include <GameLib/ContentHash.h>
+#include <GameLib/TypeRegistry.h>
+#include <nlohmann/json.hpp>
+#include <fmt/format.h>
+#include <unordered_map>
+#include <stdexcept>
+#include <cstring>
+#include <string>
+
+extern "C" {
+#include <zlib.h>
+}
+
+
+namespace bench
+{
+	using gamelib::prp::PRPOpCode;
+	using gamelib::prp::PRPOperandVal;
+	using gamelib::prp::PRPInstruction;
+	using gamelib::prp::PRPDefinitionType;
+	using gamelib::prp::StringRef;
+
+	namespace
+	{
+		constexpr std::uint32_t kRootTypeId = 0x100021u;
+		constexpr std::uint32_t kGroupTypeId = 0x100040u;
+		constexpr std::uint32_t kObjectTypeId = 0x100041u;
+
+		constexpr std::uint32_t kStringsVariety = 97u; ///< Strings repeats like in real levels (token table stays small)
+		constexpr std::uint32_t kAlignment = 0x10u;
+
+		// GMS layout
+		constexpr std::uint32_t kGMSHeaderSize = 0x50u;
+		constexpr std::uint32_t kGMSGeomDeclSize = 0x40u;
+		constexpr std::uint32_t kGMSClusterEntriesCount = 24u;
+		constexpr std::uint32_t kGeomIsRootOfGroup = 0x1000000u;
+		constexpr std::uint32_t kGeomRelativeDepthShift = 25u;
+
+		void writeU32(std::vector<uint8_t> &buffer, size_t offset, uint32_t value)
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				buffer[offset + i] = static_cast<uint8_t>((value >> (i * 8)) & 0xFFu);
+			}
+		}
+
+		void appendU32(std::vector<uint8_t> &buffer, uint32_t value)
+		{
+			buffer.resize(buffer.size() + 4, 0u);
+			writeU32(buffer, buffer.size() - 4, value);
+		}
+
+		nlohmann::json makeProperty(const std::string &name, const std::string &typeName)
+		{
+			return nlohmann::json { { "name", name }, { "typename", typeName } };
+		}
+
+		nlohmann::json makeComplexType(const std::string &typeName, const std::string &parentTypeName, std::vector<nlohmann::json> &&properties)
+		{
+			nlohmann::json declaration {
+				{ "typename", typeName },
+				{ "kind", "TypeKind.COMPLEX" },
+				{ "properties", std::move(properties) }
+			};
+
+			if (!parentTypeName.empty())
+			{
+				declaration["parent"] = parentTypeName;
+			}
+
+			return declaration;
+		}
+
+		std::string makeHash(std::uint32_t typeId)
+		{
+			return fmt::format("0x{:X}", typeId);
+		}
+
+		std::string makeString(const char *prefix, std::uint32_t index)
+		{
+			return prefix + std::to_string(index % kStringsVariety);
+		}
+
+		void emitGeomProperties(std::uint32_t objectIndex, std::vector<PRPInstruction> &instructions)
+		{
+			// ZGEOM: Position, IsInactive, PrimId
+			instructions.emplace_back(PRPOpCode::Array, PRPOperandVal(3));
+			instructions.emplace_back(PRPOpCode::Float32, PRPOperandVal(static_cast<float>(objectIndex) * 0.25f));
+			instructions.emplace_back(PRPOpCode::Float32, PRPOperandVal(static_cast<float>(objectIndex % 16u)));
+			instructions.emplace_back(PRPOpCode::Float32, PRPOperandVal(-static_cast<float>(objectIndex) * 0.5f));
+			instructions.emplace_back(PRPOpCode::EndArray);
+			instructions.emplace_back(PRPOpCode::Bool, PRPOperandVal((objectIndex % 5u) == 0u));
+			instructions.emplace_back(PRPOpCode::Int32, PRPOperandVal(static_cast<int32_t>(objectIndex)));
+		}
+
+		void emitObject(std::uint32_t objectIndex, std::uint32_t typeId, std::uint32_t controllersCount, std::uint32_t childrenCount, std::vector<PRPInstruction> &instructions)
+		{
+			instructions.emplace_back(PRPOpCode::BeginObject);
+			emitGeomProperties(objectIndex, instructions);
+
+			if (typeId == kRootTypeId)
+			{
+				instructions.emplace_back(PRPOpCode::Int32, PRPOperandVal(static_cast<int32_t>(0x7F7F7F)));
+			}
+			else if (typeId == kObjectTypeId)
+			{
+				instructions.emplace_back(PRPOpCode::Float32, PRPOperandVal(100.f - static_cast<float>(objectIndex % 100u)));
+				instructions.emplace_back(PRPOpCode::String, PRPOperandVal(makeString("Tag", objectIndex)));
+				instructions.emplace_back(PRPOpCode::Int32, PRPOperandVal(static_cast<int32_t>(objectIndex * 7u)));
+			}
+
+			instructions.emplace_back(PRPOpCode::EndObject);
+
+			instructions.emplace_back(PRPOpCode::Container, PRPOperandVal(static_cast<int32_t>(controllersCount)));
+			for (std::uint32_t controllerIndex = 0; controllerIndex < controllersCount; ++controllerIndex)
+			{
+				instructions.emplace_back(PRPOpCode::String, PRPOperandVal(std::string("SyntheticController")));
+				instructions.emplace_back(PRPOpCode::BeginObject);
+				instructions.emplace_back(PRPOpCode::Float32, PRPOperandVal(static_cast<float>(objectIndex % 10u) + 1.f));
+				instructions.emplace_back(PRPOpCode::String, PRPOperandVal(makeString("Target", objectIndex)));
+				instructions.emplace_back(PRPOpCode::Bool, PRPOperandVal(true));
+				instructions.emplace_back(PRPOpCode::EndObject);
+			}
+
+			instructions.emplace_back(PRPOpCode::Container, PRPOperandVal(static_cast<int32_t>(childrenCount)));
+		}
+
+		std::uint32_t getControllersCount(const SyntheticLevelOptions &options, std::uint32_t objectIndex)
+		{
+			return (options.controllersInterval && (objectIndex % options.controllersInterval) == 0u) ? 1u : 0u;
+		}
+
+		std::vector<uint8_t> compressRawDeflate(const std::vector<uint8_t> &body)
+		{
+			z_stream stream {};
+			if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+			{
+				throw std::runtime_error("Unable to init deflate stream");
+			}
+
+			std::vector<uint8_t> result(deflateBound(&stream, static_cast<uLong>(body.size())));
+
+			stream.next_in = const_cast<uint8_t *>(body.data());
+			stream.avail_in = static_cast<uInt>(body.size());
+			stream.next_out = result.data();
+			stream.avail_out = static_cast<uInt>(result.size());
+
+			const int status = deflate(&stream, Z_FINISH);
+			deflateEnd(&stream);
+
+			if (status != Z_STREAM_END)
+			{
+				throw std::runtime_error("Unable to compress GMS body");
+			}
+
+			result.resize(stream.total_out);
+			return result;
+		}
+	}
+
+	std::uint32_t SyntheticLevelOptions::getObjectsCount() const
+	{
+		return 1u + groupsCount * (1u + objectsPerGroup);
+	}
+
+	void registerSyntheticTypes()
+	{
+		std::vector<nlohmann::json> declarations;
+
+		declarations.push_back(nlohmann::json {
+			{ "typename", "ZVector3F" },
+			{ "kind", "TypeKind.ARRAY" },
+			{ "array", { { "expected_length", 3 }, { "inner_opcode_type", "PRPOpCode.Float32" } } }
+		});
+
+		declarations.push_back(makeComplexType("ZGEOM", "", {
+			makeProperty("Position", "ZVector3F"),
+			makeProperty("IsInactive", "PRPOpCode.Bool"),
+			makeProperty("PrimId", "PRPOpCode.Int32")
+		}));
+
+		declarations.push_back(makeComplexType("ZROOM", "ZGEOM", {
+			makeProperty("AmbientColor", "PRPOpCode.Int32")
+		}));
+
+		declarations.push_back(makeComplexType("ZGROUP", "ZGEOM", {}));
+
+		declarations.push_back(makeComplexType("ZSyntheticObject", "ZGEOM", {
+			makeProperty("Health", "PRPOpCode.Float32"),
+			makeProperty("Tag", "PRPOpCode.String"),
+			makeProperty("Flags", "PRPOpCode.Int32")
+		}));
+
+		declarations.push_back(makeComplexType("CSyntheticController", "", {
+			makeProperty("Speed", "PRPOpCode.Float32"),
+			makeProperty("Target", "PRPOpCode.String"),
+			makeProperty("Enabled", "PRPOpCode.Bool")
+		}));
+
+		std::unordered_map<std::string, std::string> typeToHash {
+			{ "ZROOM", makeHash(kRootTypeId) },
+			{ "ZGROUP", makeHash(kGroupTypeId) },
+			{ "ZSyntheticObject", makeHash(kObjectTypeId) }
+		};
+
+		gamelib::TypeRegistry::getInstance().registerTypes(std::move(declarations), std::move(typeToHash));
+	}
+
+	void generatePRPInstructions(const SyntheticLevelOptions &options, std::vector<PRPInstruction> &instructions)
+	{
+		instructions.clear();
+
+		std::uint32_t objectIndex = 0;
+		emitObject(objectIndex++, kRootTypeId, 0u, options.groupsCount, instructions);
+
+		for (std::uint32_t groupIndex = 0; groupIndex < options.groupsCount; ++groupIndex)
+		{
+			emitObject(objectIndex++, kGroupTypeId, 0u, options.objectsPerGroup, instructions);
+
+			for (std::uint32_t i = 0; i < options.objectsPerGroup; ++i, ++objectIndex)
+			{
+				emitObject(objectIndex, kObjectTypeId, getControllersCount(options, objectIndex), 0u, instructions);
+			}
+		}
+
+		instructions.emplace_back(PRPOpCode::Bool, PRPOperandVal(false));
+		instructions.emplace_back(PRPOpCode::EndOfStream);
+	}
+
+	gamelib::prp::PRPZDefines generatePRPDefinitions()
+	{
+		gamelib::prp::PRPZDefines definitions;
+		definitions.getDefinitions().emplace_back("DefaultTag", PRPDefinitionType::StringRef_1, StringRef("Tag0"));
+		definitions.getDefinitions().emplace_back("DefaultTarget", PRPDefinitionType::StringRef_1, StringRef("Target0"));
+		return definitions;
+	}
+
+	std::vector<uint8_t> generatePRPFile(const SyntheticLevelOptions &options)
+	{
+		std::vector<PRPInstruction> instructions;
+		generatePRPInstructions(options, instructions);
+
+		std::vector<uint8_t> result;
+		gamelib::prp::PRPWriter::write(generatePRPDefinitions(), instructions, false, result);
+		return result;
+	}
+
+	std::vector<uint8_t> generateGMSFile(const SyntheticLevelOptions &options, std::vector<uint8_t> &buffer)
+	{
+		// Names of geoms (ROOT is not declared in GMS)
+		buffer.assign(1, 0u);
+
+		auto addName = [&buffer](const std::string &name) -> std::uint32_t
+		{
+			const auto offset = static_cast<std::uint32_t>(buffer.size());
+			buffer.insert(buffer.end(), name.begin(), name.end());
+			buffer.push_back(0u);
+			return offset;
+		};
+
+		const std::uint32_t entitiesCount = options.getObjectsCount() - 1u;
+
+		std::vector<uint8_t> body(kGMSHeaderSize, 0u);
+		writeU32(body, 0xC, 4u);
+		writeU32(body, 0x38, 0xFFFFFFFFu);
+
+		// Clusters
+		writeU32(body, 0x14, static_cast<uint32_t>(body.size()));
+		appendU32(body, 1u);
+		for (std::uint32_t i = 0; i < kGMSClusterEntriesCount; ++i)
+		{
+			appendU32(body, 0u);
+		}
+
+		// Geom table (declarations are placed right after the table)
+		const auto geomTableOffset = static_cast<uint32_t>(body.size());
+		const auto declarationsOffset = geomTableOffset + 4u + entitiesCount * 8u;
+		writeU32(body, 0x0, geomTableOffset);
+		appendU32(body, entitiesCount);
+		body.resize(declarationsOffset + entitiesCount * kGMSGeomDeclSize, 0u);
+
+		std::uint32_t entityIndex = 0;
+		auto addEntity = [&](const std::string &name, std::uint32_t typeId, std::uint32_t objectIndex, std::uint32_t flags)
+		{
+			const auto declOffset = declarationsOffset + entityIndex * kGMSGeomDeclSize;
+
+			writeU32(body, geomTableOffset + 4u + entityIndex * 8u, (declOffset / 4u) | flags);
+			writeU32(body, declOffset + 0x00, addName(name));
+			writeU32(body, declOffset + 0x0C, (typeId == kObjectTypeId && options.primitivesCount) ? 1u + (objectIndex % options.primitivesCount) : 0u);
+			writeU32(body, declOffset + 0x14, typeId);
+			writeU32(body, declOffset + 0x30, objectIndex);
+			++entityIndex;
+		};
+
+		std::uint32_t objectIndex = 1;
+		for (std::uint32_t groupIndex = 0; groupIndex < options.groupsCount; ++groupIndex)
+		{
+			// Next group closes the previous one
+			const std::uint32_t relativeDepth = groupIndex ? 1u : 0u;
+			addEntity("Group" + std::to_string(groupIndex), kGroupTypeId, objectIndex++, kGeomIsRootOfGroup | (relativeDepth << kGeomRelativeDepthShift));
+
+			for (std::uint32_t i = 0; i < options.objectsPerGroup; ++i)
+			{
+				addEntity("Object" + std::to_string(objectIndex), kObjectTypeId, objectIndex, 0u);
+				++objectIndex;
+			}
+		}
+
+		// Geom stats
+		writeU32(body, 0x10, static_cast<uint32_t>(body.size()));
+		appendU32(body, 2u);
+		appendU32(body, kGroupTypeId);
+		appendU32(body, options.groupsCount);
+		appendU32(body, 0u);
+		appendU32(body, kObjectTypeId);
+		appendU32(body, options.groupsCount * options.objectsPerGroup);
+		appendU32(body, 0u);
+
+		// Raw header: uncompressed size, stored size, 'can avoid uncompress'
+		std::vector<uint8_t> storedBody = options.isSceneCompressed ? compressRawDeflate(body) : body;
+
+		std::vector<uint8_t> file(9, 0u);
+		writeU32(file, 0x0, static_cast<uint32_t>(body.size()));
+		writeU32(file, 0x4, static_cast<uint32_t>(storedBody.size()));
+		file[0x8] = options.isSceneCompressed ? 0u : 1u;
+		file.insert(file.end(), storedBody.begin(), storedBody.end());
+		return file;
+	}
+
+	std::vector<uint8_t> generatePRMFile(std::uint32_t primitivesCount)
+	{
+		std::vector<std::vector<uint8_t>> bodies;
+		bodies.reserve(1 + primitivesCount * 3);
+		bodies.emplace_back(0x10, 0u);
+
+		for (std::uint32_t primitiveIndex = 0; primitiveIndex < primitivesCount; ++primitiveIndex)
+		{
+			const auto descriptionIndex = static_cast<std::uint32_t>(bodies.size());
+			const bool isRepeated = (primitiveIndex % 4) == 3;
+			const auto seed = static_cast<uint8_t>(1u + (isRepeated ? primitiveIndex - 1 : primitiveIndex) % 0x7Fu);
+			const std::uint32_t trianglesCount = 16u + (primitiveIndex % 8u) * 8u;
+
+			std::vector<uint8_t> description(0x40, 0u);
+			description[0x18] = static_cast<uint8_t>((descriptionIndex + 1) & 0xFFu);
+			description[0x19] = static_cast<uint8_t>(((descriptionIndex + 1) >> 8) & 0xFFu);
+
+			std::vector<uint8_t> vertices(0x24 * trianglesCount * 3, seed);
+
+			std::vector<uint8_t> indices((4 + trianglesCount * 3 * 2 + 0xF) & ~0xFu, 0u);
+			indices[2] = static_cast<uint8_t>((trianglesCount * 3) & 0xFFu);
+			indices[3] = static_cast<uint8_t>(((trianglesCount * 3) >> 8) & 0xFFu);
+
+			bodies.push_back(std::move(description));
+			bodies.push_back(std::move(vertices));
+			bodies.push_back(std::move(indices));
+		}
+
+		std::vector<uint8_t> file(0x10, 0u);
+		std::vector<uint32_t> offsets(bodies.size(), 0u);
+
+		for (size_t i = 0; i < bodies.size(); ++i)
+		{
+			offsets[i] = static_cast<uint32_t>((file.size() + kAlignment - 1) / kAlignment * kAlignment);
+			file.resize(offsets[i], 0u);
+			file.insert(file.end(), bodies[i].begin(), bodies[i].end());
+		}
+
+		const auto tableOffset = static_cast<uint32_t>((file.size() + kAlignment - 1) / kAlignment * kAlignment);
+		file.resize(tableOffset + bodies.size() * 0x10, 0u);
+
+		writeU32(file, 0x0, tableOffset);
+		writeU32(file, 0x4, static_cast<uint32_t>(bodies.size()));
+		writeU32(file, 0x8, tableOffset);
+
+		for (size_t i = 0; i < bodies.size(); ++i)
+		{
+			writeU32(file, tableOffset + i * 0x10 + 0x0, offsets[i]);
+			writeU32(file, tableOffset + i * 0x10 + 0x4, static_cast<uint32_t>(bodies[i].size()));
+		}
+
+		return file;
+	}
+
+	SyntheticLevel generateLevel(const SyntheticLevelOptions &options)
+	{
+		SyntheticLevel level;
+		level.properties = generatePRPFile(options);
+		level.scene = generateGMSFile(options, level.buffer);
+		level.geometry = generatePRMFile(options.primitivesCount);
+		return level;
+	}
+
+	SyntheticLevelAssetsProvider::SyntheticLevelAssetsProvider(const SyntheticLevel *level) : m_level(level)
+	{
+	}
+
+	const std::string &SyntheticLevelAssetsProvider::getLevelName() const
+	{
+		return m_levelName;
+	}
+
+	std::unique_ptr<uint8_t[]> SyntheticLevelAssetsProvider::getAsset(gamelib::io::AssetKind kind, int64_t &bufferSize) const
+	{
+		const auto *body = getAssetBody(kind);
+		if (!body || body->empty())
+		{
+			bufferSize = 0;
+			return nullptr;
+		}
+
+		auto result = std::make_unique<uint8_t[]>(body->size());
+		std::memcpy(result.get(), body->data(), body->size());
+		bufferSize = static_cast<int64_t>(body->size());
+		return result;
+	}
+
+	bool SyntheticLevelAssetsProvider::hasAssetOfKind(gamelib::io::AssetKind kind) const
+	{
+		const auto *body = getAssetBody(kind);
+		return body && !body->empty();
+	}
+
+	bool SyntheticLevelAssetsProvider::saveAsset(gamelib::io::AssetKind, gamelib::Span<uint8_t>)
+	{
+		return false;
+	}
+
+	bool SyntheticLevelAssetsProvider::isValid() const
+	{
+		return m_level != nullptr;
+	}
+
+	bool SyntheticLevelAssetsProvider::isEditable() const
+	{
+		return false;
+	}
+
+	std::uint64_t SyntheticLevelAssetsProvider::getContentHash() const
+	{
+		if (!m_level)
+		{
+			return 0;
+		}
+
+		std::uint64_t hash = gamelib::ContentHash::kDefaultSeed;
+		for (const auto *body : { &m_level->properties, &m_level->scene, &m_level->buffer, &m_level->geometry })
+		{
+			hash = gamelib::ContentHash::combine(hash, gamelib::ContentHash::compute(body->data(), body->size()));
+		}
+
+		return hash;
+	}
+
+	const std::vector<uint8_t> *SyntheticLevelAssetsProvider::getAssetBody(gamelib::io::AssetKind kind) const
+	{
+		if (!m_level)
+		{
+			return nullptr;
+		}
+
+		switch (kind)
+		{
+		case gamelib::io::AssetKind::PROPERTIES: return &m_level->properties;
+		case gamelib::io::AssetKind::SCENE: return &m_level->scene;
+		case gamelib::io::AssetKind::BUFFER: return &m_level->buffer;
+		case gamelib::io::AssetKind::GEOMETRY: return &m_level->geometry;
+		default: return nullptr;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+
+#include <GameLib/TypeComplex.h>
+#include <GameLib/TypeContainer.h>
+#include <GameLib/Value.h>
+#include <stdexcept>
+#include <string>
+
+// Usage
+using gamelib::Span;
+using gamelib::Value;
+using gamelib::ValueView;
+using gamelib::TypeComplex;
+using gamelib::TypeContainer;
+using gamelib::prp::PRPOpCode;
+using gamelib::prp::PRPOperandVal;
+using gamelib::prp::PRPInstruction;
+
+// Helpers
+namespace
+{
+	constexpr int kTrivialPropertiesCount = 1000; ///< Before and after container
+
+	/**
+	 * Large object: kTrivialPropertiesCount properties, container 'Items', kTrivialPropertiesCount properties
+	 */
+	struct LargeObject
+	{
+		std::unique_ptr<TypeContainer> refTabType;
+		std::unique_ptr<TypeComplex> objectType;
+		std::vector<PRPInstruction> instructions;
+
+		explicit LargeObject(int itemsCount)
+		{
+			refTabType = std::make_unique<TypeContainer>("ZREFTAB");
+
+			std::vector<ValueView> views;
+
+			for (int i = 0; i < kTrivialPropertiesCount * 2; ++i)
+			{
+				if (i == kTrivialPropertiesCount)
+				{
+					views.emplace_back("Items", refTabType.get(), nullptr);
+					appendItems(instructions, itemsCount);
+				}
+
+				views.emplace_back("Property" + std::to_string(i), PRPOpCode::Int32, nullptr);
+				instructions.emplace_back(PRPOpCode::Int32, PRPOperandVal(static_cast<int32_t>(i)));
+			}
+
+			objectType = std::make_unique<TypeComplex>("ZLargeObject", std::move(views), nullptr, false);
+		}
+
+		[[nodiscard]] Value map() const
+		{
+			auto [value, _rest] = objectType->map(Span(instructions));
+			if (!value.has_value())
+			{
+				throw std::runtime_error("Unable to map large object");
+			}
+
+			return value.value();
+		}
+
+		static void appendItems(std::vector<PRPInstruction> &result, int itemsCount)
+		{
+			result.emplace_back(PRPOpCode::Container, PRPOperandVal(static_cast<int32_t>(itemsCount)));
+
+			for (int i = 0; i < itemsCount; ++i)
+			{
+				result.emplace_back(PRPOpCode::Int32, PRPOperandVal(static_cast<int32_t>(i)));
+			}
+		}
+	};
+}
+
+// Benchmarks
+static void Value_UpdateContainer(benchmark::State &state)
+{
+	const int itemsCount = static_cast<int>(state.range(0));
+	LargeObject object { itemsCount };
+	Value value = object.map();
+
+	std::vector<PRPInstruction> grown, original;
+	LargeObject::appendItems(grown, itemsCount + 1);
+	LargeObject::appendItems(original, itemsCount);
+
+	for (auto _ : state)
+	{
+		// Add one element and remove it back (like editor does)
+		value.updateContainer(kTrivialPropertiesCount, grown);
+		value.updateContainer(kTrivialPropertiesCount, original);
+		benchmark::DoNotOptimize(value.getInstructions().data());
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 2);
+}
+
+static void Value_RemapObject(benchmark::State &state)
+{
+	// Cost of full re-map of object which was done on each container update before
+	LargeObject object { static_cast<int>(state.range(0)) };
+
+	for (auto _ : state)
+	{
+		Value value = object.map();
+		benchmark::DoNotOptimize(value.getInstructions().data());
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(Value_UpdateContainer)->Arg(100)->Arg(10000);
+BENCHMARK(Value_RemapObject)->Arg(100)->Arg(10000);
\ No newline at end of file
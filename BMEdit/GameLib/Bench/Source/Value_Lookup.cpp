@@ -0,0 +1,109 @@
+#include <benchmark/benchmark.h>
+
+#include <GameLib/TypeComplex.h>
+#include <GameLib/Value.h>
+#include <stdexcept>
+#include <string>
+
+// Usage
+using gamelib::Span;
+using gamelib::Value;
+using gamelib::ValueView;
+using gamelib::TypeComplex;
+using gamelib::prp::PRPOpCode;
+using gamelib::prp::PRPOperandVal;
+using gamelib::prp::PRPInstruction;
+
+// Helpers
+namespace
+{
+	constexpr int kObjectsCount = 20000;
+	constexpr int kTypesCount = 8;
+	constexpr int kBasePropertiesCount = 24; ///< 'PrimId' is the last one
+	constexpr int kOwnPropertiesCount = 40;
+
+	/**
+	 * Level-like set of objects: base type ZGEOM and kTypesCount types inherited of it, objects are spread over them.
+	 */
+	struct LevelObjects
+	{
+		std::unique_ptr<TypeComplex> baseType;
+		std::vector<std::unique_ptr<TypeComplex>> types;
+		std::vector<Value> objects;
+
+		LevelObjects()
+		{
+			std::vector<ValueView> baseViews;
+			for (int i = 0; i < kBasePropertiesCount - 1; ++i)
+			{
+				baseViews.emplace_back("Base" + std::to_string(i), PRPOpCode::Int32, nullptr);
+			}
+
+			baseViews.emplace_back("PrimId", PRPOpCode::Int32, nullptr);
+			baseType = std::make_unique<TypeComplex>("ZGEOM", std::move(baseViews), nullptr, false);
+
+			for (int typeIndex = 0; typeIndex < kTypesCount; ++typeIndex)
+			{
+				const std::string typeName = "ZType" + std::to_string(typeIndex);
+
+				std::vector<ValueView> views;
+				for (int i = 0; i < kOwnPropertiesCount; ++i)
+				{
+					views.emplace_back(typeName + "_Property" + std::to_string(i), PRPOpCode::Int32, nullptr);
+				}
+
+				types.emplace_back(std::make_unique<TypeComplex>(typeName, std::move(views), baseType.get(), false));
+			}
+
+			std::vector<PRPInstruction> instructions(kBasePropertiesCount + kOwnPropertiesCount, PRPInstruction(PRPOpCode::Int32, PRPOperandVal(static_cast<int32_t>(0))));
+
+			objects.reserve(kObjectsCount);
+			for (int objectIndex = 0; objectIndex < kObjectsCount; ++objectIndex)
+			{
+				instructions[kBasePropertiesCount - 1] = PRPInstruction(PRPOpCode::Int32, PRPOperandVal(static_cast<int32_t>(objectIndex)));
+
+				auto [value, _rest] = types[objectIndex % kTypesCount]->map(Span(instructions));
+				if (!value.has_value())
+				{
+					throw std::runtime_error("Unable to map level object");
+				}
+
+				objects.emplace_back(std::move(value.value()));
+			}
+		}
+	};
+}
+
+// Benchmarks
+static void Value_ReadPropertyOfEachObject(benchmark::State &state)
+{
+	// Arg: 1 - use names index of type, 0 - linear search over entries
+	LevelObjects level;
+
+	if (!state.range(0))
+	{
+		for (auto &object : level.objects)
+		{
+			object.setEntriesIndex(nullptr);
+		}
+	}
+
+	for (auto _ : state)
+	{
+		int64_t sum = 0;
+
+		for (auto &object : level.objects)
+		{
+			if (object.hasProperty("PrimId"))
+			{
+				sum += object["PrimId"][0].getOperand().trivial.i32;
+			}
+		}
+
+		benchmark::DoNotOptimize(sum);
+	}
+
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * kObjectsCount);
+}
+
+BENCHMARK(Value_ReadPropertyOfEachObject)->Arg(0)->Arg(1);
\ No newline at end of file
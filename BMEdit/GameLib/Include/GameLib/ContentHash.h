@@ -0,0 +1,30 @@
+#pragma once
+
+#include <GameLib/Span.h>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace gamelib
+{
+	/**
+	 * @brief Fast non-cryptographic 64 bit hash of raw content (xxHash64 algorithm).
+	 * @note Result does not depend on platform, so it could be stored in cache files.
+	 */
+	class ContentHash
+	{
+	public:
+		static constexpr std::uint64_t kDefaultSeed = 0u;
+
+		ContentHash() = delete;
+
+		[[nodiscard]] static std::uint64_t compute(const std::uint8_t *data, std::size_t size, std::uint64_t seed = kDefaultSeed);
+		[[nodiscard]] static std::uint64_t compute(Span<uint8_t> buffer, std::uint64_t seed = kDefaultSeed);
+
+		/**
+		 * @fn combine
+		 * @brief Mix another hash (or value) into hash. Order of combined values matters.
+		 */
+		[[nodiscard]] static std::uint64_t combine(std::uint64_t hash, std::uint64_t value);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <GameLib/PRP/PRPInstruction.h>
+#include <GameLib/Value.h>
+#include <functional>
+#include <optional>
+#include <cstdint>
+#include <chrono>
+#include <vector>
+#include <deque>
+
+
+namespace gamelib
+{
+	/**
+	 * @class EditJournal
+	 * @brief History of property edits with undo & redo.
+	 * @details Each record keeps only changed part of entry: offset of first changed instruction and instructions before & after edit (common prefix & suffix are dropped).
+	 *          Records are stored in ring (oldest records are dropped when journal uses more memory than allowed).
+	 *          Edits of the same instructions which come faster than coalesce window are merged into one record (slider & spinbox edits).
+	 * @note Journal keeps pointers to values, so it must be cleared when values are destroyed (level closed).
+	 */
+	class EditJournal
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		static constexpr std::size_t kDefaultMemoryLimit = 16u * 1024u * 1024u;
+		static constexpr Clock::duration kDefaultCoalesceWindow = std::chrono::milliseconds(500);
+
+		struct Change
+		{
+			Value *value { nullptr };
+			int entryIndex { 0 };
+		};
+
+		using ChangeListener = std::function<void(const Change &)>;
+
+		explicit EditJournal(std::size_t memoryLimit = kDefaultMemoryLimit, Clock::duration coalesceWindow = kDefaultCoalesceWindow);
+
+		/**
+		 * @fn setEntry
+		 * @brief Replace instructions of entry and record change
+		 * @param value - value to edit
+		 * @param entryIndex - index of entry (see Value::getEntries)
+		 * @param newInstructions - new instructions of entry
+		 * @param now - time of edit (used to merge rapid edits)
+		 * @return true when value was changed
+		 * @throws std::out_of_range when value has no entry with given index
+		 * @throws std::runtime_error when size of entry changed and new instructions are not valid for it (see Value::updateContainer)
+		 */
+		bool setEntry(Value &value, int entryIndex, const std::vector<prp::PRPInstruction> &newInstructions, Clock::time_point now = Clock::now());
+
+		/**
+		 * @fn undo
+		 * @return changed entry or nothing when there is nothing to undo
+		 * @note When recorded entry doesn't exist anymore history is dropped (it can't be applied to value)
+		 */
+		std::optional<Change> undo();
+
+		/**
+		 * @fn redo
+		 * @return changed entry or nothing when there is nothing to redo
+		 * @note When recorded entry doesn't exist anymore history is dropped (it can't be applied to value)
+		 */
+		std::optional<Change> redo();
+
+		/**
+		 * @fn seal
+		 * @brief Next edit will not be merged into last record (eg. user released slider)
+		 */
+		void seal();
+
+		void clear();
+
+		/**
+		 * @fn setChangeListener
+		 * @brief Listener is called after each applied change: edit, undo and redo (caches built from values must drop changed entry)
+		 */
+		void setChangeListener(ChangeListener listener);
+
+		[[nodiscard]] bool canUndo() const;
+		[[nodiscard]] bool canRedo() const;
+		[[nodiscard]] std::size_t getRecordsCount() const;
+		[[nodiscard]] std::size_t getMemoryUsage() const;
+
+	private:
+		struct Record
+		{
+			Value *value { nullptr };
+			int entryIndex { 0 };
+			std::size_t offset { 0 }; ///< First changed instruction (from begin of entry)
+			std::vector<prp::PRPInstruction> before {};
+			std::vector<prp::PRPInstruction> after {};
+			Clock::time_point time {};
+			std::size_t memoryUsage { 0 };
+		};
+
+		static void apply(Value &value, int entryIndex, std::size_t offset, std::size_t replacedCount, const std::vector<prp::PRPInstruction> &instructions);
+		static bool isValidEntry(const Value &value, int entryIndex);
+		static std::size_t estimateMemoryUsage(const Record &record);
+		void push(Record &&record);
+		void dropRedo();
+		void notify(Value *value, int entryIndex) const;
+
+	private:
+		std::deque<Record> m_records {};
+		std::size_t m_cursor { 0 }; ///< Count of applied records (records after cursor could be redone)
+		std::size_t m_memoryUsage { 0 };
+		std::size_t m_memoryLimit { kDefaultMemoryLimit };
+		Clock::duration m_coalesceWindow { kDefaultCoalesceWindow };
+		bool m_isSealed { true };
+		ChangeListener m_changeListener {};
+	};
+}
\ No newline at end of file
@@ -8,11 +8,17 @@ namespace ZBio::ZBinaryReader
 	class BinaryReader;
 }
 
+namespace gamelib
+{
+	class LevelSnapshot;
+}
+
 namespace gamelib::gms
 {
 	class GMSEntries
 	{
 		friend class GMSHeader;
+		friend class gamelib::LevelSnapshot;
 
 	public:
 		GMSEntries();
@@ -9,6 +9,11 @@ namespace ZBio::ZBinaryReader
 	class BinaryReader;
 }
 
+namespace gamelib
+{
+	class LevelSnapshot;
+}
+
 namespace gamelib::gms
 {
 	class GMSGeomEntity
@@ -18,6 +23,7 @@ namespace gamelib::gms
 		///----------
 		friend class GMSEntries;
 		friend class GMSHeader;
+		friend class gamelib::LevelSnapshot;
 
 	public:
 		static constexpr uint32_t kInvalidParent = 0xFFFFFFEEu;
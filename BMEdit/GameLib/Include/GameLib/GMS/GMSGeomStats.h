@@ -11,10 +11,17 @@ namespace ZBio::ZBinaryReader
 	class BinaryReader;
 }
 
+namespace gamelib
+{
+	class LevelSnapshot;
+}
+
 namespace gamelib::gms
 {
 	class GMSGeomStats
 	{
+		friend class gamelib::LevelSnapshot;
+
 	public:
 		struct Entry
 		{
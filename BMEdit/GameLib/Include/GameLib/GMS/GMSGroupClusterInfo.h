@@ -8,11 +8,17 @@ namespace ZBio::ZBinaryReader
 	class BinaryReader;
 }
 
+namespace gamelib
+{
+	class LevelSnapshot;
+}
+
 namespace gamelib::gms
 {
 	class GMSGroupClusterInfo
 	{
 		friend class GMSHeader;
+		friend class gamelib::LevelSnapshot;
 	public:
 		GMSGroupClusterInfo();
 
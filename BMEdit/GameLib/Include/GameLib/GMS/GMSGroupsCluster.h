@@ -10,11 +10,17 @@ namespace ZBio::ZBinaryReader
 	class BinaryReader;
 }
 
+namespace gamelib
+{
+	class LevelSnapshot;
+}
+
 namespace gamelib::gms
 {
 	class GMSGroupsCluster
 	{
 		friend class GMSHeader;
+		friend class gamelib::LevelSnapshot;
 	public:
 		GMSGroupsCluster();
 
@@ -13,10 +13,17 @@ namespace ZBio::ZBinaryReader
 	class BinaryReader;
 }
 
+namespace gamelib
+{
+	class LevelSnapshot;
+}
+
 namespace gamelib::gms
 {
 	class GMSHeader
 	{
+		friend class gamelib::LevelSnapshot;
+
 	public:
 		GMSHeader();
 
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <mutex>
+#include <list>
+
+
+namespace gamelib::io
+{
+	/**
+	 * @brief Identity of inflated asset: archive (see IOLevelAssetsProvider::getContentHash) + CRC32 & size of uncompressed entry
+	 */
+	struct AssetCacheKey
+	{
+		std::uint64_t archiveId { 0 };
+		std::uint32_t crc { 0 };
+		std::uint64_t size { 0 };
+
+		[[nodiscard]] bool operator==(const AssetCacheKey &other) const
+		{
+			return archiveId == other.archiveId && crc == other.crc && size == other.size;
+		}
+	};
+
+	struct AssetCacheStats
+	{
+		std::size_t hits { 0 };       ///< Found in memory
+		std::size_t diskHits { 0 };   ///< Found in persistent folder (also counted as miss of memory)
+		std::size_t misses { 0 };     ///< Not found in memory
+		std::size_t evictions { 0 };
+		std::size_t entriesCount { 0 };
+		std::size_t bytes { 0 };      ///< Bytes of assets kept in memory
+	};
+
+	/**
+	 * @brief Bounded LRU cache of inflated assets, shared by all asset providers of process (see getInstance).
+	 * @details Cache keeps up to capacity bytes of assets in memory, the least recently used assets are evicted first.
+	 *          When persistent folder is set each asset is saved there too, so assets are not inflated again by next runs.
+	 *          Persistent folder is limited by size the same way (see io::CacheFolder), persisted asset is accepted only when its CRC32 & size match the key.
+	 *          Hits & misses are reported via profiler counters ("Asset cache hits", "Asset cache misses") and via getStats.
+	 * @note Cache is thread safe, assets are copied outside of lock
+	 */
+	class AssetCache
+	{
+	public:
+		static constexpr std::size_t kDefaultCapacity = 256u * 1024u * 1024u;
+		static constexpr std::uintmax_t kDefaultPersistentSizeLimit = 2048u * 1024u * 1024u;
+		static constexpr const char *kAssetExtension = ".bmasset";
+
+		explicit AssetCache(std::size_t capacity = kDefaultCapacity);
+
+		AssetCache(const AssetCache &) = delete;
+		AssetCache &operator=(const AssetCache &) = delete;
+
+		static AssetCache &getInstance();
+
+		/**
+		 * @fn get
+		 * @return copy of asset (size of buffer is key.size) or nullptr when asset is not cached
+		 * @note Persisted asset with another CRC32 is removed from persistent folder
+		 */
+		[[nodiscard]] std::unique_ptr<uint8_t[]> get(const AssetCacheKey &key);
+
+		/**
+		 * @fn put
+		 * @note Asset which is bigger than capacity is not cached. Persistent folder is trimmed after asset is saved there.
+		 */
+		void put(const AssetCacheKey &key, const uint8_t *data, std::size_t size);
+
+		/**
+		 * @fn setCapacity
+		 * @param capacity - max bytes of assets in memory (0 - cache is disabled)
+		 */
+		void setCapacity(std::size_t capacity);
+		[[nodiscard]] std::size_t getCapacity() const;
+
+		/**
+		 * @fn setPersistentFolder
+		 * @param folder - folder of persisted assets (empty - assets are kept in memory only)
+		 */
+		void setPersistentFolder(std::string folder);
+		[[nodiscard]] std::string getPersistentFolder() const;
+
+		/**
+		 * @fn setPersistentSizeLimit
+		 * @param sizeLimit - max total size of persisted assets (the least recently used assets are removed first)
+		 */
+		void setPersistentSizeLimit(std::uintmax_t sizeLimit);
+		[[nodiscard]] std::uintmax_t getPersistentSizeLimit() const;
+
+		/**
+		 * @fn clear
+		 * @brief Drop assets kept in memory (persisted assets and stats are kept)
+		 */
+		void clear();
+
+		[[nodiscard]] AssetCacheStats getStats() const;
+		void resetStats();
+
+	private:
+		struct KeyHash
+		{
+			std::size_t operator()(const AssetCacheKey &key) const;
+		};
+
+		struct Entry
+		{
+			AssetCacheKey key {};
+			std::shared_ptr<const uint8_t[]> data {};
+		};
+
+		using EntriesList = std::list<Entry>;
+
+		void insert(const AssetCacheKey &key, std::shared_ptr<const uint8_t[]> data);
+		void evict();
+		[[nodiscard]] std::string getPersistentPath(const AssetCacheKey &key) const;
+
+	private:
+		mutable std::mutex m_lock;
+		EntriesList m_entries {}; // most recently used first
+		std::unordered_map<AssetCacheKey, EntriesList::iterator, KeyHash> m_entriesByKey {};
+		std::size_t m_capacity { kDefaultCapacity };
+		std::string m_persistentFolder {};
+		std::uintmax_t m_persistentSizeLimit { kDefaultPersistentSizeLimit };
+		AssetCacheStats m_stats {};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+
+namespace gamelib::io
+{
+	/**
+	 * @brief Size limit of folder with cached files (level snapshots, inflated assets).
+	 * @details Recency of file is its last write time: files are touched when they are read, so the least recently used files are removed first.
+	 */
+	class CacheFolder
+	{
+	public:
+		CacheFolder() = delete;
+
+		/**
+		 * @fn touch
+		 * @brief Mark file as used right now
+		 */
+		static void touch(const std::string &path);
+
+		/**
+		 * @fn writeAtomically
+		 * @brief Write file into cache folder (parent folders are created), readers never see partially written file
+		 * @details Data is written into temporary file with unique name (so concurrent writers of the same path don't share it) which is renamed to path after.
+		 * @return true when file was written
+		 */
+		static bool writeAtomically(const std::string &path, const std::uint8_t *data, std::size_t size);
+
+		/**
+		 * @fn trim
+		 * @brief Remove the least recently used files with given extension until total size of them fits into limit
+		 * @param folder - cache folder (subfolders are not visited)
+		 * @param extension - extension of cached files (eg. ".bmsnap"), other files are not counted and not removed
+		 * @param sizeLimit - max total size of cached files in bytes
+		 * @param keepPath - file which is never removed (usually just written one)
+		 * @return count of removed files
+		 */
+		static std::size_t trim(const std::string &folder, std::string_view extension, std::uintmax_t sizeLimit, const std::string &keepPath = {});
+	};
+}
\ No newline at end of file
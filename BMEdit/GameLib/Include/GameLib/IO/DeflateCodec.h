@@ -0,0 +1,61 @@
+#pragma once
+
+#include <GameLib/Span.h>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+
+namespace gamelib::io
+{
+	struct DeflateOptions
+	{
+		static constexpr std::size_t kDefaultBlockSize = 1024u * 1024u;
+
+		int level { 6 };                               ///< zlib compression level (0..9)
+		std::size_t blockSize { kDefaultBlockSize };  ///< Size of independently deflated block of input
+		int threadsCount { 0 };                       ///< 0 - use all hardware threads
+	};
+
+	/**
+	 * @brief Raw deflate streams (compression method 8 of ZIP) for large assets.
+	 * @details Input is split into blocks which are deflated in parallel. Each block is primed by last 32 KB of previous block (dictionary)
+	 *          and flushed to byte boundary, so concatenated blocks are a single regular deflate stream (any inflater reads it) with almost the same ratio.
+	 *          Stream is inflated at once into buffer of known size: by libdeflate when GameLib is built with it (GAMELIB_WITH_LIBDEFLATE), by zlib otherwise.
+	 */
+	class DeflateCodec
+	{
+	public:
+		DeflateCodec() = delete;
+
+		/**
+		 * @fn compress
+		 * @param input - uncompressed data
+		 * @param output - raw deflate stream (contents of buffer are replaced)
+		 * @param crc - CRC32 of uncompressed data (computed together with compression)
+		 * @return false when zlib failed
+		 */
+		static bool compress(Span<uint8_t> input, std::vector<uint8_t> &output, std::uint32_t &crc, const DeflateOptions &options = {});
+
+		/**
+		 * @fn decompress
+		 * @param input - raw deflate stream
+		 * @param output - buffer of uncompressed data
+		 * @param outputSize - size of uncompressed data (known from ZIP directory)
+		 * @return true when stream is valid and produced exactly outputSize bytes
+		 */
+		static bool decompress(Span<uint8_t> input, uint8_t *output, std::size_t outputSize);
+
+		/**
+		 * @fn computeCRC32
+		 * @brief CRC32 of data (blocks are processed in parallel and combined)
+		 */
+		[[nodiscard]] static std::uint32_t computeCRC32(Span<uint8_t> input, int threadsCount = 0);
+
+		/**
+		 * @fn getInflateBackendName
+		 * @return name of library which is used by decompress (libdeflate or zlib)
+		 */
+		[[nodiscard]] static const char *getInflateBackendName();
+	};
+}
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <GameLib/IO/AssetKind.h>
 #include <GameLib/Span.h>
+#include <cstdint>
 #include <string>
 #include <memory>
 
@@ -24,5 +25,12 @@ namespace gamelib::io
 		// Etc
 		[[nodiscard]] virtual bool isValid() const = 0;
 		[[nodiscard]] virtual bool isEditable() const = 0;
+
+		/**
+		 * @fn getContentHash
+		 * @return hash of all assets of level (0 when content could not be identified, so level could not be cached)
+		 * @note Must be cheap compared to reading of assets
+		 */
+		[[nodiscard]] virtual std::uint64_t getContentHash() const = 0;
 	};
 }
\ No newline at end of file
@@ -1,18 +1,27 @@
 #pragma once
 
 #include <GameLib/IO/IOLevelAssetsProvider.h>
+#include <GameLib/MemoryReport.h>
 #include <GameLib/Scene/SceneObject.h>
 #include <GameLib/PRM/PRM.h>
 #include <GameLib/PRP/PRP.h>
 #include <GameLib/GMS/GMS.h>
 
+#include <unordered_set>
 #include <memory>
 #include <vector>
 #include <cstdint>
 
 
+namespace gamelib::scene
+{
+	class SceneObjectPropertiesDumper;
+}
+
 namespace gamelib
 {
+	class LevelSnapshotCache;
+
 	struct LevelProperties
 	{
 		prp::PRPHeader header;
@@ -35,12 +44,24 @@ namespace gamelib
 
 	class Level
 	{
+		friend class LevelSnapshot;
+
 	public:
 		explicit Level(std::unique_ptr<io::IOLevelAssetsProvider> &&levelAssetsProvider);
+		~Level();
 
 		[[nodiscard]] bool loadSceneData();
 
+		/**
+		 * @fn loadSceneData
+		 * @brief Restore level from snapshot of the same assets & types database when it's available. Otherwise level is loaded from assets and snapshot is saved.
+		 * @note Failure of snapshot saving is not an error of load
+		 */
+		[[nodiscard]] bool loadSceneData(const LevelSnapshotCache &snapshotCache);
+		[[nodiscard]] bool isLoadedFromSnapshot() const;
+
 		[[nodiscard]] const std::string &getLevelName() const;
+		[[nodiscard]] std::uint64_t getContentHash() const;
 		[[nodiscard]] const LevelProperties *getLevelProperties() const;
 		[[nodiscard]] LevelProperties *getLevelProperties();
 		[[nodiscard]] const SceneProperties *getSceneProperties() const;
@@ -51,15 +72,30 @@ namespace gamelib
 
 		void dumpAsset(io::AssetKind assetKind, std::vector<uint8_t> &outBuffer) const;
 
+		/**
+		 * @fn memoryReport
+		 * @brief Walk loaded data (properties, scene objects, GMS entities, PRM chunks) and estimate owned heap memory
+		 * @note Shared bodies of PRM chunks are counted once
+		 */
+		[[nodiscard]] MemoryReport memoryReport() const;
+
+		/**
+		 * @fn memoryReport
+		 * @param countedBuffers - bodies of PRM chunks which are already counted (by reports of other levels), counted bodies are added here
+		 */
+		[[nodiscard]] MemoryReport memoryReport(std::unordered_set<const uint8_t *> &countedBuffers) const;
+
 	private:
 		bool loadLevelProperties();
 		bool loadLevelScene();
 		bool loadLevelPrimitives();
+		void setupSceneHierarchy();
 
 	private:
 		// Core
 		std::unique_ptr<io::IOLevelAssetsProvider> m_assetProvider;
 		bool m_isLevelLoaded { false };
+		bool m_isLoadedFromSnapshot { false };
 
 		// Raw data
 		LevelProperties m_levelProperties;
@@ -68,5 +104,8 @@ namespace gamelib
 
 		// Managed objects
 		std::vector<scene::SceneObject::Ptr> m_sceneObjects {};
+
+		// Export
+		mutable std::unique_ptr<scene::SceneObjectPropertiesDumper> m_propertiesDumper { nullptr }; ///< Keeps encoded objects between dumps
 	};
 }
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <GameLib/PRP/PRPInstruction.h>
+#include <GameLib/PRP/PRPZDefines.h>
+#include <GameLib/Scene/SceneObject.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace gamelib
+{
+	class Level;
+
+	enum class DiffKind : std::uint8_t
+	{
+		DK_ADDED,
+		DK_REMOVED,
+		DK_CHANGED
+	};
+
+	enum class DiffObjectKey : std::uint8_t
+	{
+		DOK_PATH,       ///< Objects are matched by path in scene tree (ROOT\Outside\Lamp)
+		DOK_INSTANCE_ID ///< Objects are matched by instance id of GMS entity (objects could be moved or renamed)
+	};
+
+	struct DiffOptions
+	{
+		DiffObjectKey objectKey { DiffObjectKey::DOK_PATH };
+		int threadsCount { 0 }; ///< 0 - use all hardware threads
+	};
+
+	struct PropertyDiff
+	{
+		DiffKind kind { DiffKind::DK_CHANGED };
+		std::string name {}; ///< Name of entry (Controller.Entry for properties of controllers, * for whole value without entries)
+		std::string controller {}; ///< Name of controller (empty for properties of object)
+		std::vector<prp::PRPInstruction> oldValue {};
+		std::vector<prp::PRPInstruction> newValue {};
+	};
+
+	struct ObjectDiff
+	{
+		static constexpr std::uint32_t kNoObject = 0xFFFFFFFFu;
+
+		DiffKind kind { DiffKind::DK_CHANGED };
+		std::string path {};
+		std::uint32_t oldObjectIndex { kNoObject };
+		std::uint32_t newObjectIndex { kNoObject };
+		bool isTypeChanged { false };
+		bool isParentChanged { false };
+		bool isChildrenChanged { false }; ///< Set or order of children changed
+		std::vector<PropertyDiff> properties {};
+	};
+
+	struct DefinitionDiff
+	{
+		DiffKind kind { DiffKind::DK_CHANGED };
+		std::string name {};
+	};
+
+	/**
+	 * @brief Structural difference between two levels: objects (properties, controllers, hierarchy) and ZDefines of PRP (see compareDefinitions).
+	 * @details Objects of both levels are matched by key (path or instance id, duplicated keys are matched in order of objects).
+	 *          Each object is hashed first (type, instructions of properties & controllers, parent & children keys),
+	 *          so only objects with different hashes are compared entry by entry. Hashing and comparison are done in parallel.
+	 */
+	class LevelDiff
+	{
+	public:
+		LevelDiff() = default;
+
+		[[nodiscard]] static LevelDiff compare(const Level &oldLevel, const Level &newLevel, const DiffOptions &options = {});
+		[[nodiscard]] static LevelDiff compare(const std::vector<scene::SceneObject::Ptr> &oldObjects, const std::vector<scene::SceneObject::Ptr> &newObjects, const DiffOptions &options = {});
+
+		/**
+		 * @fn compareDefinitions
+		 * @brief Compare ZDefines of PRP by name and value (the only PRP section which is not a part of scene objects)
+		 * @note Other sections of PRP are not compared: token table and objects count are derived from content, flags of header are not edited
+		 */
+		[[nodiscard]] static std::vector<DefinitionDiff> compareDefinitions(const prp::PRPZDefines &oldDefinitions, const prp::PRPZDefines &newDefinitions);
+
+		[[nodiscard]] bool empty() const;
+		[[nodiscard]] const std::vector<ObjectDiff> &getObjects() const;
+		[[nodiscard]] const std::vector<DefinitionDiff> &getDefinitions() const;
+		[[nodiscard]] std::size_t getObjectsCount(DiffKind kind) const;
+
+		/**
+		 * @fn getUnchangedObjectsCount
+		 * @return count of matched objects which were skipped by hash
+		 */
+		[[nodiscard]] std::size_t getUnchangedObjectsCount() const;
+
+		/**
+		 * @fn getMatchedObjectIndex
+		 * @param oldObjectIndex - index of object in old level
+		 * @return index of object with the same key in new level (changed or not) or ObjectDiff::kNoObject when object was removed
+		 */
+		[[nodiscard]] std::uint32_t getMatchedObjectIndex(std::uint32_t oldObjectIndex) const;
+
+	private:
+		std::vector<ObjectDiff> m_objects {};
+		std::vector<DefinitionDiff> m_definitions {};
+		std::vector<std::uint32_t> m_matchedObjects {}; // old object -> new object
+		std::size_t m_unchangedObjectsCount { 0 };
+	};
+}
\ No newline at end of file
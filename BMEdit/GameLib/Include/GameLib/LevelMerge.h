@@ -0,0 +1,80 @@
+#pragma once
+
+#include <GameLib/LevelDiff.h>
+#include <GameLib/PRP/PRPInstruction.h>
+#include <GameLib/Scene/SceneObject.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace gamelib
+{
+	class Level;
+
+	enum class MergeConflictKind : std::uint8_t
+	{
+		MCK_PROPERTY,       ///< Property changed differently in ours & theirs
+		MCK_REMOVED_OBJECT, ///< Object changed on one side and removed on another side
+		MCK_STRUCTURE,      ///< Structural change of theirs (object, controller or entry added/removed, type or hierarchy changed) which is not merged automatically
+		MCK_NOT_APPLIED     ///< Merged change which is not written into ours (object, controller or property not found or new instructions are not valid for its type)
+	};
+
+	struct MergeChange
+	{
+		std::string path {};
+		std::uint32_t objectIndex { ObjectDiff::kNoObject }; ///< Index of object in ours
+		std::string property {}; ///< Name of property (see PropertyDiff::name)
+		std::string controller {}; ///< Name of controller (empty for properties of object)
+		std::vector<prp::PRPInstruction> value {}; ///< Instructions of theirs
+	};
+
+	struct MergeConflict
+	{
+		MergeConflictKind kind { MergeConflictKind::MCK_PROPERTY };
+		std::string path {};
+		std::string property {}; ///< Name of property (empty when conflict is about whole object)
+		std::vector<prp::PRPInstruction> baseValue {};
+		std::vector<prp::PRPInstruction> oursValue {};
+		std::vector<prp::PRPInstruction> theirsValue {};
+	};
+
+	/**
+	 * @brief Three-way merge of property edits: changes of theirs (against base) are merged into ours.
+	 * @details Merge is based on two diffs (base -> ours, base -> theirs), so unchanged objects are skipped by hash.
+	 *          Property changed only in theirs is merged, property changed in both levels to the same value is already merged,
+	 *          any other change of the same property is conflict. Structural changes of theirs are reported as conflicts (they are not applied).
+	 */
+	class LevelMerge
+	{
+	public:
+		LevelMerge() = default;
+
+		[[nodiscard]] static LevelMerge merge(const Level &base, const Level &ours, const Level &theirs, const DiffOptions &options = {});
+		[[nodiscard]] static LevelMerge merge(const std::vector<scene::SceneObject::Ptr> &base, const std::vector<scene::SceneObject::Ptr> &ours, const std::vector<scene::SceneObject::Ptr> &theirs, const DiffOptions &options = {});
+
+		/**
+		 * @fn apply
+		 * @brief Write merged changes into objects of ours
+		 * @param ours - the same objects which were used for merge
+		 * @param failedChanges - changes which are not applied (see MCK_NOT_APPLIED), ours value of them is left empty
+		 * @return count of applied changes
+		 */
+		std::size_t apply(const std::vector<scene::SceneObject::Ptr> &ours, std::vector<MergeConflict> &failedChanges) const;
+
+		[[nodiscard]] bool hasConflicts() const;
+		[[nodiscard]] const std::vector<MergeChange> &getChanges() const;
+		[[nodiscard]] const std::vector<MergeConflict> &getConflicts() const;
+
+		/**
+		 * @fn getAlreadyMergedCount
+		 * @return count of properties which were changed in both levels to the same value
+		 */
+		[[nodiscard]] std::size_t getAlreadyMergedCount() const;
+
+	private:
+		std::vector<MergeChange> m_changes {};
+		std::vector<MergeConflict> m_conflicts {};
+		std::size_t m_alreadyMergedCount { 0 };
+	};
+}
\ No newline at end of file
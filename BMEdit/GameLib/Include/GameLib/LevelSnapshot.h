@@ -0,0 +1,119 @@
+#pragma once
+
+#include <GameLib/PRP/PRPInstruction.h>
+#include <GameLib/Scene/SceneObject.h>
+#include <GameLib/Span.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace gamelib
+{
+	class Level;
+	class Value;
+	class ValueView;
+	struct LevelProperties;
+	struct LevelGeometry;
+	struct SceneProperties;
+
+	/**
+	 * @brief Binary image of loaded level: raw properties, definitions, mapped values of scene objects, GMS entities and recognized PRM chunks.
+	 * @details Snapshot is made for pair of level content (see IOLevelAssetsProvider::getContentHash) and types database (see TypeRegistry::getTypesHash),
+	 *          it's rejected when any of them changed. File consists of header, table of sections and sections aligned by kSectionAlignment.
+	 *          Bodies of PRM chunks are stored in separated section (each body is aligned too), so they are copied as is.
+	 *          Types are referenced by index in types section and resolved once per snapshot, this is the only fix-up of pointers.
+	 * @note Snapshot is a local cache, so numbers are stored in native byte order
+	 */
+	class LevelSnapshot
+	{
+	public:
+		static constexpr std::uint32_t kMagic = 0x534C4D42; // BMLS
+		static constexpr std::uint32_t kVersion = 1;
+		static constexpr std::uint32_t kSectionAlignment = 16;
+
+		LevelSnapshot() = delete;
+
+		/**
+		 * @fn write
+		 * @param level - loaded level
+		 * @param outBuffer - body of snapshot (contents of buffer are replaced)
+		 * @return false when level is not loaded or when level or types database could not be identified
+		 */
+		static bool write(const Level &level, std::vector<uint8_t> &outBuffer);
+
+		/**
+		 * @fn read
+		 * @param level - level with assets provider (assets are not read)
+		 * @param buffer - body of snapshot
+		 * @return true when snapshot was made for the same assets & types database and it's not broken. Level is not changed on failure.
+		 * @note Only children of scene objects are restored here, parents are taken from GMS entities (see Level::loadSceneData)
+		 */
+		static bool read(Level &level, Span<uint8_t> buffer);
+
+	private:
+		class SectionWriter;
+		class SectionReader;
+		struct TypesTable;
+
+		static void writeInstructions(const std::vector<prp::PRPInstruction> &instructions, SectionWriter &writer);
+		static bool readInstructions(SectionReader &reader, std::vector<prp::PRPInstruction> &instructions);
+		static void writeViews(const std::vector<ValueView> &views, TypesTable &types, SectionWriter &writer);
+		static bool readViews(SectionReader &reader, const TypesTable &types, std::vector<ValueView> &views);
+		static void writeValue(const Value &value, TypesTable &types, SectionWriter &writer);
+		static bool readValue(SectionReader &reader, const TypesTable &types, Value &value);
+
+		static void writeTypes(const TypesTable &types, SectionWriter &writer);
+		static bool readTypes(SectionReader &reader, TypesTable &types);
+		static void writeProperties(const LevelProperties &properties, SectionWriter &writer);
+		static bool readProperties(SectionReader &reader, LevelProperties &properties);
+		static void writeScene(const SceneProperties &scene, TypesTable &types, SectionWriter &writer);
+		static bool readScene(SectionReader &reader, const TypesTable &types, SceneProperties &scene);
+		static void writeObjects(const std::vector<scene::SceneObject::Ptr> &objects, TypesTable &types, SectionWriter &writer);
+		static bool readObjects(SectionReader &reader, const TypesTable &types, const SceneProperties &scene, std::vector<scene::SceneObject::Ptr> &objects);
+		static void writeGeometry(const LevelGeometry &geometry, SectionWriter &writer, SectionWriter &blobsWriter);
+		static bool readGeometry(SectionReader &reader, Span<uint8_t> blobs, LevelGeometry &geometry);
+	};
+
+	/**
+	 * @brief Folder with snapshots of levels (one file per pair of level content & types database)
+	 * @details Folder is limited by size: after each save the least recently loaded or saved snapshots are removed (see io::CacheFolder)
+	 */
+	class LevelSnapshotCache
+	{
+	public:
+		static constexpr std::uintmax_t kDefaultSizeLimit = 1024u * 1024u * 1024u;
+		static constexpr const char *kSnapshotExtension = ".bmsnap";
+
+		/**
+		 * @param cacheFolder - folder of snapshots
+		 * @param sizeLimit - max total size of snapshots in folder (the newest snapshot is kept even when it's bigger)
+		 */
+		explicit LevelSnapshotCache(std::string cacheFolder, std::uintmax_t sizeLimit = kDefaultSizeLimit);
+
+		/**
+		 * @fn load
+		 * @return true when snapshot of level was found and restored into level
+		 */
+		bool load(Level &level) const;
+
+		/**
+		 * @fn save
+		 * @note Snapshot is written into temporary file first, so readers never see partially written snapshot. Old snapshots are removed when folder exceeds size limit.
+		 */
+		bool save(const Level &level) const;
+
+		/**
+		 * @fn getSnapshotPath
+		 * @return path to snapshot of level (empty when level or types database could not be identified)
+		 */
+		[[nodiscard]] std::string getSnapshotPath(const Level &level) const;
+
+		[[nodiscard]] const std::string &getCacheFolder() const;
+		[[nodiscard]] std::uintmax_t getSizeLimit() const;
+
+	private:
+		std::string m_cacheFolder {};
+		std::uintmax_t m_sizeLimit { kDefaultSizeLimit };
+	};
+}
\ No newline at end of file
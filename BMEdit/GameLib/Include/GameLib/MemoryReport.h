@@ -0,0 +1,70 @@
+#pragma once
+
+#include <GameLib/PRP/PRPInstruction.h>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace gamelib
+{
+	class Value;
+
+	enum class MemoryCategory : int
+	{
+		PROPERTIES_INSTRUCTIONS = 0, ///< Raw PRP instructions of level
+		PROPERTIES_OPERANDS,         ///< Payloads of raw PRP instructions (strings, raw data, string arrays)
+		PROPERTIES_DEFINITIONS,      ///< ZDefines
+		SCENE_OBJECTS,               ///< Scene object instances and hierarchy links
+		SCENE_OBJECT_NAMES,          ///< Names of scene objects (including copy inside geom info)
+		SCENE_OBJECT_PROPERTIES,     ///< Values of scene objects (instructions, payloads, entries, views)
+		SCENE_OBJECT_CONTROLLERS,    ///< Controllers of scene objects (names & values)
+		SCENE_PROPERTIES_DUMPER,     ///< Cache of properties dumper (encoded objects & token table, see SceneObjectPropertiesDumper)
+		GMS_ENTITIES,                ///< GMS entities, stats & clusters
+		PRM_CHUNKS,                  ///< PRM chunks & descriptors
+
+		LAST_CATEGORY
+	};
+
+	struct MemoryUsage
+	{
+		std::size_t bytes { 0 };
+		std::size_t allocations { 0 };
+	};
+
+	/**
+	 * @brief Estimation of heap memory owned by level, grouped by category.
+	 * @details Sizes are computed from capacities of containers, allocator overhead is not counted.
+	 *          Strings which fit into small string buffer are not counted as allocations.
+	 *          Data shared between objects (types, entries indices) or levels (PRM chunk bodies) is not owned by level and not counted.
+	 */
+	class MemoryReport
+	{
+	public:
+		MemoryReport() = default;
+
+		void add(MemoryCategory category, std::size_t bytes, std::size_t allocations = 1);
+		void addString(MemoryCategory category, const std::string &str);
+		void addInstructions(MemoryCategory instructionsCategory, MemoryCategory operandsCategory, const std::vector<prp::PRPInstruction> &instructions);
+		void addValue(MemoryCategory category, const Value &value);
+		void merge(const MemoryReport &other);
+
+		template <typename T>
+		void addVector(MemoryCategory category, const std::vector<T> &vector)
+		{
+			if (vector.capacity())
+			{
+				add(category, vector.capacity() * sizeof(T));
+			}
+		}
+
+		[[nodiscard]] const MemoryUsage &get(MemoryCategory category) const;
+		[[nodiscard]] MemoryUsage getTotal() const;
+
+		[[nodiscard]] static const char *getCategoryName(MemoryCategory category);
+
+	private:
+		std::array<MemoryUsage, static_cast<std::size_t>(MemoryCategory::LAST_CATEGORY)> m_usage {};
+	};
+}
\ No newline at end of file
@@ -17,7 +17,7 @@ namespace gamelib::prm
 		struct NullData {};
 
 		std::uint32_t m_chunkIndex { 0u };
-		std::unique_ptr<uint8_t[]> m_buffer { nullptr };
+		std::shared_ptr<uint8_t[]> m_buffer { nullptr }; ///< Could be shared between chunks with the same content (see shareBufferWith)
 		std::size_t m_bufferSize { 0 };
 		PRMChunkRecognizedKind m_recognizedKind { PRMChunkRecognizedKind::CRK_UNKNOWN_BUFFER };
 		std::variant<NullData, PRMDescriptionChunkBaseHeader, PRMIndexChunkHeader, PRMVertexBufferHeader> m_data;
@@ -26,8 +26,28 @@ namespace gamelib::prm
 		PRMChunk();
 		PRMChunk(std::uint32_t chunkIndex, int totalChunksNr, std::unique_ptr<uint8_t[]> &&buffer, std::size_t size);
 
+		/**
+		 * @brief Construct chunk of already recognized kind (eg. restored from level snapshot). Recognition heuristics are skipped, only header of kind is read.
+		 */
+		PRMChunk(std::uint32_t chunkIndex, std::unique_ptr<uint8_t[]> &&buffer, std::size_t size, PRMChunkRecognizedKind recognizedKind, PRMVertexBufferFormat vertexFormat);
+
 		[[nodiscard]] std::uint32_t getIndex() const;
+
+		/**
+		 * @fn getBuffer
+		 * @note Shared buffer is copied before it's returned for modification (copy on write)
+		 */
 		[[nodiscard]] Span<uint8_t> getBuffer();
+		[[nodiscard]] Span<uint8_t> getBuffer() const;
+
+		/**
+		 * @fn shareBufferWith
+		 * @brief Drop own buffer and refer to buffer of other chunk when their contents are the same
+		 * @return true when buffer is shared now
+		 */
+		bool shareBufferWith(const PRMChunk &other);
+		[[nodiscard]] bool isBufferShared() const;
+
 		[[nodiscard]] PRMChunkRecognizedKind getKind() const;
 
 		[[nodiscard]] const PRMDescriptionChunkBaseHeader* getDescriptionBufferHeader() const;
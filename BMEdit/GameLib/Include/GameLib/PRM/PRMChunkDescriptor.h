@@ -8,6 +8,11 @@ namespace ZBio::ZBinaryReader
 	class BinaryReader;
 }
 
+namespace ZBio::ZBinaryWriter
+{
+	class BinaryWriter;
+}
+
 namespace gamelib::prm
 {
 	struct PRMChunkDescriptor
@@ -20,5 +25,6 @@ namespace gamelib::prm
 		static constexpr int kDescriptorSize = 0x10;
 
 		static void deserialize(PRMChunkDescriptor &descriptor, ZBio::ZBinaryReader::BinaryReader *binaryReader);
+		static void serialize(const PRMChunkDescriptor &descriptor, ZBio::ZBinaryWriter::BinaryWriter *binaryWriter);
 	};
 }
\ No newline at end of file
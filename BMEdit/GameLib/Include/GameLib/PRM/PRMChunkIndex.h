@@ -0,0 +1,78 @@
+#pragma once
+
+#include <GameLib/PRM/PRMChunk.h>
+#include <unordered_map>
+#include <cstdint>
+#include <vector>
+
+
+namespace gamelib::prm
+{
+	/**
+	 * @brief Content addressed index of PRM chunks.
+	 * @details Every chunk is hashed (in parallel) and chunks with the same content are grouped together.
+	 *          The first chunk of group is canonical, others are duplicates which could be replaced by canonical chunk (see PRMWriter).
+	 *          Chunks with equal hash are always compared byte by byte, so hash collision never produces false duplicate.
+	 * @note Zero chunk & empty chunks are never deduplicated.
+	 */
+	class PRMChunkIndex
+	{
+	public:
+		static constexpr std::uint32_t kInvalidChunk = 0xFFFFFFFFu;
+
+		struct DuplicateGroup
+		{
+			std::uint64_t hash { 0u };
+			std::size_t chunkSize { 0 };
+			PRMChunkRecognizedKind kind { PRMChunkRecognizedKind::CRK_UNKNOWN_BUFFER };
+			std::uint32_t canonicalChunk { kInvalidChunk };
+			std::vector<std::uint32_t> duplicates {};
+		};
+
+		PRMChunkIndex() = default;
+
+		/**
+		 * @fn build
+		 * @param chunks - all chunks of PRM file
+		 * @param threadsCount - count of hashing workers (0 - use all hardware threads)
+		 */
+		void build(const std::vector<PRMChunk> &chunks, int threadsCount = 0);
+		void clear();
+
+		[[nodiscard]] bool empty() const;
+		[[nodiscard]] std::size_t getChunksCount() const;
+		[[nodiscard]] std::uint64_t getChunkHash(std::uint32_t chunkIndex) const;
+
+		/**
+		 * @fn getCanonicalChunk
+		 * @return index of chunk with the same content which should be kept (chunkIndex itself when chunk is unique)
+		 */
+		[[nodiscard]] std::uint32_t getCanonicalChunk(std::uint32_t chunkIndex) const;
+		[[nodiscard]] bool isDuplicate(std::uint32_t chunkIndex) const;
+
+		/**
+		 * @fn findChunk
+		 * @param chunks - chunks which were used to build index
+		 * @param content - content to lookup
+		 * @return index of canonical chunk with the same content or kInvalidChunk
+		 */
+		[[nodiscard]] std::uint32_t findChunk(const std::vector<PRMChunk> &chunks, Span<uint8_t> content) const;
+
+		[[nodiscard]] const std::vector<DuplicateGroup> &getDuplicateGroups() const;
+		[[nodiscard]] std::size_t getDuplicateChunksCount() const;
+
+		/**
+		 * @fn getReclaimableBytes
+		 * @return total size of duplicated chunks bodies (bytes which could be saved by deduplication)
+		 */
+		[[nodiscard]] std::size_t getReclaimableBytes() const;
+
+	private:
+		std::vector<std::uint64_t> m_hashes {};
+		std::vector<std::uint32_t> m_canonicalChunks {};
+		std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> m_canonicalChunksByHash {};
+		std::vector<DuplicateGroup> m_duplicateGroups {};
+		std::size_t m_duplicateChunksCount { 0 };
+		std::size_t m_reclaimableBytes { 0 };
+	};
+}
\ No newline at end of file
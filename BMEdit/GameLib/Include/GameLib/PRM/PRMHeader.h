@@ -9,6 +9,11 @@ namespace ZBio::ZBinaryReader
 	class BinaryReader;
 }
 
+namespace ZBio::ZBinaryWriter
+{
+	class BinaryWriter;
+}
+
 namespace gamelib::prm
 {
 	struct PRMHeader
@@ -18,6 +23,9 @@ namespace gamelib::prm
 		uint32_t chunkOffset2 {0}; // Duplicate of chunkOffset, maybe second chunk? Or ... LODs?
 		uint32_t zeroed {0}; // always zero (maybe used as 'checkpoint')
 
+		static constexpr int kHeaderSize = 0x10;
+
 		static void deserialize(PRMHeader &header, ZBio::ZBinaryReader::BinaryReader *binaryReader);
+		static void serialize(const PRMHeader &header, ZBio::ZBinaryWriter::BinaryWriter *binaryWriter);
 	};
 }
\ No newline at end of file
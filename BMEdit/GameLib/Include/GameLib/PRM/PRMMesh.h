@@ -0,0 +1,26 @@
+#pragma once
+
+#include <GameLib/PRM/PRMVertexFormat.h>
+#include <GameLib/BoundingBox.h>
+#include <GameLib/Vector3.h>
+#include <cstdint>
+#include <vector>
+
+
+namespace gamelib::prm
+{
+	/**
+	 * @brief Decoded geometry of a single mesh (pair of vertex buffer & index buffer) referenced by description chunk
+	 * @note Only positions are decoded. Indices are triangle list and always validated against vertices count.
+	 */
+	struct PRMMesh
+	{
+		std::uint32_t vertexBufferChunk { 0u };
+		std::uint32_t indexBufferChunk { 0u };
+		PRMVertexBufferFormat vertexFormat { PRMVertexBufferFormat::VBF_UNKNOWN_VERTEX };
+		std::vector<Vector3> vertices;
+		std::vector<std::uint16_t> indices;
+
+		[[nodiscard]] std::size_t getTrianglesCount() const;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <GameLib/Scene/SceneObject.h>
+#include <GameLib/PRM/PRMChunk.h>
+#include <GameLib/Vector3.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <array>
+
+
+namespace gamelib::prm
+{
+	enum class PRMExportFormat
+	{
+		EF_GLTF_BINARY, ///< glTF 2.0 binary container (.glb)
+		EF_WAVEFRONT_OBJ ///< Wavefront OBJ (.obj)
+	};
+
+	/**
+	 * @brief Writes geometry of PRM primitives to formats which could be opened by external tools.
+	 * @details Primitives are decoded & encoded in parallel by batches. Each encoded batch is flushed to disk before the next batch is decoded,
+	 *          so peak memory usage depends on batch size, not on count of primitives in level.
+	 *          Coordinates are written as is (Z axis is up), only positions & triangles are exported.
+	 */
+	class PRMMeshExporter
+	{
+	public:
+		/**
+		 * @brief Instance of primitive in exported scene
+		 */
+		struct Entry
+		{
+			std::string name;
+			std::uint32_t primitiveIndex { 0u }; ///< Index of description chunk
+			std::array<float, 9> rotation { 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f }; ///< Row-major 3x3 matrix (same layout as ZMatrix33F)
+			Vector3 position {};
+
+			[[nodiscard]] bool hasTransform() const;
+			[[nodiscard]] Vector3 transform(const Vector3 &point) const;
+		};
+
+		struct Options
+		{
+			PRMExportFormat format { PRMExportFormat::EF_GLTF_BINARY };
+			int threadsCount { 0 }; ///< Count of workers (0 - use all hardware threads)
+			std::size_t batchSize { 64 }; ///< Count of primitives decoded at once
+		};
+
+		struct Stats
+		{
+			std::size_t exportedEntries { 0 };
+			std::size_t skippedEntries { 0 }; ///< Entries without geometry
+			std::size_t encodedPrimitives { 0 };
+			std::size_t verticesCount { 0 };
+			std::size_t trianglesCount { 0 };
+			std::size_t bytesWritten { 0 };
+		};
+
+		PRMMeshExporter() = delete;
+
+		/**
+		 * @fn collectPrimitives
+		 * @return entry without transform for each description chunk
+		 */
+		[[nodiscard]] static std::vector<Entry> collectPrimitives(const std::vector<PRMChunk> &chunks);
+
+		/**
+		 * @fn collectGeoms
+		 * @param sceneObjects - geoms to export
+		 * @param chunks - all chunks of PRM file
+		 * @return entry for each geom which refers (via PrimId) to description chunk.
+		 *         Transform is world transform: Matrix & Position properties of geom combined with the same properties of all its parents.
+		 */
+		[[nodiscard]] static std::vector<Entry> collectGeoms(const std::vector<scene::SceneObject::Ptr> &sceneObjects, const std::vector<PRMChunk> &chunks);
+
+		/**
+		 * @fn exportToFile
+		 * @param chunks - all chunks of PRM file
+		 * @param entries - entries to export
+		 * @param options - export options
+		 * @param path - path to output file (will be overwritten)
+		 * @param stats - optional export stats
+		 * @return true when at least one entry was written
+		 * @note glTF exporter writes each primitive once (every entry is a node which refers to shared mesh).
+		 *       Binary chunk is streamed to temporary file (path + ".bin.part") while the JSON chunk is built, then both are assembled into output file.
+		 * @note OBJ exporter writes transformed copy of the primitive for each entry.
+		 */
+		static bool exportToFile(const std::vector<PRMChunk> &chunks, const std::vector<Entry> &entries, const Options &options, const std::string &path, Stats *stats = nullptr);
+	};
+}
\ No newline at end of file
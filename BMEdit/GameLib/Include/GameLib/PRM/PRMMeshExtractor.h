@@ -0,0 +1,47 @@
+#pragma once
+
+#include <GameLib/PRM/PRMChunk.h>
+#include <GameLib/PRM/PRMMesh.h>
+#include <GameLib/BoundingBox.h>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+namespace gamelib::prm
+{
+	/**
+	 * @brief Resolves geometry of primitive by description chunk.
+	 * @details Description chunk refers (via ptrObjects) to the objects table: list of 32 bit chunk indices.
+	 *          Each entry of the table is a mesh record which refers to vertex buffer chunk & index buffer chunk.
+	 *          Layout of mesh record is not fully known yet, so we are looking for the first reference to recognized vertex buffer & index buffer inside of the record.
+	 */
+	class PRMMeshExtractor
+	{
+	public:
+		PRMMeshExtractor() = delete;
+
+		/**
+		 * @fn extract
+		 * @param chunks - all chunks of PRM file
+		 * @param descriptionChunkIndex - index of description chunk
+		 * @param meshes - output meshes (appended)
+		 * @return true when at least one mesh was extracted
+		 */
+		static bool extract(const std::vector<PRMChunk> &chunks, std::uint32_t descriptionChunkIndex, std::vector<PRMMesh> &meshes);
+
+		/**
+		 * @fn collectMeshReferences
+		 * @param chunks - all chunks of PRM file
+		 * @param descriptionChunkIndex - index of description chunk
+		 * @param references - output pairs of (vertex buffer chunk index, index buffer chunk index) without decoding of buffers
+		 * @return true when at least one pair was found
+		 */
+		static bool collectMeshReferences(const std::vector<PRMChunk> &chunks, std::uint32_t descriptionChunkIndex, std::vector<std::pair<std::uint32_t, std::uint32_t>> &references);
+
+		static bool decodeVertices(const PRMChunk &vertexChunk, std::vector<Vector3> &vertices);
+		static bool decodeIndices(const PRMChunk &indexChunk, std::vector<std::uint16_t> &indices);
+
+		[[nodiscard]] static BoundingBox calculateBoundingBox(const std::vector<PRMMesh> &meshes);
+	};
+}
\ No newline at end of file
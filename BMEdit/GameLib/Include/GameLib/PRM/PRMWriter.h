@@ -0,0 +1,60 @@
+#pragma once
+
+#include <GameLib/PRM/PRMHeader.h>
+#include <GameLib/PRM/PRMChunk.h>
+#include <GameLib/PRM/PRMChunkIndex.h>
+#include <GameLib/PRM/PRMChunkDescriptor.h>
+#include <cstdint>
+#include <vector>
+
+
+namespace gamelib::prm
+{
+	enum class PRMWriterLayout
+	{
+		WL_PRESERVE_ORIGINAL, ///< Unchanged chunks & descriptors table keep their source offsets (unmodified input is written byte to byte), other blocks are appended
+		WL_SEQUENTIAL         ///< Header, bodies of chunks in order of indices, descriptors table
+	};
+
+	struct PRMWriterOptions
+	{
+		PRMWriterLayout layout { PRMWriterLayout::WL_PRESERVE_ORIGINAL };
+		std::uint32_t alignment { 0u }; ///< Alignment of placed blocks (0 - detect by source descriptors, see PRMWriter::detectAlignment)
+		bool compactUnusedChunks { false }; ///< Chunks which are not reachable from any description chunk share single empty body declared like zero chunk (indices of chunks are not changed)
+		const PRMChunkIndex *deduplicationIndex { nullptr }; ///< Body of duplicated chunk is not written, its descriptor refers to the body of canonical chunk
+	};
+
+	class PRMWriter
+	{
+	public:
+		static constexpr std::uint32_t kDefaultAlignment = 0x10;
+		static constexpr std::uint32_t kMaxAlignment = 0x1000;
+
+		PRMWriter() = default;
+
+		/**
+		 * @fn write
+		 * @brief Serialize PRM file: header, bodies of chunks & descriptors table
+		 * @param header - source header (offsets are recalculated)
+		 * @param chunkDescriptors - source descriptors (kind & unkC fields are kept, offset & size are recalculated)
+		 * @param chunks - chunks to write
+		 * @param options - layout options
+		 * @param outBuffer - output buffer (result is appended)
+		 */
+		static void write(const PRMHeader &header, const std::vector<PRMChunkDescriptor> &chunkDescriptors, const std::vector<PRMChunk> &chunks, const PRMWriterOptions &options, std::vector<uint8_t> &outBuffer);
+
+		/**
+		 * @fn detectAlignment
+		 * @return the biggest power of two (up to kMaxAlignment) which divides offsets of all non empty chunks (kDefaultAlignment when there are no descriptors)
+		 */
+		[[nodiscard]] static std::uint32_t detectAlignment(const std::vector<PRMChunkDescriptor> &chunkDescriptors);
+
+		/**
+		 * @fn collectUsedChunks
+		 * @brief Find chunks which are reachable from description chunks.
+		 * @note Layout of records is not fully known, so every 16 bit word of reachable chunk (except vertex & index buffers) which looks like a chunk index is treated as reference.
+		 *       It may keep some unused chunks, but never drops a used one.
+		 */
+		static void collectUsedChunks(const std::vector<PRMChunk> &chunks, std::vector<bool> &isUsed);
+	};
+}
\ No newline at end of file
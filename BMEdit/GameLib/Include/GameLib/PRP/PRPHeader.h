@@ -8,9 +8,16 @@ namespace ZBio::ZBinaryWriter
 	class BinaryWriter;
 }
 
+namespace gamelib
+{
+	class LevelSnapshot;
+}
+
 namespace gamelib::prp {
 	class PRPHeader
 	{
+		friend class gamelib::LevelSnapshot;
+
 	public:
 		PRPHeader() = default;
 		PRPHeader(uint32_t totalKeys, bool isRaw, bool isSave = false, bool isTokenTablePresented = true);
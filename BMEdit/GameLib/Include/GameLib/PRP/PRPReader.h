@@ -21,6 +21,7 @@ namespace gamelib::prp {
 		[[nodiscard]] uint32_t getObjectsCount() const;
 		[[nodiscard]] const PRPZDefines &getDefinitions() const;
 		[[nodiscard]] const PRPByteCode &getByteCode() const;
+		[[nodiscard]] int64_t getByteCodeOffset() const;
 
 	private:
 		PRPHeader m_header {};
@@ -28,5 +29,6 @@ namespace gamelib::prp {
 		uint32_t m_objectsCount { 0 };
 		PRPZDefines m_ZDefines {};
 		PRPByteCode m_byteCode {};
+		int64_t m_byteCodeOffset { 0 }; ///< Offset of first instruction in parsed file
 	};
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <unordered_map>
 #include <string>
 #include <vector>
 
@@ -32,5 +33,6 @@ namespace gamelib::prp
 
 	private:
 		std::vector<std::string> m_tokenList;
+		std::unordered_map<std::string, int> m_tokenIndices; ///< Token -> index in m_tokenList
 	};
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include <GameLib/PRP/PRPInstruction.h>
+#include <GameLib/PRP/PRPTokenTable.h>
 #include <GameLib/PRP/PRPZDefines.h>
 
 
@@ -15,5 +16,20 @@ namespace gamelib::prp
 		PRPWriter() = default;
 
 		static void write(const PRPZDefines &definitions, const std::vector<PRPInstruction> &instructions, bool isRaw, std::vector<uint8_t> &outBuffer);
+
+		/**
+		 * @fn registerTokens
+		 * @brief Add strings of definitions to token table
+		 * @param tokensDataSize - size of token table in bytes (increased by size of each new token)
+		 */
+		static void registerTokens(const PRPZDefines &definitions, PRPTokenTable &tokenTable, uint32_t &tokensDataSize);
+
+		/**
+		 * @fn registerTokens
+		 * @brief Add strings of instructions to token table
+		 * @param tokensDataSize - size of token table in bytes (increased by size of each new token)
+		 * @return count of objects (BeginObject & BeginNamedObject) in instructions
+		 */
+		static int registerTokens(const std::vector<PRPInstruction> &instructions, PRPTokenTable &tokenTable, uint32_t &tokensDataSize);
 	};
 }
\ No newline at end of file
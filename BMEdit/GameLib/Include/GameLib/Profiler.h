@@ -0,0 +1,145 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+namespace gamelib
+{
+	/**
+	 * @brief Aggregated stats of one scope or counter (see Profiler::getSummary)
+	 */
+	struct ProfilerSummaryEntry
+	{
+		std::string name {};
+		bool isCounter { false };
+		std::uint32_t callsCount { 0 }; ///< Count of finished scopes (or counter updates)
+		double totalMs { 0.0 };         ///< Scopes only
+		double maxMs { 0.0 };           ///< Scopes only
+		std::int64_t total { 0 };       ///< Counters only: sum of all values
+	};
+
+	/**
+	 * @brief Collects timings of hot paths (scopes) and counters of GameLib.
+	 * @details Profiler is compiled in when GAMELIB_ENABLE_PROFILER is defined (CMake option of the same name) and collects data only after setEnabled(true).
+	 *          Use GAMELIB_PROFILE_SCOPE / GAMELIB_PROFILE_COUNTER macros instead of direct calls: they are expanded to nothing when profiler is not compiled in.
+	 *          Names of scopes and counters must be string literals (profiler keeps pointers).
+	 */
+	class Profiler
+	{
+		Profiler();
+
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		Profiler(const Profiler &) = delete;
+		Profiler(Profiler &&) = delete;
+		Profiler &operator=(const Profiler &) = delete;
+		Profiler &operator=(Profiler &&) = delete;
+
+		static Profiler &getInstance();
+
+		void setEnabled(bool isEnabled);
+		[[nodiscard]] bool isEnabled() const;
+
+		/**
+		 * @fn reset
+		 * @brief Drop collected data and start new session (timestamps of trace are relative to this moment)
+		 */
+		void reset();
+
+		void addScope(const char *name, Clock::time_point begin, Clock::time_point end);
+		void addCounter(const char *name, std::int64_t value);
+
+		/**
+		 * @fn getSummary
+		 * @return scopes (sorted by total time, slowest first) followed by counters
+		 */
+		[[nodiscard]] std::vector<ProfilerSummaryEntry> getSummary() const;
+
+		/**
+		 * @fn writeChromeTrace
+		 * @brief Save collected data in Chrome trace event format (chrome://tracing, Perfetto)
+		 * @return false when file could not be written
+		 */
+		bool writeChromeTrace(const std::string &path) const;
+
+	private:
+		struct ScopeEvent
+		{
+			const char *name { nullptr };
+			std::int64_t beginUs { 0 };
+			std::int64_t durationUs { 0 };
+			std::uint32_t threadIndex { 0 };
+		};
+
+		struct CounterEvent
+		{
+			const char *name { nullptr };
+			std::int64_t timestampUs { 0 };
+			std::int64_t value { 0 };
+		};
+
+		[[nodiscard]] std::int64_t toSessionTime(Clock::time_point timePoint) const;
+		[[nodiscard]] static std::uint32_t getThreadIndex();
+
+	private:
+		std::atomic<bool> m_isEnabled { false };
+		mutable std::mutex m_lock {};
+		Clock::time_point m_sessionBegin {};
+		std::vector<ScopeEvent> m_scopes {};
+		std::vector<CounterEvent> m_counters {};
+	};
+
+	/**
+	 * @brief RAII scope timer (use GAMELIB_PROFILE_SCOPE)
+	 */
+	class ProfilerScope
+	{
+	public:
+		explicit ProfilerScope(const char *name)
+			: m_name(Profiler::getInstance().isEnabled() ? name : nullptr)
+		{
+			if (m_name)
+			{
+				m_begin = Profiler::Clock::now();
+			}
+		}
+
+		~ProfilerScope()
+		{
+			if (m_name)
+			{
+				Profiler::getInstance().addScope(m_name, m_begin, Profiler::Clock::now());
+			}
+		}
+
+		ProfilerScope(const ProfilerScope &) = delete;
+		ProfilerScope(ProfilerScope &&) = delete;
+		ProfilerScope &operator=(const ProfilerScope &) = delete;
+		ProfilerScope &operator=(ProfilerScope &&) = delete;
+
+	private:
+		const char *m_name { nullptr };
+		Profiler::Clock::time_point m_begin {};
+	};
+}
+
+#if defined(GAMELIB_ENABLE_PROFILER)
+#define GAMELIB_PROFILER_CONCAT_IMPL(a, b) a##b
+#define GAMELIB_PROFILER_CONCAT(a, b) GAMELIB_PROFILER_CONCAT_IMPL(a, b)
+#define GAMELIB_PROFILE_SCOPE(name) ::gamelib::ProfilerScope GAMELIB_PROFILER_CONCAT(profilerScope, __LINE__) { name }
+#define GAMELIB_PROFILE_COUNTER(name, value)                                                                  \
+	do                                                                                                        \
+	{                                                                                                         \
+		if (::gamelib::Profiler::getInstance().isEnabled())                                                   \
+			::gamelib::Profiler::getInstance().addCounter(name, static_cast<std::int64_t>(value));            \
+	} while (false)
+#else
+#define GAMELIB_PROFILE_SCOPE(name) (void)0
+#define GAMELIB_PROFILE_COUNTER(name, value) (void)0
+#endif
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+
+
+namespace gamelib
+{
+	/**
+	 * @class Revision
+	 * @brief Stamp of last change. Stamps are taken from one process-wide counter, so each change gets stamp greater than any stamp issued before.
+	 * @details Copy & assignment take new stamp instead of copying it: assigned object is changed object.
+	 *          Thanks to that maximum of stamps of parts (eg. properties and controllers of scene object) grows on change of any part.
+	 */
+	class Revision
+	{
+	public:
+		Revision();
+		Revision(const Revision &);
+		Revision &operator=(const Revision &);
+
+		/**
+		 * @fn bump
+		 * @brief Take new stamp (must be called on each change of owner)
+		 */
+		void bump();
+
+		[[nodiscard]] std::uint64_t get() const;
+
+	private:
+		std::uint64_t m_stamp { 0u };
+	};
+}
\ No newline at end of file
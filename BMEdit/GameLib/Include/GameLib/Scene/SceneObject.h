@@ -8,6 +8,7 @@
 
 #include <GameLib/GMS/GMSGeomEntity.h>
 #include <GameLib/PRP/PRPInstruction.h>
+#include <GameLib/Revision.h>
 #include <GameLib/Span.h>
 #include <GameLib/Type.h>
 #include <map>
@@ -15,7 +16,7 @@
 
 namespace gamelib::scene
 {
-	class SceneObject
+	class SceneObject : public std::enable_shared_from_this<SceneObject>
 	{
 	public:
 		using Ptr = std::shared_ptr<SceneObject>;
@@ -36,11 +37,32 @@ namespace gamelib::scene
 		using Controllers = std::vector<Controller>;
 		using ControllerHandle = size_t;
 
+		static constexpr int kNoSiblingIndex = -1;
+
 		SceneObject();
 		SceneObject(std::string name, uint32_t typeId, const Type *type, gms::GMSGeomEntity geomEntity, Instructions rawProperties);
 
 		void setParent(const SceneObject::Ptr& parent);
 
+		/**
+		 * @fn addChild
+		 * @brief Append child to the end of children list and assign sibling index to it
+		 */
+		void addChild(const SceneObject::Ptr &child);
+
+		/**
+		 * @fn insertChild
+		 * @brief Insert child at position (clamped to children count). Sibling indices of following children are shifted.
+		 * @note Child becomes a child of this object: it's removed from children of its previous parent (reparent)
+		 */
+		void insertChild(std::size_t position, const SceneObject::Ptr &child);
+
+		/**
+		 * @fn removeChild
+		 * @return true when child was found and removed. Sibling indices of following children are shifted, parent of child is reset.
+		 */
+		bool removeChild(const SceneObject::Ptr &child);
+
 		[[nodiscard]] const std::string &getName() const;
 		[[nodiscard]] uint32_t getTypeId() const;
 		[[nodiscard]] const Type *getType() const;
@@ -52,9 +74,34 @@ namespace gamelib::scene
 		[[nodiscard]] Value &getProperties();
 		[[nodiscard]] const gms::GMSGeomEntity &getGeomInfo() const;
 		[[nodiscard]] gms::GMSGeomEntity &getGeomInfo();
+
+		/**
+		 * @fn updateController
+		 * @brief Rename controller and replace its properties
+		 * @return false when there is no controller with given handle
+		 */
+		bool updateController(ControllerHandle handle, std::string name, const Value &properties);
 		[[nodiscard]] const SceneObject::Ref &getParent() const;
 		[[nodiscard]] const std::vector<SceneObject::Ref> &getChildren() const;
-		[[nodiscard]] std::vector<SceneObject::Ref> &getChildren();
+
+		/**
+		 * @fn getSiblingIndex
+		 * @return index of this object in children list of parent (kNoSiblingIndex when object is not a child of anything)
+		 * @note Maintained by addChild/insertChild/removeChild, so it's O(1)
+		 */
+		[[nodiscard]] int getSiblingIndex() const;
+
+		/**
+		 * @fn getRevision
+		 * @return stamp of last change of object (properties, controllers and children list, see Revision). Grows on each change, so it could be used as dirty flag.
+		 */
+		[[nodiscard]] std::uint64_t getRevision() const;
+
+		/**
+		 * @fn markChanged
+		 * @brief Must be called after object was changed bypassing SceneObject & Value API (eg. controllers list or names of controllers changed via getControllers)
+		 */
+		void markChanged();
 
 	private:
 		std::string m_name {}; ///< Name of geom
@@ -63,8 +110,10 @@ namespace gamelib::scene
 		gms::GMSGeomEntity m_geom {}; ///< Base geom info
 		SceneObject::Ref m_parent {}; ///< Parent geom
 		std::vector<SceneObject::Ref> m_children {}; ///< Children geoms
+		int m_siblingIndex { kNoSiblingIndex }; ///< Index in children list of parent
 		Instructions m_rawProperties {}; ///< Property instructions
 		Controllers m_controllers; ///< Controllers
 		Value m_properties;
+		Revision m_revision {}; ///< Last change of object itself (see getRevision)
 	};
 }
\ No newline at end of file
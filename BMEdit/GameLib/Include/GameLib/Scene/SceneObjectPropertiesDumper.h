@@ -1,5 +1,7 @@
 #pragma once
 
+#include <GameLib/Scene/SceneObject.h>
+#include <GameLib/MemoryReport.h>
 #include <cstdint>
 #include <vector>
 #include <memory>
@@ -10,10 +12,19 @@ namespace gamelib
 	class Level;
 }
 
-namespace gamelib::scene
+namespace gamelib::prp
 {
-	class SceneObject;
+	class PRPZDefines;
+}
 
+namespace gamelib::scene
+{
+	/**
+	 * @brief Serializes properties of scene objects into PRP.
+	 * @details Dumper keeps encoded bytes of each object and token table between dumps, so next dump of the same scene re-encodes only objects
+	 *          which were changed since previous dump (see SceneObject::getRevision). New strings are appended to the end of token table, so bytes of unchanged objects are still valid.
+	 * @note Strings which are not used anymore are kept in token table until reset.
+	 */
 	class SceneObjectPropertiesDumper
 	{
 	public:
@@ -22,8 +33,36 @@ namespace gamelib::scene
 
 		void dump(const Level *level, std::vector<uint8_t> *outBuffer);
 
+		/**
+		 * @fn dump
+		 * @param sceneObjects - all objects of scene (first object is a ROOT)
+		 * @param definitions - ZDefines of level (must be the same object between dumps, they are encoded once)
+		 * @param isRaw - raw flag of PRP header
+		 * @param outBuffer - result
+		 */
+		void dump(const std::vector<SceneObject::Ptr> &sceneObjects, const prp::PRPZDefines &definitions, bool isRaw, std::vector<uint8_t> *outBuffer);
+
+		/**
+		 * @fn reset
+		 * @brief Drop cache (next dump encodes everything from scratch and builds compact token table)
+		 */
+		void reset();
+
+		/**
+		 * @fn getLastEncodedObjectsCount
+		 * @return count of objects which were encoded (not taken from cache) by last dump
+		 */
+		[[nodiscard]] std::size_t getLastEncodedObjectsCount() const;
+
+		/**
+		 * @fn memoryReport
+		 * @return estimation of memory used by cache (see MemoryCategory::SCENE_PROPERTIES_DUMPER)
+		 */
+		[[nodiscard]] MemoryReport memoryReport() const;
+
 	private:
-		void visitSceneObject(const SceneObject *sceneObject);
+		void visitSceneObject(const SceneObject::Ptr &sceneObject);
+		void encodeSceneObject(const SceneObject *sceneObject, std::vector<uint8_t> &bytes, int &objectsCount);
 
 	private:
 		struct DumperContext;
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <GameLib/Scene/SceneObject.h>
+#include <unordered_map>
+#include <string_view>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <mutex>
+
+
+namespace gamelib
+{
+	class Type;
+}
+
+namespace gamelib::scene
+{
+	enum class ScenePropertyColumnKind : std::uint8_t
+	{
+		PCK_NONE,    ///< Property not found (or it has no values)
+		PCK_INT32,   ///< Integers, bools, chars and bitfields
+		PCK_FLOAT32, ///< Floats (stride 3 - vector, stride 9 - matrix)
+		PCK_STRING   ///< Strings and enums (handles into strings table of column)
+	};
+
+	/**
+	 * @brief Values of one property of all objects of type (and inherited types).
+	 * @details Each row is an object, each row has 'stride' values (count of values of property), values of row are contiguous.
+	 *          Shape of property (kind & stride) is taken from the first object which has the property, rows which do not match the shape are marked as absent.
+	 */
+	struct ScenePropertyColumn
+	{
+		ScenePropertyColumnKind kind { ScenePropertyColumnKind::PCK_NONE };
+		std::size_t stride { 0 };
+
+		std::vector<std::uint32_t> objects {}; ///< Row -> index of object in Level::getSceneObjects() (sorted)
+		std::vector<std::uint8_t> present {}; ///< Row -> 1 when object has property of column shape
+		std::vector<std::int32_t> ints {}; ///< PCK_INT32: row * stride + component
+		std::vector<float> floats {}; ///< PCK_FLOAT32: row * stride + component
+		std::vector<std::uint32_t> stringHandles {}; ///< PCK_STRING: row * stride + component -> index in strings
+		std::vector<std::string> strings {}; ///< PCK_STRING: unique strings of column
+
+		[[nodiscard]] std::size_t getRowsCount() const { return objects.size(); }
+		[[nodiscard]] bool isPresent(std::size_t row) const { return present[row] != 0; }
+		[[nodiscard]] std::int32_t getInt(std::size_t row, std::size_t component = 0) const { return ints[row * stride + component]; }
+		[[nodiscard]] float getFloat(std::size_t row, std::size_t component = 0) const { return floats[row * stride + component]; }
+		[[nodiscard]] const std::string &getString(std::size_t row, std::size_t component = 0) const { return strings[stringHandles[row * stride + component]]; }
+	};
+
+	/**
+	 * @brief Extracts property of all objects of type (including inherited types) into typed columns.
+	 * @details Objects are decoded in parallel, columns are cached until owner tells that object was changed (invalidateObject) or everything was changed (invalidate).
+	 *          Objects are identified by index in Level::getSceneObjects().
+	 *          Inheritance is taken from TypeRegistry::getTypeHierarchy and property is searched once per type in TypeRegistry::getPropertiesTable
+	 *          (mapped values keep entries in order of the table), so types of objects must be registered.
+	 */
+	class ScenePropertyColumns
+	{
+	public:
+		ScenePropertyColumns() = default;
+
+		/**
+		 * @fn build
+		 * @param sceneObjects - all objects of level (extractor keeps references to them)
+		 * @param threadsCount - count of workers (0 - use all hardware threads)
+		 */
+		void build(const std::vector<SceneObject::Ptr> &sceneObjects, int threadsCount = 0);
+
+		/**
+		 * @fn getColumn
+		 * @param typeName - name of type (objects of inherited types are included)
+		 * @param propertyName - name of property
+		 * @return column (cached) or nullptr when there are no objects of this type
+		 * @note Thread safe
+		 */
+		[[nodiscard]] std::shared_ptr<const ScenePropertyColumn> getColumn(std::string_view typeName, std::string_view propertyName) const;
+
+		/**
+		 * @fn invalidateObject
+		 * @brief Drop cached columns which contain the object (must be called after properties of object were changed)
+		 */
+		void invalidateObject(std::uint32_t objectIndex);
+
+		/**
+		 * @fn invalidate
+		 * @brief Drop all cached columns
+		 */
+		void invalidate();
+
+		[[nodiscard]] std::size_t getObjectsCount() const;
+
+	private:
+		[[nodiscard]] std::shared_ptr<const ScenePropertyColumn> extract(const std::vector<std::uint32_t> &objects, std::string_view propertyName) const;
+
+	private:
+		std::vector<SceneObject::Ptr> m_objects {};
+		int m_threadsCount { 0 };
+
+		std::unordered_map<std::string, const Type *> m_typesByName {};
+		std::unordered_map<const Type *, std::vector<std::uint32_t>> m_objectsByType {}; ///< Type -> objects of type and inherited types
+
+		mutable std::mutex m_columnsLock {};
+		mutable std::unordered_map<const Type *, std::unordered_map<std::string, std::shared_ptr<const ScenePropertyColumn>>> m_columns {};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <string_view>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace gamelib::scene
+{
+	enum class SceneQueryField
+	{
+		QF_NAME,       ///< name:Lamp or just Lamp - substring of object name
+		QF_TYPE,       ///< type:ZHM3Actor - object type is ZHM3Actor or inherited of it
+		QF_CONTROLLER, ///< controller:CPatrol - object has controller with this name
+		QF_PROPERTY,   ///< prop:PrimId>100 - object has property (and value of property satisfies condition)
+		QF_UNDER       ///< under:"ROOT\Outside" - object is a descendant of object with this path (or name)
+	};
+
+	enum class SceneQueryOperator
+	{
+		QO_EXISTS,        ///< prop:Name
+		QO_EQUAL,         ///< prop:Name=Value
+		QO_NOT_EQUAL,     ///< prop:Name!=Value
+		QO_LESS,          ///< prop:Name<Value
+		QO_LESS_EQUAL,    ///< prop:Name<=Value
+		QO_GREATER,       ///< prop:Name>Value
+		QO_GREATER_EQUAL, ///< prop:Name>=Value
+		QO_CONTAINS       ///< prop:Name~Value (substring of string value)
+	};
+
+	struct SceneQueryTerm
+	{
+		SceneQueryField field { SceneQueryField::QF_NAME };
+		SceneQueryOperator op { SceneQueryOperator::QO_EXISTS };
+		std::string property {}; ///< Name of property (QF_PROPERTY only)
+		std::string value {};
+		bool isNegated { false }; ///< -type:ZGROUP
+	};
+
+	/**
+	 * @brief Parsed scene query: list of terms which must be satisfied all together.
+	 * @details Syntax: terms are separated by whitespaces, each term is [-]field:value or just value (name substring).
+	 *          Values could be quoted: "ROOT\Outside", inside quotes \" is a quote and \\ is a backslash.
+	 *          Example: type:ZHM3Actor controller:CPatrol prop:PrimId>100 under:"ROOT\\Outside"
+	 */
+	class SceneQuery
+	{
+	public:
+		SceneQuery() = default;
+
+		/**
+		 * @fn parse
+		 * @param text - query text
+		 * @return parsed query
+		 * @throws SceneQueryException when query is malformed
+		 */
+		[[nodiscard]] static SceneQuery parse(std::string_view text);
+
+		[[nodiscard]] bool empty() const;
+		[[nodiscard]] const std::vector<SceneQueryTerm> &getTerms() const;
+
+	private:
+		std::vector<SceneQueryTerm> m_terms {};
+	};
+}
\ No newline at end of file
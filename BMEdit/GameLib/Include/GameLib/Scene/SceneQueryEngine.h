@@ -0,0 +1,114 @@
+#pragma once
+
+#include <GameLib/Scene/ScenePropertyColumns.h>
+#include <GameLib/Scene/SceneSearchIndex.h>
+#include <GameLib/Scene/SceneObject.h>
+#include <GameLib/Scene/SceneQuery.h>
+#include <unordered_map>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace gamelib
+{
+	class Type;
+}
+
+namespace gamelib::scene
+{
+	/**
+	 * @brief Evaluates SceneQuery against objects of level.
+	 * @details Indexes which are built once:
+	 *            - names & paths (SceneSearchIndex)
+	 *            - type hierarchy (TypeRegistry::getTypeHierarchy): each type gets [enter; exit] DFS numbers, so 'object type is inherited of T' is a range check
+	 *            - scene hierarchy: the same numbering over scene tree, so 'object is under X' is a range check
+	 *            - controllers: controller name -> objects
+	 *          Property values are taken from ScenePropertyColumns (one column per root type), columns are extracted on first use
+	 *          and cached until objects are invalidated. String conditions are checked once per distinct string of column.
+	 *          Objects are checked in parallel.
+	 */
+	class SceneQueryEngine
+	{
+	public:
+		static constexpr std::uint32_t kInvalidObject = SceneSearchIndex::kInvalidObject;
+
+		SceneQueryEngine() = default;
+
+		/**
+		 * @fn build
+		 * @param sceneObjects - all objects of level (engine keeps references to them)
+		 * @param threadsCount - count of workers (0 - use all hardware threads)
+		 */
+		void build(const std::vector<SceneObject::Ptr> &sceneObjects, int threadsCount = 0);
+
+		/**
+		 * @fn execute
+		 * @param query - parsed query
+		 * @param results - indices of matched objects (sorted)
+		 * @note Empty query matches nothing
+		 */
+		void execute(const SceneQuery &query, std::vector<std::uint32_t> &results) const;
+
+		/**
+		 * @fn invalidateProperties
+		 * @brief Drop all cached property columns
+		 */
+		void invalidateProperties();
+
+		/**
+		 * @fn invalidateObject
+		 * @brief Drop cached property columns which contain the object (must be called after properties of object were changed)
+		 */
+		void invalidateObject(std::uint32_t objectIndex);
+
+		/**
+		 * @fn invalidateValue
+		 * @brief Drop cached property columns which contain the object owning this properties value (values of controllers are not indexed)
+		 * @return true when value belongs to one of objects
+		 */
+		bool invalidateValue(const Value *value);
+
+		[[nodiscard]] std::size_t getObjectsCount() const;
+		[[nodiscard]] const SceneObject::Ptr &getObject(std::uint32_t objectIndex) const;
+		[[nodiscard]] const SceneSearchIndex &getSearchIndex() const;
+
+	private:
+		struct Range
+		{
+			std::uint32_t enter { 0u };
+			std::uint32_t exit { 0u };
+
+			[[nodiscard]] bool contains(std::uint32_t order) const { return order >= enter && order <= exit; }
+		};
+
+		struct CompiledTerm;
+
+		void buildTypeOrder();
+		void buildTreeOrder();
+		[[nodiscard]] std::string resolvePropertyName(const std::string &propertyName) const;
+		[[nodiscard]] CompiledTerm compile(const SceneQueryTerm &term) const;
+
+	private:
+		std::vector<SceneObject::Ptr> m_objects {};
+		SceneSearchIndex m_searchIndex {};
+		int m_threadsCount { 0 };
+
+		// Types
+		std::unordered_map<const Type *, Range> m_typeRanges {};
+		std::unordered_map<std::string, const Type *> m_typesByName {}; ///< Lower case name -> type
+		std::vector<std::uint32_t> m_objectTypeOrder {}; ///< Object -> enter number of its type
+		std::vector<const Type *> m_rootTypes {}; ///< Types without parents (each object is a row of column of one root type)
+
+		// Scene tree
+		std::vector<Range> m_treeRanges {}; ///< Object -> range of its subtree
+
+		// Controllers
+		std::unordered_map<std::string, std::vector<std::uint32_t>> m_controllers {}; ///< Lower case controller name -> objects
+
+		// Properties
+		ScenePropertyColumns m_propertyColumns {};
+		std::unordered_map<const Value *, std::uint32_t> m_objectsByProperties {}; ///< Properties of object -> object
+	};
+}
\ No newline at end of file
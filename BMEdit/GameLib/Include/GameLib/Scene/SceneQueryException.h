@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdexcept>
+#include <cstdint>
+
+#include <string>
+
+
+namespace gamelib::scene
+{
+	class SceneQueryException : public std::exception
+	{
+	protected:
+		std::string m_errorDesc;
+		std::string m_cachedWhat;
+		std::size_t m_position;
+
+	public:
+		SceneQueryException(std::size_t position, std::string errorDescription);
+
+		[[nodiscard]] std::size_t getPosition() const;
+		[[nodiscard]] const std::string &getDescription() const;
+		[[nodiscard]] char const* what() const override;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <GameLib/Scene/SceneObject.h>
+#include <unordered_map>
+#include <string_view>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace gamelib::scene
+{
+	enum class SceneSearchField : std::uint8_t
+	{
+		SSF_NAME = 1 << 0, ///< Name of geom
+		SSF_TYPE = 1 << 1, ///< Name of geom type
+		SSF_PATH = 1 << 2  ///< Full path of geom (names of parents joined by '\')
+	};
+
+	[[nodiscard]] constexpr SceneSearchField operator|(SceneSearchField a, SceneSearchField b)
+	{
+		return static_cast<SceneSearchField>(static_cast<std::uint8_t>(a) | static_cast<std::uint8_t>(b));
+	}
+
+	[[nodiscard]] constexpr bool operator&(SceneSearchField a, SceneSearchField b)
+	{
+		return (static_cast<std::uint8_t>(a) & static_cast<std::uint8_t>(b)) != 0;
+	}
+
+	/**
+	 * @brief Case insensitive substring search over names, types and paths of scene objects.
+	 * @details Names are indexed by trigrams: candidates are taken from the shortest posting list of query trigrams and verified by substring search.
+	 *          Types are matched once per distinct type, paths are scanned in parallel (they share prefixes, so trigrams of paths are useless).
+	 *          Objects are identified by index in Level::getSceneObjects().
+	 * @note Index is immutable after build, so it could be built on worker thread and shared between threads.
+	 */
+	class SceneSearchIndex
+	{
+	public:
+		static constexpr std::uint32_t kInvalidObject = 0xFFFFFFFFu;
+
+		SceneSearchIndex() = default;
+
+		/**
+		 * @fn build
+		 * @param sceneObjects - all objects of level (first object is a ROOT)
+		 * @param threadsCount - count of workers (0 - use all hardware threads)
+		 */
+		void build(const std::vector<SceneObject::Ptr> &sceneObjects, int threadsCount = 0);
+
+		/**
+		 * @fn find
+		 * @param query - substring to find (case insensitive). Empty query matches nothing.
+		 * @param fields - fields to search in
+		 * @param matches - indices of matched objects (sorted)
+		 * @param candidates - when presented only these objects are checked (used to refine results of previous query which is substring of new query)
+		 */
+		void find(std::string_view query, SceneSearchField fields, std::vector<std::uint32_t> &matches, const std::vector<std::uint32_t> *candidates = nullptr) const;
+
+		/**
+		 * @fn collectVisible
+		 * @brief Mark matched objects and all their ancestors (each ancestor is visited once)
+		 * @param matches - indices of matched objects
+		 * @param visible - output flags (one per object)
+		 */
+		void collectVisible(const std::vector<std::uint32_t> &matches, std::vector<bool> &visible) const;
+
+		[[nodiscard]] bool empty() const;
+		[[nodiscard]] std::size_t getObjectsCount() const;
+		[[nodiscard]] std::uint32_t getObjectIndex(const SceneObject *sceneObject) const;
+		[[nodiscard]] std::uint32_t getParentIndex(std::uint32_t objectIndex) const;
+		[[nodiscard]] const std::string &getName(std::uint32_t objectIndex) const;
+		[[nodiscard]] const std::string &getPath(std::uint32_t objectIndex) const;
+
+		/**
+		 * @fn toLower
+		 * @return ASCII lower case copy of string (names of geoms are always ASCII)
+		 */
+		[[nodiscard]] static std::string toLower(std::string_view str);
+
+	private:
+		[[nodiscard]] bool isMatch(std::uint32_t objectIndex, std::string_view loweredQuery, SceneSearchField fields, const std::vector<bool> &matchedTypes) const;
+
+	private:
+		std::vector<std::string> m_names {}; ///< Lower case names
+		std::vector<std::string> m_paths {}; ///< Lower case paths
+		std::vector<std::uint32_t> m_typeIndices {}; ///< Object -> index in m_typeNames
+		std::vector<std::string> m_typeNames {}; ///< Lower case names of distinct types
+		std::vector<std::uint32_t> m_parents {}; ///< Object -> index of parent (kInvalidObject for ROOT)
+		std::unordered_map<const SceneObject *, std::uint32_t> m_objectIndices {};
+		std::unordered_map<std::uint32_t, std::vector<std::uint32_t>> m_nameTrigrams {}; ///< Trigram -> sorted indices of objects
+		int m_threadsCount { 0 };
+	};
+}
\ No newline at end of file
@@ -3,8 +3,11 @@
 #include <GameLib/Type.h>
 #include <GameLib/ValueView.h>
 #include <GameLib/GeomBasedTypeInfo.h>
+#include <GameLib/ValueEntriesIndex.h>
 #include <optional>
 #include <variant>
+#include <memory>
+#include <mutex>
 
 
 namespace gamelib
@@ -29,6 +32,13 @@ namespace gamelib
 		[[nodiscard]] bool hasGeomInfo() const;
 		[[nodiscard]] const GeomBasedTypeInfo &getGeomInfo() const;
 
+		/**
+		 * @fn getEntriesIndex
+		 * @param entries - entries of value mapped by this type (used only when index was not built yet)
+		 * @return names index shared between all values mapped by this type
+		 */
+		[[nodiscard]] const std::shared_ptr<const ValueEntriesIndex> &getEntriesIndex(Span<ValueEntry> entries) const;
+
 		[[nodiscard]] VerificationResult verify(const Span<prp::PRPInstruction>& instructions) const override;
 		[[nodiscard]] Type::DataMappingResult map(const Span<prp::PRPInstruction> &instructions) const override;
 
@@ -40,5 +50,7 @@ namespace gamelib
 		TypeReference m_parent {};
 		bool m_allowUnexposedInstructions { false };
 		std::optional<GeomBasedTypeInfo> m_geomInfo;
+		mutable std::once_flag m_entriesIndexFlag {};
+		mutable std::shared_ptr<const ValueEntriesIndex> m_entriesIndex {}; ///< Layout of mapped value is fixed, so index is shared between all values of type
 	};
 }
\ No newline at end of file
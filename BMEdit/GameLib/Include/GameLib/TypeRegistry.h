@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string_view>
 #include <vector>
 #include <memory>
 #include <string>
@@ -7,6 +8,7 @@
 #include <unordered_map>
 
 #include <GameLib/Type.h>
+#include <GameLib/ValueView.h>
 #include <GameLib/StringLiteral.h>
 
 #include <nlohmann/json.hpp>
@@ -19,6 +21,17 @@ namespace gamelib
 		TypeRegistry();
 
 	public:
+		/**
+		 * @brief Properties of complex type including inherited ones (properties of root parent goes first, like in PRP data).
+		 *        Owner of each property is available via ValueView::getOwnerType
+		 */
+		using PropertiesTable = std::vector<const ValueView *>;
+
+		/**
+		 * @brief Complex type and its parents (type itself goes first, root parent goes last)
+		 */
+		using TypeHierarchy = std::vector<const Type *>;
+
 		TypeRegistry(const TypeRegistry &) = delete;
 		TypeRegistry(TypeRegistry &&) = delete;
 		TypeRegistry &operator=(const TypeRegistry &) = delete;
@@ -42,6 +55,36 @@ namespace gamelib
 		void linkTypes();
 		void addHashAssociation(std::size_t hash, const std::string &typeName);
 
+		/**
+		 * @fn getTypesHash
+		 * @return hash of registered types database (declarations & hash associations), 0 when nothing registered
+		 * @note Does not depend on order of declarations in registerTypes, so it could be used as part of key of cache files
+		 */
+		[[nodiscard]] std::uint64_t getTypesHash() const;
+
+		/**
+		 * @fn getPropertiesTable
+		 * @param type - any registered type
+		 * @return cached flattened properties of complex type (empty table for other kinds of types)
+		 * @note Tables are built in linkTypes
+		 */
+		[[nodiscard]] const PropertiesTable &getPropertiesTable(const Type *type) const;
+
+		/**
+		 * @fn getTypeHierarchy
+		 * @param type - any registered type
+		 * @return cached chain of complex type and its parents (empty for other kinds of types)
+		 * @note Hierarchies are built in linkTypes together with properties tables
+		 */
+		[[nodiscard]] const TypeHierarchy &getTypeHierarchy(const Type *type) const;
+
+		/**
+		 * @fn findProperties
+		 * @param query - case insensitive substring of property name
+		 * @param results - declarations of matched properties (each property is reported once, at the type where it declared)
+		 */
+		void findProperties(std::string_view query, std::vector<const ValueView *> &results) const;
+
 		template <typename T>
 		T* registerType(std::unique_ptr<T>&& constructedType) requires (std::is_base_of_v<Type, T>)
 		{
@@ -55,6 +98,7 @@ namespace gamelib
 				return nullptr;
 
 			m_types.emplace_back(std::move(constructedType));
+			addToTypesHash(ptr->getName());
 
 			return ptr;
 		}
@@ -81,10 +125,22 @@ namespace gamelib
 
 	private:
 		bool canCastImpl(const Type* pSrc, const Type* pDst) const;
+		void buildPropertiesTables();
+		void addToTypesHash(std::string_view token);
 
 	private:
+		struct DeclaredProperty
+		{
+			std::string lowerName;
+			const ValueView *view { nullptr };
+		};
+
 		std::vector<std::unique_ptr<Type>> m_types;
 		std::unordered_map<std::string, Type*> m_typesByHash;
 		std::unordered_map<std::string, Type*> m_typesByName;
+		std::unordered_map<const Type*, PropertiesTable> m_propertiesTables;
+		std::unordered_map<const Type*, TypeHierarchy> m_typeHierarchies;
+		std::vector<DeclaredProperty> m_declaredProperties;
+		std::uint64_t m_typesHash { 0u };
 	};
 }
\ No newline at end of file
@@ -2,15 +2,19 @@
 
 #include <GameLib/PRP/PRPInstruction.h>
 #include <GameLib/ValueView.h>
+#include <GameLib/Revision.h>
 #include <GameLib/Span.h>
 
+#include <string_view>
 #include <optional>
+#include <memory>
 #include <vector>
 
 
 namespace gamelib
 {
 	class Type;
+	class ValueEntriesIndex;
 
 	/**
 	 * @struct ValueEntry
@@ -59,6 +63,11 @@ namespace gamelib
 		Value(const Type *type, std::vector<prp::PRPInstruction> data);
 		Value(const Type *type, std::vector<prp::PRPInstruction> data, std::vector<ValueView> views);
 
+		/**
+		 * Restore value with known layout (entries must refer to given instructions)
+		 */
+		Value(const Type *type, std::vector<prp::PRPInstruction> data, std::vector<ValueEntry> entries, std::vector<ValueView> views);
+
 		/**
 		 * Store a single value without mapping (for trivial stuff)
 		 * @param another
@@ -79,7 +88,7 @@ namespace gamelib
 		 * @return span of instructions
 		 * @note This function may throw an exception if requested propertyName not found. You should check your property via hasProperty before ask operator[]
 		 */
-		Span<prp::PRPInstruction> operator[](const char* propertyName);
+		Span<prp::PRPInstruction> operator[](std::string_view propertyName);
 
 		[[nodiscard]] bool operator==(const Value &other) const;
 		[[nodiscard]] bool operator!=(const Value &other) const;
@@ -88,15 +97,53 @@ namespace gamelib
 		[[nodiscard]] const std::vector<prp::PRPInstruction>& getInstructions() const;
 		[[nodiscard]] std::vector<prp::PRPInstruction>& getInstructions();
 		[[nodiscard]] Span<ValueEntry> getEntries() const;
+		[[nodiscard]] const std::vector<ValueView> &getViews() const;
 
+		/**
+		 * @fn updateContainer
+		 * @param entryIndex - index of entry (see getEntries)
+		 * @param newDecl - new instructions of entry (must be valid for type of entry property)
+		 * @note Only instructions of entry are replaced, offsets of following entries are moved. Views are not changed.
+		 * @throws std::runtime_error when entry has no type or new instructions are not valid for it
+		 */
 		void updateContainer(int entryIndex, const std::vector<prp::PRPInstruction>& newDecl);
 
-		bool hasProperty(const char* propertyName) const;
+		bool hasProperty(std::string_view propertyName) const;
+
+		/**
+		 * @fn getEntryIndex
+		 * @param propertyName - name of the property
+		 * @return index of entry (see getEntries) or -1 when property not found
+		 * @note When value has entries index lookup is O(1), otherwise entries are compared one by one
+		 */
+		[[nodiscard]] int getEntryIndex(std::string_view propertyName) const;
+
+		/**
+		 * @fn setEntriesIndex
+		 * @param index - name index of entries (built for the same layout of entries, usually shared between all values of type)
+		 * @note Index is dropped when new entry added
+		 */
+		void setEntriesIndex(std::shared_ptr<const ValueEntriesIndex> index);
+		[[nodiscard]] const std::shared_ptr<const ValueEntriesIndex> &getEntriesIndex() const;
+
+		/**
+		 * @fn getRevision
+		 * @return stamp of last change (grows on each change made via Value API, assignment or reported via markChanged, see Revision)
+		 */
+		[[nodiscard]] std::uint64_t getRevision() const;
+
+		/**
+		 * @fn markChanged
+		 * @brief Must be called after instructions were changed in place (via getInstructions)
+		 */
+		void markChanged();
 
 	private:
 		const Type *m_type {nullptr}; // type
 		std::vector<prp::PRPInstruction> m_data; // instructions
 		std::vector<ValueEntry> m_entries; // entries
 		std::vector<ValueView> m_views; // bruh
+		std::shared_ptr<const ValueEntriesIndex> m_entriesIndex {}; // name -> entry (optional)
+		Revision m_revision {}; // last change
 	};
 }
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <GameLib/Span.h>
+#include <string_view>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace gamelib
+{
+	struct ValueEntry;
+
+	/**
+	 * @class ValueEntriesIndex
+	 * @brief Immutable map between entry name and entry index.
+	 * @details Perfect hash (hash and displace): name hash selects bucket, displacement of bucket selects slot, and slots of all names are different.
+	 *          So lookup is two table reads and one string compare.
+	 *          Layout of entries of complex type is fixed, so one index is built per type and shared between all values of this type.
+	 *          When the same name declared twice the first entry wins (like in linear search).
+	 */
+	class ValueEntriesIndex
+	{
+	public:
+		static constexpr int kNotFound = -1;
+
+		explicit ValueEntriesIndex(Span<ValueEntry> entries);
+
+		/**
+		 * @fn find
+		 * @param name - name of entry
+		 * @return index of entry or kNotFound
+		 */
+		[[nodiscard]] int find(std::string_view name) const;
+
+		[[nodiscard]] std::size_t getEntriesCount() const;
+
+	private:
+		[[nodiscard]] static std::uint64_t hash(std::string_view name);
+		[[nodiscard]] static std::uint64_t slotHash(std::uint64_t nameHash, std::uint32_t displacement);
+		bool tryBuild(std::size_t slotsCount);
+
+	private:
+		std::vector<std::string> m_names {}; ///< Names of entries (index of name is index of entry)
+		std::vector<std::uint32_t> m_displacements {}; ///< Bucket -> displacement
+		std::vector<std::int32_t> m_slots {}; ///< Slot -> entry index or kNotFound
+		std::uint64_t m_bucketsMask { 0 };
+		std::uint64_t m_slotsMask { 0 };
+	};
+}
\ No newline at end of file
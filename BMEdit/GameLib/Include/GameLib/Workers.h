@@ -0,0 +1,125 @@
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <vector>
+
+
+namespace gamelib
+{
+	/**
+	 * @fn resolveWorkersCount
+	 * @param requested - requested count of workers (0 or less - use all hardware threads)
+	 * @param maxUseful - count of independent jobs (there is no reason to spawn more workers)
+	 */
+	inline int resolveWorkersCount(int requested, std::size_t maxUseful)
+	{
+		int workersCount = requested > 0 ? requested : static_cast<int>(std::thread::hardware_concurrency());
+		const int upperBound = static_cast<int>(std::min<std::size_t>(std::max<std::size_t>(maxUseful, 1), 0xFFFF));
+		return std::clamp(workersCount, 1, upperBound);
+	}
+
+	/**
+	 * @fn runWorkers
+	 * @brief Run worker function on workersCount threads (caller thread is a worker #0) and wait for all of them
+	 * @note When any worker throws, all threads are joined anyway and the first exception is rethrown on caller thread
+	 */
+	template <typename TWorker>
+	void runWorkers(int workersCount, TWorker &&worker)
+	{
+		std::exception_ptr firstError {};
+		std::mutex errorLock;
+
+		auto saveError = [&firstError, &errorLock](std::exception_ptr error)
+		{
+			std::lock_guard<std::mutex> guard { errorLock };
+			if (!firstError)
+			{
+				firstError = std::move(error);
+			}
+		};
+
+		auto runWorker = [&worker, &saveError](int workerIndex)
+		{
+			try
+			{
+				worker(workerIndex);
+			}
+			catch (...)
+			{
+				saveError(std::current_exception());
+			}
+		};
+
+		std::vector<std::thread> threads;
+		bool isSpawned = true;
+
+		try
+		{
+			threads.reserve(workersCount > 1 ? workersCount - 1 : 0);
+
+			for (int workerIndex = 1; workerIndex < workersCount; ++workerIndex)
+			{
+				threads.emplace_back([&runWorker, workerIndex]() { runWorker(workerIndex); });
+			}
+		}
+		catch (...)
+		{
+			// Workers which were already started must be joined before leaving
+			saveError(std::current_exception());
+			isSpawned = false;
+		}
+
+		if (isSpawned)
+		{
+			runWorker(0);
+		}
+
+		for (auto &thread : threads)
+		{
+			thread.join();
+		}
+
+		if (firstError)
+		{
+			std::rethrow_exception(firstError);
+		}
+	}
+
+	/**
+	 * @fn runParallelFor
+	 * @brief Run job for each index in [first; last) on workers (jobs are taken one by one, so heavy jobs are balanced between workers)
+	 * @param threadsCount - requested count of workers (0 or less - use all hardware threads)
+	 * @note When job throws, jobs which were not started yet are skipped and the first exception is rethrown on caller thread
+	 */
+	template <typename TJob>
+	void runParallelFor(std::size_t first, std::size_t last, int threadsCount, TJob &&job)
+	{
+		if (first >= last)
+		{
+			return;
+		}
+
+		std::atomic<std::size_t> nextIndex { first };
+
+		runWorkers(resolveWorkersCount(threadsCount, last - first), [&](int)
+		{
+			for (auto index = nextIndex.fetch_add(1); index < last; index = nextIndex.fetch_add(1))
+			{
+				try
+				{
+					job(index);
+				}
+				catch (...)
+				{
+					// Other workers stop before their next job, exception is reported by runWorkers
+					nextIndex.store(last);
+					throw;
+				}
+			}
+		});
+	}
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <GameLib/IO/IOLevelAssetsProvider.h>
+#include <GameLib/Scene/SceneQuery.h>
+#include <GameLib/MemoryReport.h>
+#include <unordered_map>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <mutex>
+
+
+namespace gamelib::scene
+{
+	class SceneQueryEngine;
+}
+
+namespace gamelib
+{
+	class Level;
+	class LevelSnapshotCache;
+
+	/**
+	 * @brief Set of levels which are loaded at the same time.
+	 * @details Levels are loaded in parallel and share read-only data:
+	 *            - types database (TypeRegistry must be loaded before levels and must not be changed while workspace has levels)
+	 *            - bodies of PRM chunks with the same content (inside of level and between levels), so memory grows only by unique chunks
+	 *          Shared chunk body is copied when it's requested for modification (see PRMChunk::getBuffer), so levels stay independent.
+	 *          Queries are evaluated by SceneQueryEngine of each level, engines are built on first query.
+	 */
+	class Workspace
+	{
+	public:
+		static constexpr std::uint32_t kInvalidLevel = 0xFFFFFFFFu;
+
+		struct ObjectRef
+		{
+			std::uint32_t levelIndex { kInvalidLevel };
+			std::uint32_t objectIndex { 0u };
+
+			[[nodiscard]] bool operator==(const ObjectRef &other) const = default;
+		};
+
+		Workspace();
+		~Workspace();
+
+		/**
+		 * @fn addLevel
+		 * @return index of level (level is not loaded until loadLevels call)
+		 */
+		std::uint32_t addLevel(std::unique_ptr<io::IOLevelAssetsProvider> &&levelAssetsProvider);
+
+		/**
+		 * @fn loadLevels
+		 * @brief Load all levels which are not loaded yet (in parallel) and share their PRM chunks with other levels
+		 * @param threadsCount - count of workers (0 - use all hardware threads)
+		 * @param snapshotCache - when set, levels are restored from (and saved into) snapshots
+		 * @return true when all levels are loaded
+		 * @note Errors of levels are not thrown, see getLoadError
+		 */
+		bool loadLevels(int threadsCount = 0, const LevelSnapshotCache *snapshotCache = nullptr);
+		void removeLevel(std::uint32_t levelIndex);
+		void clear();
+
+		[[nodiscard]] std::size_t getLevelsCount() const;
+		[[nodiscard]] const Level *getLevel(std::uint32_t levelIndex) const;
+		[[nodiscard]] Level *getLevel(std::uint32_t levelIndex);
+		[[nodiscard]] bool isLevelLoaded(std::uint32_t levelIndex) const;
+		[[nodiscard]] const std::string &getLoadError(std::uint32_t levelIndex) const;
+
+		/**
+		 * @fn findObjects
+		 * @param query - parsed scene query
+		 * @param results - matched objects of all loaded levels (ordered by level, then by object)
+		 */
+		void findObjects(const scene::SceneQuery &query, std::vector<ObjectRef> &results) const;
+
+		/**
+		 * @fn findObjectsByName
+		 * @param name - exact name of object
+		 * @param results - objects with this name in all loaded levels (ordered by level, then by object)
+		 */
+		void findObjectsByName(const std::string &name, std::vector<ObjectRef> &results) const;
+
+		/**
+		 * @fn invalidateQueries
+		 * @brief Drop cached query data of level (must be called after properties of objects were changed)
+		 */
+		void invalidateQueries(std::uint32_t levelIndex);
+
+		[[nodiscard]] std::size_t getSharedChunksCount() const;
+
+		/**
+		 * @fn getSharedBytes
+		 * @return bytes of PRM chunk bodies which are not allocated because of sharing
+		 */
+		[[nodiscard]] std::size_t getSharedBytes() const;
+
+		/**
+		 * @fn memoryReport
+		 * @brief Memory reports of all loaded levels, shared chunk bodies are counted once
+		 */
+		[[nodiscard]] MemoryReport memoryReport() const;
+
+	private:
+		struct LevelSlot
+		{
+			std::unique_ptr<Level> level { nullptr };
+			bool isLoaded { false };
+			std::string loadError {};
+			mutable std::unique_ptr<scene::SceneQueryEngine> queryEngine { nullptr };
+		};
+
+		struct ChunkRef
+		{
+			std::uint32_t levelIndex { kInvalidLevel };
+			std::uint32_t chunkIndex { 0u };
+		};
+
+		struct SharedChunksStats
+		{
+			std::size_t chunksCount { 0 };
+			std::size_t bytes { 0 };
+		};
+
+		void shareChunks(std::uint32_t levelIndex, int threadsCount);
+		[[nodiscard]] SharedChunksStats getSharedChunksStats() const;
+		[[nodiscard]] const scene::SceneQueryEngine &getQueryEngine(const LevelSlot &slot) const;
+
+	private:
+		std::vector<std::unique_ptr<LevelSlot>> m_levels {};
+		std::unordered_map<std::uint64_t, std::vector<ChunkRef>> m_chunksByHash {}; ///< Content hash -> chunks which own unique content
+		mutable std::mutex m_queryEnginesLock {};
+	};
+}
\ No newline at end of file
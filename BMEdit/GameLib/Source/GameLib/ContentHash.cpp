@@ -0,0 +1,137 @@
+#include <GameLib/ContentHash.h>
+
+
+namespace gamelib
+{
+	namespace
+	{
+		constexpr std::uint64_t kPrime1 = 0x9E3779B185EBCA87ull;
+		constexpr std::uint64_t kPrime2 = 0xC2B2AE3D27D4EB4Full;
+		constexpr std::uint64_t kPrime3 = 0x165667B19E3779F9ull;
+		constexpr std::uint64_t kPrime4 = 0x85EBCA77C2B2AE63ull;
+		constexpr std::uint64_t kPrime5 = 0x27D4EB2F165667C5ull;
+
+		constexpr std::uint64_t rotl(std::uint64_t value, int bits)
+		{
+			return (value << bits) | (value >> (64 - bits));
+		}
+
+		std::uint64_t read64(const std::uint8_t *data)
+		{
+			std::uint64_t value = 0;
+
+			for (int i = 0; i < 8; ++i)
+			{
+				value |= static_cast<std::uint64_t>(data[i]) << (i * 8);
+			}
+
+			return value;
+		}
+
+		std::uint32_t read32(const std::uint8_t *data)
+		{
+			return static_cast<std::uint32_t>(data[0]) | (static_cast<std::uint32_t>(data[1]) << 8) | (static_cast<std::uint32_t>(data[2]) << 16) | (static_cast<std::uint32_t>(data[3]) << 24);
+		}
+
+		constexpr std::uint64_t round(std::uint64_t accumulator, std::uint64_t input)
+		{
+			accumulator += input * kPrime2;
+			accumulator = rotl(accumulator, 31);
+			return accumulator * kPrime1;
+		}
+
+		constexpr std::uint64_t mergeRound(std::uint64_t accumulator, std::uint64_t value)
+		{
+			accumulator ^= round(0, value);
+			return accumulator * kPrime1 + kPrime4;
+		}
+
+		constexpr std::uint64_t avalanche(std::uint64_t hash)
+		{
+			hash ^= hash >> 33;
+			hash *= kPrime2;
+			hash ^= hash >> 29;
+			hash *= kPrime3;
+			hash ^= hash >> 32;
+			return hash;
+		}
+	}
+
+	std::uint64_t ContentHash::compute(const std::uint8_t *data, std::size_t size, std::uint64_t seed)
+	{
+		const std::uint8_t *current = data;
+		const std::uint8_t *end = data + size;
+		std::uint64_t hash;
+
+		if (size >= 32)
+		{
+			// Four independent lanes per 32 bytes stripe
+			std::uint64_t v1 = seed + kPrime1 + kPrime2;
+			std::uint64_t v2 = seed + kPrime2;
+			std::uint64_t v3 = seed;
+			std::uint64_t v4 = seed - kPrime1;
+
+			const std::uint8_t *limit = end - 32;
+
+			do
+			{
+				v1 = round(v1, read64(current + 0));
+				v2 = round(v2, read64(current + 8));
+				v3 = round(v3, read64(current + 16));
+				v4 = round(v4, read64(current + 24));
+				current += 32;
+			} while (current <= limit);
+
+			hash = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+			hash = mergeRound(hash, v1);
+			hash = mergeRound(hash, v2);
+			hash = mergeRound(hash, v3);
+			hash = mergeRound(hash, v4);
+		}
+		else
+		{
+			hash = seed + kPrime5;
+		}
+
+		hash += static_cast<std::uint64_t>(size);
+
+		// Tail
+		while (current + 8 <= end)
+		{
+			hash ^= round(0, read64(current));
+			hash = rotl(hash, 27) * kPrime1 + kPrime4;
+			current += 8;
+		}
+
+		if (current + 4 <= end)
+		{
+			hash ^= static_cast<std::uint64_t>(read32(current)) * kPrime1;
+			hash = rotl(hash, 23) * kPrime2 + kPrime3;
+			current += 4;
+		}
+
+		while (current < end)
+		{
+			hash ^= static_cast<std::uint64_t>(*current) * kPrime5;
+			hash = rotl(hash, 11) * kPrime1;
+			++current;
+		}
+
+		return avalanche(hash);
+	}
+
+	std::uint64_t ContentHash::compute(Span<uint8_t> buffer, std::uint64_t seed)
+	{
+		if (!buffer)
+		{
+			return compute(nullptr, 0, seed);
+		}
+
+		return compute(buffer.cbegin(), static_cast<std::size_t>(buffer.size()), seed);
+	}
+
+	std::uint64_t ContentHash::combine(std::uint64_t hash, std::uint64_t value)
+	{
+		return avalanche(hash ^ round(0, value) ^ (hash << 6) ^ (hash >> 2));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,270 @@
+#include <GameLib/EditJournal.h>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+
+namespace gamelib
+{
+	using namespace prp;
+
+	EditJournal::EditJournal(std::size_t memoryLimit, Clock::duration coalesceWindow)
+		: m_memoryLimit(memoryLimit), m_coalesceWindow(coalesceWindow)
+	{
+	}
+
+	bool EditJournal::setEntry(Value &value, int entryIndex, const std::vector<PRPInstruction> &newInstructions, Clock::time_point now)
+	{
+		if (!isValidEntry(value, entryIndex))
+		{
+			throw std::out_of_range("Entry index is out of range");
+		}
+
+		const auto &entry = value.getEntries()[entryIndex];
+		const std::size_t entryOffset = entry.instructions.offset();
+		const std::size_t entrySize = entry.instructions.size();
+		const std::size_t newSize = newInstructions.size();
+		const auto entryBegin = value.getInstructions().begin() + static_cast<std::ptrdiff_t>(entryOffset);
+
+		// Drop common prefix & suffix, only changed part is stored
+		const std::size_t maxCommon = std::min(entrySize, newSize);
+		std::size_t prefix = 0;
+
+		while (prefix < maxCommon && entryBegin[static_cast<std::ptrdiff_t>(prefix)] == newInstructions[prefix])
+		{
+			++prefix;
+		}
+
+		if (prefix == entrySize && prefix == newSize)
+		{
+			return false; // Nothing changed
+		}
+
+		std::size_t suffix = 0;
+
+		while (suffix < maxCommon - prefix && entryBegin[static_cast<std::ptrdiff_t>(entrySize - 1 - suffix)] == newInstructions[newSize - 1 - suffix])
+		{
+			++suffix;
+		}
+
+		Record record;
+		record.value = &value;
+		record.entryIndex = entryIndex;
+		record.offset = prefix;
+		record.before.assign(entryBegin + static_cast<std::ptrdiff_t>(prefix), entryBegin + static_cast<std::ptrdiff_t>(entrySize - suffix));
+		record.after.assign(newInstructions.begin() + static_cast<std::ptrdiff_t>(prefix), newInstructions.begin() + static_cast<std::ptrdiff_t>(newSize - suffix));
+		record.time = now;
+
+		// Apply first: invalid data must not be recorded
+		apply(value, entryIndex, record.offset, record.before.size(), record.after);
+
+		// Merge with previous edit of the same instructions
+		if (!m_isSealed && m_cursor == m_records.size() && !m_records.empty())
+		{
+			auto &last = m_records.back();
+
+			if (last.value == record.value &&
+			    last.entryIndex == record.entryIndex &&
+			    last.offset == record.offset &&
+			    last.after.size() == record.before.size() &&
+			    now - last.time <= m_coalesceWindow)
+			{
+				m_memoryUsage -= last.memoryUsage;
+
+				if (last.before == record.after)
+				{
+					// Edit returned instructions back
+					m_records.pop_back();
+					--m_cursor;
+					m_isSealed = true;
+					notify(&value, entryIndex);
+					return true;
+				}
+
+				last.after = std::move(record.after);
+				last.time = now;
+				last.memoryUsage = estimateMemoryUsage(last);
+				m_memoryUsage += last.memoryUsage;
+				notify(&value, entryIndex);
+				return true;
+			}
+		}
+
+		push(std::move(record));
+		m_isSealed = false;
+		notify(&value, entryIndex);
+		return true;
+	}
+
+	std::optional<EditJournal::Change> EditJournal::undo()
+	{
+		if (!canUndo())
+		{
+			return std::nullopt;
+		}
+
+		const auto &record = m_records[m_cursor - 1];
+		if (!isValidEntry(*record.value, record.entryIndex))
+		{
+			// Value was restructured outside of journal, history can't be applied anymore
+			clear();
+			return std::nullopt;
+		}
+
+		--m_cursor;
+		apply(*record.value, record.entryIndex, record.offset, record.after.size(), record.before);
+		m_isSealed = true;
+		notify(record.value, record.entryIndex);
+
+		return Change { record.value, record.entryIndex };
+	}
+
+	std::optional<EditJournal::Change> EditJournal::redo()
+	{
+		if (!canRedo())
+		{
+			return std::nullopt;
+		}
+
+		const auto &record = m_records[m_cursor];
+		if (!isValidEntry(*record.value, record.entryIndex))
+		{
+			clear();
+			return std::nullopt;
+		}
+
+		++m_cursor;
+		apply(*record.value, record.entryIndex, record.offset, record.before.size(), record.after);
+		m_isSealed = true;
+		notify(record.value, record.entryIndex);
+
+		return Change { record.value, record.entryIndex };
+	}
+
+	void EditJournal::seal()
+	{
+		m_isSealed = true;
+	}
+
+	void EditJournal::clear()
+	{
+		m_records.clear();
+		m_cursor = 0;
+		m_memoryUsage = 0;
+		m_isSealed = true;
+	}
+
+	void EditJournal::setChangeListener(ChangeListener listener)
+	{
+		m_changeListener = std::move(listener);
+	}
+
+	bool EditJournal::canUndo() const
+	{
+		return m_cursor > 0;
+	}
+
+	bool EditJournal::canRedo() const
+	{
+		return m_cursor < m_records.size();
+	}
+
+	std::size_t EditJournal::getRecordsCount() const
+	{
+		return m_records.size();
+	}
+
+	std::size_t EditJournal::getMemoryUsage() const
+	{
+		return m_memoryUsage;
+	}
+
+	void EditJournal::apply(Value &value, int entryIndex, std::size_t offset, std::size_t replacedCount, const std::vector<PRPInstruction> &instructions)
+	{
+		const auto &entry = value.getEntries()[entryIndex];
+		const auto entryOffset = static_cast<std::ptrdiff_t>(entry.instructions.offset());
+		const auto entrySize = static_cast<std::ptrdiff_t>(entry.instructions.size());
+		auto &valueInstructions = value.getInstructions();
+
+		if (replacedCount == instructions.size())
+		{
+			// Same size: just replace changed instructions
+			std::copy(instructions.begin(), instructions.end(), valueInstructions.begin() + entryOffset + static_cast<std::ptrdiff_t>(offset));
+			value.markChanged();
+			return;
+		}
+
+		// Size changed: rebuild entry, value will move following entries
+		const auto entryBegin = valueInstructions.begin() + entryOffset;
+		std::vector<PRPInstruction> entryInstructions;
+		entryInstructions.reserve(static_cast<std::size_t>(entrySize) - replacedCount + instructions.size());
+		std::copy(entryBegin, entryBegin + static_cast<std::ptrdiff_t>(offset), std::back_inserter(entryInstructions));
+		std::copy(instructions.begin(), instructions.end(), std::back_inserter(entryInstructions));
+		std::copy(entryBegin + static_cast<std::ptrdiff_t>(offset + replacedCount), entryBegin + entrySize, std::back_inserter(entryInstructions));
+
+		value.updateContainer(entryIndex, entryInstructions);
+	}
+
+	bool EditJournal::isValidEntry(const Value &value, int entryIndex)
+	{
+		return entryIndex >= 0 && entryIndex < value.getEntries().size();
+	}
+
+	std::size_t EditJournal::estimateMemoryUsage(const Record &record)
+	{
+		std::size_t result = sizeof(Record);
+
+		for (const auto *instructions : { &record.before, &record.after })
+		{
+			result += instructions->capacity() * sizeof(PRPInstruction);
+
+			for (const auto &instruction : *instructions)
+			{
+				const auto &operand = instruction.getOperand();
+				result += operand.str.capacity() + operand.raw.capacity() + operand.stringArray.capacity() * sizeof(std::string);
+
+				for (const auto &str : operand.stringArray)
+				{
+					result += str.capacity();
+				}
+			}
+		}
+
+		return result;
+	}
+
+	void EditJournal::push(Record &&record)
+	{
+		dropRedo();
+
+		record.memoryUsage = estimateMemoryUsage(record);
+		m_memoryUsage += record.memoryUsage;
+		m_records.emplace_back(std::move(record));
+		m_cursor = m_records.size();
+
+		// Keep at least last record
+		while (m_memoryUsage > m_memoryLimit && m_records.size() > 1)
+		{
+			m_memoryUsage -= m_records.front().memoryUsage;
+			m_records.pop_front();
+			--m_cursor;
+		}
+	}
+
+	void EditJournal::dropRedo()
+	{
+		while (m_records.size() > m_cursor)
+		{
+			m_memoryUsage -= m_records.back().memoryUsage;
+			m_records.pop_back();
+		}
+	}
+
+	void EditJournal::notify(Value *value, int entryIndex) const
+	{
+		if (m_changeListener)
+		{
+			m_changeListener(Change { value, entryIndex });
+		}
+	}
+}
\ No newline at end of file
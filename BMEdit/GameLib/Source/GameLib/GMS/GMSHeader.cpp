@@ -4,6 +4,7 @@
 #include <GameLib/BinaryReaderSeekScope.h>
 #include <GameLib/TypeRegistry.h>
 #include <GameLib/TypeComplex.h>
+#include <GameLib/Profiler.h>
 #include <ZBinaryReader.hpp>
 
 #include <sstream>
@@ -186,6 +187,8 @@ namespace gamelib::gms
 
 	void GMSHeader::buildSceneHierarchy(GMSHeader &header)
 	{
+		GAMELIB_PROFILE_SCOPE("GMSHeader::buildSceneHierarchy");
+
 		std::vector<GMSGeomEntity*> currentPath {};
 		currentPath.resize(1);
 		currentPath.reserve(128);
@@ -1,4 +1,5 @@
 #include <GameLib/GMS/GMSReader.h>
+#include <GameLib/Profiler.h>
 #include <ZBinaryReader.hpp>
 
 extern "C" {
@@ -12,6 +13,8 @@ namespace gamelib::gms
 
 	bool GMSReader::parse(const GMSHeader *header, const uint8_t *gmsBuffer, int64_t gmsBufferSize, const uint8_t *bufBuffer, int64_t bufBufferSize)
 	{
+		GAMELIB_PROFILE_SCOPE("GMSReader::parse");
+
 		m_header = header;
 
 		// Read RAW header (first 9 bytes)
@@ -45,6 +48,8 @@ namespace gamelib::gms
 	                                                           uint32_t rawBufferSize,
 	                                                           uint32_t uncompressedSize)
 	{
+		GAMELIB_PROFILE_SCOPE("GMSReader::decompressGmsBuffer");
+
 		auto outBuffer = std::make_unique<uint8_t[]>(uncompressedSize);
 		if (!outBuffer)
 		{
@@ -0,0 +1,256 @@
+#include <GameLib/IO/AssetCache.h>
+#include <GameLib/IO/CacheFolder.h>
+#include <GameLib/IO/DeflateCodec.h>
+#include <GameLib/ContentHash.h>
+#include <GameLib/Profiler.h>
+#include <fmt/format.h>
+#include <filesystem>
+#include <fstream>
+#include <cstring>
+
+
+namespace gamelib::io
+{
+	AssetCache::AssetCache(std::size_t capacity) : m_capacity(capacity)
+	{
+	}
+
+	AssetCache &AssetCache::getInstance()
+	{
+		static AssetCache instance;
+		return instance;
+	}
+
+	std::unique_ptr<uint8_t[]> AssetCache::get(const AssetCacheKey &key)
+	{
+		std::shared_ptr<const uint8_t[]> data;
+		std::string persistentPath;
+
+		{
+			std::lock_guard lock { m_lock };
+
+			if (!m_capacity)
+			{
+				return nullptr;
+			}
+
+			if (auto it = m_entriesByKey.find(key); it != m_entriesByKey.end())
+			{
+				m_entries.splice(m_entries.begin(), m_entries, it->second);
+				data = it->second->data;
+				++m_stats.hits;
+			}
+			else
+			{
+				persistentPath = getPersistentPath(key);
+				++m_stats.misses;
+			}
+		}
+
+		if (data)
+		{
+			GAMELIB_PROFILE_COUNTER("Asset cache hits", 1);
+
+			auto buffer = std::make_unique<uint8_t[]>(key.size);
+			std::memcpy(buffer.get(), data.get(), key.size);
+			return buffer;
+		}
+
+		GAMELIB_PROFILE_COUNTER("Asset cache misses", 1);
+
+		if (persistentPath.empty())
+		{
+			return nullptr;
+		}
+
+		// Persisted asset is accepted only when it has expected size
+		std::ifstream file(persistentPath, std::ios::binary | std::ios::ate);
+		if (!file || static_cast<std::uint64_t>(file.tellg()) != key.size)
+		{
+			return nullptr;
+		}
+
+		auto buffer = std::make_unique<uint8_t[]>(key.size);
+		file.seekg(0, std::ios::beg);
+		if (!file.read(reinterpret_cast<char *>(buffer.get()), static_cast<std::streamsize>(key.size)))
+		{
+			return nullptr;
+		}
+
+		file.close();
+
+		// ... and expected content (file could be damaged or written by another build)
+		if (DeflateCodec::computeCRC32(Span<uint8_t>(buffer.get(), static_cast<int64_t>(key.size))) != key.crc)
+		{
+			std::error_code ec;
+			std::filesystem::remove(persistentPath, ec);
+			return nullptr;
+		}
+
+		CacheFolder::touch(persistentPath);
+
+		std::lock_guard lock { m_lock };
+		++m_stats.diskHits;
+
+		if (key.size <= m_capacity)
+		{
+			auto copy = std::make_unique<uint8_t[]>(key.size);
+			std::memcpy(copy.get(), buffer.get(), key.size);
+			insert(key, std::shared_ptr<const uint8_t[]>(std::move(copy)));
+		}
+
+		return buffer;
+	}
+
+	void AssetCache::put(const AssetCacheKey &key, const uint8_t *data, std::size_t size)
+	{
+		if (!data || !size || size != key.size)
+		{
+			return;
+		}
+
+		std::string persistentPath;
+		std::uintmax_t persistentSizeLimit = 0;
+
+		{
+			std::lock_guard lock { m_lock };
+
+			if (size > m_capacity)
+			{
+				return;
+			}
+
+			persistentPath = getPersistentPath(key);
+			persistentSizeLimit = m_persistentSizeLimit;
+		}
+
+		auto copy = std::make_unique<uint8_t[]>(size);
+		std::memcpy(copy.get(), data, size);
+
+		{
+			std::lock_guard lock { m_lock };
+			insert(key, std::shared_ptr<const uint8_t[]>(std::move(copy)));
+		}
+
+		std::error_code ec;
+		if (persistentPath.empty() || std::filesystem::exists(persistentPath, ec))
+		{
+			return;
+		}
+
+		if (!CacheFolder::writeAtomically(persistentPath, data, size))
+		{
+			return;
+		}
+
+		CacheFolder::trim(std::filesystem::path(persistentPath).parent_path().string(), kAssetExtension, persistentSizeLimit, persistentPath);
+	}
+
+	void AssetCache::setCapacity(std::size_t capacity)
+	{
+		std::lock_guard lock { m_lock };
+		m_capacity = capacity;
+		evict();
+	}
+
+	std::size_t AssetCache::getCapacity() const
+	{
+		std::lock_guard lock { m_lock };
+		return m_capacity;
+	}
+
+	void AssetCache::setPersistentFolder(std::string folder)
+	{
+		std::lock_guard lock { m_lock };
+		m_persistentFolder = std::move(folder);
+	}
+
+	std::string AssetCache::getPersistentFolder() const
+	{
+		std::lock_guard lock { m_lock };
+		return m_persistentFolder;
+	}
+
+	void AssetCache::setPersistentSizeLimit(std::uintmax_t sizeLimit)
+	{
+		std::lock_guard lock { m_lock };
+		m_persistentSizeLimit = sizeLimit;
+	}
+
+	std::uintmax_t AssetCache::getPersistentSizeLimit() const
+	{
+		std::lock_guard lock { m_lock };
+		return m_persistentSizeLimit;
+	}
+
+	void AssetCache::clear()
+	{
+		std::lock_guard lock { m_lock };
+		m_entriesByKey.clear();
+		m_entries.clear();
+		m_stats.entriesCount = 0;
+		m_stats.bytes = 0;
+	}
+
+	AssetCacheStats AssetCache::getStats() const
+	{
+		std::lock_guard lock { m_lock };
+		return m_stats;
+	}
+
+	void AssetCache::resetStats()
+	{
+		std::lock_guard lock { m_lock };
+		m_stats.hits = 0;
+		m_stats.diskHits = 0;
+		m_stats.misses = 0;
+		m_stats.evictions = 0;
+	}
+
+	std::size_t AssetCache::KeyHash::operator()(const AssetCacheKey &key) const
+	{
+		return static_cast<std::size_t>(ContentHash::combine(ContentHash::combine(key.archiveId, key.crc), key.size));
+	}
+
+	void AssetCache::insert(const AssetCacheKey &key, std::shared_ptr<const uint8_t[]> data)
+	{
+		if (auto it = m_entriesByKey.find(key); it != m_entriesByKey.end())
+		{
+			m_entries.splice(m_entries.begin(), m_entries, it->second);
+			return;
+		}
+
+		m_entries.push_front(Entry { key, std::move(data) });
+		m_entriesByKey[key] = m_entries.begin();
+
+		++m_stats.entriesCount;
+		m_stats.bytes += static_cast<std::size_t>(key.size);
+
+		evict();
+	}
+
+	void AssetCache::evict()
+	{
+		while (m_stats.bytes > m_capacity && !m_entries.empty())
+		{
+			const auto &entry = m_entries.back();
+
+			m_stats.bytes -= static_cast<std::size_t>(entry.key.size);
+			--m_stats.entriesCount;
+			++m_stats.evictions;
+
+			m_entriesByKey.erase(entry.key);
+			m_entries.pop_back();
+		}
+	}
+
+	std::string AssetCache::getPersistentPath(const AssetCacheKey &key) const
+	{
+		if (m_persistentFolder.empty())
+		{
+			return {};
+		}
+
+		return (std::filesystem::path(m_persistentFolder) / fmt::format("{:016X}_{:08X}_{:X}{}", key.archiveId, key.crc, key.size, kAssetExtension)).string();
+	}
+}
\ No newline at end of file
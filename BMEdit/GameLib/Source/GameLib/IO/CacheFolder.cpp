@@ -0,0 +1,128 @@
+#include <GameLib/IO/CacheFolder.h>
+#include <fmt/format.h>
+#include <filesystem>
+#include <algorithm>
+#include <fstream>
+#include <thread>
+#include <atomic>
+#include <vector>
+
+
+namespace gamelib::io
+{
+	namespace
+	{
+		struct CachedFile
+		{
+			std::filesystem::path path {};
+			std::filesystem::file_time_type lastWriteTime {};
+			std::uintmax_t size { 0 };
+		};
+
+		std::atomic<std::uint64_t> g_temporaryFilesCounter { 0 };
+
+		/**
+		 * Temporary file is unique per writer and its extension never matches extension of cached files
+		 */
+		std::filesystem::path makeTemporaryPath(const std::string &path)
+		{
+			const auto threadId = std::hash<std::thread::id>{}(std::this_thread::get_id());
+			return fmt::format("{}.{:x}.{}.tmp", path, threadId, g_temporaryFilesCounter.fetch_add(1));
+		}
+	}
+
+	void CacheFolder::touch(const std::string &path)
+	{
+		std::error_code ec;
+		std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+	}
+
+	bool CacheFolder::writeAtomically(const std::string &path, const std::uint8_t *data, std::size_t size)
+	{
+		std::error_code ec;
+		std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+
+		const auto temporaryPath = makeTemporaryPath(path);
+		{
+			std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+			if (!file.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(size)))
+			{
+				file.close();
+				std::filesystem::remove(temporaryPath, ec);
+				return false;
+			}
+		}
+
+		std::filesystem::rename(temporaryPath, path, ec);
+		if (ec)
+		{
+			std::filesystem::remove(temporaryPath, ec);
+			return false;
+		}
+
+		return true;
+	}
+
+	std::size_t CacheFolder::trim(const std::string &folder, std::string_view extension, std::uintmax_t sizeLimit, const std::string &keepPath)
+	{
+		std::error_code ec;
+		std::filesystem::directory_iterator it { folder, ec };
+		if (ec)
+		{
+			return 0;
+		}
+
+		std::vector<CachedFile> files;
+		std::uintmax_t totalSize = 0;
+		const std::filesystem::path keptFile { keepPath };
+
+		for (const auto &entry : it)
+		{
+			if (!entry.is_regular_file(ec) || entry.path().extension() != extension)
+			{
+				continue;
+			}
+
+			CachedFile file { entry.path(), entry.last_write_time(ec), entry.file_size(ec) };
+			if (ec)
+			{
+				continue;
+			}
+
+			totalSize += file.size;
+
+			if (!keepPath.empty() && std::filesystem::equivalent(file.path, keptFile, ec))
+			{
+				continue;
+			}
+
+			files.emplace_back(std::move(file));
+		}
+
+		if (totalSize <= sizeLimit)
+		{
+			return 0;
+		}
+
+		// Oldest first
+		std::sort(files.begin(), files.end(), [](const CachedFile &a, const CachedFile &b) { return a.lastWriteTime < b.lastWriteTime; });
+
+		std::size_t removedCount = 0;
+
+		for (const auto &file : files)
+		{
+			if (totalSize <= sizeLimit)
+			{
+				break;
+			}
+
+			if (std::filesystem::remove(file.path, ec))
+			{
+				totalSize -= file.size;
+				++removedCount;
+			}
+		}
+
+		return removedCount;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,214 @@
+#include <GameLib/IO/DeflateCodec.h>
+#include <GameLib/Profiler.h>
+#include <GameLib/Workers.h>
+#include <algorithm>
+#include <limits>
+#include <zlib.h>
+
+#ifdef GAMELIB_WITH_LIBDEFLATE
+#include <libdeflate.h>
+#endif
+
+
+namespace gamelib::io
+{
+	namespace
+	{
+		constexpr std::size_t kDictionarySize = 32u * 1024u;        // Window of deflate
+		constexpr std::size_t kCRCBlockSize = 4u * 1024u * 1024u;
+		constexpr std::size_t kMaxChunk = std::numeric_limits<uInt>::max();
+
+		/**
+		 * @brief Deflate one block of input. All blocks except the last one are flushed to byte boundary without end of stream mark.
+		 */
+		bool deflateBlock(const uint8_t *input, std::size_t inputSize, const uint8_t *dictionary, std::size_t dictionarySize, bool isLastBlock, int level, std::vector<uint8_t> &output)
+		{
+			z_stream stream {};
+			if (deflateInit2(&stream, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+			{
+				return false;
+			}
+
+			if (dictionarySize && deflateSetDictionary(&stream, dictionary, static_cast<uInt>(dictionarySize)) != Z_OK)
+			{
+				deflateEnd(&stream);
+				return false;
+			}
+
+			// Bound is computed for Z_FINISH, sync flush adds empty stored block (5 bytes)
+			output.resize(deflateBound(&stream, static_cast<uLong>(inputSize)) + 16u);
+
+			stream.next_in = const_cast<uint8_t *>(input);
+			stream.avail_in = static_cast<uInt>(inputSize);
+			stream.next_out = output.data();
+			stream.avail_out = static_cast<uInt>(output.size());
+
+			const int status = deflate(&stream, isLastBlock ? Z_FINISH : Z_SYNC_FLUSH);
+			const bool isOk = isLastBlock ? status == Z_STREAM_END : (status == Z_OK && stream.avail_in == 0 && stream.avail_out != 0);
+
+			output.resize(stream.total_out);
+			deflateEnd(&stream);
+			return isOk;
+		}
+
+		std::uint32_t crc32Of(const uint8_t *data, std::size_t size)
+		{
+			uLong crc = crc32(0L, Z_NULL, 0);
+
+			for (std::size_t offset = 0; offset < size; offset += kMaxChunk)
+			{
+				crc = crc32(crc, data + offset, static_cast<uInt>(std::min(kMaxChunk, size - offset)));
+			}
+
+			return static_cast<std::uint32_t>(crc);
+		}
+	}
+
+	bool DeflateCodec::compress(Span<uint8_t> input, std::vector<uint8_t> &output, std::uint32_t &crc, const DeflateOptions &options)
+	{
+		GAMELIB_PROFILE_SCOPE("DeflateCodec::compress");
+
+		const auto *data = input.cbegin();
+		const auto dataSize = static_cast<std::size_t>(input.size());
+		const auto blockSize = std::clamp<std::size_t>(options.blockSize, kDictionarySize, kMaxChunk / 2);
+		const auto blocksCount = std::max<std::size_t>((dataSize + blockSize - 1) / blockSize, 1u);
+
+		std::vector<std::vector<uint8_t>> blocks(blocksCount);
+		std::vector<std::uint32_t> blockCRCs(blocksCount, 0u);
+		std::vector<std::uint8_t> isBlockOk(blocksCount, 0u);
+
+		runParallelFor(0, blocksCount, options.threadsCount, [&](std::size_t blockIndex)
+		{
+			const auto offset = blockIndex * blockSize;
+			const auto size = std::min(blockSize, dataSize - std::min(offset, dataSize));
+			const auto dictionarySize = std::min(offset, kDictionarySize);
+
+			isBlockOk[blockIndex] = deflateBlock(data + offset, size, data + offset - dictionarySize, dictionarySize, blockIndex + 1 == blocksCount, options.level, blocks[blockIndex]) ? 1u : 0u;
+			blockCRCs[blockIndex] = crc32Of(data + offset, size);
+		});
+
+		if (std::find(isBlockOk.begin(), isBlockOk.end(), 0u) != isBlockOk.end())
+		{
+			return false;
+		}
+
+		std::size_t outputSize = 0;
+		for (const auto &block : blocks)
+		{
+			outputSize += block.size();
+		}
+
+		output.clear();
+		output.reserve(outputSize);
+
+		uLong combinedCRC = blockCRCs[0];
+		for (std::size_t blockIndex = 0; blockIndex < blocksCount; ++blockIndex)
+		{
+			output.insert(output.end(), blocks[blockIndex].begin(), blocks[blockIndex].end());
+
+			if (blockIndex > 0)
+			{
+				const auto size = std::min(blockSize, dataSize - blockIndex * blockSize);
+				combinedCRC = crc32_combine(combinedCRC, blockCRCs[blockIndex], static_cast<z_off_t>(size));
+			}
+		}
+
+		crc = static_cast<std::uint32_t>(combinedCRC);
+
+		GAMELIB_PROFILE_COUNTER("Deflated bytes", static_cast<std::int64_t>(dataSize));
+		return true;
+	}
+
+	bool DeflateCodec::decompress(Span<uint8_t> input, uint8_t *output, std::size_t outputSize)
+	{
+		GAMELIB_PROFILE_SCOPE("DeflateCodec::decompress");
+
+#ifdef GAMELIB_WITH_LIBDEFLATE
+		libdeflate_decompressor *decompressor = libdeflate_alloc_decompressor();
+		if (!decompressor)
+		{
+			return false;
+		}
+
+		std::size_t actualSize = 0;
+		const auto result = libdeflate_deflate_decompress(decompressor, input.cbegin(), static_cast<std::size_t>(input.size()), output, outputSize, &actualSize);
+		libdeflate_free_decompressor(decompressor);
+
+		return result == LIBDEFLATE_SUCCESS && actualSize == outputSize;
+#else
+		z_stream stream {};
+		if (inflateInit2(&stream, -15) != Z_OK)
+		{
+			return false;
+		}
+
+		// Whole stream is inflated by a few calls (zlib counters are 32 bit)
+		const auto *inputData = input.cbegin();
+		std::size_t inputLeft = static_cast<std::size_t>(input.size());
+		std::size_t outputLeft = outputSize;
+		int status = Z_OK;
+
+		stream.next_out = output;
+
+		while (status == Z_OK)
+		{
+			if (!stream.avail_in && inputLeft)
+			{
+				stream.next_in = const_cast<uint8_t *>(inputData);
+				stream.avail_in = static_cast<uInt>(std::min(kMaxChunk, inputLeft));
+				inputData += stream.avail_in;
+				inputLeft -= stream.avail_in;
+			}
+
+			if (!stream.avail_out && outputLeft)
+			{
+				stream.avail_out = static_cast<uInt>(std::min(kMaxChunk, outputLeft));
+				outputLeft -= stream.avail_out;
+			}
+
+			status = inflate(&stream, Z_FINISH);
+
+			if (status == Z_BUF_ERROR && (stream.avail_in || inputLeft) && (stream.avail_out || outputLeft))
+			{
+				status = Z_OK; // End of chunk, continue with next one
+			}
+		}
+
+		const bool isOk = status == Z_STREAM_END && !stream.avail_out && !outputLeft;
+		inflateEnd(&stream);
+		return isOk;
+#endif
+	}
+
+	std::uint32_t DeflateCodec::computeCRC32(Span<uint8_t> input, int threadsCount)
+	{
+		const auto *data = input.cbegin();
+		const auto dataSize = static_cast<std::size_t>(input.size());
+		const auto blocksCount = std::max<std::size_t>((dataSize + kCRCBlockSize - 1) / kCRCBlockSize, 1u);
+
+		std::vector<std::uint32_t> blockCRCs(blocksCount, 0u);
+
+		runParallelFor(0, blocksCount, threadsCount, [&](std::size_t blockIndex)
+		{
+			const auto offset = blockIndex * kCRCBlockSize;
+			blockCRCs[blockIndex] = crc32Of(data + offset, std::min(kCRCBlockSize, dataSize - std::min(offset, dataSize)));
+		});
+
+		uLong crc = blockCRCs[0];
+		for (std::size_t blockIndex = 1; blockIndex < blocksCount; ++blockIndex)
+		{
+			crc = crc32_combine(crc, blockCRCs[blockIndex], static_cast<z_off_t>(std::min(kCRCBlockSize, dataSize - blockIndex * kCRCBlockSize)));
+		}
+
+		return static_cast<std::uint32_t>(crc);
+	}
+
+	const char *DeflateCodec::getInflateBackendName()
+	{
+#ifdef GAMELIB_WITH_LIBDEFLATE
+		return "libdeflate";
+#else
+		return "zlib";
+#endif
+	}
+}
\ No newline at end of file
@@ -1,14 +1,20 @@
 #include <GameLib/GMS/GMSReader.h>
 #include <GameLib/GMS/GMSStructureError.h>
 #include <GameLib/Level.h>
+#include <GameLib/LevelSnapshot.h>
 #include <GameLib/PRP/PRPReader.h>
 
 #include <GameLib/Scene/SceneObjectPropertiesLoader.h>
 #include <GameLib/Scene/SceneObjectPropertiesDumper.h>
 
+#include <GameLib/Profiler.h>
 #include <GameLib/Type.h>
 #include <GameLib/TypeRegistry.h>
 #include <GameLib/PRM/PRMReader.h>
+#include <GameLib/PRM/PRMWriter.h>
+
+#include <type_traits>
+#include <variant>
 
 
 namespace gamelib
@@ -18,8 +24,12 @@ namespace gamelib
 	{
 	}
 
+	Level::~Level() = default;
+
 	bool Level::loadSceneData()
 	{
+		GAMELIB_PROFILE_SCOPE("Level::loadSceneData");
+
 		if (!m_assetProvider || !m_assetProvider->isValid())
 		{
 			return false;
@@ -45,6 +55,38 @@ namespace gamelib
 		return true;
 	}
 
+	bool Level::loadSceneData(const LevelSnapshotCache &snapshotCache)
+	{
+		GAMELIB_PROFILE_SCOPE("Level::loadSceneData (snapshot cache)");
+
+		if (!m_assetProvider || !m_assetProvider->isValid())
+		{
+			return false;
+		}
+
+		if (snapshotCache.load(*this))
+		{
+			setupSceneHierarchy();
+
+			m_isLevelLoaded = true;
+			m_isLoadedFromSnapshot = true;
+			return true;
+		}
+
+		if (!loadSceneData())
+		{
+			return false;
+		}
+
+		(void)snapshotCache.save(*this);
+		return true;
+	}
+
+	bool Level::isLoadedFromSnapshot() const
+	{
+		return m_isLoadedFromSnapshot;
+	}
+
 	const std::string &Level::getLevelName() const
 	{
 		if (m_assetProvider)
@@ -56,6 +98,11 @@ namespace gamelib
 		return kUnknownLevel;
 	}
 
+	std::uint64_t Level::getContentHash() const
+	{
+		return m_assetProvider ? m_assetProvider->getContentHash() : 0;
+	}
+
 	const LevelProperties *Level::getLevelProperties() const
 	{
 		return m_isLevelLoaded ? &m_levelProperties : nullptr;
@@ -95,9 +142,120 @@ namespace gamelib
 	{
 		if (assetKind == io::AssetKind::PROPERTIES)
 		{
-			scene::SceneObjectPropertiesDumper dumper;
-			dumper.dump(this, &outBuffer);
+			if (!m_propertiesDumper)
+			{
+				m_propertiesDumper = std::make_unique<scene::SceneObjectPropertiesDumper>();
+			}
+
+			m_propertiesDumper->dump(this, &outBuffer);
+		}
+		else if (assetKind == io::AssetKind::GEOMETRY)
+		{
+			prm::PRMWriter::write(m_levelGeometry.header, m_levelGeometry.chunkDescriptors, m_levelGeometry.chunks, prm::PRMWriterOptions {}, outBuffer);
+		}
+	}
+
+	MemoryReport Level::memoryReport() const
+	{
+		std::unordered_set<const uint8_t *> countedBuffers;
+		return memoryReport(countedBuffers);
+	}
+
+	MemoryReport Level::memoryReport(std::unordered_set<const uint8_t *> &countedBuffers) const
+	{
+		MemoryReport report;
+
+		// Properties
+		report.addInstructions(MemoryCategory::PROPERTIES_INSTRUCTIONS, MemoryCategory::PROPERTIES_OPERANDS, m_levelProperties.rawProperties);
+
+		const auto &definitions = m_levelProperties.ZDefines.getDefinitions();
+		report.addVector(MemoryCategory::PROPERTIES_DEFINITIONS, definitions);
+
+		for (const auto &definition : definitions)
+		{
+			report.addString(MemoryCategory::PROPERTIES_DEFINITIONS, definition.getName());
+
+			std::visit([&report](const auto &value)
+			{
+				using T = std::decay_t<decltype(value)>;
+
+				if constexpr (std::is_same_v<T, prp::StringRef>)
+				{
+					report.addString(MemoryCategory::PROPERTIES_DEFINITIONS, value);
+				}
+				else
+				{
+					report.addVector(MemoryCategory::PROPERTIES_DEFINITIONS, value);
+
+					if constexpr (std::is_same_v<T, prp::StringRefTab>)
+					{
+						for (const auto &str : value)
+						{
+							report.addString(MemoryCategory::PROPERTIES_DEFINITIONS, str);
+						}
+					}
+				}
+			}, definition.getValue());
+		}
+
+		// Scene objects (allocated by make_shared: object & control block in one allocation)
+		report.addVector(MemoryCategory::SCENE_OBJECTS, m_sceneObjects);
+
+		for (const auto &sceneObject : m_sceneObjects)
+		{
+			if (!sceneObject)
+			{
+				continue;
+			}
+
+			report.add(MemoryCategory::SCENE_OBJECTS, sizeof(scene::SceneObject) + 2 * sizeof(void *));
+			report.addVector(MemoryCategory::SCENE_OBJECTS, sceneObject->getChildren());
+
+			report.addString(MemoryCategory::SCENE_OBJECT_NAMES, sceneObject->getName());
+			report.addString(MemoryCategory::SCENE_OBJECT_NAMES, sceneObject->getGeomInfo().getName());
+
+			report.addInstructions(MemoryCategory::SCENE_OBJECT_PROPERTIES, MemoryCategory::SCENE_OBJECT_PROPERTIES, sceneObject->getRawInstructions());
+			report.addValue(MemoryCategory::SCENE_OBJECT_PROPERTIES, sceneObject->getProperties());
+
+			report.addVector(MemoryCategory::SCENE_OBJECT_CONTROLLERS, sceneObject->getControllers());
+			for (const auto &controller : sceneObject->getControllers())
+			{
+				report.addString(MemoryCategory::SCENE_OBJECT_CONTROLLERS, controller.name);
+				report.addValue(MemoryCategory::SCENE_OBJECT_CONTROLLERS, controller.properties);
+			}
 		}
+
+		// Encoded properties kept between dumps
+		if (m_propertiesDumper)
+		{
+			report.merge(m_propertiesDumper->memoryReport());
+		}
+
+		// GMS
+		const auto &gmsHeader = m_sceneProperties.header;
+		report.addVector(MemoryCategory::GMS_ENTITIES, gmsHeader.getEntries().getGeomEntities());
+		report.addVector(MemoryCategory::GMS_ENTITIES, gmsHeader.getGeomStats().getStatEntries());
+		report.addVector(MemoryCategory::GMS_ENTITIES, gmsHeader.getGeomClusters().getClusters());
+
+		for (const auto &entity : gmsHeader.getEntries().getGeomEntities())
+		{
+			report.addString(MemoryCategory::GMS_ENTITIES, entity.getName());
+		}
+
+		// PRM
+		report.addVector(MemoryCategory::PRM_CHUNKS, m_levelGeometry.chunkDescriptors);
+		report.addVector(MemoryCategory::PRM_CHUNKS, m_levelGeometry.chunks);
+
+		// Shared body is counted by the first chunk which refers to it
+		for (const auto &chunk : m_levelGeometry.chunks)
+		{
+			if (const auto buffer = chunk.getBuffer(); buffer.size() > 0 && countedBuffers.insert(buffer.cbegin()).second)
+			{
+				report.add(MemoryCategory::PRM_CHUNKS, static_cast<std::size_t>(buffer.size()));
+			}
+		}
+
+		return report;
 	}
 
 	bool Level::loadLevelProperties()
@@ -175,18 +333,10 @@ namespace gamelib
 			using scene::SceneObject;
 
 			scene::SceneObjectPropertiesLoader::load(Span(m_sceneObjects), Span(m_levelProperties.rawProperties));
+			GAMELIB_PROFILE_COUNTER("Scene objects", m_sceneObjects.size());
 
 			// Scene hierarchy setup
-			for (const auto& sceneObject : m_sceneObjects)
-			{
-				auto parentIndex= sceneObject->getGeomInfo().getParentGeomIndex();
-				if (parentIndex == gms::GMSGeomEntity::kInvalidParent)
-				{
-					continue; // No parent, probably ROOT
-				}
-
-				sceneObject->setParent(m_sceneObjects[parentIndex]);
-			}
+			setupSceneHierarchy();
 
 #if 0       //TODO: Remove this code later
 			std::int32_t lowestPrimId = 0xFFFF;
@@ -211,6 +361,22 @@ namespace gamelib
 		return true;
 	}
 
+	void Level::setupSceneHierarchy()
+	{
+		GAMELIB_PROFILE_SCOPE("Level::setupSceneHierarchy");
+
+		for (const auto& sceneObject : m_sceneObjects)
+		{
+			auto parentIndex= sceneObject->getGeomInfo().getParentGeomIndex();
+			if (parentIndex == gms::GMSGeomEntity::kInvalidParent)
+			{
+				continue; // No parent, probably ROOT
+			}
+
+			sceneObject->setParent(m_sceneObjects[parentIndex]);
+		}
+	}
+
 	bool Level::loadLevelPrimitives()
 	{
 		// Read PRM file
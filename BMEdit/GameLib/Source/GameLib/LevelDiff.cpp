@@ -0,0 +1,577 @@
+#include <GameLib/LevelDiff.h>
+#include <GameLib/ContentHash.h>
+#include <GameLib/Profiler.h>
+#include <GameLib/Workers.h>
+#include <GameLib/Level.h>
+#include <GameLib/Value.h>
+#include <GameLib/Type.h>
+#include <fmt/format.h>
+#include <unordered_map>
+#include <algorithm>
+#include <cstring>
+
+
+namespace gamelib
+{
+	namespace
+	{
+		constexpr std::uint32_t kNoParent = 0xFFFFFFFFu;
+
+		/**
+		 * @brief Keys, paths & hashes of objects of one level
+		 */
+		struct DiffSide
+		{
+			const std::vector<scene::SceneObject::Ptr> *objects { nullptr };
+			std::vector<std::string> paths {};
+			std::vector<std::string> keys {};
+			std::vector<std::uint32_t> parents {};
+			std::vector<std::vector<std::uint32_t>> children {};
+			std::vector<std::uint64_t> hashes {};
+		};
+
+		std::uint64_t hashString(const std::string &str)
+		{
+			return ContentHash::compute(reinterpret_cast<const std::uint8_t *>(str.data()), str.size());
+		}
+
+		template <typename T>
+		std::uint64_t hashTrivial(T value)
+		{
+			return ContentHash::compute(reinterpret_cast<const std::uint8_t *>(&value), sizeof(T));
+		}
+
+		/**
+		 * @note Only meaningful part of operand is hashed (the same parts are compared by PRPInstruction::operator==)
+		 */
+		std::uint64_t hashInstruction(const prp::PRPInstruction &instruction)
+		{
+			using prp::PRPOpCode;
+
+			const auto &operand = instruction.getOperand();
+			std::uint64_t hash = ContentHash::combine(static_cast<std::uint64_t>(instruction.getOpCode()), instruction.isSet() ? 1u : 0u);
+
+			if (instruction.isDeclarator())
+			{
+				return hash;
+			}
+
+			switch (instruction.getOpCode())
+			{
+			case PRPOpCode::Char:
+			case PRPOpCode::Bool:
+			case PRPOpCode::Int8:
+			case PRPOpCode::NamedChar:
+			case PRPOpCode::NamedBool:
+			case PRPOpCode::NamedInt8:
+				return ContentHash::combine(hash, static_cast<std::uint8_t>(operand.trivial.i8));
+			case PRPOpCode::Int16:
+			case PRPOpCode::NamedInt16:
+				return ContentHash::combine(hash, static_cast<std::uint16_t>(operand.trivial.i16));
+			case PRPOpCode::Int32:
+			case PRPOpCode::NamedInt32:
+			case PRPOpCode::Bitfield:
+			case PRPOpCode::NameBitfield:
+			case PRPOpCode::Array:
+			case PRPOpCode::NamedArray:
+			case PRPOpCode::Container:
+			case PRPOpCode::NamedContainer:
+				return ContentHash::combine(hash, static_cast<std::uint32_t>(operand.trivial.i32));
+			case PRPOpCode::Float32:
+			case PRPOpCode::NamedFloat32:
+				return ContentHash::combine(hash, hashTrivial(operand.trivial.f32));
+			case PRPOpCode::Float64:
+			case PRPOpCode::NamedFloat64:
+				return ContentHash::combine(hash, hashTrivial(operand.trivial.f64));
+			case PRPOpCode::String:
+			case PRPOpCode::NamedString:
+			case PRPOpCode::StringOrArray_E:
+			case PRPOpCode::StringOrArray_8E:
+				return ContentHash::combine(hash, hashString(operand.str));
+			case PRPOpCode::RawData:
+			case PRPOpCode::NamedRawData:
+				return ContentHash::combine(hash, ContentHash::compute(operand.raw.data(), operand.raw.size()));
+			case PRPOpCode::StringArray:
+				for (const auto &str : operand.stringArray)
+				{
+					hash = ContentHash::combine(hash, hashString(str));
+				}
+				return hash;
+			default:
+				return hash;
+			}
+		}
+
+		std::uint64_t hashInstructions(std::uint64_t hash, const std::vector<prp::PRPInstruction> &instructions)
+		{
+			for (const auto &instruction : instructions)
+			{
+				hash = ContentHash::combine(hash, hashInstruction(instruction));
+			}
+
+			return ContentHash::combine(hash, instructions.size());
+		}
+
+		void buildSide(DiffSide &side, const std::vector<scene::SceneObject::Ptr> &objects, const DiffOptions &options)
+		{
+			const auto objectsCount = static_cast<std::uint32_t>(objects.size());
+
+			side.objects = &objects;
+			side.paths.assign(objectsCount, {});
+			side.keys.assign(objectsCount, {});
+			side.parents.assign(objectsCount, kNoParent);
+			side.children.assign(objectsCount, {});
+			side.hashes.assign(objectsCount, 0u);
+
+			// Hierarchy
+			std::unordered_map<const scene::SceneObject *, std::uint32_t> objectIndices;
+			objectIndices.reserve(objectsCount);
+
+			for (std::uint32_t objectIndex = 0; objectIndex < objectsCount; ++objectIndex)
+			{
+				objectIndices[objects[objectIndex].get()] = objectIndex;
+			}
+
+			auto findObject = [&objectIndices](const scene::SceneObject::Ref &objectRef) -> std::uint32_t
+			{
+				const auto object = objectRef.lock();
+				const auto it = object ? objectIndices.find(object.get()) : objectIndices.end();
+				return it != objectIndices.end() ? it->second : kNoParent;
+			};
+
+			for (std::uint32_t objectIndex = 0; objectIndex < objectsCount; ++objectIndex)
+			{
+				side.parents[objectIndex] = findObject(objects[objectIndex]->getParent());
+
+				for (const auto &childRef : objects[objectIndex]->getChildren())
+				{
+					if (const auto childIndex = findObject(childRef); childIndex != kNoParent)
+					{
+						side.children[objectIndex].push_back(childIndex);
+					}
+				}
+			}
+
+			// Paths (parent path is built before child path)
+			std::vector<std::uint32_t> chain;
+
+			for (std::uint32_t objectIndex = 0; objectIndex < objectsCount; ++objectIndex)
+			{
+				chain.clear();
+
+				for (std::uint32_t current = objectIndex; current != kNoParent && side.paths[current].empty() && chain.size() <= objectsCount; current = side.parents[current])
+				{
+					chain.push_back(current);
+				}
+
+				for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+				{
+					const auto &name = objects[*it]->getName();
+					const auto parentIndex = side.parents[*it];
+
+					if (parentIndex != kNoParent && !side.paths[parentIndex].empty())
+					{
+						side.paths[*it].reserve(side.paths[parentIndex].size() + 1 + name.size());
+						side.paths[*it].append(side.paths[parentIndex]).append(1, '\\').append(name);
+					}
+					else
+					{
+						side.paths[*it] = name;
+					}
+				}
+			}
+
+			// Keys (duplicated keys get ordinal number, so objects with the same key are matched in order)
+			std::unordered_map<std::string, std::uint32_t> keyOccurrences;
+			keyOccurrences.reserve(objectsCount);
+
+			for (std::uint32_t objectIndex = 0; objectIndex < objectsCount; ++objectIndex)
+			{
+				auto key = options.objectKey == DiffObjectKey::DOK_INSTANCE_ID
+					? fmt::format("{:08X}", objects[objectIndex]->getGeomInfo().getInstanceId())
+					: side.paths[objectIndex];
+
+				if (const auto occurrence = keyOccurrences[key]++; occurrence > 0)
+				{
+					key.append(1, '\0').append(std::to_string(occurrence));
+				}
+
+				side.keys[objectIndex] = std::move(key);
+			}
+
+			// Hashes
+			runParallelFor(0, objectsCount, options.threadsCount, [&side, &objects](std::size_t objectIndex)
+			{
+				const auto &object = objects[objectIndex];
+
+				std::uint64_t hash = object->getType() ? hashString(object->getType()->getName()) : 0u;
+				hash = hashInstructions(hash, object->getProperties().getInstructions());
+
+				for (const auto &controller : object->getControllers())
+				{
+					hash = ContentHash::combine(hash, hashString(controller.name));
+					hash = hashInstructions(hash, controller.properties.getInstructions());
+				}
+
+				const auto parentIndex = side.parents[objectIndex];
+				hash = ContentHash::combine(hash, parentIndex != kNoParent ? hashString(side.keys[parentIndex]) : 0u);
+
+				for (const auto childIndex : side.children[objectIndex])
+				{
+					hash = ContentHash::combine(hash, hashString(side.keys[childIndex]));
+				}
+
+				side.hashes[objectIndex] = hash;
+			});
+		}
+
+		std::vector<prp::PRPInstruction> getEntryInstructions(const Value &value, const ValueEntry &entry)
+		{
+			const auto &instructions = value.getInstructions();
+			const auto first = instructions.begin() + entry.instructions.iOffset;
+			return { first, first + entry.instructions.iSize };
+		}
+
+		bool isSameEntry(const Value &oldValue, const ValueEntry &oldEntry, const Value &newValue, const ValueEntry &newEntry)
+		{
+			if (oldEntry.instructions.iSize != newEntry.instructions.iSize)
+			{
+				return false;
+			}
+
+			const auto oldFirst = oldValue.getInstructions().begin() + oldEntry.instructions.iOffset;
+			const auto newFirst = newValue.getInstructions().begin() + newEntry.instructions.iOffset;
+			return std::equal(oldFirst, oldFirst + oldEntry.instructions.iSize, newFirst);
+		}
+
+		std::string makePropertyName(const std::string &owner, const std::string &entryName)
+		{
+			return owner.empty() ? entryName : fmt::format("{}.{}", owner, entryName);
+		}
+
+		/**
+		 * @param owner - name of controller (empty for properties of object)
+		 */
+		void compareValues(const std::string &owner, const Value &oldValue, const Value &newValue, std::vector<PropertyDiff> &diffs)
+		{
+			auto oldEntries = oldValue.getEntries();
+			auto newEntries = newValue.getEntries();
+
+			// Value without entries is compared as a whole
+			if (oldEntries.empty() || newEntries.empty())
+			{
+				if (oldValue.getInstructions() != newValue.getInstructions())
+				{
+					auto &diff = diffs.emplace_back();
+					diff.kind = DiffKind::DK_CHANGED;
+					diff.name = owner.empty() ? "*" : owner;
+					diff.controller = owner;
+					diff.oldValue = oldValue.getInstructions();
+					diff.newValue = newValue.getInstructions();
+				}
+
+				return;
+			}
+
+			std::unordered_map<std::string_view, std::size_t> newEntryIndices;
+			newEntryIndices.reserve(static_cast<std::size_t>(newEntries.size()));
+
+			for (std::size_t entryIndex = 0; entryIndex < static_cast<std::size_t>(newEntries.size()); ++entryIndex)
+			{
+				newEntryIndices.try_emplace(newEntries[entryIndex].name, entryIndex);
+			}
+
+			std::vector<bool> isNewEntryMatched(static_cast<std::size_t>(newEntries.size()), false);
+
+			for (const auto &oldEntry : oldEntries)
+			{
+				const auto it = newEntryIndices.find(oldEntry.name);
+				if (it == newEntryIndices.end() || isNewEntryMatched[it->second])
+				{
+					auto &diff = diffs.emplace_back();
+					diff.kind = DiffKind::DK_REMOVED;
+					diff.name = makePropertyName(owner, oldEntry.name);
+					diff.controller = owner;
+					diff.oldValue = getEntryInstructions(oldValue, oldEntry);
+					continue;
+				}
+
+				isNewEntryMatched[it->second] = true;
+
+				const auto &newEntry = newEntries[static_cast<int64_t>(it->second)];
+				if (!isSameEntry(oldValue, oldEntry, newValue, newEntry))
+				{
+					auto &diff = diffs.emplace_back();
+					diff.kind = DiffKind::DK_CHANGED;
+					diff.name = makePropertyName(owner, oldEntry.name);
+					diff.controller = owner;
+					diff.oldValue = getEntryInstructions(oldValue, oldEntry);
+					diff.newValue = getEntryInstructions(newValue, newEntry);
+				}
+			}
+
+			for (std::size_t entryIndex = 0; entryIndex < isNewEntryMatched.size(); ++entryIndex)
+			{
+				if (!isNewEntryMatched[entryIndex])
+				{
+					const auto &newEntry = newEntries[static_cast<int64_t>(entryIndex)];
+
+					auto &diff = diffs.emplace_back();
+					diff.kind = DiffKind::DK_ADDED;
+					diff.name = makePropertyName(owner, newEntry.name);
+					diff.controller = owner;
+					diff.newValue = getEntryInstructions(newValue, newEntry);
+				}
+			}
+		}
+
+		void compareControllers(const scene::SceneObject &oldObject, const scene::SceneObject &newObject, std::vector<PropertyDiff> &diffs)
+		{
+			const auto &oldControllers = oldObject.getControllers();
+			const auto &newControllers = newObject.getControllers();
+			std::vector<bool> isNewControllerMatched(newControllers.size(), false);
+
+			for (const auto &oldController : oldControllers)
+			{
+				auto it = std::find_if(newControllers.begin(), newControllers.end(), [&oldController, &isNewControllerMatched, &newControllers](const auto &newController)
+				{
+					return newController.name == oldController.name && !isNewControllerMatched[&newController - newControllers.data()];
+				});
+
+				if (it == newControllers.end())
+				{
+					auto &diff = diffs.emplace_back();
+					diff.kind = DiffKind::DK_REMOVED;
+					diff.name = oldController.name;
+					diff.controller = oldController.name;
+					diff.oldValue = oldController.properties.getInstructions();
+					continue;
+				}
+
+				isNewControllerMatched[std::distance(newControllers.begin(), it)] = true;
+				compareValues(oldController.name, oldController.properties, it->properties, diffs);
+			}
+
+			for (std::size_t controllerIndex = 0; controllerIndex < newControllers.size(); ++controllerIndex)
+			{
+				if (!isNewControllerMatched[controllerIndex])
+				{
+					auto &diff = diffs.emplace_back();
+					diff.kind = DiffKind::DK_ADDED;
+					diff.name = newControllers[controllerIndex].name;
+					diff.controller = newControllers[controllerIndex].name;
+					diff.newValue = newControllers[controllerIndex].properties.getInstructions();
+				}
+			}
+		}
+
+		bool compareObjects(const DiffSide &oldSide, std::uint32_t oldIndex, const DiffSide &newSide, std::uint32_t newIndex, ObjectDiff &diff)
+		{
+			const auto &oldObject = *(*oldSide.objects)[oldIndex];
+			const auto &newObject = *(*newSide.objects)[newIndex];
+
+			auto getKey = [](const DiffSide &side, std::uint32_t objectIndex) -> const std::string &
+			{
+				static const std::string kNoKey {};
+				return objectIndex != kNoParent ? side.keys[objectIndex] : kNoKey;
+			};
+
+			diff.kind = DiffKind::DK_CHANGED;
+			diff.path = newSide.paths[newIndex];
+			diff.oldObjectIndex = oldIndex;
+			diff.newObjectIndex = newIndex;
+			diff.isTypeChanged = oldObject.getType() != newObject.getType();
+			diff.isParentChanged = getKey(oldSide, oldSide.parents[oldIndex]) != getKey(newSide, newSide.parents[newIndex]);
+
+			const auto &oldChildren = oldSide.children[oldIndex];
+			const auto &newChildren = newSide.children[newIndex];
+
+			diff.isChildrenChanged = oldChildren.size() != newChildren.size() ||
+				!std::equal(oldChildren.begin(), oldChildren.end(), newChildren.begin(), [&oldSide, &newSide](std::uint32_t oldChild, std::uint32_t newChild)
+				{
+					return oldSide.keys[oldChild] == newSide.keys[newChild];
+				});
+
+			compareValues({}, oldObject.getProperties(), newObject.getProperties(), diff.properties);
+			compareControllers(oldObject, newObject, diff.properties);
+
+			return diff.isTypeChanged || diff.isParentChanged || diff.isChildrenChanged || !diff.properties.empty();
+		}
+	}
+
+	LevelDiff LevelDiff::compare(const Level &oldLevel, const Level &newLevel, const DiffOptions &options)
+	{
+		auto diff = compare(oldLevel.getSceneObjects(), newLevel.getSceneObjects(), options);
+
+		const auto *oldProperties = oldLevel.getLevelProperties();
+		const auto *newProperties = newLevel.getLevelProperties();
+
+		if (oldProperties && newProperties)
+		{
+			diff.m_definitions = compareDefinitions(oldProperties->ZDefines, newProperties->ZDefines);
+		}
+
+		return diff;
+	}
+
+	LevelDiff LevelDiff::compare(const std::vector<scene::SceneObject::Ptr> &oldObjects, const std::vector<scene::SceneObject::Ptr> &newObjects, const DiffOptions &options)
+	{
+		GAMELIB_PROFILE_SCOPE("LevelDiff::compare");
+
+		DiffSide oldSide;
+		DiffSide newSide;
+
+		buildSide(oldSide, oldObjects, options);
+		buildSide(newSide, newObjects, options);
+
+		std::unordered_map<std::string_view, std::uint32_t> newObjectsByKey;
+		newObjectsByKey.reserve(newObjects.size());
+
+		for (std::uint32_t objectIndex = 0; objectIndex < newObjects.size(); ++objectIndex)
+		{
+			newObjectsByKey[newSide.keys[objectIndex]] = objectIndex;
+		}
+
+		// Match objects, the same hash means the same object
+		LevelDiff result;
+		result.m_matchedObjects.assign(oldObjects.size(), ObjectDiff::kNoObject);
+
+		std::vector<bool> isNewObjectMatched(newObjects.size(), false);
+		std::vector<std::pair<std::uint32_t, std::uint32_t>> candidates;
+
+		for (std::uint32_t objectIndex = 0; objectIndex < oldObjects.size(); ++objectIndex)
+		{
+			const auto it = newObjectsByKey.find(oldSide.keys[objectIndex]);
+			if (it == newObjectsByKey.end())
+			{
+				auto &removed = result.m_objects.emplace_back();
+				removed.kind = DiffKind::DK_REMOVED;
+				removed.path = oldSide.paths[objectIndex];
+				removed.oldObjectIndex = objectIndex;
+				continue;
+			}
+
+			isNewObjectMatched[it->second] = true;
+			result.m_matchedObjects[objectIndex] = it->second;
+
+			if (oldSide.hashes[objectIndex] == newSide.hashes[it->second])
+			{
+				++result.m_unchangedObjectsCount;
+				continue;
+			}
+
+			candidates.emplace_back(objectIndex, it->second);
+		}
+
+		// Changed objects are compared entry by entry
+		std::vector<ObjectDiff> changedObjects(candidates.size());
+		std::vector<std::uint8_t> isChanged(candidates.size(), 0u);
+
+		runParallelFor(0, candidates.size(), options.threadsCount, [&](std::size_t candidateIndex)
+		{
+			const auto [oldIndex, newIndex] = candidates[candidateIndex];
+			isChanged[candidateIndex] = compareObjects(oldSide, oldIndex, newSide, newIndex, changedObjects[candidateIndex]) ? 1u : 0u;
+		});
+
+		for (std::size_t candidateIndex = 0; candidateIndex < candidates.size(); ++candidateIndex)
+		{
+			if (isChanged[candidateIndex])
+			{
+				result.m_objects.push_back(std::move(changedObjects[candidateIndex]));
+			}
+			else
+			{
+				++result.m_unchangedObjectsCount; // Different hashes of the same values (eg. 0.0 and -0.0)
+			}
+		}
+
+		for (std::uint32_t objectIndex = 0; objectIndex < newObjects.size(); ++objectIndex)
+		{
+			if (!isNewObjectMatched[objectIndex])
+			{
+				auto &added = result.m_objects.emplace_back();
+				added.kind = DiffKind::DK_ADDED;
+				added.path = newSide.paths[objectIndex];
+				added.newObjectIndex = objectIndex;
+			}
+		}
+
+		GAMELIB_PROFILE_COUNTER("Diff candidates", candidates.size());
+		return result;
+	}
+
+	std::vector<DefinitionDiff> LevelDiff::compareDefinitions(const prp::PRPZDefines &oldDefinitions, const prp::PRPZDefines &newDefinitions)
+	{
+		std::vector<DefinitionDiff> diffs;
+
+		const auto &oldList = oldDefinitions.getDefinitions();
+		const auto &newList = newDefinitions.getDefinitions();
+
+		std::unordered_map<std::string_view, std::size_t> newIndices;
+		newIndices.reserve(newList.size());
+
+		for (std::size_t definitionIndex = 0; definitionIndex < newList.size(); ++definitionIndex)
+		{
+			newIndices.try_emplace(newList[definitionIndex].getName(), definitionIndex);
+		}
+
+		std::vector<bool> isNewDefinitionMatched(newList.size(), false);
+
+		for (const auto &definition : oldList)
+		{
+			const auto it = newIndices.find(definition.getName());
+			if (it == newIndices.end())
+			{
+				diffs.push_back(DefinitionDiff { DiffKind::DK_REMOVED, definition.getName() });
+				continue;
+			}
+
+			isNewDefinitionMatched[it->second] = true;
+
+			if (!(definition == newList[it->second]))
+			{
+				diffs.push_back(DefinitionDiff { DiffKind::DK_CHANGED, definition.getName() });
+			}
+		}
+
+		for (std::size_t definitionIndex = 0; definitionIndex < newList.size(); ++definitionIndex)
+		{
+			if (!isNewDefinitionMatched[definitionIndex])
+			{
+				diffs.push_back(DefinitionDiff { DiffKind::DK_ADDED, newList[definitionIndex].getName() });
+			}
+		}
+
+		return diffs;
+	}
+
+	bool LevelDiff::empty() const
+	{
+		return m_objects.empty() && m_definitions.empty();
+	}
+
+	const std::vector<ObjectDiff> &LevelDiff::getObjects() const
+	{
+		return m_objects;
+	}
+
+	const std::vector<DefinitionDiff> &LevelDiff::getDefinitions() const
+	{
+		return m_definitions;
+	}
+
+	std::size_t LevelDiff::getObjectsCount(DiffKind kind) const
+	{
+		return static_cast<std::size_t>(std::count_if(m_objects.begin(), m_objects.end(), [kind](const ObjectDiff &object) { return object.kind == kind; }));
+	}
+
+	std::size_t LevelDiff::getUnchangedObjectsCount() const
+	{
+		return m_unchangedObjectsCount;
+	}
+
+	std::uint32_t LevelDiff::getMatchedObjectIndex(std::uint32_t oldObjectIndex) const
+	{
+		return oldObjectIndex < m_matchedObjects.size() ? m_matchedObjects[oldObjectIndex] : ObjectDiff::kNoObject;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,265 @@
+#include <GameLib/LevelMerge.h>
+#include <GameLib/Profiler.h>
+#include <GameLib/Level.h>
+#include <GameLib/Value.h>
+#include <unordered_map>
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace gamelib
+{
+	namespace
+	{
+		const PropertyDiff *findProperty(const ObjectDiff *object, const std::string &name)
+		{
+			if (!object)
+			{
+				return nullptr;
+			}
+
+			const auto it = std::find_if(object->properties.begin(), object->properties.end(), [&name](const PropertyDiff &property) { return property.name == name; });
+			return it != object->properties.end() ? &(*it) : nullptr;
+		}
+
+		bool applyChange(const MergeChange &change, Value &value)
+		{
+			// Value without entries is replaced as a whole
+			if (change.property == "*" || (!change.controller.empty() && change.property == change.controller))
+			{
+				if (!value.getEntries().empty())
+				{
+					return false;
+				}
+
+				value.getInstructions() = change.value;
+				value.markChanged();
+				return true;
+			}
+
+			const auto entryName = change.controller.empty() ? std::string_view(change.property) : std::string_view(change.property).substr(std::min(change.controller.size() + 1, change.property.size()));
+			const int entryIndex = value.getEntryIndex(entryName);
+			if (entryIndex < 0)
+			{
+				return false;
+			}
+
+			const auto &entry = value.getEntries()[entryIndex];
+			if (entry.instructions.size() == change.value.size())
+			{
+				std::copy(change.value.begin(), change.value.end(), value.getInstructions().begin() + entry.instructions.iOffset);
+				value.markChanged();
+				return true;
+			}
+
+			// Size of entry changed (eg. array), new instructions are verified by type of property
+			try
+			{
+				value.updateContainer(entryIndex, change.value);
+				return true;
+			}
+			catch (const std::runtime_error &)
+			{
+				return false;
+			}
+		}
+	}
+
+	LevelMerge LevelMerge::merge(const Level &base, const Level &ours, const Level &theirs, const DiffOptions &options)
+	{
+		return merge(base.getSceneObjects(), ours.getSceneObjects(), theirs.getSceneObjects(), options);
+	}
+
+	LevelMerge LevelMerge::merge(const std::vector<scene::SceneObject::Ptr> &base, const std::vector<scene::SceneObject::Ptr> &ours, const std::vector<scene::SceneObject::Ptr> &theirs, const DiffOptions &options)
+	{
+		GAMELIB_PROFILE_SCOPE("LevelMerge::merge");
+
+		const auto oursDiff = LevelDiff::compare(base, ours, options);
+		const auto theirsDiff = LevelDiff::compare(base, theirs, options);
+
+		// Base object -> changes of ours (changed & removed objects only)
+		std::unordered_map<std::uint32_t, const ObjectDiff *> oursByBase;
+		oursByBase.reserve(oursDiff.getObjects().size());
+
+		for (const auto &object : oursDiff.getObjects())
+		{
+			if (object.oldObjectIndex != ObjectDiff::kNoObject)
+			{
+				oursByBase[object.oldObjectIndex] = &object;
+			}
+		}
+
+		LevelMerge result;
+
+		auto addConflict = [&result](MergeConflictKind kind, const std::string &path, const PropertyDiff *theirsProperty, const PropertyDiff *oursProperty)
+		{
+			auto &conflict = result.m_conflicts.emplace_back();
+			conflict.kind = kind;
+			conflict.path = path;
+
+			if (theirsProperty)
+			{
+				conflict.property = theirsProperty->name;
+				conflict.baseValue = theirsProperty->oldValue;
+				conflict.theirsValue = theirsProperty->newValue;
+			}
+
+			if (oursProperty)
+			{
+				conflict.oursValue = oursProperty->newValue;
+			}
+		};
+
+		for (const auto &theirsObject : theirsDiff.getObjects())
+		{
+			if (theirsObject.kind == DiffKind::DK_ADDED)
+			{
+				addConflict(MergeConflictKind::MCK_STRUCTURE, theirsObject.path, nullptr, nullptr);
+				continue;
+			}
+
+			const auto it = oursByBase.find(theirsObject.oldObjectIndex);
+			const ObjectDiff *oursObject = it != oursByBase.end() ? it->second : nullptr;
+
+			if (theirsObject.kind == DiffKind::DK_REMOVED)
+			{
+				if (!oursObject)
+				{
+					addConflict(MergeConflictKind::MCK_STRUCTURE, theirsObject.path, nullptr, nullptr);
+				}
+				else if (oursObject->kind == DiffKind::DK_CHANGED)
+				{
+					addConflict(MergeConflictKind::MCK_REMOVED_OBJECT, theirsObject.path, nullptr, nullptr);
+				}
+
+				continue; // Removed in both levels
+			}
+
+			if (oursObject && oursObject->kind == DiffKind::DK_REMOVED)
+			{
+				addConflict(MergeConflictKind::MCK_REMOVED_OBJECT, theirsObject.path, nullptr, nullptr);
+				continue;
+			}
+
+			if (theirsObject.isTypeChanged || theirsObject.isParentChanged || theirsObject.isChildrenChanged)
+			{
+				addConflict(MergeConflictKind::MCK_STRUCTURE, theirsObject.path, nullptr, nullptr);
+
+				if (theirsObject.isTypeChanged)
+				{
+					continue; // Layout of properties is different
+				}
+			}
+
+			const auto oursIndex = oursDiff.getMatchedObjectIndex(theirsObject.oldObjectIndex);
+
+			for (const auto &theirsProperty : theirsObject.properties)
+			{
+				if (const auto *oursProperty = findProperty(oursObject, theirsProperty.name))
+				{
+					if (oursProperty->kind == theirsProperty.kind && oursProperty->newValue == theirsProperty.newValue)
+					{
+						++result.m_alreadyMergedCount;
+					}
+					else
+					{
+						addConflict(MergeConflictKind::MCK_PROPERTY, theirsObject.path, &theirsProperty, oursProperty);
+					}
+
+					continue;
+				}
+
+				if (theirsProperty.kind != DiffKind::DK_CHANGED)
+				{
+					addConflict(MergeConflictKind::MCK_STRUCTURE, theirsObject.path, &theirsProperty, nullptr);
+					continue;
+				}
+
+				auto &change = result.m_changes.emplace_back();
+				change.path = theirsObject.path;
+				change.objectIndex = oursIndex;
+				change.property = theirsProperty.name;
+				change.controller = theirsProperty.controller;
+				change.value = theirsProperty.newValue;
+			}
+		}
+
+		GAMELIB_PROFILE_COUNTER("Merged changes", result.m_changes.size());
+		GAMELIB_PROFILE_COUNTER("Merge conflicts", result.m_conflicts.size());
+		return result;
+	}
+
+	std::size_t LevelMerge::apply(const std::vector<scene::SceneObject::Ptr> &ours, std::vector<MergeConflict> &failedChanges) const
+	{
+		GAMELIB_PROFILE_SCOPE("LevelMerge::apply");
+
+		std::size_t appliedCount = 0;
+		failedChanges.clear();
+
+		auto addFailedChange = [&failedChanges](const MergeChange &change)
+		{
+			auto &conflict = failedChanges.emplace_back();
+			conflict.kind = MergeConflictKind::MCK_NOT_APPLIED;
+			conflict.path = change.path;
+			conflict.property = change.property;
+			conflict.theirsValue = change.value;
+		};
+
+		for (const auto &change : m_changes)
+		{
+			if (change.objectIndex >= ours.size() || !ours[change.objectIndex])
+			{
+				addFailedChange(change);
+				continue;
+			}
+
+			auto &object = *ours[change.objectIndex];
+			Value *value = &object.getProperties();
+
+			if (!change.controller.empty())
+			{
+				auto &controllers = object.getControllers();
+				auto it = std::find_if(controllers.begin(), controllers.end(), [&change](const auto &controller) { return controller.name == change.controller; });
+				if (it == controllers.end())
+				{
+					addFailedChange(change);
+					continue;
+				}
+
+				value = &it->properties;
+			}
+
+			if (applyChange(change, *value))
+			{
+				++appliedCount;
+			}
+			else
+			{
+				addFailedChange(change);
+			}
+		}
+
+		GAMELIB_PROFILE_COUNTER("Not applied changes", failedChanges.size());
+		return appliedCount;
+	}
+
+	bool LevelMerge::hasConflicts() const
+	{
+		return !m_conflicts.empty();
+	}
+
+	const std::vector<MergeChange> &LevelMerge::getChanges() const
+	{
+		return m_changes;
+	}
+
+	const std::vector<MergeConflict> &LevelMerge::getConflicts() const
+	{
+		return m_conflicts;
+	}
+
+	std::size_t LevelMerge::getAlreadyMergedCount() const
+	{
+		return m_alreadyMergedCount;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,1188 @@
+#include <GameLib/LevelSnapshot.h>
+#include <GameLib/IO/CacheFolder.h>
+#include <GameLib/ContentHash.h>
+#include <GameLib/Level.h>
+#include <GameLib/Profiler.h>
+#include <GameLib/TypeComplex.h>
+#include <GameLib/TypeRegistry.h>
+#include <GameLib/Value.h>
+#include <fmt/format.h>
+#include <unordered_map>
+#include <type_traits>
+#include <filesystem>
+#include <fstream>
+#include <cstring>
+#include <array>
+
+
+namespace gamelib
+{
+	namespace
+	{
+		enum SectionKind : std::uint32_t
+		{
+			SK_TYPES = 0,   ///< Names of referenced types
+			SK_PROPERTIES,  ///< PRP header, definitions & raw instructions
+			SK_SCENE,       ///< GMS entities, stats & clusters
+			SK_OBJECTS,     ///< Mapped values & controllers of scene objects
+			SK_GEOMETRY,    ///< PRM header, descriptors & recognized chunks
+			SK_BLOBS,       ///< Aligned bodies of PRM chunks
+
+			SK_LAST_SECTION
+		};
+
+		struct FileHeader
+		{
+			std::uint32_t magic { 0 };
+			std::uint32_t version { 0 };
+			std::uint64_t contentHash { 0 };
+			std::uint64_t typesHash { 0 };
+			std::uint64_t bodyHash { 0 }; ///< Hash of everything after header
+			std::uint32_t sectionsCount { 0 };
+			std::uint32_t reserved { 0 };
+		};
+
+		struct SectionEntry
+		{
+			std::uint32_t kind { 0 };
+			std::uint32_t reserved { 0 };
+			std::uint64_t offset { 0 };
+			std::uint64_t size { 0 };
+		};
+
+		static_assert(sizeof(FileHeader) == 40, "Unexpected padding in snapshot header");
+		static_assert(sizeof(SectionEntry) == 24, "Unexpected padding in snapshot section entry");
+
+		constexpr std::uint32_t kNoType = 0xFFFFFFFFu;
+
+		constexpr std::uint8_t kOperandHasString = 1u << 0u;
+		constexpr std::uint8_t kOperandHasRawData = 1u << 1u;
+		constexpr std::uint8_t kOperandHasStringArray = 1u << 2u;
+		constexpr std::uint8_t kInstructionIsSet = 1u << 3u;
+
+		constexpr std::uint8_t kViewOfType = 0u;
+		constexpr std::uint8_t kViewOfTrivialType = 1u;
+
+		std::size_t alignUp(std::size_t value, std::size_t alignment)
+		{
+			return ((value + alignment - 1) / alignment) * alignment;
+		}
+	}
+
+	class LevelSnapshot::SectionWriter
+	{
+	public:
+		template <typename T>
+		void write(T value) requires (std::is_trivially_copyable_v<T>)
+		{
+			writeBytes(&value, sizeof(T));
+		}
+
+		void writeBytes(const void *data, std::size_t size)
+		{
+			if (size)
+			{
+				const auto *bytes = reinterpret_cast<const uint8_t *>(data);
+				m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+			}
+		}
+
+		void writeString(const std::string &str)
+		{
+			write<std::uint32_t>(static_cast<std::uint32_t>(str.size()));
+			writeBytes(str.data(), str.size());
+		}
+
+		void align(std::size_t alignment)
+		{
+			m_buffer.resize(alignUp(m_buffer.size(), alignment), 0u);
+		}
+
+		[[nodiscard]] const std::vector<uint8_t> &getBuffer() const
+		{
+			return m_buffer;
+		}
+
+	private:
+		std::vector<uint8_t> m_buffer {};
+	};
+
+	/**
+	 * @brief Bounds checked reader of section. Any failed read means broken snapshot.
+	 */
+	class LevelSnapshot::SectionReader
+	{
+	public:
+		explicit SectionReader(Span<uint8_t> section) : m_data(section.cbegin()), m_size(static_cast<std::size_t>(section.size()))
+		{
+		}
+
+		template <typename T>
+		bool read(T &value) requires (std::is_trivially_copyable_v<T>)
+		{
+			return readBytes(&value, sizeof(T));
+		}
+
+		bool readBytes(void *data, std::size_t size)
+		{
+			if (size > m_size - m_offset)
+			{
+				return false;
+			}
+
+			if (size)
+			{
+				std::memcpy(data, m_data + m_offset, size);
+				m_offset += size;
+			}
+
+			return true;
+		}
+
+		bool readString(std::string &str)
+		{
+			std::uint32_t length = 0;
+			if (!read(length) || length > m_size - m_offset)
+			{
+				return false;
+			}
+
+			str.assign(reinterpret_cast<const char *>(m_data + m_offset), length);
+			m_offset += length;
+			return true;
+		}
+
+		/**
+		 * Read count of elements and check that they could fit into the rest of section (protects from huge allocations on broken data)
+		 */
+		bool readCount(std::uint32_t &count, std::size_t minElementSize)
+		{
+			return read(count) && static_cast<std::uint64_t>(count) * minElementSize <= m_size - m_offset;
+		}
+
+	private:
+		const uint8_t *m_data { nullptr };
+		std::size_t m_size { 0 };
+		std::size_t m_offset { 0 };
+	};
+
+	struct LevelSnapshot::TypesTable
+	{
+		std::vector<const Type *> types {};
+		std::unordered_map<const Type *, std::uint32_t> indices {};
+
+		std::uint32_t getIndex(const Type *type)
+		{
+			if (!type)
+			{
+				return kNoType;
+			}
+
+			auto [it, isNew] = indices.try_emplace(type, static_cast<std::uint32_t>(types.size()));
+			if (isNew)
+			{
+				types.push_back(type);
+			}
+
+			return it->second;
+		}
+
+		bool getType(std::uint32_t index, const Type *&type) const
+		{
+			if (index == kNoType)
+			{
+				type = nullptr;
+				return true;
+			}
+
+			if (index >= types.size())
+			{
+				return false;
+			}
+
+			type = types[index];
+			return true;
+		}
+	};
+
+	bool LevelSnapshot::write(const Level &level, std::vector<uint8_t> &outBuffer)
+	{
+		GAMELIB_PROFILE_SCOPE("LevelSnapshot::write");
+
+		const auto contentHash = level.getContentHash();
+		const auto typesHash = TypeRegistry::getInstance().getTypesHash();
+
+		if (!level.m_isLevelLoaded || !contentHash || !typesHash)
+		{
+			return false;
+		}
+
+		TypesTable types;
+		std::array<SectionWriter, SK_LAST_SECTION> sections;
+
+		writeProperties(level.m_levelProperties, sections[SK_PROPERTIES]);
+		writeScene(level.m_sceneProperties, types, sections[SK_SCENE]);
+		writeObjects(level.m_sceneObjects, types, sections[SK_OBJECTS]);
+		writeGeometry(level.m_levelGeometry, sections[SK_GEOMETRY], sections[SK_BLOBS]);
+		writeTypes(types, sections[SK_TYPES]); // Last one: table is filled by other sections
+
+		// Layout: header, sections table, aligned sections
+		std::array<SectionEntry, SK_LAST_SECTION> sectionEntries {};
+		std::size_t offset = alignUp(sizeof(FileHeader) + sizeof(sectionEntries), kSectionAlignment);
+
+		for (std::uint32_t sectionIndex = 0; sectionIndex < SK_LAST_SECTION; ++sectionIndex)
+		{
+			auto &entry = sectionEntries[sectionIndex];
+			entry.kind = sectionIndex;
+			entry.offset = offset;
+			entry.size = sections[sectionIndex].getBuffer().size();
+
+			offset = alignUp(offset + entry.size, kSectionAlignment);
+		}
+
+		outBuffer.clear();
+		outBuffer.resize(offset, 0u);
+
+		std::memcpy(outBuffer.data() + sizeof(FileHeader), sectionEntries.data(), sizeof(sectionEntries));
+
+		for (std::uint32_t sectionIndex = 0; sectionIndex < SK_LAST_SECTION; ++sectionIndex)
+		{
+			const auto &body = sections[sectionIndex].getBuffer();
+			if (!body.empty())
+			{
+				std::memcpy(outBuffer.data() + sectionEntries[sectionIndex].offset, body.data(), body.size());
+			}
+		}
+
+		FileHeader header;
+		header.magic = kMagic;
+		header.version = kVersion;
+		header.contentHash = contentHash;
+		header.typesHash = typesHash;
+		header.bodyHash = ContentHash::compute(outBuffer.data() + sizeof(FileHeader), outBuffer.size() - sizeof(FileHeader));
+		header.sectionsCount = SK_LAST_SECTION;
+
+		std::memcpy(outBuffer.data(), &header, sizeof(FileHeader));
+		GAMELIB_PROFILE_COUNTER("Snapshot bytes", outBuffer.size());
+		return true;
+	}
+
+	bool LevelSnapshot::read(Level &level, Span<uint8_t> buffer)
+	{
+		GAMELIB_PROFILE_SCOPE("LevelSnapshot::read");
+
+		const auto contentHash = level.getContentHash();
+		const auto typesHash = TypeRegistry::getInstance().getTypesHash();
+
+		if (!contentHash || !typesHash || buffer.size() < static_cast<int64_t>(sizeof(FileHeader)))
+		{
+			return false;
+		}
+
+		const auto *data = buffer.cbegin();
+		const auto dataSize = static_cast<std::size_t>(buffer.size());
+
+		FileHeader header;
+		std::memcpy(&header, data, sizeof(FileHeader));
+
+		if (header.magic != kMagic || header.version != kVersion || header.contentHash != contentHash || header.typesHash != typesHash || header.sectionsCount != SK_LAST_SECTION)
+		{
+			return false;
+		}
+
+		std::array<SectionEntry, SK_LAST_SECTION> sectionEntries {};
+		if (dataSize < sizeof(FileHeader) + sizeof(sectionEntries))
+		{
+			return false;
+		}
+
+		if (ContentHash::compute(data + sizeof(FileHeader), dataSize - sizeof(FileHeader)) != header.bodyHash)
+		{
+			return false; // Broken file
+		}
+
+		std::memcpy(sectionEntries.data(), data + sizeof(FileHeader), sizeof(sectionEntries));
+
+		std::array<Span<uint8_t>, SK_LAST_SECTION> sections {};
+		for (std::uint32_t sectionIndex = 0; sectionIndex < SK_LAST_SECTION; ++sectionIndex)
+		{
+			const auto &entry = sectionEntries[sectionIndex];
+			if (entry.kind != sectionIndex || entry.offset > dataSize || entry.size > dataSize - entry.offset)
+			{
+				return false;
+			}
+
+			sections[sectionIndex] = Span<uint8_t>(data + entry.offset, static_cast<int64_t>(entry.size));
+		}
+
+		// Restore into temporary storage, level is changed only when whole snapshot is valid
+		TypesTable types;
+		LevelProperties properties {};
+		SceneProperties scene {};
+		LevelGeometry geometry {};
+		std::vector<scene::SceneObject::Ptr> objects {};
+
+		SectionReader typesReader { sections[SK_TYPES] };
+		SectionReader propertiesReader { sections[SK_PROPERTIES] };
+		SectionReader sceneReader { sections[SK_SCENE] };
+		SectionReader objectsReader { sections[SK_OBJECTS] };
+		SectionReader geometryReader { sections[SK_GEOMETRY] };
+
+		if (!readTypes(typesReader, types) ||
+			!readProperties(propertiesReader, properties) ||
+			!readScene(sceneReader, types, scene) ||
+			!readObjects(objectsReader, types, scene, objects) ||
+			!readGeometry(geometryReader, sections[SK_BLOBS], geometry))
+		{
+			return false;
+		}
+
+		level.m_levelProperties = std::move(properties);
+		level.m_sceneProperties = std::move(scene);
+		level.m_levelGeometry = std::move(geometry);
+		level.m_sceneObjects = std::move(objects);
+		return true;
+	}
+
+	void LevelSnapshot::writeInstructions(const std::vector<prp::PRPInstruction> &instructions, SectionWriter &writer)
+	{
+		writer.write<std::uint32_t>(static_cast<std::uint32_t>(instructions.size()));
+
+		for (const auto &instruction : instructions)
+		{
+			const auto &operand = instruction.getOperand();
+
+			std::uint8_t payloadMask = 0u;
+			payloadMask |= operand.str.empty() ? 0u : kOperandHasString;
+			payloadMask |= operand.raw.empty() ? 0u : kOperandHasRawData;
+			payloadMask |= operand.stringArray.empty() ? 0u : kOperandHasStringArray;
+			payloadMask |= instruction.isSet() ? kInstructionIsSet : 0u;
+
+			writer.write<std::uint32_t>(static_cast<std::uint32_t>(instruction.getOpCode()));
+			writer.write<std::uint8_t>(payloadMask);
+			writer.write(operand.trivial);
+
+			if (payloadMask & kOperandHasString)
+			{
+				writer.writeString(operand.str);
+			}
+
+			if (payloadMask & kOperandHasRawData)
+			{
+				writer.write<std::uint32_t>(static_cast<std::uint32_t>(operand.raw.size()));
+				writer.writeBytes(operand.raw.data(), operand.raw.size());
+			}
+
+			if (payloadMask & kOperandHasStringArray)
+			{
+				writer.write<std::uint32_t>(static_cast<std::uint32_t>(operand.stringArray.size()));
+				for (const auto &str : operand.stringArray)
+				{
+					writer.writeString(str);
+				}
+			}
+		}
+	}
+
+	bool LevelSnapshot::readInstructions(SectionReader &reader, std::vector<prp::PRPInstruction> &instructions)
+	{
+		constexpr std::size_t kMinInstructionSize = sizeof(std::uint32_t) + sizeof(std::uint8_t) + sizeof(prp::PRPOperandVal::trivial);
+
+		std::uint32_t instructionsCount = 0;
+		if (!reader.readCount(instructionsCount, kMinInstructionSize))
+		{
+			return false;
+		}
+
+		instructions.clear();
+		instructions.reserve(instructionsCount);
+
+		for (std::uint32_t instructionIndex = 0; instructionIndex < instructionsCount; ++instructionIndex)
+		{
+			std::uint32_t opCode = 0;
+			std::uint8_t payloadMask = 0u;
+			prp::PRPOperandVal operand {};
+
+			if (!reader.read(opCode) || !reader.read(payloadMask) || !reader.read(operand.trivial))
+			{
+				return false;
+			}
+
+			if ((payloadMask & kOperandHasString) && !reader.readString(operand.str))
+			{
+				return false;
+			}
+
+			if (payloadMask & kOperandHasRawData)
+			{
+				std::uint32_t rawSize = 0;
+				if (!reader.readCount(rawSize, 1))
+				{
+					return false;
+				}
+
+				operand.raw.resize(rawSize);
+				if (!reader.readBytes(operand.raw.data(), rawSize))
+				{
+					return false;
+				}
+			}
+
+			if (payloadMask & kOperandHasStringArray)
+			{
+				std::uint32_t stringsCount = 0;
+				if (!reader.readCount(stringsCount, sizeof(std::uint32_t)))
+				{
+					return false;
+				}
+
+				operand.stringArray.resize(stringsCount);
+				for (auto &str : operand.stringArray)
+				{
+					if (!reader.readString(str))
+					{
+						return false;
+					}
+				}
+			}
+
+			if (payloadMask & kInstructionIsSet)
+			{
+				instructions.emplace_back(static_cast<prp::PRPOpCode>(opCode), std::move(operand));
+			}
+			else
+			{
+				instructions.emplace_back(static_cast<prp::PRPOpCode>(opCode));
+			}
+		}
+
+		return true;
+	}
+
+	void LevelSnapshot::writeViews(const std::vector<ValueView> &views, TypesTable &types, SectionWriter &writer)
+	{
+		writer.write<std::uint32_t>(static_cast<std::uint32_t>(views.size()));
+
+		for (const auto &view : views)
+		{
+			writer.writeString(view.getName());
+
+			if (view.isTrivialType())
+			{
+				writer.write<std::uint8_t>(kViewOfTrivialType);
+				writer.write<std::uint32_t>(static_cast<std::uint32_t>(view.getTrivialType()));
+			}
+			else
+			{
+				writer.write<std::uint8_t>(kViewOfType);
+				writer.write<std::uint32_t>(types.getIndex(view.getType()));
+			}
+
+			writer.write<std::uint32_t>(types.getIndex(view.getOwnerType()));
+		}
+	}
+
+	bool LevelSnapshot::readViews(SectionReader &reader, const TypesTable &types, std::vector<ValueView> &views)
+	{
+		constexpr std::size_t kMinViewSize = sizeof(std::uint32_t) + sizeof(std::uint8_t) + 2 * sizeof(std::uint32_t);
+
+		std::uint32_t viewsCount = 0;
+		if (!reader.readCount(viewsCount, kMinViewSize))
+		{
+			return false;
+		}
+
+		views.clear();
+		views.reserve(viewsCount);
+
+		for (std::uint32_t viewIndex = 0; viewIndex < viewsCount; ++viewIndex)
+		{
+			std::string name;
+			std::uint8_t viewKind = 0u;
+			std::uint32_t typeReference = 0u;
+			std::uint32_t ownerTypeIndex = kNoType;
+			const Type *ownerType = nullptr;
+
+			if (!reader.readString(name) || !reader.read(viewKind) || !reader.read(typeReference) || !reader.read(ownerTypeIndex) || !types.getType(ownerTypeIndex, ownerType))
+			{
+				return false;
+			}
+
+			if (viewKind == kViewOfTrivialType)
+			{
+				views.emplace_back(std::move(name), static_cast<prp::PRPOpCode>(typeReference), ownerType);
+				continue;
+			}
+
+			const Type *viewType = nullptr;
+			if (viewKind != kViewOfType || !types.getType(typeReference, viewType))
+			{
+				return false;
+			}
+
+			views.emplace_back(std::move(name), viewType, ownerType);
+		}
+
+		return true;
+	}
+
+	void LevelSnapshot::writeValue(const Value &value, TypesTable &types, SectionWriter &writer)
+	{
+		writer.write<std::uint32_t>(types.getIndex(value.getType()));
+		writeInstructions(value.getInstructions(), writer);
+
+		auto entries = value.getEntries();
+		writer.write<std::uint32_t>(static_cast<std::uint32_t>(entries.size()));
+
+		for (const auto &entry : entries)
+		{
+			writer.writeString(entry.name);
+			writer.write<std::int64_t>(entry.instructions.iOffset);
+			writer.write<std::int64_t>(entry.instructions.iSize);
+			writeViews(entry.views, types, writer);
+		}
+
+		writeViews(value.getViews(), types, writer);
+		writer.write<std::uint8_t>(value.getEntriesIndex() ? 1u : 0u);
+	}
+
+	bool LevelSnapshot::readValue(SectionReader &reader, const TypesTable &types, Value &value)
+	{
+		constexpr std::size_t kMinEntrySize = sizeof(std::uint32_t) + 2 * sizeof(std::int64_t) + sizeof(std::uint32_t);
+
+		std::uint32_t typeIndex = kNoType;
+		const Type *type = nullptr;
+		std::vector<prp::PRPInstruction> instructions;
+
+		if (!reader.read(typeIndex) || !types.getType(typeIndex, type) || !readInstructions(reader, instructions))
+		{
+			return false;
+		}
+
+		std::uint32_t entriesCount = 0;
+		if (!reader.readCount(entriesCount, kMinEntrySize))
+		{
+			return false;
+		}
+
+		std::vector<ValueEntry> entries(entriesCount);
+		for (auto &entry : entries)
+		{
+			if (!reader.readString(entry.name) || !reader.read(entry.instructions.iOffset) || !reader.read(entry.instructions.iSize) || !readViews(reader, types, entry.views))
+			{
+				return false;
+			}
+
+			const auto instructionsCount = static_cast<std::int64_t>(instructions.size());
+			if (entry.instructions.iOffset < 0 || entry.instructions.iSize < 0 || entry.instructions.iOffset > instructionsCount || entry.instructions.iSize > instructionsCount - entry.instructions.iOffset)
+			{
+				return false;
+			}
+		}
+
+		std::vector<ValueView> views;
+		std::uint8_t hasEntriesIndex = 0u;
+
+		if (!readViews(reader, types, views) || !reader.read(hasEntriesIndex))
+		{
+			return false;
+		}
+
+		value = Value(type, std::move(instructions), std::move(entries), std::move(views));
+
+		// Index is shared between all mapped values of type, so we take it from type (or build it from our layout)
+		if (hasEntriesIndex && type && type->getKind() == TypeKind::COMPLEX)
+		{
+			value.setEntriesIndex(reinterpret_cast<const TypeComplex *>(type)->getEntriesIndex(value.getEntries()));
+		}
+
+		return true;
+	}
+
+	void LevelSnapshot::writeTypes(const TypesTable &types, SectionWriter &writer)
+	{
+		writer.write<std::uint32_t>(static_cast<std::uint32_t>(types.types.size()));
+
+		for (const auto *type : types.types)
+		{
+			writer.writeString(type->getName());
+		}
+	}
+
+	bool LevelSnapshot::readTypes(SectionReader &reader, TypesTable &types)
+	{
+		std::uint32_t typesCount = 0;
+		if (!reader.readCount(typesCount, sizeof(std::uint32_t)))
+		{
+			return false;
+		}
+
+		const auto &registry = TypeRegistry::getInstance();
+		types.types.resize(typesCount, nullptr);
+
+		for (auto &type : types.types)
+		{
+			std::string typeName;
+			if (!reader.readString(typeName))
+			{
+				return false;
+			}
+
+			type = registry.findTypeByName(typeName);
+			if (!type)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void LevelSnapshot::writeProperties(const LevelProperties &properties, SectionWriter &writer)
+	{
+		const auto &header = properties.header;
+		writer.write<std::uint8_t>(header.m_isMagicBytesValid);
+		writer.write<std::uint8_t>(header.m_isRawView);
+		writer.write<std::uint32_t>(header.m_flags);
+		writer.write<std::uint32_t>(header.m_totalKeys);
+		writer.write<std::uint32_t>(header.m_ZDefinesOffset);
+		writer.write<std::uint32_t>(properties.objectsCount);
+
+		const auto &definitions = properties.ZDefines.getDefinitions();
+		writer.write<std::uint32_t>(static_cast<std::uint32_t>(definitions.size()));
+
+		for (const auto &definition : definitions)
+		{
+			writer.writeString(definition.getName());
+			writer.write<std::uint16_t>(static_cast<std::uint16_t>(definition.getType()));
+			writer.write<std::uint8_t>(static_cast<std::uint8_t>(definition.getValue().index()));
+
+			std::visit([&writer](const auto &value)
+			{
+				using T = std::decay_t<decltype(value)>;
+
+				if constexpr (std::is_same_v<T, prp::StringRef>)
+				{
+					writer.writeString(value);
+				}
+				else if constexpr (std::is_same_v<T, prp::StringRefTab>)
+				{
+					writer.write<std::uint32_t>(static_cast<std::uint32_t>(value.size()));
+					for (const auto &str : value)
+					{
+						writer.writeString(str);
+					}
+				}
+				else
+				{
+					writer.write<std::uint32_t>(static_cast<std::uint32_t>(value.size()));
+					writer.writeBytes(value.data(), value.size() * sizeof(typename T::value_type));
+				}
+			}, definition.getValue());
+		}
+
+		writeInstructions(properties.rawProperties, writer);
+	}
+
+	bool LevelSnapshot::readProperties(SectionReader &reader, LevelProperties &properties)
+	{
+		auto &header = properties.header;
+		if (!reader.read(header.m_isMagicBytesValid) || !reader.read(header.m_isRawView) || !reader.read(header.m_flags) ||
+			!reader.read(header.m_totalKeys) || !reader.read(header.m_ZDefinesOffset) || !reader.read(properties.objectsCount))
+		{
+			return false;
+		}
+
+		constexpr std::size_t kMinDefinitionSize = sizeof(std::uint32_t) + sizeof(std::uint16_t) + sizeof(std::uint8_t) + sizeof(std::uint32_t);
+
+		std::uint32_t definitionsCount = 0;
+		if (!reader.readCount(definitionsCount, kMinDefinitionSize))
+		{
+			return false;
+		}
+
+		auto &definitions = properties.ZDefines.getDefinitions();
+		definitions.reserve(definitionsCount);
+
+		for (std::uint32_t definitionIndex = 0; definitionIndex < definitionsCount; ++definitionIndex)
+		{
+			std::string name;
+			std::uint16_t definitionType = 0;
+			std::uint8_t valueIndex = 0;
+
+			if (!reader.readString(name) || !reader.read(definitionType) || !reader.read(valueIndex))
+			{
+				return false;
+			}
+
+			prp::PRPDefinitionValue value;
+			std::uint32_t itemsCount = 0;
+
+			switch (valueIndex)
+			{
+			case 0:
+			case 1:
+				if (!reader.readCount(itemsCount, sizeof(std::int32_t)))
+				{
+					return false;
+				}
+
+				if (valueIndex == 0)
+				{
+					auto &array = value.emplace<prp::ArrayI32>(itemsCount);
+					reader.readBytes(array.data(), array.size() * sizeof(std::int32_t));
+				}
+				else
+				{
+					auto &array = value.emplace<prp::ArrayF32>(itemsCount);
+					reader.readBytes(array.data(), array.size() * sizeof(float));
+				}
+				break;
+			case 2:
+				if (!reader.readString(value.emplace<prp::StringRef>()))
+				{
+					return false;
+				}
+				break;
+			case 3:
+				if (!reader.readCount(itemsCount, sizeof(std::uint32_t)))
+				{
+					return false;
+				}
+
+				for (auto &str : value.emplace<prp::StringRefTab>(itemsCount))
+				{
+					if (!reader.readString(str))
+					{
+						return false;
+					}
+				}
+				break;
+			default:
+				return false;
+			}
+
+			definitions.emplace_back(std::move(name), static_cast<prp::PRPDefinitionType>(definitionType), std::move(value));
+		}
+
+		return readInstructions(reader, properties.rawProperties);
+	}
+
+	void LevelSnapshot::writeScene(const SceneProperties &scene, TypesTable &types, SectionWriter &writer)
+	{
+		const auto &entities = scene.header.m_geomEntities.m_entities;
+		writer.write<std::uint32_t>(static_cast<std::uint32_t>(entities.size()));
+
+		for (const auto &entity : entities)
+		{
+			writer.writeString(entity.m_name);
+
+			for (const auto field : {
+				entity.m_parentGeomIndex, entity.m_geomFlags, entity.m_unk4, entity.m_unk8, entity.m_primitiveId, entity.m_unk10, entity.m_typeId, entity.m_unk18,
+				entity.m_coliBits, entity.m_unk20, entity.m_unk24, entity.m_unk28, entity.m_unk2C, entity.m_instanceId, entity.m_unk34.u32, entity.m_unk38, entity.m_unk3C })
+			{
+				writer.write<std::uint32_t>(field);
+			}
+		}
+
+		const auto &statEntries = scene.header.m_geomStats.m_statEntries;
+		writer.write<std::uint32_t>(static_cast<std::uint32_t>(statEntries.size()));
+
+		for (const auto &statEntry : statEntries)
+		{
+			writer.write<std::uint32_t>(statEntry.typeId);
+			writer.write<std::uint32_t>(types.getIndex(statEntry.typeInfo));
+			writer.write<std::uint32_t>(statEntry.count);
+			writer.write<std::uint32_t>(statEntry.unk);
+		}
+
+		const auto &clusters = scene.header.m_geomClusters.m_clusters;
+		writer.write<std::uint32_t>(static_cast<std::uint32_t>(clusters.size()));
+
+		for (const auto &cluster : clusters)
+		{
+			writer.writeBytes(cluster.m_data.data(), sizeof(cluster.m_data));
+			writer.write<std::uint32_t>(cluster.m_clusterSize);
+		}
+	}
+
+	bool LevelSnapshot::readScene(SectionReader &reader, const TypesTable &types, SceneProperties &scene)
+	{
+		constexpr std::size_t kEntityFieldsCount = 17;
+
+		std::uint32_t entitiesCount = 0;
+		if (!reader.readCount(entitiesCount, sizeof(std::uint32_t) * (1 + kEntityFieldsCount)))
+		{
+			return false;
+		}
+
+		auto &entities = scene.header.m_geomEntities.m_entities;
+		entities.resize(entitiesCount);
+
+		for (auto &entity : entities)
+		{
+			if (!reader.readString(entity.m_name))
+			{
+				return false;
+			}
+
+			for (auto *field : {
+				&entity.m_parentGeomIndex, &entity.m_geomFlags, &entity.m_unk4, &entity.m_unk8, &entity.m_primitiveId, &entity.m_unk10, &entity.m_typeId, &entity.m_unk18,
+				&entity.m_coliBits, &entity.m_unk20, &entity.m_unk24, &entity.m_unk28, &entity.m_unk2C, &entity.m_instanceId, &entity.m_unk34.u32, &entity.m_unk38, &entity.m_unk3C })
+			{
+				if (!reader.read(*field))
+				{
+					return false;
+				}
+			}
+
+			if (entity.m_parentGeomIndex != gms::GMSGeomEntity::kInvalidParent && entity.m_parentGeomIndex >= entitiesCount)
+			{
+				return false;
+			}
+		}
+
+		std::uint32_t statEntriesCount = 0;
+		if (!reader.readCount(statEntriesCount, 4 * sizeof(std::uint32_t)))
+		{
+			return false;
+		}
+
+		auto &statEntries = scene.header.m_geomStats.m_statEntries;
+		statEntries.resize(statEntriesCount);
+
+		for (auto &statEntry : statEntries)
+		{
+			std::uint32_t typeIndex = kNoType;
+			if (!reader.read(statEntry.typeId) || !reader.read(typeIndex) || !types.getType(typeIndex, statEntry.typeInfo) || !reader.read(statEntry.count) || !reader.read(statEntry.unk))
+			{
+				return false;
+			}
+		}
+
+		std::uint32_t clustersCount = 0;
+		if (!reader.readCount(clustersCount, sizeof(gms::GMSGroupClusterInfo::ClusterData) + sizeof(std::uint32_t)))
+		{
+			return false;
+		}
+
+		auto &clusters = scene.header.m_geomClusters.m_clusters;
+		clusters.resize(clustersCount);
+
+		for (auto &cluster : clusters)
+		{
+			if (!reader.readBytes(cluster.m_data.data(), sizeof(cluster.m_data)) || !reader.read(cluster.m_clusterSize))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void LevelSnapshot::writeObjects(const std::vector<scene::SceneObject::Ptr> &objects, TypesTable &types, SectionWriter &writer)
+	{
+		writer.write<std::uint32_t>(static_cast<std::uint32_t>(objects.size()));
+
+		for (const auto &object : objects)
+		{
+			writer.writeString(object->getName());
+			writer.write<std::uint32_t>(object->getTypeId());
+			writer.write<std::uint32_t>(types.getIndex(object->getType()));
+			writeInstructions(object->getRawInstructions(), writer);
+			writeValue(object->getProperties(), types, writer);
+
+			const auto &controllers = object->getControllers();
+			writer.write<std::uint32_t>(static_cast<std::uint32_t>(controllers.size()));
+
+			for (const auto &controller : controllers)
+			{
+				writer.writeString(controller.name);
+				writeValue(controller.properties, types, writer);
+			}
+		}
+
+		// Order of children comes from properties, so it's stored as is (parents are restored from GMS entities)
+		std::unordered_map<const scene::SceneObject *, std::uint32_t> objectIndices;
+		objectIndices.reserve(objects.size());
+
+		for (std::uint32_t objectIndex = 0; objectIndex < objects.size(); ++objectIndex)
+		{
+			objectIndices[objects[objectIndex].get()] = objectIndex;
+		}
+
+		for (const auto &object : objects)
+		{
+			const auto &children = object->getChildren();
+			writer.write<std::uint32_t>(static_cast<std::uint32_t>(children.size()));
+
+			for (const auto &childRef : children)
+			{
+				const auto child = childRef.lock();
+				const auto it = child ? objectIndices.find(child.get()) : objectIndices.end();
+				writer.write<std::uint32_t>(it != objectIndices.end() ? it->second : kNoType);
+			}
+		}
+	}
+
+	bool LevelSnapshot::readObjects(SectionReader &reader, const TypesTable &types, const SceneProperties &scene, std::vector<scene::SceneObject::Ptr> &objects)
+	{
+		const auto &entities = scene.header.getEntries().getGeomEntities();
+
+		// Each object is made from GMS entity with the same index (see Level::loadLevelScene)
+		std::uint32_t objectsCount = 0;
+		if (!reader.read(objectsCount) || objectsCount != entities.size())
+		{
+			return false;
+		}
+
+		objects.resize(objectsCount);
+
+		for (std::uint32_t objectIndex = 0; objectIndex < objectsCount; ++objectIndex)
+		{
+			std::string name;
+			std::uint32_t typeId = 0;
+			std::uint32_t typeIndex = kNoType;
+			const Type *type = nullptr;
+			scene::SceneObject::Instructions rawInstructions;
+
+			if (!reader.readString(name) || !reader.read(typeId) || !reader.read(typeIndex) || !types.getType(typeIndex, type) || !readInstructions(reader, rawInstructions))
+			{
+				return false;
+			}
+
+			auto &object = objects[objectIndex];
+			object = std::make_shared<scene::SceneObject>(std::move(name), typeId, type, entities[objectIndex], std::move(rawInstructions));
+
+			if (!readValue(reader, types, object->getProperties()))
+			{
+				return false;
+			}
+
+			std::uint32_t controllersCount = 0;
+			if (!reader.readCount(controllersCount, 2 * sizeof(std::uint32_t)))
+			{
+				return false;
+			}
+
+			auto &controllers = object->getControllers();
+			controllers.resize(controllersCount);
+			object->markChanged();
+
+			for (auto &controller : controllers)
+			{
+				if (!reader.readString(controller.name) || !readValue(reader, types, controller.properties))
+				{
+					return false;
+				}
+			}
+		}
+
+		for (const auto &object : objects)
+		{
+			std::uint32_t childrenCount = 0;
+			if (!reader.readCount(childrenCount, sizeof(std::uint32_t)))
+			{
+				return false;
+			}
+
+			for (std::uint32_t childIndex = 0; childIndex < childrenCount; ++childIndex)
+			{
+				std::uint32_t objectIndex = kNoType;
+				if (!reader.read(objectIndex) || objectIndex >= objectsCount)
+				{
+					return false;
+				}
+
+				object->addChild(objects[objectIndex]);
+			}
+		}
+
+		return true;
+	}
+
+	void LevelSnapshot::writeGeometry(const LevelGeometry &geometry, SectionWriter &writer, SectionWriter &blobsWriter)
+	{
+		writer.write<std::uint32_t>(geometry.header.chunkOffset);
+		writer.write<std::uint32_t>(geometry.header.countOfPrimitives);
+		writer.write<std::uint32_t>(geometry.header.chunkOffset2);
+		writer.write<std::uint32_t>(geometry.header.zeroed);
+
+		writer.write<std::uint32_t>(static_cast<std::uint32_t>(geometry.chunkDescriptors.size()));
+		for (const auto &descriptor : geometry.chunkDescriptors)
+		{
+			writer.write<std::uint32_t>(descriptor.declarationOffset);
+			writer.write<std::uint32_t>(descriptor.declarationSize);
+			writer.write<std::uint32_t>(descriptor.declarationKind);
+			writer.write<std::uint32_t>(descriptor.unkC);
+		}
+
+		writer.write<std::uint32_t>(static_cast<std::uint32_t>(geometry.chunks.size()));
+		for (const auto &chunk : geometry.chunks)
+		{
+			const auto body = chunk.getBuffer();
+			const auto *vertexBufferHeader = chunk.getVertexBufferHeader();
+
+			blobsWriter.align(kSectionAlignment);
+			const auto blobOffset = static_cast<std::uint64_t>(blobsWriter.getBuffer().size());
+			blobsWriter.writeBytes(body.cbegin(), static_cast<std::size_t>(body.size()));
+
+			writer.write<std::uint32_t>(chunk.getIndex());
+			writer.write<std::uint8_t>(static_cast<std::uint8_t>(chunk.getKind()));
+			writer.write<std::uint8_t>(static_cast<std::uint8_t>(vertexBufferHeader ? vertexBufferHeader->vertexFormat : prm::PRMVertexBufferFormat::VBF_UNKNOWN_VERTEX));
+			writer.write<std::uint64_t>(blobOffset);
+			writer.write<std::uint64_t>(static_cast<std::uint64_t>(body.size()));
+		}
+	}
+
+	bool LevelSnapshot::readGeometry(SectionReader &reader, Span<uint8_t> blobs, LevelGeometry &geometry)
+	{
+		if (!reader.read(geometry.header.chunkOffset) || !reader.read(geometry.header.countOfPrimitives) || !reader.read(geometry.header.chunkOffset2) || !reader.read(geometry.header.zeroed))
+		{
+			return false;
+		}
+
+		std::uint32_t descriptorsCount = 0;
+		if (!reader.readCount(descriptorsCount, 4 * sizeof(std::uint32_t)))
+		{
+			return false;
+		}
+
+		geometry.chunkDescriptors.resize(descriptorsCount);
+		for (auto &descriptor : geometry.chunkDescriptors)
+		{
+			if (!reader.read(descriptor.declarationOffset) || !reader.read(descriptor.declarationSize) || !reader.read(descriptor.declarationKind) || !reader.read(descriptor.unkC))
+			{
+				return false;
+			}
+		}
+
+		constexpr std::size_t kChunkRecordSize = sizeof(std::uint32_t) + 2 * sizeof(std::uint8_t) + 2 * sizeof(std::uint64_t);
+
+		std::uint32_t chunksCount = 0;
+		if (!reader.readCount(chunksCount, kChunkRecordSize))
+		{
+			return false;
+		}
+
+		const auto blobsSize = static_cast<std::uint64_t>(blobs.size());
+		geometry.chunks.reserve(chunksCount);
+
+		for (std::uint32_t chunkIndex = 0; chunkIndex < chunksCount; ++chunkIndex)
+		{
+			std::uint32_t index = 0;
+			std::uint8_t kind = 0;
+			std::uint8_t vertexFormat = 0;
+			std::uint64_t blobOffset = 0;
+			std::uint64_t blobSize = 0;
+
+			if (!reader.read(index) || !reader.read(kind) || !reader.read(vertexFormat) || !reader.read(blobOffset) || !reader.read(blobSize))
+			{
+				return false;
+			}
+
+			if (kind > static_cast<std::uint8_t>(prm::PRMChunkRecognizedKind::CRK_UNKNOWN_BUFFER) || blobOffset > blobsSize || blobSize > blobsSize - blobOffset)
+			{
+				return false;
+			}
+
+			std::unique_ptr<uint8_t[]> body = blobSize ? blobs.slice(static_cast<int64_t>(blobOffset), static_cast<int64_t>(blobSize)).new_buffer() : nullptr;
+
+			geometry.chunks.emplace_back(index, std::move(body), static_cast<std::size_t>(blobSize), static_cast<prm::PRMChunkRecognizedKind>(kind), static_cast<prm::PRMVertexBufferFormat>(vertexFormat));
+		}
+
+		return true;
+	}
+
+	LevelSnapshotCache::LevelSnapshotCache(std::string cacheFolder, std::uintmax_t sizeLimit)
+		: m_cacheFolder(std::move(cacheFolder)), m_sizeLimit(sizeLimit)
+	{
+	}
+
+	bool LevelSnapshotCache::load(Level &level) const
+	{
+		const auto snapshotPath = getSnapshotPath(level);
+		if (snapshotPath.empty())
+		{
+			return false;
+		}
+
+		std::ifstream file(snapshotPath, std::ios::binary | std::ios::ate);
+		if (!file)
+		{
+			return false;
+		}
+
+		const auto fileSize = static_cast<std::streamsize>(file.tellg());
+		if (fileSize <= 0)
+		{
+			return false;
+		}
+
+		// Whole snapshot is read at once, sections are parsed in place
+		std::vector<uint8_t> buffer(static_cast<std::size_t>(fileSize));
+		file.seekg(0, std::ios::beg);
+
+		if (!file.read(reinterpret_cast<char *>(buffer.data()), fileSize))
+		{
+			return false;
+		}
+
+		file.close();
+
+		if (!LevelSnapshot::read(level, Span<uint8_t>(buffer)))
+		{
+			return false;
+		}
+
+		io::CacheFolder::touch(snapshotPath);
+		return true;
+	}
+
+	bool LevelSnapshotCache::save(const Level &level) const
+	{
+		const auto snapshotPath = getSnapshotPath(level);
+		if (snapshotPath.empty())
+		{
+			return false;
+		}
+
+		std::vector<uint8_t> buffer;
+		if (!LevelSnapshot::write(level, buffer))
+		{
+			return false;
+		}
+
+		if (!io::CacheFolder::writeAtomically(snapshotPath, buffer.data(), buffer.size()))
+		{
+			return false;
+		}
+
+		io::CacheFolder::trim(m_cacheFolder, kSnapshotExtension, m_sizeLimit, snapshotPath);
+		return true;
+	}
+
+	std::string LevelSnapshotCache::getSnapshotPath(const Level &level) const
+	{
+		const auto contentHash = level.getContentHash();
+		const auto typesHash = TypeRegistry::getInstance().getTypesHash();
+
+		if (m_cacheFolder.empty() || !contentHash || !typesHash)
+		{
+			return {};
+		}
+
+		const auto snapshotKey = ContentHash::combine(contentHash, typesHash);
+		return (std::filesystem::path(m_cacheFolder) / fmt::format("{:016X}{}", snapshotKey, kSnapshotExtension)).string();
+	}
+
+	const std::string &LevelSnapshotCache::getCacheFolder() const
+	{
+		return m_cacheFolder;
+	}
+
+	std::uintmax_t LevelSnapshotCache::getSizeLimit() const
+	{
+		return m_sizeLimit;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include <GameLib/MemoryReport.h>
+#include <GameLib/Value.h>
+#include <cassert>
+
+
+namespace gamelib
+{
+	namespace
+	{
+		const std::size_t kSmallStringCapacity = std::string().capacity();
+	}
+
+	void MemoryReport::add(MemoryCategory category, std::size_t bytes, std::size_t allocations)
+	{
+		assert(category != MemoryCategory::LAST_CATEGORY);
+
+		auto &usage = m_usage[static_cast<std::size_t>(category)];
+		usage.bytes += bytes;
+		usage.allocations += allocations;
+	}
+
+	void MemoryReport::addString(MemoryCategory category, const std::string &str)
+	{
+		if (str.capacity() > kSmallStringCapacity)
+		{
+			add(category, str.capacity() + 1);
+		}
+	}
+
+	void MemoryReport::addInstructions(MemoryCategory instructionsCategory, MemoryCategory operandsCategory, const std::vector<prp::PRPInstruction> &instructions)
+	{
+		addVector(instructionsCategory, instructions);
+
+		for (const auto &instruction : instructions)
+		{
+			const auto &operand = instruction.getOperand();
+
+			addString(operandsCategory, operand.str);
+			addVector(operandsCategory, operand.raw);
+			addVector(operandsCategory, operand.stringArray);
+
+			for (const auto &str : operand.stringArray)
+			{
+				addString(operandsCategory, str);
+			}
+		}
+	}
+
+	void MemoryReport::addValue(MemoryCategory category, const Value &value)
+	{
+		addInstructions(category, category, value.getInstructions());
+
+		auto entries = value.getEntries();
+		if (!entries.empty())
+		{
+			add(category, entries.size() * sizeof(ValueEntry));
+		}
+
+		for (const auto &entry : entries)
+		{
+			addString(category, entry.name);
+			addVector(category, entry.views);
+
+			for (const auto &view : entry.views)
+			{
+				addString(category, view.getName());
+			}
+		}
+
+		addVector(category, value.getViews());
+		for (const auto &view : value.getViews())
+		{
+			addString(category, view.getName());
+		}
+	}
+
+	void MemoryReport::merge(const MemoryReport &other)
+	{
+		for (std::size_t category = 0; category < m_usage.size(); ++category)
+		{
+			m_usage[category].bytes += other.m_usage[category].bytes;
+			m_usage[category].allocations += other.m_usage[category].allocations;
+		}
+	}
+
+	const MemoryUsage &MemoryReport::get(MemoryCategory category) const
+	{
+		assert(category != MemoryCategory::LAST_CATEGORY);
+		return m_usage[static_cast<std::size_t>(category)];
+	}
+
+	MemoryUsage MemoryReport::getTotal() const
+	{
+		MemoryUsage total;
+
+		for (const auto &usage : m_usage)
+		{
+			total.bytes += usage.bytes;
+			total.allocations += usage.allocations;
+		}
+
+		return total;
+	}
+
+	const char *MemoryReport::getCategoryName(MemoryCategory category)
+	{
+		switch (category)
+		{
+		case MemoryCategory::PROPERTIES_INSTRUCTIONS: return "Properties: instructions";
+		case MemoryCategory::PROPERTIES_OPERANDS: return "Properties: operands";
+		case MemoryCategory::PROPERTIES_DEFINITIONS: return "Properties: definitions";
+		case MemoryCategory::SCENE_OBJECTS: return "Scene: objects";
+		case MemoryCategory::SCENE_OBJECT_NAMES: return "Scene: names";
+		case MemoryCategory::SCENE_OBJECT_PROPERTIES: return "Scene: properties";
+		case MemoryCategory::SCENE_OBJECT_CONTROLLERS: return "Scene: controllers";
+		case MemoryCategory::SCENE_PROPERTIES_DUMPER: return "Scene: dumper cache";
+		case MemoryCategory::GMS_ENTITIES: return "GMS: entities";
+		case MemoryCategory::PRM_CHUNKS: return "PRM: chunks";
+		default: return "Unknown";
+		}
+	}
+}
\ No newline at end of file
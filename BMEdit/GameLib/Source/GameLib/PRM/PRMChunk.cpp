@@ -1,5 +1,6 @@
 #include <GameLib/PRM/PRMChunk.h>
 #include <ZBinaryReader.hpp>
+#include <cstring>
 
 
 namespace gamelib::prm
@@ -22,16 +23,81 @@ namespace gamelib::prm
 		}
 	}
 
+	PRMChunk::PRMChunk(std::uint32_t chunkIndex, std::unique_ptr<uint8_t[]> &&buffer, std::size_t size, PRMChunkRecognizedKind recognizedKind, PRMVertexBufferFormat vertexFormat)
+		: m_chunkIndex(chunkIndex)
+		, m_buffer(std::move(buffer))
+		, m_bufferSize(size)
+		, m_recognizedKind(recognizedKind)
+	{
+		const auto chunk = getBuffer();
+
+		if (m_recognizedKind == PRMChunkRecognizedKind::CRK_DESCRIPTION_BUFFER && chunk.size() >= sizeof(PRMDescriptionChunkBaseHeader))
+		{
+			auto binaryReader = ZBio::ZBinaryReader::BinaryReader(reinterpret_cast<const char*>(&chunk[0]), chunk.size());
+
+			PRMDescriptionChunkBaseHeader chunkHdr;
+			PRMDescriptionChunkBaseHeader::deserialize(chunkHdr, &binaryReader);
+			m_data.emplace<PRMDescriptionChunkBaseHeader>(chunkHdr);
+		}
+		else if (m_recognizedKind == PRMChunkRecognizedKind::CRK_INDEX_BUFFER && chunk.size() > 4)
+		{
+			auto binaryReader = ZBio::ZBinaryReader::BinaryReader(reinterpret_cast<const char*>(&chunk[0]), chunk.size());
+
+			PRMIndexChunkHeader chunkHdr {};
+			PRMIndexChunkHeader::deserialize(chunkHdr, &binaryReader);
+			m_data.emplace<PRMIndexChunkHeader>(chunkHdr);
+		}
+		else if (m_recognizedKind == PRMChunkRecognizedKind::CRK_VERTEX_BUFFER)
+		{
+			PRMVertexBufferHeader vertexBufferHeader;
+			vertexBufferHeader.vertexFormat = vertexFormat;
+			m_data.emplace<PRMVertexBufferHeader>(vertexBufferHeader);
+		}
+	}
+
 	std::uint32_t PRMChunk::getIndex() const
 	{
 		return m_chunkIndex;
 	}
 
 	Span<uint8_t> PRMChunk::getBuffer()
+	{
+		if (isBufferShared())
+		{
+			std::shared_ptr<uint8_t[]> ownBuffer { new uint8_t[m_bufferSize] };
+			std::memcpy(ownBuffer.get(), m_buffer.get(), m_bufferSize);
+			m_buffer = std::move(ownBuffer);
+		}
+
+		return { m_buffer.get(), static_cast<int64_t>(m_bufferSize) };
+	}
+
+	Span<uint8_t> PRMChunk::getBuffer() const
 	{
 		return { m_buffer.get(), static_cast<int64_t>(m_bufferSize) };
 	}
 
+	bool PRMChunk::shareBufferWith(const PRMChunk &other)
+	{
+		if (m_buffer == other.m_buffer)
+		{
+			return m_buffer != nullptr;
+		}
+
+		if (!m_buffer || !other.m_buffer || m_bufferSize != other.m_bufferSize || std::memcmp(m_buffer.get(), other.m_buffer.get(), m_bufferSize) != 0)
+		{
+			return false;
+		}
+
+		m_buffer = other.m_buffer;
+		return true;
+	}
+
+	bool PRMChunk::isBufferShared() const
+	{
+		return m_buffer && m_buffer.use_count() > 1;
+	}
+
 	PRMChunkRecognizedKind PRMChunk::getKind() const
 	{
 		return m_recognizedKind;
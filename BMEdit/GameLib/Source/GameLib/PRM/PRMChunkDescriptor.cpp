@@ -1,5 +1,6 @@
 #include <GameLib/PRM/PRMChunkDescriptor.h>
 #include <ZBinaryReader.hpp>
+#include <ZBinaryWriter.hpp>
 
 
 namespace gamelib::prm
@@ -13,4 +14,14 @@ namespace gamelib::prm
 		kind   = binaryReader->read<uint32_t, ZBio::Endianness::LE>();
 		unkC   = binaryReader->read<uint32_t, ZBio::Endianness::LE>();
 	}
+
+	void PRMChunkDescriptor::serialize(const PRMChunkDescriptor &descriptor, ZBio::ZBinaryWriter::BinaryWriter *binaryWriter)
+	{
+		const auto &[offset, size, kind, unkC] = descriptor;
+
+		binaryWriter->write<uint32_t, ZBio::Endianness::LE>(offset);
+		binaryWriter->write<uint32_t, ZBio::Endianness::LE>(size);
+		binaryWriter->write<uint32_t, ZBio::Endianness::LE>(kind);
+		binaryWriter->write<uint32_t, ZBio::Endianness::LE>(unkC);
+	}
 }
\ No newline at end of file
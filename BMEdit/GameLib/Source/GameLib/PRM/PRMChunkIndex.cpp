@@ -0,0 +1,147 @@
+#include <GameLib/PRM/PRMChunkIndex.h>
+#include <GameLib/ContentHash.h>
+#include <GameLib/Workers.h>
+#include <algorithm>
+#include <cstring>
+
+
+namespace gamelib::prm
+{
+	namespace
+	{
+		bool isSameContent(Span<uint8_t> first, Span<uint8_t> second)
+		{
+			return first.size() == second.size() && (first.empty() || std::memcmp(first.cbegin(), second.cbegin(), static_cast<std::size_t>(first.size())) == 0);
+		}
+
+		bool isDeduplicable(const PRMChunk &chunk)
+		{
+			return chunk.getKind() != PRMChunkRecognizedKind::CRK_ZERO_CHUNK && !chunk.getBuffer().empty();
+		}
+	}
+
+	void PRMChunkIndex::build(const std::vector<PRMChunk> &chunks, int threadsCount)
+	{
+		clear();
+
+		// Hashing is the most expensive part, so it's done in parallel
+		m_hashes.resize(chunks.size(), 0u);
+
+		runParallelFor(0, chunks.size(), threadsCount, [this, &chunks](std::size_t chunkIndex)
+		{
+			m_hashes[chunkIndex] = ContentHash::compute(chunks[chunkIndex].getBuffer());
+		});
+
+		// Grouping is done in order of chunks, so the canonical chunk is always the first one
+		std::unordered_map<std::uint32_t, std::size_t> groupByCanonicalChunk;
+		m_canonicalChunks.resize(chunks.size());
+
+		for (std::uint32_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex)
+		{
+			m_canonicalChunks[chunkIndex] = chunkIndex;
+
+			const auto &chunk = chunks[chunkIndex];
+			if (!isDeduplicable(chunk))
+			{
+				continue;
+			}
+
+			auto &candidates = m_canonicalChunksByHash[m_hashes[chunkIndex]];
+			auto it = std::find_if(candidates.begin(), candidates.end(), [&chunks, &chunk](std::uint32_t candidate)
+			{
+				return isSameContent(chunks[candidate].getBuffer(), chunk.getBuffer());
+			});
+
+			if (it == candidates.end())
+			{
+				candidates.push_back(chunkIndex);
+				continue;
+			}
+
+			m_canonicalChunks[chunkIndex] = *it;
+
+			auto [groupIt, isNewGroup] = groupByCanonicalChunk.try_emplace(*it, m_duplicateGroups.size());
+			if (isNewGroup)
+			{
+				auto &group = m_duplicateGroups.emplace_back();
+				group.hash = m_hashes[chunkIndex];
+				group.chunkSize = static_cast<std::size_t>(chunk.getBuffer().size());
+				group.kind = chunks[*it].getKind();
+				group.canonicalChunk = *it;
+			}
+
+			m_duplicateGroups[groupIt->second].duplicates.push_back(chunkIndex);
+			m_reclaimableBytes += static_cast<std::size_t>(chunk.getBuffer().size());
+			++m_duplicateChunksCount;
+		}
+	}
+
+	void PRMChunkIndex::clear()
+	{
+		m_hashes.clear();
+		m_canonicalChunks.clear();
+		m_canonicalChunksByHash.clear();
+		m_duplicateGroups.clear();
+		m_duplicateChunksCount = 0;
+		m_reclaimableBytes = 0;
+	}
+
+	bool PRMChunkIndex::empty() const
+	{
+		return m_hashes.empty();
+	}
+
+	std::size_t PRMChunkIndex::getChunksCount() const
+	{
+		return m_hashes.size();
+	}
+
+	std::uint64_t PRMChunkIndex::getChunkHash(std::uint32_t chunkIndex) const
+	{
+		return chunkIndex < m_hashes.size() ? m_hashes[chunkIndex] : 0u;
+	}
+
+	std::uint32_t PRMChunkIndex::getCanonicalChunk(std::uint32_t chunkIndex) const
+	{
+		return chunkIndex < m_canonicalChunks.size() ? m_canonicalChunks[chunkIndex] : kInvalidChunk;
+	}
+
+	bool PRMChunkIndex::isDuplicate(std::uint32_t chunkIndex) const
+	{
+		return chunkIndex < m_canonicalChunks.size() && m_canonicalChunks[chunkIndex] != chunkIndex;
+	}
+
+	std::uint32_t PRMChunkIndex::findChunk(const std::vector<PRMChunk> &chunks, Span<uint8_t> content) const
+	{
+		auto it = m_canonicalChunksByHash.find(ContentHash::compute(content));
+		if (it == m_canonicalChunksByHash.end())
+		{
+			return kInvalidChunk;
+		}
+
+		for (const auto candidate : it->second)
+		{
+			if (candidate < chunks.size() && isSameContent(chunks[candidate].getBuffer(), content))
+			{
+				return candidate;
+			}
+		}
+
+		return kInvalidChunk;
+	}
+
+	const std::vector<PRMChunkIndex::DuplicateGroup> &PRMChunkIndex::getDuplicateGroups() const
+	{
+		return m_duplicateGroups;
+	}
+
+	std::size_t PRMChunkIndex::getDuplicateChunksCount() const
+	{
+		return m_duplicateChunksCount;
+	}
+
+	std::size_t PRMChunkIndex::getReclaimableBytes() const
+	{
+		return m_reclaimableBytes;
+	}
+}
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include <GameLib/PRM/PRMHeader.h>
 #include <ZBinaryReader.hpp>
+#include <ZBinaryWriter.hpp>
 
 
 namespace gamelib::prm
@@ -11,4 +12,12 @@ namespace gamelib::prm
 		header.chunkOffset2 = binaryReader->read<uint32_t>();
 		header.zeroed = binaryReader->read<uint32_t>();
 	}
+
+	void PRMHeader::serialize(const PRMHeader &header, ZBio::ZBinaryWriter::BinaryWriter *binaryWriter)
+	{
+		binaryWriter->write<uint32_t, ZBio::Endianness::LE>(header.chunkOffset);
+		binaryWriter->write<uint32_t, ZBio::Endianness::LE>(header.countOfPrimitives);
+		binaryWriter->write<uint32_t, ZBio::Endianness::LE>(header.chunkOffset2);
+		binaryWriter->write<uint32_t, ZBio::Endianness::LE>(header.zeroed);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,10 @@
+#include <GameLib/PRM/PRMMesh.h>
+
+
+namespace gamelib::prm
+{
+	std::size_t PRMMesh::getTrianglesCount() const
+	{
+		return indices.size() / 3;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,646 @@
+#include <GameLib/PRM/PRMMeshExporter.h>
+#include <GameLib/PRM/PRMMeshExtractor.h>
+#include <GameLib/Workers.h>
+#include <nlohmann/json.hpp>
+#include <fmt/format.h>
+#include <unordered_map>
+#include <filesystem>
+#include <algorithm>
+#include <iterator>
+#include <fstream>
+#include <limits>
+#include <bit>
+
+
+namespace gamelib::prm
+{
+	namespace
+	{
+		constexpr std::uint32_t kGLBMagic = 0x46546C67; // glTF
+		constexpr std::uint32_t kGLBVersion = 2;
+		constexpr std::uint32_t kGLBChunkJSON = 0x4E4F534A; // JSON
+		constexpr std::uint32_t kGLBChunkBIN = 0x004E4942; // BIN\0
+		constexpr int kGLTFComponentUnsignedShort = 5123;
+		constexpr int kGLTFComponentFloat = 5126;
+		constexpr int kGLTFTargetArrayBuffer = 34962;
+		constexpr int kGLTFTargetElementArrayBuffer = 34963;
+		constexpr int kGLTFModeTriangles = 4;
+
+		constexpr std::size_t alignUp(std::size_t value, std::size_t alignment)
+		{
+			return (value + alignment - 1) & ~(alignment - 1);
+		}
+
+		template <typename T>
+		void appendLE(std::vector<std::uint8_t> &buffer, T value)
+		{
+			std::uint64_t bits = 0;
+
+			if constexpr (std::is_floating_point_v<T>)
+				bits = std::bit_cast<std::uint32_t>(static_cast<float>(value));
+			else
+				bits = static_cast<std::uint64_t>(value);
+
+			for (std::size_t i = 0; i < sizeof(T); ++i)
+			{
+				buffer.push_back(static_cast<std::uint8_t>((bits >> (i * 8)) & 0xFFu));
+			}
+		}
+
+		bool readFloats(Span<prp::PRPInstruction> instructions, float *values, std::size_t count)
+		{
+			std::size_t found = 0;
+
+			for (int64_t i = 0; i < instructions.size() && found < count; ++i)
+			{
+				const auto &instruction = instructions[static_cast<int>(i)];
+				const auto opCode = instruction.getOpCode();
+
+				if (opCode == prp::PRPOpCode::Float32 || opCode == prp::PRPOpCode::NamedFloat32)
+				{
+					values[found++] = instruction.getOperand().get<float>();
+				}
+			}
+
+			return found == count;
+		}
+
+		struct Transform
+		{
+			std::array<float, 9> rotation { 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f };
+			Vector3 position {};
+		};
+
+		/**
+		 * @brief Transform of object relative to its parent (Matrix & Position properties)
+		 */
+		Transform readLocalTransform(scene::SceneObject &sceneObject)
+		{
+			Transform transform;
+			auto &properties = sceneObject.getProperties();
+
+			if (properties.hasProperty("Matrix"))
+			{
+				std::array<float, 9> matrix {};
+				if (readFloats(properties["Matrix"], matrix.data(), matrix.size()))
+				{
+					transform.rotation = matrix;
+				}
+			}
+
+			if (properties.hasProperty("Position"))
+			{
+				std::array<float, 3> position {};
+				if (readFloats(properties["Position"], position.data(), position.size()))
+				{
+					transform.position = Vector3 { position[0], position[1], position[2] };
+				}
+			}
+
+			return transform;
+		}
+
+		/**
+		 * @brief parent * local (rotation is applied to column vector, the same as Entry::transform does)
+		 */
+		Transform combineTransforms(const Transform &parent, const Transform &local)
+		{
+			const auto &a = parent.rotation;
+			const auto &b = local.rotation;
+			const auto &p = local.position;
+			Transform result;
+
+			for (int row = 0; row < 3; ++row)
+			{
+				for (int column = 0; column < 3; ++column)
+				{
+					result.rotation[row * 3 + column] = a[row * 3 + 0] * b[column] + a[row * 3 + 1] * b[3 + column] + a[row * 3 + 2] * b[6 + column];
+				}
+			}
+
+			result.position.x = a[0] * p.x + a[1] * p.y + a[2] * p.z + parent.position.x;
+			result.position.y = a[3] * p.x + a[4] * p.y + a[5] * p.z + parent.position.y;
+			result.position.z = a[6] * p.x + a[7] * p.y + a[8] * p.z + parent.position.z;
+			return result;
+		}
+
+		/**
+		 * @brief World transform of object: local transforms of all parents are combined (results are memoized, so each object is visited once)
+		 */
+		const Transform &getWorldTransform(const scene::SceneObject::Ptr &sceneObject, std::unordered_map<const scene::SceneObject *, Transform> &worldTransforms)
+		{
+			// Objects from sceneObject up to the first one with known world transform
+			std::vector<scene::SceneObject::Ptr> chain;
+			Transform world;
+
+			for (auto current = sceneObject; current; current = current->getParent().lock())
+			{
+				if (auto it = worldTransforms.find(current.get()); it != worldTransforms.end())
+				{
+					world = it->second;
+					break;
+				}
+
+				chain.push_back(current);
+			}
+
+			for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+			{
+				world = combineTransforms(world, readLocalTransform(**it));
+				worldTransforms[it->get()] = world;
+			}
+
+			return worldTransforms.at(sceneObject.get());
+		}
+
+		std::string makeEntryName(const PRMMeshExporter::Entry &entry)
+		{
+			return entry.name.empty() ? fmt::format("Primitive_{}", entry.primitiveIndex) : entry.name;
+		}
+
+		std::size_t sizeOfFile(const std::string &path)
+		{
+			std::error_code errorCode;
+			const auto fileSize = std::filesystem::file_size(path, errorCode);
+			return errorCode ? 0 : static_cast<std::size_t>(fileSize);
+		}
+
+		void removeFile(const std::string &path)
+		{
+			std::error_code errorCode;
+			std::filesystem::remove(path, errorCode);
+		}
+
+		/// ---------------------------------------------------------------------------------------------------------------
+		/// glTF
+		/// ---------------------------------------------------------------------------------------------------------------
+		struct GLBEncodedMesh
+		{
+			std::size_t positionsOffset { 0 };
+			std::size_t positionsSize { 0 };
+			std::size_t indicesOffset { 0 };
+			std::size_t indicesSize { 0 };
+			std::size_t verticesCount { 0 };
+			std::size_t indicesCount { 0 };
+			Vector3 min {};
+			Vector3 max {};
+		};
+
+		struct GLBEncodedPrimitive
+		{
+			std::vector<std::uint8_t> bytes; ///< Part of BIN chunk (offsets of meshes are relative to the beginning of this block)
+			std::vector<GLBEncodedMesh> meshes;
+		};
+
+		void encodePrimitiveAsGLB(const std::vector<PRMChunk> &chunks, std::uint32_t primitiveIndex, GLBEncodedPrimitive &encoded)
+		{
+			std::vector<PRMMesh> meshes;
+			if (!PRMMeshExtractor::extract(chunks, primitiveIndex, meshes))
+			{
+				return;
+			}
+
+			for (const auto &mesh : meshes)
+			{
+				if (mesh.vertices.empty() || mesh.indices.size() < 3)
+				{
+					continue;
+				}
+
+				GLBEncodedMesh encodedMesh;
+				encodedMesh.verticesCount = mesh.vertices.size();
+				encodedMesh.indicesCount = mesh.getTrianglesCount() * 3;
+				encodedMesh.min = encodedMesh.max = mesh.vertices.front();
+
+				// Positions (each section is 4 bytes aligned, so offsets are valid for accessors)
+				encodedMesh.positionsOffset = encoded.bytes.size();
+
+				for (const auto &vertex : mesh.vertices)
+				{
+					appendLE(encoded.bytes, vertex.x);
+					appendLE(encoded.bytes, vertex.y);
+					appendLE(encoded.bytes, vertex.z);
+
+					encodedMesh.min.x = std::min(encodedMesh.min.x, vertex.x);
+					encodedMesh.min.y = std::min(encodedMesh.min.y, vertex.y);
+					encodedMesh.min.z = std::min(encodedMesh.min.z, vertex.z);
+					encodedMesh.max.x = std::max(encodedMesh.max.x, vertex.x);
+					encodedMesh.max.y = std::max(encodedMesh.max.y, vertex.y);
+					encodedMesh.max.z = std::max(encodedMesh.max.z, vertex.z);
+				}
+
+				encodedMesh.positionsSize = encoded.bytes.size() - encodedMesh.positionsOffset;
+
+				// Indices
+				encodedMesh.indicesOffset = encoded.bytes.size();
+
+				for (std::size_t i = 0; i < encodedMesh.indicesCount; ++i)
+				{
+					appendLE(encoded.bytes, mesh.indices[i]);
+				}
+
+				encodedMesh.indicesSize = encoded.bytes.size() - encodedMesh.indicesOffset;
+				encoded.bytes.resize(alignUp(encoded.bytes.size(), 4), 0u);
+
+				encoded.meshes.push_back(encodedMesh);
+			}
+		}
+
+		bool exportAsGLB(const std::vector<PRMChunk> &chunks, const std::vector<PRMMeshExporter::Entry> &entries, const PRMMeshExporter::Options &options, const std::string &path, PRMMeshExporter::Stats &stats)
+		{
+			// Every primitive is encoded once, entries are nodes which refer to the mesh of primitive
+			std::vector<std::uint32_t> primitives;
+			std::unordered_map<std::uint32_t, int> meshByPrimitive;
+
+			for (const auto &entry : entries)
+			{
+				if (meshByPrimitive.emplace(entry.primitiveIndex, -1).second)
+				{
+					primitives.push_back(entry.primitiveIndex);
+				}
+			}
+
+			const std::string binPath = path + ".bin.part";
+			std::ofstream binStream(binPath, std::ios::binary | std::ios::trunc);
+			if (!binStream)
+			{
+				return false;
+			}
+
+			nlohmann::json meshesJson = nlohmann::json::array();
+			nlohmann::json accessorsJson = nlohmann::json::array();
+			nlohmann::json bufferViewsJson = nlohmann::json::array();
+			std::size_t binSize = 0;
+
+			auto addBufferView = [&bufferViewsJson, &binSize](std::size_t offset, std::size_t size, int target) -> std::size_t
+			{
+				bufferViewsJson.push_back({ { "buffer", 0 }, { "byteOffset", binSize + offset }, { "byteLength", size }, { "target", target } });
+				return bufferViewsJson.size() - 1;
+			};
+
+			const auto batchSize = std::max<std::size_t>(options.batchSize, 1);
+			std::vector<GLBEncodedPrimitive> batch;
+
+			for (std::size_t batchBegin = 0; batchBegin < primitives.size(); batchBegin += batchSize)
+			{
+				const auto batchEnd = std::min(batchBegin + batchSize, primitives.size());
+				batch.clear();
+				batch.resize(batchEnd - batchBegin);
+
+				runParallelFor(batchBegin, batchEnd, options.threadsCount, [&](std::size_t index)
+				{
+					encodePrimitiveAsGLB(chunks, primitives[index], batch[index - batchBegin]);
+				});
+
+				// Flush batch in order of primitives, so output does not depend on count of workers
+				for (std::size_t i = 0; i < batch.size(); ++i)
+				{
+					const auto &encoded = batch[i];
+					if (encoded.meshes.empty())
+					{
+						continue;
+					}
+
+					nlohmann::json primitivesJson = nlohmann::json::array();
+
+					for (const auto &mesh : encoded.meshes)
+					{
+						const auto positionsView = addBufferView(mesh.positionsOffset, mesh.positionsSize, kGLTFTargetArrayBuffer);
+						const auto indicesView = addBufferView(mesh.indicesOffset, mesh.indicesSize, kGLTFTargetElementArrayBuffer);
+
+						accessorsJson.push_back({
+							{ "bufferView", positionsView },
+							{ "componentType", kGLTFComponentFloat },
+							{ "count", mesh.verticesCount },
+							{ "type", "VEC3" },
+							{ "min", { mesh.min.x, mesh.min.y, mesh.min.z } },
+							{ "max", { mesh.max.x, mesh.max.y, mesh.max.z } }
+						});
+
+						accessorsJson.push_back({
+							{ "bufferView", indicesView },
+							{ "componentType", kGLTFComponentUnsignedShort },
+							{ "count", mesh.indicesCount },
+							{ "type", "SCALAR" }
+						});
+
+						primitivesJson.push_back({
+							{ "attributes", { { "POSITION", accessorsJson.size() - 2 } } },
+							{ "indices", accessorsJson.size() - 1 },
+							{ "mode", kGLTFModeTriangles }
+						});
+
+						stats.verticesCount += mesh.verticesCount;
+						stats.trianglesCount += mesh.indicesCount / 3;
+					}
+
+					const auto primitiveIndex = primitives[batchBegin + i];
+					meshesJson.push_back({ { "name", fmt::format("Primitive_{}", primitiveIndex) }, { "primitives", std::move(primitivesJson) } });
+					meshByPrimitive[primitiveIndex] = static_cast<int>(meshesJson.size() - 1);
+
+					binStream.write(reinterpret_cast<const char*>(encoded.bytes.data()), static_cast<std::streamsize>(encoded.bytes.size()));
+					binSize += encoded.bytes.size();
+					++stats.encodedPrimitives;
+				}
+			}
+
+			binStream.close();
+
+			// Nodes
+			nlohmann::json nodesJson = nlohmann::json::array();
+
+			for (const auto &entry : entries)
+			{
+				const auto meshIndex = meshByPrimitive[entry.primitiveIndex];
+				if (meshIndex < 0)
+				{
+					++stats.skippedEntries;
+					continue;
+				}
+
+				nlohmann::json nodeJson = { { "name", makeEntryName(entry) }, { "mesh", meshIndex } };
+
+				if (entry.hasTransform())
+				{
+					// glTF matrix is column-major
+					const auto &r = entry.rotation;
+					const auto &p = entry.position;
+					nodeJson["matrix"] = { r[0], r[3], r[6], 0.f, r[1], r[4], r[7], 0.f, r[2], r[5], r[8], 0.f, p.x, p.y, p.z, 1.f };
+				}
+
+				nodesJson.push_back(std::move(nodeJson));
+				++stats.exportedEntries;
+			}
+
+			if (nodesJson.empty() || !binSize || sizeOfFile(binPath) != binSize)
+			{
+				removeFile(binPath);
+				return false;
+			}
+
+			nlohmann::json sceneNodesJson = nlohmann::json::array();
+			for (std::size_t i = 0; i < nodesJson.size(); ++i)
+			{
+				sceneNodesJson.push_back(i);
+			}
+
+			nlohmann::json document = {
+				{ "asset", { { "version", "2.0" }, { "generator", "BMEdit" } } },
+				{ "scene", 0 },
+				{ "scenes", { { { "nodes", std::move(sceneNodesJson) } } } },
+				{ "nodes", std::move(nodesJson) },
+				{ "meshes", std::move(meshesJson) },
+				{ "accessors", std::move(accessorsJson) },
+				{ "bufferViews", std::move(bufferViewsJson) },
+				{ "buffers", { { { "byteLength", binSize } } } }
+			};
+
+			std::string jsonChunk = document.dump();
+			jsonChunk.resize(alignUp(jsonChunk.size(), 4), ' ');
+
+			const std::size_t totalSize = 12 + 8 + jsonChunk.size() + 8 + binSize;
+			if (totalSize > std::numeric_limits<std::uint32_t>::max())
+			{
+				removeFile(binPath);
+				return false;
+			}
+
+			std::vector<std::uint8_t> header;
+			appendLE<std::uint32_t>(header, kGLBMagic);
+			appendLE<std::uint32_t>(header, kGLBVersion);
+			appendLE<std::uint32_t>(header, static_cast<std::uint32_t>(totalSize));
+			appendLE<std::uint32_t>(header, static_cast<std::uint32_t>(jsonChunk.size()));
+			appendLE<std::uint32_t>(header, kGLBChunkJSON);
+
+			std::vector<std::uint8_t> binHeader;
+			appendLE<std::uint32_t>(binHeader, static_cast<std::uint32_t>(binSize));
+			appendLE<std::uint32_t>(binHeader, kGLBChunkBIN);
+
+			std::ofstream outputStream(path, std::ios::binary | std::ios::trunc);
+			std::ifstream binInputStream(binPath, std::ios::binary);
+			if (!outputStream || !binInputStream)
+			{
+				removeFile(binPath);
+				return false;
+			}
+
+			outputStream.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+			outputStream.write(jsonChunk.data(), static_cast<std::streamsize>(jsonChunk.size()));
+			outputStream.write(reinterpret_cast<const char*>(binHeader.data()), static_cast<std::streamsize>(binHeader.size()));
+
+			std::vector<char> copyBuffer(1024 * 1024);
+			while (binInputStream)
+			{
+				binInputStream.read(copyBuffer.data(), static_cast<std::streamsize>(copyBuffer.size()));
+				outputStream.write(copyBuffer.data(), binInputStream.gcount());
+			}
+
+			binInputStream.close();
+			removeFile(binPath);
+
+			stats.bytesWritten = totalSize;
+			return outputStream.good();
+		}
+
+		/// ---------------------------------------------------------------------------------------------------------------
+		/// OBJ
+		/// ---------------------------------------------------------------------------------------------------------------
+		void encodeEntryAsOBJ(const PRMMeshExporter::Entry &entry, const std::vector<PRMMesh> &meshes, std::size_t firstVertex, std::string &text)
+		{
+			auto name = makeEntryName(entry);
+			std::replace_if(name.begin(), name.end(), [](char ch) { return ch == ' ' || ch == '\t'; }, '_');
+
+			auto out = std::back_inserter(text);
+			fmt::format_to(out, "o {}\n", name);
+
+			for (const auto &mesh : meshes)
+			{
+				for (const auto &vertex : mesh.vertices)
+				{
+					const auto point = entry.transform(vertex);
+					fmt::format_to(out, "v {} {} {}\n", point.x, point.y, point.z);
+				}
+			}
+
+			for (const auto &mesh : meshes)
+			{
+				for (std::size_t triangle = 0; triangle < mesh.getTrianglesCount(); ++triangle)
+				{
+					fmt::format_to(out, "f {} {} {}\n",
+								   firstVertex + mesh.indices[triangle * 3 + 0],
+								   firstVertex + mesh.indices[triangle * 3 + 1],
+								   firstVertex + mesh.indices[triangle * 3 + 2]);
+				}
+
+				firstVertex += mesh.vertices.size();
+			}
+		}
+
+		bool exportAsOBJ(const std::vector<PRMChunk> &chunks, const std::vector<PRMMeshExporter::Entry> &entries, const PRMMeshExporter::Options &options, const std::string &path, PRMMeshExporter::Stats &stats)
+		{
+			std::ofstream outputStream(path, std::ios::trunc);
+			if (!outputStream)
+			{
+				return false;
+			}
+
+			outputStream << "# Exported by BMEdit\n";
+
+			const auto batchSize = std::max<std::size_t>(options.batchSize, 1);
+			std::vector<std::vector<PRMMesh>> batchMeshes;
+			std::vector<std::size_t> batchFirstVertex;
+			std::vector<std::string> batchText;
+			std::size_t nextVertex = 1; // OBJ indices are 1-based
+
+			for (std::size_t batchBegin = 0; batchBegin < entries.size(); batchBegin += batchSize)
+			{
+				const auto batchEnd = std::min(batchBegin + batchSize, entries.size());
+				const auto count = batchEnd - batchBegin;
+
+				batchMeshes.clear();
+				batchMeshes.resize(count);
+				batchText.clear();
+				batchText.resize(count);
+				batchFirstVertex.assign(count, 0);
+
+				// Decode (vertices count of each entry is required to produce global indices)
+				runParallelFor(batchBegin, batchEnd, options.threadsCount, [&](std::size_t index)
+				{
+					PRMMeshExtractor::extract(chunks, entries[index].primitiveIndex, batchMeshes[index - batchBegin]);
+				});
+
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					batchFirstVertex[i] = nextVertex;
+
+					for (const auto &mesh : batchMeshes[i])
+					{
+						nextVertex += mesh.vertices.size();
+						stats.verticesCount += mesh.vertices.size();
+						stats.trianglesCount += mesh.getTrianglesCount();
+					}
+				}
+
+				// Encode
+				runParallelFor(batchBegin, batchEnd, options.threadsCount, [&](std::size_t index)
+				{
+					const auto slot = index - batchBegin;
+					if (!batchMeshes[slot].empty())
+					{
+						encodeEntryAsOBJ(entries[index], batchMeshes[slot], batchFirstVertex[slot], batchText[slot]);
+					}
+				});
+
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					if (batchText[i].empty())
+					{
+						++stats.skippedEntries;
+						continue;
+					}
+
+					outputStream.write(batchText[i].data(), static_cast<std::streamsize>(batchText[i].size()));
+					++stats.exportedEntries;
+					++stats.encodedPrimitives;
+				}
+			}
+
+			outputStream.close();
+
+			if (!stats.exportedEntries)
+			{
+				removeFile(path);
+				return false;
+			}
+
+			stats.bytesWritten = sizeOfFile(path);
+			return !outputStream.fail();
+		}
+	}
+
+	bool PRMMeshExporter::Entry::hasTransform() const
+	{
+		static constexpr std::array<float, 9> kIdentity { 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f };
+		return rotation != kIdentity || position.x != 0.f || position.y != 0.f || position.z != 0.f;
+	}
+
+	Vector3 PRMMeshExporter::Entry::transform(const Vector3 &point) const
+	{
+		Vector3 result;
+		result.x = rotation[0] * point.x + rotation[1] * point.y + rotation[2] * point.z + position.x;
+		result.y = rotation[3] * point.x + rotation[4] * point.y + rotation[5] * point.z + position.y;
+		result.z = rotation[6] * point.x + rotation[7] * point.y + rotation[8] * point.z + position.z;
+		return result;
+	}
+
+	std::vector<PRMMeshExporter::Entry> PRMMeshExporter::collectPrimitives(const std::vector<PRMChunk> &chunks)
+	{
+		std::vector<Entry> entries;
+
+		for (const auto &chunk : chunks)
+		{
+			if (chunk.getKind() == PRMChunkRecognizedKind::CRK_DESCRIPTION_BUFFER)
+			{
+				auto &entry = entries.emplace_back();
+				entry.primitiveIndex = chunk.getIndex();
+			}
+		}
+
+		return entries;
+	}
+
+	std::vector<PRMMeshExporter::Entry> PRMMeshExporter::collectGeoms(const std::vector<scene::SceneObject::Ptr> &sceneObjects, const std::vector<PRMChunk> &chunks)
+	{
+		std::vector<Entry> entries;
+		std::unordered_map<const scene::SceneObject *, Transform> worldTransforms;
+
+		for (const auto &sceneObject : sceneObjects)
+		{
+			auto &properties = sceneObject->getProperties();
+			if (!properties.hasProperty("PrimId"))
+			{
+				continue;
+			}
+
+			const auto primId = properties["PrimId"][0].getOperand().get<std::int32_t>();
+			if (primId <= 0 || static_cast<std::size_t>(primId) >= chunks.size() || chunks[primId].getKind() != PRMChunkRecognizedKind::CRK_DESCRIPTION_BUFFER)
+			{
+				continue;
+			}
+
+			Entry entry;
+			entry.name = sceneObject->getName();
+			entry.primitiveIndex = static_cast<std::uint32_t>(primId);
+
+			const auto &world = getWorldTransform(sceneObject, worldTransforms);
+			entry.rotation = world.rotation;
+			entry.position = world.position;
+
+			entries.emplace_back(std::move(entry));
+		}
+
+		return entries;
+	}
+
+	bool PRMMeshExporter::exportToFile(const std::vector<PRMChunk> &chunks, const std::vector<Entry> &entries, const Options &options, const std::string &path, Stats *stats)
+	{
+		Stats localStats;
+		Stats &exportStats = stats ? *stats : localStats;
+		exportStats = Stats();
+
+		if (entries.empty() || path.empty())
+		{
+			return false;
+		}
+
+		switch (options.format)
+		{
+			case PRMExportFormat::EF_GLTF_BINARY:
+				return exportAsGLB(chunks, entries, options, path, exportStats);
+			case PRMExportFormat::EF_WAVEFRONT_OBJ:
+				return exportAsOBJ(chunks, entries, options, path, exportStats);
+		}
+
+		return false;
+	}
+}
\ No newline at end of file
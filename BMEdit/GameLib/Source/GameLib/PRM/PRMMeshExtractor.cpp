@@ -0,0 +1,266 @@
+#include <GameLib/PRM/PRMMeshExtractor.h>
+#include <GameLib/PRM/PRMIndexChunkHeader.h>
+#include <ZBinaryReader.hpp>
+#include <algorithm>
+#include <limits>
+
+
+namespace gamelib::prm
+{
+	namespace
+	{
+		void readChunkReferences(const PRMChunk &chunk, std::vector<std::uint32_t> &references)
+		{
+			const auto buffer = chunk.getBuffer();
+			if (!buffer || buffer.size() < static_cast<int64_t>(sizeof(std::uint32_t)))
+			{
+				return;
+			}
+
+			ZBio::ZBinaryReader::BinaryReader binaryReader(reinterpret_cast<const char*>(buffer.cbegin()), buffer.size());
+
+			const auto wordsCount = buffer.size() / static_cast<int64_t>(sizeof(std::uint32_t));
+			references.reserve(references.size() + wordsCount);
+
+			for (int64_t i = 0; i < wordsCount; ++i)
+			{
+				references.emplace_back(binaryReader.read<std::uint32_t, ZBio::Endianness::LE>());
+			}
+		}
+
+		bool isChunkOfKind(const std::vector<PRMChunk> &chunks, std::uint32_t chunkIndex, PRMChunkRecognizedKind kind)
+		{
+			return chunkIndex != 0u && chunkIndex < chunks.size() && chunks[chunkIndex].getKind() == kind;
+		}
+
+		bool resolveMeshReferences(const std::vector<PRMChunk> &chunks, const std::vector<std::uint32_t> &references, std::uint32_t &vertexChunk, std::uint32_t &indexChunk)
+		{
+			vertexChunk = 0u;
+			indexChunk = 0u;
+
+			for (const auto ref : references)
+			{
+				if (!vertexChunk && isChunkOfKind(chunks, ref, PRMChunkRecognizedKind::CRK_VERTEX_BUFFER))
+				{
+					vertexChunk = ref;
+				}
+				else if (!indexChunk && isChunkOfKind(chunks, ref, PRMChunkRecognizedKind::CRK_INDEX_BUFFER))
+				{
+					indexChunk = ref;
+				}
+
+				if (vertexChunk && indexChunk)
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+	}
+
+	bool PRMMeshExtractor::collectMeshReferences(const std::vector<PRMChunk> &chunks, std::uint32_t descriptionChunkIndex, std::vector<std::pair<std::uint32_t, std::uint32_t>> &meshReferences)
+	{
+		if (!isChunkOfKind(chunks, descriptionChunkIndex, PRMChunkRecognizedKind::CRK_DESCRIPTION_BUFFER))
+		{
+			return false;
+		}
+
+		const auto *descriptionHeader = chunks[descriptionChunkIndex].getDescriptionBufferHeader();
+		if (!descriptionHeader || descriptionHeader->ptrObjects == 0u || descriptionHeader->ptrObjects >= chunks.size())
+		{
+			return false;
+		}
+
+		std::vector<std::uint32_t> objectsTable;
+		readChunkReferences(chunks[descriptionHeader->ptrObjects], objectsTable);
+
+		std::vector<std::uint32_t> recordReferences;
+		const auto initialReferencesCount = meshReferences.size();
+
+		auto addMeshReference = [&meshReferences](std::uint32_t vertexChunk, std::uint32_t indexChunk)
+		{
+			const auto ref = std::make_pair(vertexChunk, indexChunk);
+			if (std::find(meshReferences.begin(), meshReferences.end(), ref) == meshReferences.end())
+			{
+				meshReferences.emplace_back(ref);
+			}
+		};
+
+		for (const auto objectChunkIndex : objectsTable)
+		{
+			if (objectChunkIndex == 0u || objectChunkIndex >= chunks.size() || objectChunkIndex == descriptionChunkIndex)
+			{
+				continue;
+			}
+
+			const auto kind = chunks[objectChunkIndex].getKind();
+			if (kind == PRMChunkRecognizedKind::CRK_VERTEX_BUFFER || kind == PRMChunkRecognizedKind::CRK_INDEX_BUFFER)
+			{
+				// Objects table refers buffers directly, handled below
+				continue;
+			}
+
+			recordReferences.clear();
+			readChunkReferences(chunks[objectChunkIndex], recordReferences);
+
+			if (std::uint32_t vertexChunk = 0u, indexChunk = 0u; resolveMeshReferences(chunks, recordReferences, vertexChunk, indexChunk))
+			{
+				addMeshReference(vertexChunk, indexChunk);
+			}
+		}
+
+		if (meshReferences.size() == initialReferencesCount)
+		{
+			// Small primitives could keep references to buffers right in objects table
+			if (std::uint32_t vertexChunk = 0u, indexChunk = 0u; resolveMeshReferences(chunks, objectsTable, vertexChunk, indexChunk))
+			{
+				addMeshReference(vertexChunk, indexChunk);
+			}
+		}
+
+		return meshReferences.size() != initialReferencesCount;
+	}
+
+	bool PRMMeshExtractor::extract(const std::vector<PRMChunk> &chunks, std::uint32_t descriptionChunkIndex, std::vector<PRMMesh> &meshes)
+	{
+		std::vector<std::pair<std::uint32_t, std::uint32_t>> meshReferences;
+		if (!collectMeshReferences(chunks, descriptionChunkIndex, meshReferences))
+		{
+			return false;
+		}
+
+		bool hasAnyMesh = false;
+
+		for (const auto& [vertexChunk, indexChunk] : meshReferences)
+		{
+			PRMMesh mesh;
+			mesh.vertexBufferChunk = vertexChunk;
+			mesh.indexBufferChunk = indexChunk;
+			mesh.vertexFormat = chunks[vertexChunk].getVertexBufferHeader()->vertexFormat;
+
+			if (!decodeVertices(chunks[vertexChunk], mesh.vertices) || !decodeIndices(chunks[indexChunk], mesh.indices))
+			{
+				continue;
+			}
+
+			// Drop triangles which refers to vertices out of buffer
+			const auto verticesCount = mesh.vertices.size();
+			std::size_t validIndicesCount = 0;
+
+			for (std::size_t i = 0; i + 2 < mesh.indices.size(); i += 3)
+			{
+				if (mesh.indices[i] >= verticesCount || mesh.indices[i + 1] >= verticesCount || mesh.indices[i + 2] >= verticesCount)
+				{
+					continue;
+				}
+
+				mesh.indices[validIndicesCount++] = mesh.indices[i];
+				mesh.indices[validIndicesCount++] = mesh.indices[i + 1];
+				mesh.indices[validIndicesCount++] = mesh.indices[i + 2];
+			}
+
+			mesh.indices.resize(validIndicesCount);
+
+			if (mesh.indices.empty())
+			{
+				continue;
+			}
+
+			meshes.emplace_back(std::move(mesh));
+			hasAnyMesh = true;
+		}
+
+		return hasAnyMesh;
+	}
+
+	bool PRMMeshExtractor::decodeVertices(const PRMChunk &vertexChunk, std::vector<Vector3> &vertices)
+	{
+		const auto *vertexHeader = vertexChunk.getVertexBufferHeader();
+		if (!vertexHeader || vertexHeader->vertexFormat == PRMVertexBufferFormat::VBF_UNKNOWN_VERTEX)
+		{
+			return false;
+		}
+
+		// Vertex format value is a stride of vertex. Position is always first 3 floats.
+		const auto stride = static_cast<int64_t>(vertexHeader->vertexFormat);
+		const auto buffer = vertexChunk.getBuffer();
+		if (!buffer || buffer.size() < stride)
+		{
+			return false;
+		}
+
+		ZBio::ZBinaryReader::BinaryReader binaryReader(reinterpret_cast<const char*>(buffer.cbegin()), buffer.size());
+
+		const auto verticesCount = buffer.size() / stride;
+		vertices.resize(verticesCount);
+
+		for (int64_t i = 0; i < verticesCount; ++i)
+		{
+			binaryReader.seek(i * stride);
+
+			auto &vertex = vertices[i];
+			vertex.x = binaryReader.read<float, ZBio::Endianness::LE>();
+			vertex.y = binaryReader.read<float, ZBio::Endianness::LE>();
+			vertex.z = binaryReader.read<float, ZBio::Endianness::LE>();
+		}
+
+		return true;
+	}
+
+	bool PRMMeshExtractor::decodeIndices(const PRMChunk &indexChunk, std::vector<std::uint16_t> &indices)
+	{
+		const auto *indexHeader = indexChunk.getIndexBufferHeader();
+		if (!indexHeader)
+		{
+			return false;
+		}
+
+		const auto buffer = indexChunk.getBuffer();
+		constexpr int64_t kIndexHeaderSize = 4;
+
+		if (!buffer || buffer.size() < kIndexHeaderSize + (static_cast<int64_t>(indexHeader->indicesCount) * 2))
+		{
+			return false;
+		}
+
+		ZBio::ZBinaryReader::BinaryReader binaryReader(reinterpret_cast<const char*>(buffer.cbegin()), buffer.size());
+		binaryReader.seek(kIndexHeaderSize);
+
+		indices.resize(indexHeader->indicesCount);
+
+		for (auto &index : indices)
+		{
+			index = binaryReader.read<std::uint16_t, ZBio::Endianness::LE>();
+		}
+
+		return true;
+	}
+
+	BoundingBox PRMMeshExtractor::calculateBoundingBox(const std::vector<PRMMesh> &meshes)
+	{
+		constexpr float kMax = std::numeric_limits<float>::max();
+		constexpr float kMin = std::numeric_limits<float>::lowest();
+
+		BoundingBox result { Vector3 { kMax, kMax, kMax }, Vector3 { kMin, kMin, kMin } };
+		bool hasVertices = false;
+
+		for (const auto &mesh : meshes)
+		{
+			for (const auto index : mesh.indices)
+			{
+				const auto &vertex = mesh.vertices[index];
+
+				result.min.x = std::min(result.min.x, vertex.x);
+				result.min.y = std::min(result.min.y, vertex.y);
+				result.min.z = std::min(result.min.z, vertex.z);
+				result.max.x = std::max(result.max.x, vertex.x);
+				result.max.y = std::max(result.max.y, vertex.y);
+				result.max.z = std::max(result.max.z, vertex.z);
+				hasVertices = true;
+			}
+		}
+
+		return hasVertices ? result : BoundingBox {};
+	}
+}
\ No newline at end of file
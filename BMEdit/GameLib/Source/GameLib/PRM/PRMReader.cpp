@@ -5,6 +5,7 @@
 #include <GameLib/PRM/PRMReader.h>
 #include <GameLib/PRM/PRMChunk.h>
 #include <GameLib/PRM/PRMDescriptionChunkBaseHeader.h>
+#include <GameLib/Profiler.h>
 
 #include <ZBinaryReader.hpp>
 
@@ -22,6 +23,8 @@ namespace gamelib::prm
 
 	bool PRMReader::read(Span<uint8_t> buffer)
 	{
+		GAMELIB_PROFILE_SCOPE("PRMReader::read");
+
 		if (!buffer)
 		{
 			return false;
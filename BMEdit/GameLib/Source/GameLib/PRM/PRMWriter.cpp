@@ -0,0 +1,316 @@
+#include <GameLib/PRM/PRMWriter.h>
+#include <ZBinaryWriter.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+
+namespace gamelib::prm
+{
+	namespace
+	{
+		constexpr std::uint32_t kNoChunk = 0xFFFFFFFFu;
+		constexpr std::uint32_t kPlaceholderBodySize = 0x10; // Recognized as empty index buffer
+
+		struct Block
+		{
+			std::uint32_t chunkIndex { kNoChunk }; ///< kNoChunk for descriptors table & placeholder
+			std::uint32_t size { 0u };
+			std::uint32_t sourceOffset { 0u };
+			std::uint32_t offset { 0u };
+			bool isPlaced { false };
+		};
+
+		std::uint32_t alignUp(std::uint32_t value, std::uint32_t alignment)
+		{
+			return alignment > 1 ? ((value + alignment - 1) / alignment) * alignment : value;
+		}
+
+		/**
+		 * @brief Place blocks at their source offsets while they don't overlap each other (and header)
+		 */
+		void placeAtSourceOffsets(std::vector<Block*> &candidates)
+		{
+			std::sort(candidates.begin(), candidates.end(), [](const Block *a, const Block *b) { return a->sourceOffset < b->sourceOffset; });
+
+			std::uint32_t occupiedEnd = PRMHeader::kHeaderSize;
+
+			for (auto *block : candidates)
+			{
+				if (block->sourceOffset < occupiedEnd)
+				{
+					continue; // Will be appended
+				}
+
+				block->offset = block->sourceOffset;
+				block->isPlaced = true;
+				occupiedEnd = block->offset + block->size;
+			}
+		}
+	}
+
+	void PRMWriter::write(const PRMHeader &header,
+	                      const std::vector<PRMChunkDescriptor> &chunkDescriptors,
+	                      const std::vector<PRMChunk> &chunks,
+	                      const PRMWriterOptions &options,
+	                      std::vector<uint8_t> &outBuffer)
+	{
+		const auto chunksCount = static_cast<std::uint32_t>(chunks.size());
+		const auto *deduplicationIndex = options.deduplicationIndex;
+		const bool isDeduplicationEnabled = deduplicationIndex && deduplicationIndex->getChunksCount() == chunks.size();
+		assert(!deduplicationIndex || isDeduplicationEnabled); // Index was built for another set of chunks
+
+		const bool hasSourceLayout = chunkDescriptors.size() == chunks.size();
+		const bool isPreserveLayout = options.layout == PRMWriterLayout::WL_PRESERVE_ORIGINAL && hasSourceLayout;
+		const std::uint32_t alignment = options.alignment ? options.alignment : detectAlignment(chunkDescriptors);
+
+		std::vector<bool> isUsed;
+		if (options.compactUnusedChunks)
+		{
+			collectUsedChunks(chunks, isUsed);
+		}
+
+		// Resolve owner of body for each chunk
+		std::vector<std::uint32_t> bodyOwner(chunksCount, kNoChunk);
+		bool hasCompactedChunks = false;
+
+		for (std::uint32_t chunkIndex = 0; chunkIndex < chunksCount; ++chunkIndex)
+		{
+			if (options.compactUnusedChunks && !isUsed[chunkIndex])
+			{
+				hasCompactedChunks = true;
+				continue; // Refers to placeholder
+			}
+
+			bodyOwner[chunkIndex] = chunkIndex;
+
+			if (isDeduplicationEnabled && deduplicationIndex->isDuplicate(chunkIndex))
+			{
+				const auto canonicalChunk = deduplicationIndex->getCanonicalChunk(chunkIndex);
+				if (!options.compactUnusedChunks || isUsed[canonicalChunk])
+				{
+					bodyOwner[chunkIndex] = canonicalChunk;
+				}
+			}
+		}
+
+		// Blocks: own bodies, placeholder & descriptors table
+		std::vector<Block> bodies(chunksCount);
+		Block placeholder { kNoChunk, kPlaceholderBodySize };
+		Block descriptorsTable { kNoChunk, chunksCount * PRMChunkDescriptor::kDescriptorSize, header.chunkOffset };
+
+		std::vector<Block*> candidates;
+		candidates.reserve(chunksCount + 1);
+
+		for (std::uint32_t chunkIndex = 0; chunkIndex < chunksCount; ++chunkIndex)
+		{
+			auto &body = bodies[chunkIndex];
+			body.chunkIndex = chunkIndex;
+			body.size = static_cast<std::uint32_t>(chunks[chunkIndex].getBuffer().size());
+
+			if (isPreserveLayout && bodyOwner[chunkIndex] == chunkIndex && chunkDescriptors[chunkIndex].declarationSize == body.size)
+			{
+				body.sourceOffset = chunkDescriptors[chunkIndex].declarationOffset;
+
+				if (body.size == 0u)
+				{
+					// Empty body could be placed anywhere
+					body.offset = body.sourceOffset;
+					body.isPlaced = true;
+				}
+				else
+				{
+					candidates.push_back(&body);
+				}
+			}
+		}
+
+		if (isPreserveLayout && header.countOfPrimitives == chunksCount)
+		{
+			candidates.push_back(&descriptorsTable);
+		}
+
+		placeAtSourceOffsets(candidates);
+
+		// Append other blocks after placed ones
+		std::uint32_t fileSize = PRMHeader::kHeaderSize;
+
+		for (const auto *block : candidates)
+		{
+			if (block->isPlaced)
+			{
+				fileSize = std::max(fileSize, block->offset + block->size);
+			}
+		}
+
+		auto appendBlock = [&fileSize, alignment](Block &block)
+		{
+			block.offset = alignUp(fileSize, alignment);
+			block.isPlaced = true;
+			fileSize = block.offset + block.size;
+		};
+
+		for (std::uint32_t chunkIndex = 0; chunkIndex < chunksCount; ++chunkIndex)
+		{
+			if (bodyOwner[chunkIndex] == chunkIndex && !bodies[chunkIndex].isPlaced)
+			{
+				appendBlock(bodies[chunkIndex]);
+			}
+		}
+
+		if (hasCompactedChunks)
+		{
+			appendBlock(placeholder);
+		}
+
+		if (!descriptorsTable.isPlaced)
+		{
+			appendBlock(descriptorsTable);
+		}
+
+		// Build descriptors
+		std::vector<PRMChunkDescriptor> descriptors(chunksCount, PRMChunkDescriptor { 0u, 0u, 0u, 0u });
+
+		for (std::uint32_t chunkIndex = 0; chunkIndex < chunksCount; ++chunkIndex)
+		{
+			auto &descriptor = descriptors[chunkIndex];
+
+			const auto owner = bodyOwner[chunkIndex];
+
+			if (owner == kNoChunk)
+			{
+				// Placeholder is declared like zero chunk (it has no geometry too), kind of original chunk would make readers parse placeholder as that chunk
+				if (!chunkDescriptors.empty())
+				{
+					descriptor.declarationKind = chunkDescriptors[0].declarationKind;
+					descriptor.unkC = chunkDescriptors[0].unkC;
+				}
+			}
+			else if (chunkIndex < chunkDescriptors.size())
+			{
+				descriptor.declarationKind = chunkDescriptors[chunkIndex].declarationKind;
+				descriptor.unkC = chunkDescriptors[chunkIndex].unkC;
+			}
+
+			const auto &body = owner == kNoChunk ? placeholder : bodies[owner];
+			descriptor.declarationOffset = body.offset;
+			descriptor.declarationSize = body.size;
+		}
+
+		PRMHeader newHeader = header;
+		newHeader.chunkOffset = descriptorsTable.offset;
+		newHeader.chunkOffset2 = (!hasSourceLayout || header.chunkOffset2 == header.chunkOffset) ? descriptorsTable.offset : header.chunkOffset2;
+		newHeader.countOfPrimitives = chunksCount;
+		newHeader.zeroed = 0u;
+
+		// Serialize header & descriptors table
+		auto writerSink = std::make_unique<ZBio::ZBinaryWriter::BufferSink>();
+		auto binaryWriter = ZBio::ZBinaryWriter::BinaryWriter(std::move(writerSink));
+
+		PRMHeader::serialize(newHeader, &binaryWriter);
+
+		for (const auto &descriptor : descriptors)
+		{
+			PRMChunkDescriptor::serialize(descriptor, &binaryWriter);
+		}
+
+		auto raw = binaryWriter.release().value();
+
+		// Save result to buffer (gaps between blocks are zeroed)
+		const auto baseOffset = outBuffer.size();
+		outBuffer.resize(baseOffset + fileSize, 0u);
+
+		auto *output = outBuffer.data() + baseOffset;
+		std::memcpy(output, raw.data(), PRMHeader::kHeaderSize);
+		std::memcpy(output + descriptorsTable.offset, raw.data() + PRMHeader::kHeaderSize, descriptorsTable.size);
+
+		for (std::uint32_t chunkIndex = 0; chunkIndex < chunksCount; ++chunkIndex)
+		{
+			const auto &body = bodies[chunkIndex];
+			if (bodyOwner[chunkIndex] == chunkIndex && body.size > 0u)
+			{
+				std::memcpy(output + body.offset, chunks[chunkIndex].getBuffer().cbegin(), body.size);
+			}
+		}
+	}
+
+	std::uint32_t PRMWriter::detectAlignment(const std::vector<PRMChunkDescriptor> &chunkDescriptors)
+	{
+		std::uint32_t alignment = kMaxAlignment;
+		bool hasAnyChunk = false;
+
+		for (const auto &descriptor : chunkDescriptors)
+		{
+			if (descriptor.declarationSize == 0u)
+			{
+				continue;
+			}
+
+			hasAnyChunk = true;
+
+			while (alignment > 1u && (descriptor.declarationOffset % alignment) != 0u)
+			{
+				alignment >>= 1u;
+			}
+		}
+
+		return hasAnyChunk ? alignment : kDefaultAlignment;
+	}
+
+	void PRMWriter::collectUsedChunks(const std::vector<PRMChunk> &chunks, std::vector<bool> &isUsed)
+	{
+		const auto chunksCount = static_cast<std::uint32_t>(chunks.size());
+		isUsed.assign(chunksCount, false);
+
+		std::vector<std::uint32_t> queue;
+		queue.reserve(chunksCount);
+
+		auto reach = [&isUsed, &queue, chunksCount](std::uint32_t chunkIndex)
+		{
+			if (chunkIndex < chunksCount && !isUsed[chunkIndex])
+			{
+				isUsed[chunkIndex] = true;
+				queue.push_back(chunkIndex);
+			}
+		};
+
+		if (chunksCount > 0)
+		{
+			isUsed[0] = true; // Zero chunk is always presented
+		}
+
+		// Every description chunk is a primitive (geoms refer them by index)
+		for (const auto &chunk : chunks)
+		{
+			if (const auto *descriptionHeader = chunk.getDescriptionBufferHeader())
+			{
+				reach(chunk.getIndex());
+				reach(descriptionHeader->ptrObjects);
+				reach(descriptionHeader->ptrParts);
+				reach(descriptionHeader->nextVariation);
+			}
+		}
+
+		for (std::size_t i = 0; i < queue.size(); ++i)
+		{
+			const auto &chunk = chunks[queue[i]];
+			const auto kind = chunk.getKind();
+
+			if (kind == PRMChunkRecognizedKind::CRK_VERTEX_BUFFER || kind == PRMChunkRecognizedKind::CRK_INDEX_BUFFER)
+			{
+				continue; // Raw data
+			}
+
+			const auto buffer = chunk.getBuffer();
+
+			for (int64_t offset = 0; offset + 2 <= buffer.size(); offset += 2)
+			{
+				const auto word = static_cast<std::uint32_t>(buffer[static_cast<int>(offset)]) | (static_cast<std::uint32_t>(buffer[static_cast<int>(offset + 1)]) << 8);
+				if (word != 0u)
+				{
+					reach(word);
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
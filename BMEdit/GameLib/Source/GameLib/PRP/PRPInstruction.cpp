@@ -215,6 +215,8 @@ namespace gamelib::prp
 			case PRPOpCode::NameBitfield:
 			case PRPOpCode::Array:
 			case PRPOpCode::NamedArray:
+			case PRPOpCode::Container:
+			case PRPOpCode::NamedContainer:
 				return m_operand.trivial.i32 == other.m_operand.trivial.i32;
 
 			case PRPOpCode::NamedFloat32:
@@ -1,4 +1,5 @@
 #include <GameLib/PRP/PRPReader.h>
+#include <GameLib/Profiler.h>
 #include <ZBinaryReader.hpp>
 
 
@@ -9,6 +10,8 @@ namespace gamelib::prp
 
 	bool PRPReader::parse(const uint8_t *prpFile, int64_t prpFileSize)
 	{
+		GAMELIB_PROFILE_SCOPE("PRPReader::parse");
+
 		m_header = PRPHeader(prpFile, prpFileSize);
 		if (!m_header) {
 			return false;
@@ -52,6 +55,7 @@ namespace gamelib::prp
 		// Read Instructions
 		{
 			m_byteCode = PRPByteCode();
+			m_byteCodeOffset = zDefinesReadResult.lastOffset;
 			if (!m_byteCode.parse(
 				&prpFile[zDefinesReadResult.lastOffset],
 				prpFileSize - zDefinesReadResult.lastOffset,
@@ -59,6 +63,8 @@ namespace gamelib::prp
 				&m_tokenTable)) {
 				return false;
 			}
+
+			GAMELIB_PROFILE_COUNTER("PRP instructions", m_byteCode.getInstructions().size());
 		}
 
 		return true;
@@ -88,4 +94,9 @@ namespace gamelib::prp
 	{
 		return m_byteCode;
 	}
+
+	int64_t PRPReader::getByteCodeOffset() const
+	{
+		return m_byteCodeOffset;
+	}
 }
\ No newline at end of file
@@ -23,13 +23,13 @@ namespace gamelib::prp {
 
 	int PRPTokenTable::indexOf(const std::string &token) const
 	{
-		auto it = std::find(m_tokenList.begin(), m_tokenList.end(), token);
-		if (it == m_tokenList.end())
+		auto it = m_tokenIndices.find(token);
+		if (it == m_tokenIndices.end())
 		{
 			return -1;
 		}
 
-		return static_cast<int>(it - m_tokenList.begin());
+		return it->second;
 	}
 
 	bool PRPTokenTable::hasIndex(int index) const
@@ -65,7 +65,7 @@ namespace gamelib::prp {
 
 	bool PRPTokenTable::addToken(const std::string &token)
 	{
-		if (hasToken(token)) {
+		if (!m_tokenIndices.try_emplace(token, static_cast<int>(m_tokenList.size())).second) {
 			return false;
 		}
 
@@ -81,7 +81,14 @@ namespace gamelib::prp {
 			return;
 		}
 
+		m_tokenIndices.erase(token);
 		m_tokenList.erase(m_tokenList.begin() + tokenIndex);
+
+		// Following tokens are moved
+		for (int i = tokenIndex; i < static_cast<int>(m_tokenList.size()); ++i)
+		{
+			m_tokenIndices[m_tokenList[i]] = i;
+		}
 	}
 
 	void PRPTokenTable::serialize(const PRPTokenTable &tokenTable, ZBio::ZBinaryWriter::BinaryWriter *writerStream)
@@ -34,22 +34,25 @@ namespace gamelib::prp
 		void operator()(const ArrayF32&) {} // Do nothing
 	};
 
-	void buildTokenTableAndCacheObjectsCount(const PRPZDefines &definitions, const std::vector<PRPInstruction> &instructions, PRPTokenTable &tokenTable, int &objectsCount, uint32_t &dataOffset)
+	void PRPWriter::registerTokens(const PRPZDefines &definitions, PRPTokenTable &tokenTable, uint32_t &tokensDataSize)
 	{
-		ZDefineStringVisitor visitor(dataOffset, tokenTable);
+		ZDefineStringVisitor visitor(tokensDataSize, tokenTable);
 
-		// Save string references from ZDefines
 		for (const auto &def: definitions.getDefinitions())
 		{
 			if (tokenTable.addToken(def.getName()))
 			{
-				dataOffset += (def.getName().length() + 1);
+				tokensDataSize += (def.getName().length() + 1);
 			}
 
 			std::visit(visitor, def.getValue());
 		}
+	}
+
+	int PRPWriter::registerTokens(const std::vector<PRPInstruction> &instructions, PRPTokenTable &tokenTable, uint32_t &tokensDataSize)
+	{
+		int objectsCount = 0;
 
-		// Save string references from instructions
 		for (const auto& instruction: instructions)
 		{
 			const auto opCode = instruction.getOpCode();
@@ -59,21 +62,32 @@ namespace gamelib::prp
 			{
 				for (const auto &str: instruction.getOperand().stringArray)
 				{
-					dataOffset += tokenTable.addToken(str) * (str.length() + 1);
+					tokensDataSize += tokenTable.addToken(str) * (str.length() + 1);
 				}
 			}
 
 			if (opCode == PRPOpCode::String || opCode == PRPOpCode::NamedString)
 			{
 				const auto& tok = instruction.getOperand().str;
-				dataOffset += tokenTable.addToken(tok) * (tok.length() + 1);
+				tokensDataSize += tokenTable.addToken(tok) * (tok.length() + 1);
 			}
 			else if (opCode == PRPOpCode::StringOrArray_E || opCode == PRPOpCode::StringOrArray_8E)
 			{
 				const auto& tok = instruction.getOperand().str;
-				dataOffset += tokenTable.addToken(tok) * (tok.length() + 1);
+				tokensDataSize += tokenTable.addToken(tok) * (tok.length() + 1);
 			}
 		}
+
+		return objectsCount;
+	}
+
+	void buildTokenTableAndCacheObjectsCount(const PRPZDefines &definitions, const std::vector<PRPInstruction> &instructions, PRPTokenTable &tokenTable, int &objectsCount, uint32_t &dataOffset)
+	{
+		// Save string references from ZDefines
+		PRPWriter::registerTokens(definitions, tokenTable, dataOffset);
+
+		// Save string references from instructions
+		objectsCount += PRPWriter::registerTokens(instructions, tokenTable, dataOffset);
 	}
 
 	void PRPWriter::write(const PRPZDefines &definitions,
@@ -0,0 +1,164 @@
+#include <GameLib/Profiler.h>
+#include <nlohmann/json.hpp>
+#include <unordered_map>
+#include <algorithm>
+#include <fstream>
+
+
+namespace gamelib
+{
+	Profiler::Profiler() : m_sessionBegin(Clock::now())
+	{
+	}
+
+	Profiler &Profiler::getInstance()
+	{
+		static Profiler g_profilerInstance;
+		return g_profilerInstance;
+	}
+
+	void Profiler::setEnabled(bool isEnabled)
+	{
+		m_isEnabled.store(isEnabled, std::memory_order_relaxed);
+	}
+
+	bool Profiler::isEnabled() const
+	{
+		return m_isEnabled.load(std::memory_order_relaxed);
+	}
+
+	void Profiler::reset()
+	{
+		std::lock_guard lock { m_lock };
+
+		m_sessionBegin = Clock::now();
+		m_scopes.clear();
+		m_counters.clear();
+	}
+
+	void Profiler::addScope(const char *name, Clock::time_point begin, Clock::time_point end)
+	{
+		const auto threadIndex = getThreadIndex();
+		const auto durationUs = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+
+		std::lock_guard lock { m_lock };
+		m_scopes.push_back(ScopeEvent { name, toSessionTime(begin), durationUs, threadIndex });
+	}
+
+	void Profiler::addCounter(const char *name, std::int64_t value)
+	{
+		const auto now = Clock::now();
+
+		std::lock_guard lock { m_lock };
+		m_counters.push_back(CounterEvent { name, toSessionTime(now), value });
+	}
+
+	std::vector<ProfilerSummaryEntry> Profiler::getSummary() const
+	{
+		std::vector<ProfilerSummaryEntry> scopes;
+		std::vector<ProfilerSummaryEntry> counters;
+
+		{
+			std::lock_guard lock { m_lock };
+
+			// Names are literals, but the same literal could have different addresses in different TUs
+			std::unordered_map<std::string, std::size_t> scopeIndices;
+			for (const auto &scope : m_scopes)
+			{
+				auto [it, isNew] = scopeIndices.try_emplace(scope.name, scopes.size());
+				if (isNew)
+				{
+					auto &entry = scopes.emplace_back();
+					entry.name = scope.name;
+				}
+
+				auto &entry = scopes[it->second];
+				const double durationMs = static_cast<double>(scope.durationUs) / 1000.0;
+
+				++entry.callsCount;
+				entry.totalMs += durationMs;
+				entry.maxMs = std::max(entry.maxMs, durationMs);
+			}
+
+			std::unordered_map<std::string, std::size_t> counterIndices;
+			for (const auto &counter : m_counters)
+			{
+				auto [it, isNew] = counterIndices.try_emplace(counter.name, counters.size());
+				if (isNew)
+				{
+					auto &entry = counters.emplace_back();
+					entry.name = counter.name;
+					entry.isCounter = true;
+				}
+
+				auto &entry = counters[it->second];
+				++entry.callsCount;
+				entry.total += counter.value;
+			}
+		}
+
+		std::stable_sort(scopes.begin(), scopes.end(), [](const ProfilerSummaryEntry &a, const ProfilerSummaryEntry &b) { return a.totalMs > b.totalMs; });
+		scopes.insert(scopes.end(), counters.begin(), counters.end());
+		return scopes;
+	}
+
+	bool Profiler::writeChromeTrace(const std::string &path) const
+	{
+		auto events = nlohmann::json::array();
+
+		{
+			std::lock_guard lock { m_lock };
+
+			for (const auto &scope : m_scopes)
+			{
+				events.push_back(nlohmann::json {
+					{ "name", scope.name },
+					{ "cat", "GameLib" },
+					{ "ph", "X" },
+					{ "ts", scope.beginUs },
+					{ "dur", scope.durationUs },
+					{ "pid", 0 },
+					{ "tid", scope.threadIndex }
+				});
+			}
+
+			// Trace viewer shows counter values as is, so we store running total
+			std::unordered_map<std::string, std::int64_t> totals;
+			for (const auto &counter : m_counters)
+			{
+				auto &total = totals[counter.name];
+				total += counter.value;
+
+				events.push_back(nlohmann::json {
+					{ "name", counter.name },
+					{ "cat", "GameLib" },
+					{ "ph", "C" },
+					{ "ts", counter.timestampUs },
+					{ "pid", 0 },
+					{ "args", { { "value", total } } }
+				});
+			}
+		}
+
+		std::ofstream file { path, std::ios::out | std::ios::trunc };
+		if (!file)
+		{
+			return false;
+		}
+
+		file << nlohmann::json { { "traceEvents", std::move(events) }, { "displayTimeUnit", "ms" } }.dump();
+		return static_cast<bool>(file);
+	}
+
+	std::int64_t Profiler::toSessionTime(Clock::time_point timePoint) const
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(timePoint - m_sessionBegin).count();
+	}
+
+	std::uint32_t Profiler::getThreadIndex()
+	{
+		static std::atomic<std::uint32_t> g_nextThreadIndex { 0 };
+		thread_local const std::uint32_t threadIndex = g_nextThreadIndex.fetch_add(1, std::memory_order_relaxed);
+		return threadIndex;
+	}
+}
\ No newline at end of file
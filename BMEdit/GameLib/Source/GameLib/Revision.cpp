@@ -0,0 +1,39 @@
+#include <GameLib/Revision.h>
+#include <atomic>
+
+
+namespace gamelib
+{
+	namespace
+	{
+		std::uint64_t nextStamp()
+		{
+			static std::atomic<std::uint64_t> g_lastStamp { 0u };
+			return ++g_lastStamp;
+		}
+	}
+
+	Revision::Revision() : m_stamp(nextStamp())
+	{
+	}
+
+	Revision::Revision(const Revision &) : m_stamp(nextStamp())
+	{
+	}
+
+	Revision &Revision::operator=(const Revision &)
+	{
+		m_stamp = nextStamp();
+		return *this;
+	}
+
+	void Revision::bump()
+	{
+		m_stamp = nextStamp();
+	}
+
+	std::uint64_t Revision::get() const
+	{
+		return m_stamp;
+	}
+}
\ No newline at end of file
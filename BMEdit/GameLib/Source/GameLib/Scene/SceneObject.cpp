@@ -1,5 +1,6 @@
 #include <GameLib/Scene/SceneObject.h>
 
+#include <algorithm>
 #include <utility>
 
 
@@ -41,6 +42,61 @@ namespace gamelib::scene
 		m_parent = parent;
 	}
 
+	void SceneObject::addChild(const SceneObject::Ptr &child)
+	{
+		insertChild(m_children.size(), child);
+	}
+
+	void SceneObject::insertChild(std::size_t position, const SceneObject::Ptr &child)
+	{
+		if (!child)
+		{
+			return;
+		}
+
+		if (auto previousParent = child->m_parent.lock(); previousParent && previousParent.get() != this)
+		{
+			previousParent->removeChild(child);
+		}
+
+		position = std::min(position, m_children.size());
+		m_children.insert(m_children.begin() + static_cast<std::ptrdiff_t>(position), child);
+		child->m_parent = weak_from_this();
+		m_revision.bump();
+
+		for (std::size_t i = position; i < m_children.size(); ++i)
+		{
+			if (auto sibling = m_children[i].lock())
+			{
+				sibling->m_siblingIndex = static_cast<int>(i);
+			}
+		}
+	}
+
+	bool SceneObject::removeChild(const SceneObject::Ptr &child)
+	{
+		if (!child || child->m_siblingIndex < 0 || child->m_siblingIndex >= static_cast<int>(m_children.size()) || m_children[child->m_siblingIndex].lock() != child)
+		{
+			return false;
+		}
+
+		const auto position = static_cast<std::size_t>(child->m_siblingIndex);
+		m_children.erase(m_children.begin() + static_cast<std::ptrdiff_t>(position));
+		child->m_siblingIndex = kNoSiblingIndex;
+		child->m_parent.reset();
+		m_revision.bump();
+
+		for (std::size_t i = position; i < m_children.size(); ++i)
+		{
+			if (auto sibling = m_children[i].lock())
+			{
+				sibling->m_siblingIndex = static_cast<int>(i);
+			}
+		}
+
+		return true;
+	}
+
 	const std::string &SceneObject::getName() const
 	{
 		return m_name;
@@ -96,6 +152,20 @@ namespace gamelib::scene
 		return m_geom;
 	}
 
+	bool SceneObject::updateController(ControllerHandle handle, std::string name, const Value &properties)
+	{
+		if (handle >= m_controllers.size())
+		{
+			return false;
+		}
+
+		auto &controller = m_controllers[handle];
+		controller.name = std::move(name);
+		controller.properties = properties;
+		m_revision.bump();
+		return true;
+	}
+
 	const SceneObject::Ref &SceneObject::getParent() const
 	{
 		return m_parent;
@@ -106,8 +176,26 @@ namespace gamelib::scene
 		return m_children;
 	}
 
-	std::vector<SceneObject::Ref> &SceneObject::getChildren()
+	int SceneObject::getSiblingIndex() const
 	{
-		return m_children;
+		return m_siblingIndex;
+	}
+
+	std::uint64_t SceneObject::getRevision() const
+	{
+		// Each change takes stamp greater than all stamps before, so latest stamp of parts is stamp of object
+		std::uint64_t revision = std::max(m_revision.get(), m_properties.getRevision());
+
+		for (const auto &controller : m_controllers)
+		{
+			revision = std::max(revision, controller.properties.getRevision());
+		}
+
+		return revision;
+	}
+
+	void SceneObject::markChanged()
+	{
+		m_revision.bump();
 	}
 }
\ No newline at end of file
@@ -1,9 +1,14 @@
 #include <GameLib/Scene/SceneObjectPropertiesDumper.h>
 #include <GameLib/Scene/SceneObject.h>
 #include <GameLib/PRP/PRPInstruction.h>
+#include <GameLib/PRP/PRPTokenTable.h>
+#include <GameLib/PRP/PRPByteCode.h>
 #include <GameLib/PRP/PRPZDefines.h>
+#include <GameLib/PRP/PRPHeader.h>
 #include <GameLib/PRP/PRPWriter.h>
 #include <GameLib/Level.h>
+#include <ZBinaryWriter.hpp>
+#include <unordered_map>
 #include <cassert>
 
 using namespace gamelib::scene;
@@ -14,15 +19,51 @@ namespace gamelib::scene
 {
 	struct SceneObjectPropertiesDumper::DumperContext
 	{
+		struct ObjectChunk
+		{
+			SceneObject::Ref object {}; ///< Chunk is valid only for alive object (address could be reused by another one)
+			std::uint64_t revision { 0u };
+			std::vector<uint8_t> bytes {}; ///< Properties, controllers & count of children (children are separate chunks)
+			int objectsCount { 0 };
+			std::uint32_t dumpIndex { 0u }; ///< Index of last dump which used this chunk
+		};
+
 		DumperContext() = default;
 		~DumperContext() = default;
 
-		const Level *level { nullptr };
-		std::vector<uint8_t> *outBuffer { nullptr };
-		std::vector<PRPInstruction> instructions {};
+		// Source
+		const SceneObject *root { nullptr };
+		const PRPZDefines *definitions { nullptr };
+		bool isRaw { false };
+
+		// Token table (append only)
+		PRPTokenTable tokenTable {};
+		uint32_t tokensDataSize { 0u };
+
+		// Encoded data
+		std::vector<uint8_t> definitionsBytes {};
+		std::unordered_map<const SceneObject *, ObjectChunk> chunks {};
+		std::vector<const ObjectChunk *> order {}; ///< Chunks of current dump (DFS order)
+		std::vector<PRPInstruction> instructions {}; ///< Temporary buffer
+		std::uint32_t dumpIndex { 0u };
+		std::size_t encodedObjectsCount { 0 };
 	};
 }
 
+namespace
+{
+	std::vector<uint8_t> serializeInstructions(const std::vector<PRPInstruction> &instructions, const PRPTokenTable &tokenTable)
+	{
+		static const PRPHeader kHeader {}; // Not used by instruction serializers
+
+		auto writerSink = std::make_unique<ZBio::ZBinaryWriter::BufferSink>();
+		auto binaryWriter = ZBio::ZBinaryWriter::BinaryWriter(std::move(writerSink));
+		PRPByteCode::serialize(instructions, &kHeader, &tokenTable, &binaryWriter);
+
+		return binaryWriter.release().value();
+	}
+}
+
 SceneObjectPropertiesDumper::SceneObjectPropertiesDumper() = default;
 SceneObjectPropertiesDumper::~SceneObjectPropertiesDumper() = default;
 
@@ -35,28 +76,145 @@ void SceneObjectPropertiesDumper::dump(const gamelib::Level *level, std::vector<
 		return;
 	}
 
-	m_localContext = std::make_unique<SceneObjectPropertiesDumper::DumperContext>();
-	m_localContext->level = level;
-	m_localContext->outBuffer = outBuffer;
+	dump(level->getSceneObjects(), level->getLevelProperties()->ZDefines, level->getLevelProperties()->header.isRaw(), outBuffer);
+}
+
+void SceneObjectPropertiesDumper::dump(const std::vector<SceneObject::Ptr> &sceneObjects, const PRPZDefines &definitions, bool isRaw, std::vector<uint8_t> *outBuffer)
+{
+	if (!outBuffer)
+	{
+		assert(outBuffer != nullptr && "Bad out buffer instance");
+		return;
+	}
+
+	const SceneObject *root = sceneObjects.empty() ? nullptr : sceneObjects[0].get();
+
+	// Cache is valid only for the same scene
+	if (m_localContext && (m_localContext->root != root || m_localContext->definitions != &definitions || m_localContext->isRaw != isRaw))
+	{
+		reset();
+	}
+
+	if (!m_localContext)
+	{
+		m_localContext = std::make_unique<SceneObjectPropertiesDumper::DumperContext>();
+		m_localContext->root = root;
+		m_localContext->definitions = &definitions;
+		m_localContext->isRaw = isRaw;
+
+		// Definitions are first in token table (like PRPWriter does)
+		PRPWriter::registerTokens(definitions, m_localContext->tokenTable, m_localContext->tokensDataSize);
+
+		auto writerSink = std::make_unique<ZBio::ZBinaryWriter::BufferSink>();
+		auto binaryWriter = ZBio::ZBinaryWriter::BinaryWriter(std::move(writerSink));
+		PRPZDefines::serialize(definitions, &m_localContext->tokenTable, &binaryWriter);
+		m_localContext->definitionsBytes = binaryWriter.release().value();
+	}
+
+	auto &ctx = *m_localContext;
+	++ctx.dumpIndex;
+	ctx.encodedObjectsCount = 0;
+	ctx.order.clear();
+
+	if (!sceneObjects.empty())
+	{
+		visitSceneObject(sceneObjects[0]); // Take root and start visitor
+	}
+
+	// Drop chunks of removed objects
+	std::erase_if(ctx.chunks, [dumpIndex = ctx.dumpIndex](const auto &chunk) { return chunk.second.dumpIndex != dumpIndex; });
 
-	std::vector<prp::PRPInstruction> generatedInstructions;
-	if (!m_localContext->level->getSceneObjects().empty())
+	// Tail
+	ctx.instructions.clear();
+	ctx.instructions.emplace_back(PRPOpCode::Bool, PRPOperandVal(false)); // Unknown tag, but it needs to be here
+	ctx.instructions.emplace_back(PRPOpCode::EndOfStream);
+	const auto tailBytes = serializeInstructions(ctx.instructions, ctx.tokenTable);
+
+	// Header, token table & objects count
+	int objectsCount = 0;
+	std::size_t bytecodeSize = tailBytes.size();
+
+	for (const auto *chunk : ctx.order)
 	{
-		visitSceneObject(m_localContext->level->getSceneObjects()[0].get()); // Take root and start visitor
+		objectsCount += chunk->objectsCount;
+		bytecodeSize += chunk->bytes.size();
 	}
 
-	m_localContext->instructions.reserve(2); // Add extra instructions
-	m_localContext->instructions.emplace_back(PRPOpCode::Bool, PRPOperandVal(false)); // Unknown tag, but it needs to be here
-	m_localContext->instructions.emplace_back(PRPOpCode::EndOfStream);
+	auto writerSink = std::make_unique<ZBio::ZBinaryWriter::BufferSink>();
+	auto binaryWriter = ZBio::ZBinaryWriter::BinaryWriter(std::move(writerSink));
+
+	PRPHeader header(ctx.tokenTable.getNonEmptyTokenCount(), isRaw, false, true);
+	PRPHeader::serialize(header, ctx.tokensDataSize, &binaryWriter);
+	PRPTokenTable::serialize(ctx.tokenTable, &binaryWriter);
+	binaryWriter.write<uint32_t, ZBio::Endianness::LE>(objectsCount);
 
-	prp::PRPWriter::write(
-	    m_localContext->level->getLevelProperties()->ZDefines,
-	    m_localContext->instructions,
-	    m_localContext->level->getLevelProperties()->header.isRaw(),
-	    *outBuffer);
+	const auto headerBytes = binaryWriter.release().value();
+
+	// Splice everything
+	outBuffer->reserve(outBuffer->size() + headerBytes.size() + ctx.definitionsBytes.size() + bytecodeSize);
+	outBuffer->insert(outBuffer->end(), headerBytes.begin(), headerBytes.end());
+	outBuffer->insert(outBuffer->end(), ctx.definitionsBytes.begin(), ctx.definitionsBytes.end());
+
+	for (const auto *chunk : ctx.order)
+	{
+		outBuffer->insert(outBuffer->end(), chunk->bytes.begin(), chunk->bytes.end());
+	}
+
+	outBuffer->insert(outBuffer->end(), tailBytes.begin(), tailBytes.end());
+}
+
+void SceneObjectPropertiesDumper::reset()
+{
+	m_localContext = nullptr;
 }
 
-void SceneObjectPropertiesDumper::visitSceneObject(const SceneObject *sceneObject)
+std::size_t SceneObjectPropertiesDumper::getLastEncodedObjectsCount() const
+{
+	return m_localContext ? m_localContext->encodedObjectsCount : 0;
+}
+
+gamelib::MemoryReport SceneObjectPropertiesDumper::memoryReport() const
+{
+	using gamelib::MemoryCategory;
+
+	gamelib::MemoryReport report;
+	if (!m_localContext)
+	{
+		return report;
+	}
+
+	const auto &ctx = *m_localContext;
+	constexpr auto kCategory = MemoryCategory::SCENE_PROPERTIES_DUMPER;
+
+	// Token table: list of tokens and index of them (node per token)
+	const auto tokensCount = static_cast<std::size_t>(ctx.tokenTable.getTokenCount());
+	report.add(kCategory, tokensCount * sizeof(std::string));
+	report.add(kCategory, tokensCount * (sizeof(std::pair<const std::string, int>) + sizeof(void *)), tokensCount);
+
+	for (std::size_t tokenIndex = 0; tokenIndex < tokensCount; ++tokenIndex)
+	{
+		const auto &token = ctx.tokenTable.tokenAt(static_cast<uint32_t>(tokenIndex));
+		report.addString(kCategory, token); // In list
+		report.addString(kCategory, token); // In index
+	}
+
+	// Encoded objects
+	report.add(kCategory, ctx.chunks.bucket_count() * sizeof(void *));
+	report.add(kCategory, ctx.chunks.size() * (sizeof(std::pair<const SceneObject *const, DumperContext::ObjectChunk>) + sizeof(void *)), ctx.chunks.size());
+
+	for (const auto &[_object, chunk] : ctx.chunks)
+	{
+		report.addVector(kCategory, chunk.bytes);
+	}
+
+	report.addVector(kCategory, ctx.definitionsBytes);
+	report.addVector(kCategory, ctx.order);
+	report.addInstructions(kCategory, kCategory, ctx.instructions);
+
+	return report;
+}
+
+void SceneObjectPropertiesDumper::visitSceneObject(const SceneObject::Ptr &sceneObject)
 {
 	if (!sceneObject)
 	{
@@ -70,8 +228,41 @@ void SceneObjectPropertiesDumper::visitSceneObject(const SceneObject *sceneObjec
 		return;
 	}
 
+	auto& ctx = *m_localContext;
+	auto& chunk = ctx.chunks[sceneObject.get()];
+	const auto revision = sceneObject->getRevision();
+
+	if (chunk.object.lock() != sceneObject || chunk.revision != revision || chunk.bytes.empty())
+	{
+		chunk.object = sceneObject;
+		chunk.revision = revision;
+		chunk.bytes.clear();
+		encodeSceneObject(sceneObject.get(), chunk.bytes, chunk.objectsCount);
+		++ctx.encodedObjectsCount;
+	}
+
+	chunk.dumpIndex = ctx.dumpIndex;
+	ctx.order.push_back(&chunk);
+
+	// Children
+	for (const auto& childRef : sceneObject->getChildren())
+	{
+		auto child = childRef.lock();
+		if (!child)
+		{
+			assert(false && "Invalid child instance");
+			return;
+		}
+
+		visitSceneObject(child);
+	}
+}
+
+void SceneObjectPropertiesDumper::encodeSceneObject(const SceneObject *sceneObject, std::vector<uint8_t> &bytes, int &objectsCount)
+{
 	auto& ctx = *m_localContext;
 	auto& out = ctx.instructions;
+	out.clear();
 
 	{
 		// Properties
@@ -90,7 +281,7 @@ void SceneObjectPropertiesDumper::visitSceneObject(const SceneObject *sceneObjec
 
 		for (const auto& [name, properties] : sceneObject->getControllers())
 		{
-			out.reserve(3 + properties.getInstructions().size());
+			out.reserve(out.size() + 3 + properties.getInstructions().size());
 
 			out.emplace_back(PRPOpCode::String, PRPOperandVal(name));
 			out.emplace_back(PRPOpCode::BeginObject);
@@ -105,21 +296,11 @@ void SceneObjectPropertiesDumper::visitSceneObject(const SceneObject *sceneObjec
 	}
 
 	{
-		// Children
-		out.reserve(1);
-
+		// Children count (children are encoded as separate chunks)
 		out.emplace_back(PRPOpCode::Container, PRPOperandVal(static_cast<int>(sceneObject->getChildren().size())));
-
-		for (const auto& childRef : sceneObject->getChildren())
-		{
-			auto child = childRef.lock();
-			if (!child)
-			{
-				assert(false && "Invalid child instance");
-				return;
-			}
-
-			visitSceneObject(child.get());
-		}
 	}
+
+	// New strings are appended to the end of token table, indices of known strings are not changed
+	objectsCount = PRPWriter::registerTokens(out, ctx.tokenTable, ctx.tokensDataSize);
+	bytes = serializeInstructions(out, ctx.tokenTable);
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <GameLib/TypeRegistry.h>
 #include <GameLib/TypeComplex.h>
 #include <GameLib/TypeAlias.h>
+#include <GameLib/Profiler.h>
 
 #include <fmt/format.h>
 
@@ -44,6 +45,8 @@ namespace gamelib::scene
 
 	void SceneObjectPropertiesLoader::load(Span<SceneObject::Ptr> objects, Span<PRPInstruction> instructions)
 	{
+		GAMELIB_PROFILE_SCOPE("SceneObjectPropertiesLoader::load");
+
 		if (!objects || !instructions)
 			return;
 
@@ -262,7 +265,7 @@ namespace gamelib::scene
 
 			for (int32_t geomIdx = 0; geomIdx < childrenCount; ++geomIdx)
 			{
-				currentObject->getChildren().push_back(getCurrentObject());
+				currentObject->addChild(getCurrentObject());
 				visitImpl(currentObject);
 			}
 		}
@@ -0,0 +1,365 @@
+#include <GameLib/Scene/ScenePropertyColumns.h>
+#include <GameLib/ValueEntriesIndex.h>
+#include <GameLib/TypeRegistry.h>
+#include <GameLib/Workers.h>
+#include <GameLib/Type.h>
+#include <algorithm>
+
+
+namespace gamelib::scene
+{
+	namespace
+	{
+		constexpr std::size_t kExtractBlockSize = 512;
+		constexpr int kUnknownPosition = -2;
+
+		/**
+		 * @brief Position of property in flattened properties table of type (mapped values have entries in the same order)
+		 * @return index in table, ValueEntriesIndex::kNotFound when type has no such property or kUnknownPosition when type declares nothing
+		 */
+		int getTablePosition(const Type *type, std::string_view propertyName)
+		{
+			const auto &table = TypeRegistry::getInstance().getPropertiesTable(type);
+			if (table.empty())
+			{
+				return kUnknownPosition;
+			}
+
+			for (std::size_t i = 0; i < table.size(); ++i)
+			{
+				if (table[i]->getName() == propertyName)
+				{
+					return static_cast<int>(i);
+				}
+			}
+
+			return ValueEntriesIndex::kNotFound;
+		}
+
+		/**
+		 * @brief Take entry from position in properties table when value follows layout of type, otherwise look up it by name
+		 */
+		int getEntryIndex(const Value &properties, int tablePosition, std::string_view propertyName)
+		{
+			if (tablePosition == ValueEntriesIndex::kNotFound)
+			{
+				return ValueEntriesIndex::kNotFound;
+			}
+
+			if (tablePosition >= 0 && static_cast<std::size_t>(tablePosition) < properties.getEntries().size() && properties.getEntries()[tablePosition].name == propertyName)
+			{
+				return tablePosition;
+			}
+
+			return properties.getEntryIndex(propertyName);
+		}
+
+		ScenePropertyColumnKind getValueKind(const prp::PRPInstruction &instruction)
+		{
+			switch (instruction.getOpCode())
+			{
+				case prp::PRPOpCode::Char:
+				case prp::PRPOpCode::NamedChar:
+				case prp::PRPOpCode::Bool:
+				case prp::PRPOpCode::NamedBool:
+				case prp::PRPOpCode::Int8:
+				case prp::PRPOpCode::NamedInt8:
+				case prp::PRPOpCode::Int16:
+				case prp::PRPOpCode::NamedInt16:
+				case prp::PRPOpCode::Int32:
+				case prp::PRPOpCode::NamedInt32:
+				case prp::PRPOpCode::Bitfield:
+				case prp::PRPOpCode::NameBitfield:
+					return ScenePropertyColumnKind::PCK_INT32;
+				case prp::PRPOpCode::Float32:
+				case prp::PRPOpCode::NamedFloat32:
+				case prp::PRPOpCode::Float64:
+				case prp::PRPOpCode::NamedFloat64:
+					return ScenePropertyColumnKind::PCK_FLOAT32;
+				case prp::PRPOpCode::String:
+				case prp::PRPOpCode::NamedString:
+				case prp::PRPOpCode::StringOrArray_E:
+				case prp::PRPOpCode::StringOrArray_8E:
+					return ScenePropertyColumnKind::PCK_STRING;
+				default:
+					return ScenePropertyColumnKind::PCK_NONE; // Markers (arrays, containers, objects) are not values
+			}
+		}
+
+		std::int32_t getIntValue(const prp::PRPInstruction &instruction)
+		{
+			const auto &operand = instruction.getOperand();
+
+			switch (instruction.getOpCode())
+			{
+				case prp::PRPOpCode::Char:
+				case prp::PRPOpCode::NamedChar:
+					return static_cast<std::int32_t>(operand.trivial.c);
+				case prp::PRPOpCode::Bool:
+				case prp::PRPOpCode::NamedBool:
+					return operand.trivial.b ? 1 : 0;
+				case prp::PRPOpCode::Int8:
+				case prp::PRPOpCode::NamedInt8:
+					return static_cast<std::int32_t>(operand.trivial.i8);
+				case prp::PRPOpCode::Int16:
+				case prp::PRPOpCode::NamedInt16:
+					return static_cast<std::int32_t>(operand.trivial.i16);
+				default:
+					return operand.trivial.i32;
+			}
+		}
+
+		float getFloatValue(const prp::PRPInstruction &instruction)
+		{
+			const auto opCode = instruction.getOpCode();
+			if (opCode == prp::PRPOpCode::Float64 || opCode == prp::PRPOpCode::NamedFloat64)
+			{
+				return static_cast<float>(instruction.getOperand().trivial.f64);
+			}
+
+			return instruction.getOperand().trivial.f32;
+		}
+
+		/**
+		 * @brief Take shape of property (kind of first value and count of values)
+		 */
+		void detectShape(const Value &properties, int entryIndex, ScenePropertyColumn &column)
+		{
+			const auto &entry = properties.getEntries()[entryIndex];
+			const auto &instructions = properties.getInstructions();
+
+			for (std::size_t i = entry.instructions.offset(); i < entry.instructions.offset() + entry.instructions.size() && i < instructions.size(); ++i)
+			{
+				const auto kind = getValueKind(instructions[i]);
+				if (kind == ScenePropertyColumnKind::PCK_NONE)
+				{
+					continue;
+				}
+
+				if (column.kind == ScenePropertyColumnKind::PCK_NONE)
+				{
+					column.kind = kind;
+				}
+
+				++column.stride;
+			}
+		}
+	}
+
+	void ScenePropertyColumns::build(const std::vector<SceneObject::Ptr> &sceneObjects, int threadsCount)
+	{
+		m_objects = sceneObjects;
+		m_threadsCount = threadsCount;
+		m_typesByName.clear();
+		m_objectsByType.clear();
+
+		const auto &registry = TypeRegistry::getInstance();
+
+		for (std::uint32_t objectIndex = 0; objectIndex < m_objects.size(); ++objectIndex)
+		{
+			for (const Type *type : registry.getTypeHierarchy(m_objects[objectIndex]->getType()))
+			{
+				m_typesByName.try_emplace(type->getName(), type);
+				m_objectsByType[type].push_back(objectIndex);
+			}
+		}
+
+		invalidate();
+	}
+
+	std::shared_ptr<const ScenePropertyColumn> ScenePropertyColumns::getColumn(std::string_view typeName, std::string_view propertyName) const
+	{
+		auto typeIt = m_typesByName.find(std::string(typeName));
+		if (typeIt == m_typesByName.end())
+		{
+			return nullptr;
+		}
+
+		const Type *type = typeIt->second;
+
+		{
+			std::lock_guard<std::mutex> guard { m_columnsLock };
+			if (auto columnsIt = m_columns.find(type); columnsIt != m_columns.end())
+			{
+				if (auto it = columnsIt->second.find(std::string(propertyName)); it != columnsIt->second.end())
+				{
+					return it->second;
+				}
+			}
+		}
+
+		auto column = extract(m_objectsByType.at(type), propertyName);
+
+		std::lock_guard<std::mutex> guard { m_columnsLock };
+		return m_columns[type].try_emplace(std::string(propertyName), std::move(column)).first->second;
+	}
+
+	void ScenePropertyColumns::invalidateObject(std::uint32_t objectIndex)
+	{
+		std::lock_guard<std::mutex> guard { m_columnsLock };
+
+		// Object is a row of columns of its type and all parent types
+		for (const Type *type : TypeRegistry::getInstance().getTypeHierarchy(m_objects.at(objectIndex)->getType()))
+		{
+			m_columns.erase(type);
+		}
+	}
+
+	void ScenePropertyColumns::invalidate()
+	{
+		std::lock_guard<std::mutex> guard { m_columnsLock };
+		m_columns.clear();
+	}
+
+	std::size_t ScenePropertyColumns::getObjectsCount() const
+	{
+		return m_objects.size();
+	}
+
+	std::shared_ptr<const ScenePropertyColumn> ScenePropertyColumns::extract(const std::vector<std::uint32_t> &objects, std::string_view propertyName) const
+	{
+		auto column = std::make_shared<ScenePropertyColumn>();
+		column->objects = objects;
+		column->present.assign(objects.size(), 0u);
+
+		// Property is searched once per type, rows take entry by position
+		std::unordered_map<const Type *, int> tablePositions;
+		for (const auto objectIndex : objects)
+		{
+			const Type *type = m_objects[objectIndex]->getType();
+			if (!tablePositions.contains(type))
+			{
+				tablePositions[type] = getTablePosition(type, propertyName);
+			}
+		}
+
+		// Shape of column
+		for (const auto objectIndex : objects)
+		{
+			const auto &object = m_objects[objectIndex];
+			const auto &properties = object->getProperties();
+			if (const int entryIndex = getEntryIndex(properties, tablePositions.at(object->getType()), propertyName); entryIndex >= 0)
+			{
+				detectShape(properties, entryIndex, *column);
+				break;
+			}
+		}
+
+		if (column->kind == ScenePropertyColumnKind::PCK_NONE)
+		{
+			column->stride = 0;
+			return column;
+		}
+
+		const std::size_t stride = column->stride;
+		const std::size_t rowsCount = objects.size();
+		const auto kind = column->kind;
+		std::vector<const std::string *> rowStrings;
+
+		switch (kind)
+		{
+			case ScenePropertyColumnKind::PCK_INT32: column->ints.assign(rowsCount * stride, 0); break;
+			case ScenePropertyColumnKind::PCK_FLOAT32: column->floats.assign(rowsCount * stride, 0.f); break;
+			case ScenePropertyColumnKind::PCK_STRING: rowStrings.assign(rowsCount * stride, nullptr); break;
+			case ScenePropertyColumnKind::PCK_NONE: break;
+		}
+
+		// Decode rows
+		const std::size_t blocksCount = (rowsCount + kExtractBlockSize - 1) / kExtractBlockSize;
+
+		runParallelFor(0, blocksCount, m_threadsCount, [&](std::size_t blockIndex)
+		{
+			const std::size_t first = blockIndex * kExtractBlockSize;
+			const std::size_t last = std::min(rowsCount, first + kExtractBlockSize);
+
+			for (std::size_t row = first; row < last; ++row)
+			{
+				const auto &object = m_objects[objects[row]];
+				const auto &properties = object->getProperties();
+				const int entryIndex = getEntryIndex(properties, tablePositions.at(object->getType()), propertyName);
+				if (entryIndex < 0)
+				{
+					continue;
+				}
+
+				const auto &entry = properties.getEntries()[entryIndex];
+				const auto &instructions = properties.getInstructions();
+				std::size_t component = 0;
+				bool isMatched = true;
+
+				for (std::size_t i = entry.instructions.offset(); i < entry.instructions.offset() + entry.instructions.size() && i < instructions.size() && isMatched; ++i)
+				{
+					const auto &instruction = instructions[i];
+					const auto valueKind = getValueKind(instruction);
+
+					if (valueKind == ScenePropertyColumnKind::PCK_NONE)
+					{
+						continue;
+					}
+
+					if (valueKind != kind || component >= stride)
+					{
+						isMatched = false;
+						break;
+					}
+
+					const std::size_t cell = row * stride + component++;
+
+					switch (kind)
+					{
+						case ScenePropertyColumnKind::PCK_INT32: column->ints[cell] = getIntValue(instruction); break;
+						case ScenePropertyColumnKind::PCK_FLOAT32: column->floats[cell] = getFloatValue(instruction); break;
+						case ScenePropertyColumnKind::PCK_STRING: rowStrings[cell] = &instruction.getOperand().str; break;
+						case ScenePropertyColumnKind::PCK_NONE: break;
+					}
+				}
+
+				if (isMatched && component == stride)
+				{
+					column->present[row] = 1u;
+					continue;
+				}
+
+				// Shape mismatch: row stays absent and zeroed
+				switch (kind)
+				{
+					case ScenePropertyColumnKind::PCK_INT32: std::fill_n(column->ints.begin() + row * stride, stride, 0); break;
+					case ScenePropertyColumnKind::PCK_FLOAT32: std::fill_n(column->floats.begin() + row * stride, stride, 0.f); break;
+					case ScenePropertyColumnKind::PCK_STRING: std::fill_n(rowStrings.begin() + row * stride, stride, nullptr); break;
+					case ScenePropertyColumnKind::PCK_NONE: break;
+				}
+			}
+		});
+
+		// Strings are shared between rows (enums are repeated a lot)
+		if (kind == ScenePropertyColumnKind::PCK_STRING)
+		{
+			std::unordered_map<std::string_view, std::uint32_t> handles;
+			column->stringHandles.assign(rowsCount * stride, 0u);
+			column->strings.emplace_back(); // Handle 0 is an empty string (absent rows)
+			handles.emplace(std::string_view {}, 0u);
+
+			for (std::size_t row = 0; row < rowsCount; ++row)
+			{
+				if (!column->present[row])
+				{
+					continue;
+				}
+
+				for (std::size_t component = 0; component < stride; ++component)
+				{
+					const std::string &str = *rowStrings[row * stride + component];
+					auto [it, isInserted] = handles.try_emplace(str, static_cast<std::uint32_t>(column->strings.size()));
+					if (isInserted)
+					{
+						column->strings.push_back(str);
+					}
+
+					column->stringHandles[row * stride + component] = it->second;
+				}
+			}
+		}
+
+		return column;
+	}
+}
\ No newline at end of file
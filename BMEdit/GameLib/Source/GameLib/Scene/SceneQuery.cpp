@@ -0,0 +1,237 @@
+#include <GameLib/Scene/SceneQuery.h>
+#include <GameLib/Scene/SceneQueryException.h>
+#include <fmt/format.h>
+#include <algorithm>
+#include <cctype>
+#include <array>
+
+
+namespace gamelib::scene
+{
+	namespace
+	{
+		struct FieldName
+		{
+			std::string_view name;
+			SceneQueryField field;
+		};
+
+		struct OperatorName
+		{
+			std::string_view name;
+			SceneQueryOperator op;
+		};
+
+		constexpr std::array<FieldName, 6> kFields = {
+			FieldName { "name", SceneQueryField::QF_NAME },
+			FieldName { "type", SceneQueryField::QF_TYPE },
+			FieldName { "controller", SceneQueryField::QF_CONTROLLER },
+			FieldName { "prop", SceneQueryField::QF_PROPERTY },
+			FieldName { "property", SceneQueryField::QF_PROPERTY },
+			FieldName { "under", SceneQueryField::QF_UNDER }
+		};
+
+		// Two chars operators first
+		constexpr std::array<OperatorName, 7> kOperators = {
+			OperatorName { ">=", SceneQueryOperator::QO_GREATER_EQUAL },
+			OperatorName { "<=", SceneQueryOperator::QO_LESS_EQUAL },
+			OperatorName { "!=", SceneQueryOperator::QO_NOT_EQUAL },
+			OperatorName { "=", SceneQueryOperator::QO_EQUAL },
+			OperatorName { "<", SceneQueryOperator::QO_LESS },
+			OperatorName { ">", SceneQueryOperator::QO_GREATER },
+			OperatorName { "~", SceneQueryOperator::QO_CONTAINS }
+		};
+
+		bool isSpace(char ch)
+		{
+			return std::isspace(static_cast<unsigned char>(ch)) != 0;
+		}
+
+		bool isOperatorChar(char ch)
+		{
+			return ch == '=' || ch == '!' || ch == '<' || ch == '>' || ch == '~';
+		}
+
+		class Parser
+		{
+		public:
+			explicit Parser(std::string_view text) : m_text(text)
+			{
+			}
+
+			std::vector<SceneQueryTerm> parse()
+			{
+				std::vector<SceneQueryTerm> terms;
+
+				for (skipSpaces(); !isEnd(); skipSpaces())
+				{
+					terms.push_back(parseTerm());
+				}
+
+				return terms;
+			}
+
+		private:
+			SceneQueryTerm parseTerm()
+			{
+				SceneQueryTerm term;
+
+				if (peek() == '-')
+				{
+					term.isNegated = true;
+					++m_pos;
+				}
+
+				// Field prefix
+				const std::size_t fieldBegin = m_pos;
+				while (!isEnd() && std::isalpha(static_cast<unsigned char>(peek())))
+				{
+					++m_pos;
+				}
+
+				if (!isEnd() && peek() == ':' && m_pos > fieldBegin)
+				{
+					std::string fieldName { m_text.substr(fieldBegin, m_pos - fieldBegin) };
+					std::transform(fieldName.begin(), fieldName.end(), fieldName.begin(), [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
+
+					auto it = std::find_if(kFields.begin(), kFields.end(), [&fieldName](const FieldName &field) { return field.name == fieldName; });
+					if (it == kFields.end())
+					{
+						throw SceneQueryException(fieldBegin, fmt::format("Unknown field '{}'", fieldName));
+					}
+
+					term.field = it->field;
+					++m_pos; // ':'
+				}
+				else
+				{
+					m_pos = fieldBegin; // Just a name
+				}
+
+				if (term.field == SceneQueryField::QF_PROPERTY)
+				{
+					parseCondition(term);
+				}
+				else
+				{
+					term.op = SceneQueryOperator::QO_CONTAINS;
+					term.value = parseValue(false);
+				}
+
+				if (term.value.empty() && term.op != SceneQueryOperator::QO_EXISTS)
+				{
+					throw SceneQueryException(m_pos, "Expected value");
+				}
+
+				return term;
+			}
+
+			void parseCondition(SceneQueryTerm &term)
+			{
+				term.property = parseValue(true);
+				if (term.property.empty())
+				{
+					throw SceneQueryException(m_pos, "Expected property name");
+				}
+
+				if (isEnd() || isSpace(peek()))
+				{
+					term.op = SceneQueryOperator::QO_EXISTS;
+					return;
+				}
+
+				auto it = std::find_if(kOperators.begin(), kOperators.end(), [this](const OperatorName &op) { return m_text.substr(m_pos, op.name.size()) == op.name; });
+				if (it == kOperators.end())
+				{
+					throw SceneQueryException(m_pos, "Expected comparison operator");
+				}
+
+				term.op = it->op;
+				m_pos += it->name.size();
+				term.value = parseValue(false);
+			}
+
+			/**
+			 * Read value until whitespace (or operator when stopOnOperator is true). Quoted parts could contain anything.
+			 */
+			std::string parseValue(bool stopOnOperator)
+			{
+				std::string value;
+
+				while (!isEnd() && !isSpace(peek()) && !(stopOnOperator && isOperatorChar(peek())))
+				{
+					if (peek() != '"')
+					{
+						value.push_back(m_text[m_pos++]);
+						continue;
+					}
+
+					const std::size_t quoteBegin = m_pos++;
+					for (;;)
+					{
+						if (isEnd())
+						{
+							throw SceneQueryException(quoteBegin, "Unterminated quoted string");
+						}
+
+						const char ch = m_text[m_pos++];
+						if (ch == '"')
+						{
+							break;
+						}
+
+						if (ch == '\\' && !isEnd() && (peek() == '"' || peek() == '\\'))
+						{
+							value.push_back(m_text[m_pos++]);
+						}
+						else
+						{
+							value.push_back(ch);
+						}
+					}
+				}
+
+				return value;
+			}
+
+			void skipSpaces()
+			{
+				while (!isEnd() && isSpace(peek()))
+				{
+					++m_pos;
+				}
+			}
+
+			[[nodiscard]] bool isEnd() const
+			{
+				return m_pos >= m_text.size();
+			}
+
+			[[nodiscard]] char peek() const
+			{
+				return m_text[m_pos];
+			}
+
+		private:
+			std::string_view m_text;
+			std::size_t m_pos { 0 };
+		};
+	}
+
+	SceneQuery SceneQuery::parse(std::string_view text)
+	{
+		SceneQuery query;
+		query.m_terms = Parser(text).parse();
+		return query;
+	}
+
+	bool SceneQuery::empty() const
+	{
+		return m_terms.empty();
+	}
+
+	const std::vector<SceneQueryTerm> &SceneQuery::getTerms() const
+	{
+		return m_terms;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,536 @@
+#include <GameLib/Scene/SceneQueryEngine.h>
+#include <GameLib/TypeRegistry.h>
+#include <GameLib/Workers.h>
+#include <GameLib/Type.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cctype>
+
+
+namespace gamelib::scene
+{
+	namespace
+	{
+		constexpr std::size_t kEvaluateBlockSize = 1024;
+		constexpr std::uint32_t kNoOrder = 0xFFFFFFFFu;
+
+		bool parseNumber(const std::string &str, double &number)
+		{
+			if (str == "true" || str == "false")
+			{
+				number = (str == "true") ? 1.0 : 0.0;
+				return true;
+			}
+
+			if (str.empty())
+			{
+				return false;
+			}
+
+			char *end = nullptr;
+			number = std::strtod(str.c_str(), &end);
+			return end == str.c_str() + str.size();
+		}
+
+		bool iequals(std::string_view a, std::string_view b)
+		{
+			return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) { return std::tolower(static_cast<unsigned char>(x)) == std::tolower(static_cast<unsigned char>(y)); });
+		}
+
+		bool isComparisonSatisfied(SceneQueryOperator op, int comparison)
+		{
+			switch (op)
+			{
+				case SceneQueryOperator::QO_EQUAL: return comparison == 0;
+				case SceneQueryOperator::QO_NOT_EQUAL: return comparison != 0;
+				case SceneQueryOperator::QO_LESS: return comparison < 0;
+				case SceneQueryOperator::QO_LESS_EQUAL: return comparison <= 0;
+				case SceneQueryOperator::QO_GREATER: return comparison > 0;
+				case SceneQueryOperator::QO_GREATER_EQUAL: return comparison >= 0;
+				case SceneQueryOperator::QO_CONTAINS: return comparison == 0; // Numbers
+				case SceneQueryOperator::QO_EXISTS: return true;
+			}
+
+			return false;
+		}
+
+		/**
+		 * @brief Mark objects of column which satisfy condition (first value of property is compared)
+		 */
+		void matchColumn(const ScenePropertyColumn &column, SceneQueryOperator op, const std::string &value, bool isNumber, double number, std::vector<bool> &objects)
+		{
+			const std::size_t rowsCount = column.getRowsCount();
+
+			if (column.kind == ScenePropertyColumnKind::PCK_STRING)
+			{
+				// Strings are shared between rows, so condition is checked once per distinct string
+				std::vector<bool> isStringMatched(column.strings.size(), false);
+
+				for (std::size_t i = 0; i < column.strings.size(); ++i)
+				{
+					const std::string str = SceneSearchIndex::toLower(column.strings[i]);
+
+					if (op == SceneQueryOperator::QO_CONTAINS)
+					{
+						isStringMatched[i] = str.find(value) != std::string::npos;
+					}
+					else
+					{
+						isStringMatched[i] = op == SceneQueryOperator::QO_EXISTS || isComparisonSatisfied(op, str.compare(value));
+					}
+				}
+
+				for (std::size_t row = 0; row < rowsCount; ++row)
+				{
+					if (column.isPresent(row) && isStringMatched[column.stringHandles[row * column.stride]])
+					{
+						objects[column.objects[row]] = true;
+					}
+				}
+
+				return;
+			}
+
+			for (std::size_t row = 0; row < rowsCount; ++row)
+			{
+				if (!column.isPresent(row))
+				{
+					continue;
+				}
+
+				if (op == SceneQueryOperator::QO_EXISTS)
+				{
+					objects[column.objects[row]] = true;
+					continue;
+				}
+
+				if (!isNumber)
+				{
+					continue;
+				}
+
+				const double rowNumber = (column.kind == ScenePropertyColumnKind::PCK_INT32) ? static_cast<double>(column.getInt(row)) : static_cast<double>(column.getFloat(row));
+				const int comparison = (rowNumber < number) ? -1 : (rowNumber > number ? 1 : 0);
+
+				if (isComparisonSatisfied(op, comparison))
+				{
+					objects[column.objects[row]] = true;
+				}
+			}
+		}
+	}
+
+	struct SceneQueryEngine::CompiledTerm
+	{
+		SceneQueryField field { SceneQueryField::QF_NAME };
+		SceneQueryOperator op { SceneQueryOperator::QO_EXISTS };
+		bool isNegated { false };
+
+		std::vector<bool> objects {}; ///< QF_NAME, QF_CONTROLLER & QF_PROPERTY: matched objects
+		std::vector<Range> ranges {}; ///< QF_TYPE: ranges of types, QF_UNDER: ranges of subtrees
+		std::string value {};
+	};
+
+	void SceneQueryEngine::build(const std::vector<SceneObject::Ptr> &sceneObjects, int threadsCount)
+	{
+		m_objects = sceneObjects;
+		m_threadsCount = threadsCount;
+		m_searchIndex.build(m_objects, threadsCount);
+
+		buildTypeOrder();
+		buildTreeOrder();
+
+		m_controllers.clear();
+
+		for (std::uint32_t objectIndex = 0; objectIndex < m_objects.size(); ++objectIndex)
+		{
+			for (const auto &controller : m_objects[objectIndex]->getControllers())
+			{
+				auto &objects = m_controllers[SceneSearchIndex::toLower(controller.name)];
+				if (objects.empty() || objects.back() != objectIndex)
+				{
+					objects.push_back(objectIndex);
+				}
+			}
+		}
+
+		// Properties
+		m_propertyColumns.build(m_objects, threadsCount);
+		m_objectsByProperties.clear();
+
+		for (std::uint32_t objectIndex = 0; objectIndex < m_objects.size(); ++objectIndex)
+		{
+			m_objectsByProperties[&m_objects[objectIndex]->getProperties()] = objectIndex;
+		}
+	}
+
+	void SceneQueryEngine::execute(const SceneQuery &query, std::vector<std::uint32_t> &results) const
+	{
+		results.clear();
+
+		if (query.empty() || m_objects.empty())
+		{
+			return;
+		}
+
+		std::vector<CompiledTerm> terms;
+		terms.reserve(query.getTerms().size());
+
+		for (const auto &term : query.getTerms())
+		{
+			terms.push_back(compile(term));
+		}
+
+		auto isTermMatched = [this](const CompiledTerm &term, std::uint32_t objectIndex) -> bool
+		{
+			switch (term.field)
+			{
+				case SceneQueryField::QF_NAME:
+				case SceneQueryField::QF_CONTROLLER:
+				case SceneQueryField::QF_PROPERTY:
+					return term.objects[objectIndex];
+				case SceneQueryField::QF_TYPE:
+					return std::any_of(term.ranges.begin(), term.ranges.end(), [order = m_objectTypeOrder[objectIndex]](const Range &range) { return range.contains(order); });
+				case SceneQueryField::QF_UNDER:
+					return std::any_of(term.ranges.begin(), term.ranges.end(), [order = m_treeRanges[objectIndex].enter](const Range &range) { return range.contains(order); });
+			}
+
+			return false;
+		};
+
+		const std::size_t objectsCount = m_objects.size();
+		const std::size_t blocksCount = (objectsCount + kEvaluateBlockSize - 1) / kEvaluateBlockSize;
+		std::vector<std::vector<std::uint32_t>> blockResults(blocksCount);
+
+		runParallelFor(0, blocksCount, m_threadsCount, [&](std::size_t blockIndex)
+		{
+			const std::size_t first = blockIndex * kEvaluateBlockSize;
+			const std::size_t last = std::min(objectsCount, first + kEvaluateBlockSize);
+
+			for (std::size_t objectIndex = first; objectIndex < last; ++objectIndex)
+			{
+				const bool isMatched = std::all_of(terms.begin(), terms.end(), [&](const CompiledTerm &term)
+				{
+					return isTermMatched(term, static_cast<std::uint32_t>(objectIndex)) != term.isNegated;
+				});
+
+				if (isMatched)
+				{
+					blockResults[blockIndex].push_back(static_cast<std::uint32_t>(objectIndex));
+				}
+			}
+		});
+
+		for (const auto &block : blockResults)
+		{
+			results.insert(results.end(), block.begin(), block.end());
+		}
+	}
+
+	void SceneQueryEngine::invalidateProperties()
+	{
+		m_propertyColumns.invalidate();
+	}
+
+	void SceneQueryEngine::invalidateObject(std::uint32_t objectIndex)
+	{
+		m_propertyColumns.invalidateObject(objectIndex);
+	}
+
+	bool SceneQueryEngine::invalidateValue(const Value *value)
+	{
+		auto it = m_objectsByProperties.find(value);
+		if (it == m_objectsByProperties.end())
+		{
+			return false;
+		}
+
+		invalidateObject(it->second);
+		return true;
+	}
+
+	std::size_t SceneQueryEngine::getObjectsCount() const
+	{
+		return m_objects.size();
+	}
+
+	const SceneObject::Ptr &SceneQueryEngine::getObject(std::uint32_t objectIndex) const
+	{
+		return m_objects.at(objectIndex);
+	}
+
+	const SceneSearchIndex &SceneQueryEngine::getSearchIndex() const
+	{
+		return m_searchIndex;
+	}
+
+	void SceneQueryEngine::buildTypeOrder()
+	{
+		m_typeRanges.clear();
+		m_typesByName.clear();
+		m_rootTypes.clear();
+
+		// Collect types of objects and all their parents
+		std::unordered_map<const Type *, std::vector<const Type *>> childTypes;
+
+		const auto &registry = TypeRegistry::getInstance();
+
+		for (const auto &object : m_objects)
+		{
+			const auto &hierarchy = registry.getTypeHierarchy(object->getType());
+
+			for (std::size_t i = 0; i < hierarchy.size() && !m_typesByName.contains(SceneSearchIndex::toLower(hierarchy[i]->getName())); ++i)
+			{
+				const Type *type = hierarchy[i];
+				m_typesByName[SceneSearchIndex::toLower(type->getName())] = type;
+
+				if (i + 1 < hierarchy.size())
+				{
+					childTypes[hierarchy[i + 1]].push_back(type);
+				}
+				else
+				{
+					m_rootTypes.push_back(type);
+				}
+			}
+		}
+
+		// Number types in DFS order
+		std::uint32_t order = 0u;
+		std::vector<std::pair<const Type *, bool>> stack; // type, is exit
+
+		for (const Type *rootType : m_rootTypes)
+		{
+			stack.emplace_back(rootType, false);
+
+			while (!stack.empty())
+			{
+				auto [type, isExit] = stack.back();
+				stack.pop_back();
+
+				if (isExit)
+				{
+					m_typeRanges[type].exit = order - 1;
+					continue;
+				}
+
+				m_typeRanges[type].enter = order++;
+				stack.emplace_back(type, true);
+
+				if (auto it = childTypes.find(type); it != childTypes.end())
+				{
+					for (const Type *childType : it->second)
+					{
+						stack.emplace_back(childType, false);
+					}
+				}
+			}
+		}
+
+		m_objectTypeOrder.assign(m_objects.size(), kNoOrder);
+
+		for (std::size_t objectIndex = 0; objectIndex < m_objects.size(); ++objectIndex)
+		{
+			if (auto it = m_typeRanges.find(m_objects[objectIndex]->getType()); it != m_typeRanges.end())
+			{
+				m_objectTypeOrder[objectIndex] = it->second.enter;
+			}
+		}
+	}
+
+	void SceneQueryEngine::buildTreeOrder()
+	{
+		const auto objectsCount = static_cast<std::uint32_t>(m_objects.size());
+
+		// Children lists (CSR) from parent indices
+		std::vector<std::uint32_t> childrenOffsets(objectsCount + 1, 0u);
+		std::vector<std::uint32_t> children(objectsCount, 0u);
+		std::vector<std::uint32_t> roots;
+
+		for (std::uint32_t objectIndex = 0; objectIndex < objectsCount; ++objectIndex)
+		{
+			const auto parentIndex = m_searchIndex.getParentIndex(objectIndex);
+			if (parentIndex != kInvalidObject)
+			{
+				++childrenOffsets[parentIndex + 1];
+			}
+			else
+			{
+				roots.push_back(objectIndex);
+			}
+		}
+
+		for (std::uint32_t i = 0; i < objectsCount; ++i)
+		{
+			childrenOffsets[i + 1] += childrenOffsets[i];
+		}
+
+		std::vector<std::uint32_t> cursor(childrenOffsets.begin(), childrenOffsets.end() - 1);
+
+		for (std::uint32_t objectIndex = 0; objectIndex < objectsCount; ++objectIndex)
+		{
+			const auto parentIndex = m_searchIndex.getParentIndex(objectIndex);
+			if (parentIndex != kInvalidObject)
+			{
+				children[cursor[parentIndex]++] = objectIndex;
+			}
+		}
+
+		// Number objects in DFS order (objects inside of parents cycle are never visited & never match 'under')
+		m_treeRanges.assign(objectsCount, Range { kNoOrder, 0u });
+
+		std::uint32_t order = 0u;
+		std::vector<std::pair<std::uint32_t, bool>> stack; // object, is exit
+
+		for (const auto rootIndex : roots)
+		{
+			stack.emplace_back(rootIndex, false);
+
+			while (!stack.empty())
+			{
+				auto [objectIndex, isExit] = stack.back();
+				stack.pop_back();
+
+				if (isExit)
+				{
+					m_treeRanges[objectIndex].exit = order - 1;
+					continue;
+				}
+
+				m_treeRanges[objectIndex].enter = order++;
+				stack.emplace_back(objectIndex, true);
+
+				for (std::uint32_t i = childrenOffsets[objectIndex]; i < childrenOffsets[objectIndex + 1]; ++i)
+				{
+					stack.emplace_back(children[i], false);
+				}
+			}
+		}
+	}
+
+	std::string SceneQueryEngine::resolvePropertyName(const std::string &propertyName) const
+	{
+		// Names in query are case insensitive, columns are addressed by declared name
+		const auto &registry = TypeRegistry::getInstance();
+
+		for (const auto &[_typeName, type] : m_typesByName)
+		{
+			for (const ValueView *view : registry.getPropertiesTable(type))
+			{
+				if (iequals(view->getName(), propertyName))
+				{
+					return view->getName();
+				}
+			}
+		}
+
+		// Property is not declared (unexposed instructions): take name from objects
+		for (const auto &object : m_objects)
+		{
+			for (const auto &entry : object->getProperties().getEntries())
+			{
+				if (iequals(entry.name, propertyName))
+				{
+					return entry.name;
+				}
+			}
+		}
+
+		return propertyName;
+	}
+
+	SceneQueryEngine::CompiledTerm SceneQueryEngine::compile(const SceneQueryTerm &term) const
+	{
+		CompiledTerm compiled;
+		compiled.field = term.field;
+		compiled.op = term.op;
+		compiled.isNegated = term.isNegated;
+		compiled.value = SceneSearchIndex::toLower(term.value);
+
+		switch (term.field)
+		{
+			case SceneQueryField::QF_NAME:
+			{
+				std::vector<std::uint32_t> matches;
+				m_searchIndex.find(compiled.value, SceneSearchField::SSF_NAME, matches);
+
+				compiled.objects.assign(m_objects.size(), false);
+				for (const auto objectIndex : matches)
+				{
+					compiled.objects[objectIndex] = true;
+				}
+			}
+			break;
+			case SceneQueryField::QF_CONTROLLER:
+			{
+				compiled.objects.assign(m_objects.size(), false);
+
+				for (const auto &[controllerName, objects] : m_controllers)
+				{
+					if (controllerName.find(compiled.value) == std::string::npos)
+					{
+						continue;
+					}
+
+					for (const auto objectIndex : objects)
+					{
+						compiled.objects[objectIndex] = true;
+					}
+				}
+			}
+			break;
+			case SceneQueryField::QF_TYPE:
+			{
+				if (auto it = m_typesByName.find(compiled.value); it != m_typesByName.end())
+				{
+					compiled.ranges.push_back(m_typeRanges.at(it->second));
+				}
+			}
+			break;
+			case SceneQueryField::QF_UNDER:
+			{
+				// Full path or just a name of ancestor
+				const bool isPath = compiled.value.find('\\') != std::string::npos;
+
+				for (std::uint32_t objectIndex = 0; objectIndex < m_objects.size(); ++objectIndex)
+				{
+					const auto &range = m_treeRanges[objectIndex];
+					if (range.enter == kNoOrder || range.exit <= range.enter)
+					{
+						continue; // Not in tree or has no children
+					}
+
+					const bool isAncestor = isPath
+						? m_searchIndex.getPath(objectIndex) == compiled.value
+						: iequals(m_objects[objectIndex]->getName(), compiled.value);
+
+					if (isAncestor)
+					{
+						compiled.ranges.push_back(Range { range.enter + 1, range.exit });
+					}
+				}
+			}
+			break;
+			case SceneQueryField::QF_PROPERTY:
+			{
+				compiled.objects.assign(m_objects.size(), false);
+
+				double number = 0.0;
+				const bool isNumber = parseNumber(compiled.value, number);
+				const std::string propertyName = resolvePropertyName(term.property);
+
+				// Each object is a row of column of its root type
+				for (const Type *rootType : m_rootTypes)
+				{
+					if (const auto column = m_propertyColumns.getColumn(rootType->getName(), propertyName); column && column->kind != ScenePropertyColumnKind::PCK_NONE)
+					{
+						matchColumn(*column, compiled.op, compiled.value, isNumber, number, compiled.objects);
+					}
+				}
+			}
+			break;
+		}
+
+		return compiled;
+	}
+}
\ No newline at end of file
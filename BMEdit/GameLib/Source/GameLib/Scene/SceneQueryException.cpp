@@ -0,0 +1,28 @@
+#include <GameLib/Scene/SceneQueryException.h>
+#include <fmt/format.h>
+#include <utility>
+
+using namespace gamelib::scene;
+
+
+SceneQueryException::SceneQueryException(std::size_t position, std::string errorDescription)
+	: m_errorDesc(std::move(errorDescription))
+	, m_position(position)
+{
+	m_cachedWhat = fmt::format("Bad scene query at position {} (reason: {})", m_position, m_errorDesc);
+}
+
+std::size_t SceneQueryException::getPosition() const
+{
+	return m_position;
+}
+
+const std::string &SceneQueryException::getDescription() const
+{
+	return m_errorDesc;
+}
+
+const char* SceneQueryException::what() const
+{
+	return m_cachedWhat.data();
+}
\ No newline at end of file
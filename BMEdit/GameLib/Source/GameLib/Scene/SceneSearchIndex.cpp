@@ -0,0 +1,272 @@
+#include <GameLib/Scene/SceneSearchIndex.h>
+#include <GameLib/Workers.h>
+#include <GameLib/Type.h>
+#include <algorithm>
+
+
+namespace gamelib::scene
+{
+	namespace
+	{
+		constexpr std::size_t kTrigramSize = 3;
+		constexpr std::size_t kVerifyBlockSize = 1024;
+
+		std::uint32_t makeTrigram(const char *str)
+		{
+			return (static_cast<std::uint32_t>(static_cast<std::uint8_t>(str[0])) << 16) |
+				   (static_cast<std::uint32_t>(static_cast<std::uint8_t>(str[1])) << 8) |
+				   static_cast<std::uint32_t>(static_cast<std::uint8_t>(str[2]));
+		}
+
+		/**
+		 * @brief Run predicate over objects (by blocks in parallel) and collect matched ones in the same order
+		 */
+		template <typename TGetObject, typename TPredicate>
+		void verifyInParallel(std::size_t count, int threadsCount, std::vector<std::uint32_t> &matches, TGetObject &&getObject, TPredicate &&predicate)
+		{
+			const std::size_t blocksCount = (count + kVerifyBlockSize - 1) / kVerifyBlockSize;
+			std::vector<std::vector<std::uint32_t>> blockMatches(blocksCount);
+
+			runParallelFor(0, blocksCount, threadsCount, [&](std::size_t blockIndex)
+			{
+				const std::size_t first = blockIndex * kVerifyBlockSize;
+				const std::size_t last = std::min(count, first + kVerifyBlockSize);
+
+				for (std::size_t i = first; i < last; ++i)
+				{
+					const std::uint32_t objectIndex = getObject(i);
+					if (predicate(objectIndex))
+					{
+						blockMatches[blockIndex].push_back(objectIndex);
+					}
+				}
+			});
+
+			for (const auto &block : blockMatches)
+			{
+				matches.insert(matches.end(), block.begin(), block.end());
+			}
+		}
+	}
+
+	void SceneSearchIndex::build(const std::vector<SceneObject::Ptr> &sceneObjects, int threadsCount)
+	{
+		const auto objectsCount = static_cast<std::uint32_t>(sceneObjects.size());
+
+		m_threadsCount = threadsCount;
+		m_names.assign(objectsCount, {});
+		m_paths.assign(objectsCount, {});
+		m_typeIndices.assign(objectsCount, 0u);
+		m_typeNames.clear();
+		m_parents.assign(objectsCount, kInvalidObject);
+		m_objectIndices.clear();
+		m_nameTrigrams.clear();
+
+		m_objectIndices.reserve(objectsCount);
+
+		for (std::uint32_t objectIndex = 0; objectIndex < objectsCount; ++objectIndex)
+		{
+			m_objectIndices[sceneObjects[objectIndex].get()] = objectIndex;
+		}
+
+		// Names, parents & types
+		std::unordered_map<const Type *, std::uint32_t> typeIndices;
+
+		for (std::uint32_t objectIndex = 0; objectIndex < objectsCount; ++objectIndex)
+		{
+			const auto &sceneObject = sceneObjects[objectIndex];
+
+			if (auto parent = sceneObject->getParent().lock())
+			{
+				m_parents[objectIndex] = getObjectIndex(parent.get());
+			}
+
+			auto [it, isNewType] = typeIndices.try_emplace(sceneObject->getType(), static_cast<std::uint32_t>(m_typeNames.size()));
+			if (isNewType)
+			{
+				m_typeNames.push_back(sceneObject->getType() ? toLower(sceneObject->getType()->getName()) : std::string {});
+			}
+
+			m_typeIndices[objectIndex] = it->second;
+		}
+
+		runParallelFor(0, objectsCount, threadsCount, [this, &sceneObjects](std::size_t objectIndex)
+		{
+			m_names[objectIndex] = toLower(sceneObjects[objectIndex]->getName());
+		});
+
+		// Paths (parent path is built before child path)
+		std::vector<std::uint32_t> chain;
+
+		for (std::uint32_t objectIndex = 0; objectIndex < objectsCount; ++objectIndex)
+		{
+			if (!m_paths[objectIndex].empty() || m_names[objectIndex].empty())
+			{
+				continue;
+			}
+
+			chain.clear();
+
+			for (std::uint32_t current = objectIndex; current != kInvalidObject && m_paths[current].empty() && chain.size() <= objectsCount; current = m_parents[current])
+			{
+				chain.push_back(current);
+			}
+
+			for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+			{
+				const std::uint32_t parentIndex = m_parents[*it];
+
+				if (parentIndex != kInvalidObject && !m_paths[parentIndex].empty())
+				{
+					m_paths[*it].reserve(m_paths[parentIndex].size() + 1 + m_names[*it].size());
+					m_paths[*it].append(m_paths[parentIndex]).append(1, '\\').append(m_names[*it]);
+				}
+				else
+				{
+					m_paths[*it] = m_names[*it];
+				}
+			}
+		}
+
+		// Trigrams of names
+		for (std::uint32_t objectIndex = 0; objectIndex < objectsCount; ++objectIndex)
+		{
+			const auto &name = m_names[objectIndex];
+
+			for (std::size_t i = 0; i + kTrigramSize <= name.size(); ++i)
+			{
+				auto &postingList = m_nameTrigrams[makeTrigram(&name[i])];
+				if (postingList.empty() || postingList.back() != objectIndex)
+				{
+					postingList.push_back(objectIndex);
+				}
+			}
+		}
+	}
+
+	void SceneSearchIndex::find(std::string_view query, SceneSearchField fields, std::vector<std::uint32_t> &matches, const std::vector<std::uint32_t> *candidates) const
+	{
+		matches.clear();
+
+		const std::string loweredQuery = toLower(query);
+		if (loweredQuery.empty() || m_names.empty())
+		{
+			return;
+		}
+
+		std::vector<bool> matchedTypes(m_typeNames.size(), false);
+
+		if (fields & SceneSearchField::SSF_TYPE)
+		{
+			for (std::size_t typeIndex = 0; typeIndex < m_typeNames.size(); ++typeIndex)
+			{
+				matchedTypes[typeIndex] = m_typeNames[typeIndex].find(loweredQuery) != std::string::npos;
+			}
+		}
+
+		auto predicate = [this, &loweredQuery, fields, &matchedTypes](std::uint32_t objectIndex)
+		{
+			return isMatch(objectIndex, loweredQuery, fields, matchedTypes);
+		};
+
+		if (candidates)
+		{
+			verifyInParallel(candidates->size(), m_threadsCount, matches, [candidates](std::size_t i) { return (*candidates)[i]; }, predicate);
+			return;
+		}
+
+		if (fields == SceneSearchField::SSF_NAME && loweredQuery.size() >= kTrigramSize)
+		{
+			// Every match contains all trigrams of query, so the shortest posting list contains all matches
+			const std::vector<std::uint32_t> *shortestList = nullptr;
+
+			for (std::size_t i = 0; i + kTrigramSize <= loweredQuery.size(); ++i)
+			{
+				auto it = m_nameTrigrams.find(makeTrigram(&loweredQuery[i]));
+				if (it == m_nameTrigrams.end())
+				{
+					return; // Nothing could match
+				}
+
+				if (!shortestList || it->second.size() < shortestList->size())
+				{
+					shortestList = &it->second;
+				}
+			}
+
+			verifyInParallel(shortestList->size(), m_threadsCount, matches, [shortestList](std::size_t i) { return (*shortestList)[i]; }, predicate);
+			return;
+		}
+
+		verifyInParallel(m_names.size(), m_threadsCount, matches, [](std::size_t i) { return static_cast<std::uint32_t>(i); }, predicate);
+	}
+
+	void SceneSearchIndex::collectVisible(const std::vector<std::uint32_t> &matches, std::vector<bool> &visible) const
+	{
+		visible.assign(m_names.size(), false);
+
+		for (const auto objectIndex : matches)
+		{
+			// Stop at first visible ancestor: its ancestors are already visible
+			for (std::uint32_t current = objectIndex; current != kInvalidObject && current < visible.size() && !visible[current]; current = m_parents[current])
+			{
+				visible[current] = true;
+			}
+		}
+	}
+
+	bool SceneSearchIndex::empty() const
+	{
+		return m_names.empty();
+	}
+
+	std::size_t SceneSearchIndex::getObjectsCount() const
+	{
+		return m_names.size();
+	}
+
+	std::uint32_t SceneSearchIndex::getObjectIndex(const SceneObject *sceneObject) const
+	{
+		auto it = m_objectIndices.find(sceneObject);
+		return it != m_objectIndices.end() ? it->second : kInvalidObject;
+	}
+
+	std::uint32_t SceneSearchIndex::getParentIndex(std::uint32_t objectIndex) const
+	{
+		return objectIndex < m_parents.size() ? m_parents[objectIndex] : kInvalidObject;
+	}
+
+	const std::string &SceneSearchIndex::getName(std::uint32_t objectIndex) const
+	{
+		static const std::string kEmptyName {};
+		return objectIndex < m_names.size() ? m_names[objectIndex] : kEmptyName;
+	}
+
+	const std::string &SceneSearchIndex::getPath(std::uint32_t objectIndex) const
+	{
+		static const std::string kEmptyPath {};
+		return objectIndex < m_paths.size() ? m_paths[objectIndex] : kEmptyPath;
+	}
+
+	std::string SceneSearchIndex::toLower(std::string_view str)
+	{
+		std::string result { str };
+		std::transform(result.begin(), result.end(), result.begin(), [](char ch) { return (ch >= 'A' && ch <= 'Z') ? static_cast<char>(ch - 'A' + 'a') : ch; });
+		return result;
+	}
+
+	bool SceneSearchIndex::isMatch(std::uint32_t objectIndex, std::string_view loweredQuery, SceneSearchField fields, const std::vector<bool> &matchedTypes) const
+	{
+		if ((fields & SceneSearchField::SSF_NAME) && m_names[objectIndex].find(loweredQuery) != std::string::npos)
+		{
+			return true;
+		}
+
+		if ((fields & SceneSearchField::SSF_TYPE) && matchedTypes[m_typeIndices[objectIndex]])
+		{
+			return true;
+		}
+
+		return (fields & SceneSearchField::SSF_PATH) && m_paths[objectIndex].find(loweredQuery) != std::string::npos;
+	}
+}
\ No newline at end of file
@@ -146,6 +146,15 @@ namespace gamelib
 		return m_geomInfo.emplace();
 	}
 
+	const std::shared_ptr<const ValueEntriesIndex> &TypeComplex::getEntriesIndex(Span<ValueEntry> entries) const
+	{
+		std::call_once(m_entriesIndexFlag, [this, &entries]() {
+			m_entriesIndex = std::make_shared<ValueEntriesIndex>(entries);
+		});
+
+		return m_entriesIndex;
+	}
+
 	Type::DataMappingResult TypeComplex::map(const Span<PRPInstruction> &instructions) const
 	{
 		const auto& [result, _span] = verify(instructions);
@@ -219,6 +228,9 @@ namespace gamelib
 			ourSlice = newSlice;
 		}
 
+		// Attach names index (built by first mapped value)
+		resultValue.setEntriesIndex(getEntriesIndex(resultValue.getEntries()));
+
 		// Done
 		return Type::DataMappingResult(resultValue, ourSlice);
 	}
@@ -4,8 +4,11 @@
 #include <GameLib/TypeArray.h>
 #include <GameLib/TypeComplex.h>
 #include <GameLib/TypeNotFoundException.h>
+#include <GameLib/ContentHash.h>
 
+#include <algorithm>
 #include <sstream>
+#include <cctype>
 
 
 namespace gamelib
@@ -22,7 +25,11 @@ namespace gamelib
 	{
 		m_typesByHash.clear();
 		m_typesByName.clear();
+		m_propertiesTables.clear();
+		m_typeHierarchies.clear();
+		m_declaredProperties.clear();
 		m_types.clear();
+		m_typesHash = 0u;
 	}
 
 	void TypeRegistry::registerTypes(std::vector<nlohmann::json> &&typeDeclarations, std::unordered_map<std::string, std::string> &&typeToHash)
@@ -31,6 +38,10 @@ namespace gamelib
 
 		m_types.reserve(typeDeclarations.size());
 
+		// Declarations are usually collected from folder, so we sort hashes to make result independent of order
+		std::vector<std::uint64_t> declarationHashes;
+		declarationHashes.reserve(typeDeclarations.size() + typeToHash.size());
+
 		for (const auto &jsonDeclaration: typeDeclarations)
 		{
 			if (!jsonDeclaration.contains("typename") || !jsonDeclaration.contains("kind"))
@@ -50,6 +61,9 @@ namespace gamelib
 			auto typePtr = typeInstance.get();
 			m_types.emplace_back(std::move(typeInstance));
 
+			const std::string declarationDump = jsonDeclaration.dump();
+			declarationHashes.push_back(ContentHash::compute(reinterpret_cast<const std::uint8_t *>(declarationDump.data()), declarationDump.size()));
+
 			m_typesByName[typeName] = typePtr;
 			if (typeToHash.contains(typeName))
 			{
@@ -57,6 +71,18 @@ namespace gamelib
 			}
 		}
 
+		for (const auto &[typeName, typeHash] : typeToHash)
+		{
+			const std::string association = typeName + "=" + typeHash;
+			declarationHashes.push_back(ContentHash::compute(reinterpret_cast<const std::uint8_t *>(association.data()), association.size()));
+		}
+
+		std::sort(declarationHashes.begin(), declarationHashes.end());
+		for (const auto declarationHash : declarationHashes)
+		{
+			m_typesHash = ContentHash::combine(m_typesHash, declarationHash);
+		}
+
 		linkTypes();
 	}
 
@@ -211,6 +237,8 @@ namespace gamelib
 				}
 			}
 		}
+
+		buildPropertiesTables();
 	}
 
 	void TypeRegistry::addHashAssociation(std::size_t hash, const std::string &typeName)
@@ -222,6 +250,113 @@ namespace gamelib
 			auto str = stringStream.str();
 
 			m_typesByHash[str] = const_cast<Type*>(typePtr);
+			addToTypesHash(typeName + "=" + str);
+		}
+	}
+
+	std::uint64_t TypeRegistry::getTypesHash() const
+	{
+		return m_typesHash;
+	}
+
+	void TypeRegistry::addToTypesHash(std::string_view token)
+	{
+		m_typesHash = ContentHash::combine(m_typesHash, ContentHash::compute(reinterpret_cast<const std::uint8_t *>(token.data()), token.size()));
+	}
+
+	const TypeRegistry::PropertiesTable &TypeRegistry::getPropertiesTable(const Type *type) const
+	{
+		static const PropertiesTable kEmptyTable {};
+
+		auto it = m_propertiesTables.find(type);
+		if (it == m_propertiesTables.end())
+		{
+			return kEmptyTable;
+		}
+
+		return it->second;
+	}
+
+	const TypeRegistry::TypeHierarchy &TypeRegistry::getTypeHierarchy(const Type *type) const
+	{
+		static const TypeHierarchy kEmptyHierarchy {};
+
+		auto it = m_typeHierarchies.find(type);
+		if (it == m_typeHierarchies.end())
+		{
+			return kEmptyHierarchy;
+		}
+
+		return it->second;
+	}
+
+	void TypeRegistry::findProperties(std::string_view query, std::vector<const ValueView *> &results) const
+	{
+		results.clear();
+
+		if (query.empty())
+		{
+			return;
+		}
+
+		std::string lowerQuery { query };
+		std::transform(lowerQuery.begin(), lowerQuery.end(), lowerQuery.begin(), [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
+
+		for (const auto &[lowerName, view]: m_declaredProperties)
+		{
+			if (lowerName.find(lowerQuery) != std::string::npos)
+			{
+				results.push_back(view);
+			}
+		}
+	}
+
+	void TypeRegistry::buildPropertiesTables()
+	{
+		m_propertiesTables.clear();
+		m_typeHierarchies.clear();
+		m_declaredProperties.clear();
+
+		// Types are linked here, so parent of complex type is a pointer
+		std::vector<const TypeComplex *> hierarchy;
+
+		for (const auto &type: m_types)
+		{
+			if (type->getKind() != TypeKind::COMPLEX)
+			{
+				continue;
+			}
+
+			auto complex = reinterpret_cast<const TypeComplex *>(type.get());
+
+			for (const auto &view: complex->getInstructionViews())
+			{
+				std::string lowerName = view.getName();
+				std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(), [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
+				m_declaredProperties.push_back(DeclaredProperty { std::move(lowerName), &view });
+			}
+
+			hierarchy.clear();
+			std::size_t propertiesCount = 0;
+
+			for (const Type *current = complex; current && current->getKind() == TypeKind::COMPLEX; current = reinterpret_cast<const TypeComplex *>(current)->getParent())
+			{
+				hierarchy.push_back(reinterpret_cast<const TypeComplex *>(current));
+				propertiesCount += hierarchy.back()->getInstructionViews().size();
+			}
+
+			m_typeHierarchies[complex].assign(hierarchy.begin(), hierarchy.end());
+
+			PropertiesTable &table = m_propertiesTables[complex];
+			table.reserve(propertiesCount);
+
+			for (auto it = hierarchy.rbegin(); it != hierarchy.rend(); ++it)
+			{
+				for (const auto &view: (*it)->getInstructionViews())
+				{
+					table.push_back(&view);
+				}
+			}
 		}
 	}
 
@@ -1,5 +1,7 @@
+#include <GameLib/ValueEntriesIndex.h>
 #include <GameLib/Value.h>
 #include <GameLib/Type.h>
+#include <cassert>
 #include <stdexcept>
 #include <utility>
 #include <algorithm>
@@ -20,6 +22,11 @@ namespace gamelib
 	{
 	}
 
+	Value::Value(const Type *type, std::vector<prp::PRPInstruction> data, std::vector<ValueEntry> entries, std::vector<ValueView> views)
+		: m_type(type), m_data(std::move(data)), m_entries(std::move(entries)), m_views(std::move(views))
+	{
+	}
+
 	Value &Value::operator+=(const Value &another)
 	{
 		// Copy data instructions (in any case)
@@ -27,6 +34,7 @@ namespace gamelib
 
 		// Copy views
 		std::copy(another.m_views.begin(), another.m_views.end(), std::back_inserter(m_views));
+		m_revision.bump();
 
 		// Return self
 		return *this;
@@ -42,6 +50,9 @@ namespace gamelib
 		// Copy instructions
 		std::copy(chunkData.m_data.begin(), chunkData.m_data.end(), std::back_inserter(m_data));
 
+		// Layout changed, index is not valid anymore
+		m_entriesIndex.reset();
+
 		// Create entry
 		auto& newEnt = m_entries.emplace_back();
 		newEnt.name = chunkName;
@@ -51,25 +62,21 @@ namespace gamelib
 		// Copy views
 		std::copy(chunkData.m_views.begin(), chunkData.m_views.end(), std::back_inserter(newEnt.views));
 		std::copy(chunkData.m_views.begin(), chunkData.m_views.end(), std::back_inserter(m_views)); //TODO: Remove
+		m_revision.bump();
 
 		return *this;
 	}
 
-	Span<prp::PRPInstruction> Value::operator[](const char* token)
+	Span<prp::PRPInstruction> Value::operator[](std::string_view token)
 	{
 		if (m_entries.empty())
 		{
 			throw std::out_of_range("Value::operator[] empty container access!");
 		}
 
-		const auto strt = std::string { token };
-
-		for (auto &ent : m_entries)
+		if (const int entryIndex = getEntryIndex(token); entryIndex >= 0)
 		{
-			if (ent.name == strt)
-			{
-				return Span(m_data).slice(ent.instructions);
-			}
+			return Span(m_data).slice(m_entries[entryIndex].instructions);
 		}
 
 		throw std::out_of_range("Value::operator[] invalid token passed!");
@@ -120,39 +127,102 @@ namespace gamelib
 		return Span<ValueEntry>(m_entries);
 	}
 
+	const std::vector<ValueView> &Value::getViews() const
+	{
+		return m_views;
+	}
+
 	void Value::updateContainer(int entryIndex, const std::vector<prp::PRPInstruction> &newDecl)
 	{
-		// So, let's update data chunk and then rebuild views
-		const auto& [off, sz] = m_entries.at(entryIndex).instructions;
-		m_data.erase(m_data.begin() + off, m_data.begin() + off + sz);
-		std::copy(newDecl.begin(), newDecl.end(), std::inserter(m_data, m_data.begin() + off));
+		auto &entry = m_entries.at(entryIndex);
+
+		// Verify new declaration by type of property only (rest of object is untouched)
+		const Type *propertyType = entry.views.empty() ? nullptr : entry.views.back().getType();
+		if (!propertyType)
+		{
+			throw std::runtime_error("Unable to update container: property '" + entry.name + "' has no type");
+		}
+
+		const auto [isValid, unusedInstructions] = propertyType->verify(Span(newDecl));
+		if (!isValid || !unusedInstructions.empty())
+		{
+			throw std::runtime_error("Unable to update container: new data of property '" + entry.name + "' is not valid for type " + propertyType->getName());
+		}
+
+		// Replace instructions of entry in place
+		const auto offset = static_cast<std::ptrdiff_t>(entry.instructions.iOffset);
+		const auto oldSize = static_cast<std::ptrdiff_t>(entry.instructions.iSize);
+		const auto newSize = static_cast<std::ptrdiff_t>(newDecl.size());
+		const auto commonSize = std::min(oldSize, newSize);
 
-		// And then rebuild everything
-		auto [mappedData, _newSlice] = m_type->map(Span(m_data));
+		std::copy(newDecl.begin(), newDecl.begin() + commonSize, m_data.begin() + offset);
 
-		if (!mappedData.has_value())
+		if (newSize > oldSize)
 		{
-			throw std::runtime_error("Unable to map new data bunch. Looks like an internal error");
-			return;
+			m_data.insert(m_data.begin() + offset + oldSize, newDecl.begin() + oldSize, newDecl.end());
 		}
+		else if (newSize < oldSize)
+		{
+			m_data.erase(m_data.begin() + offset + newSize, m_data.begin() + offset + oldSize);
+		}
+
+		// Move entries which placed after this one
+		entry.instructions.iSize = newSize;
+		m_revision.bump();
 
-		const auto& data = mappedData.value();
-		m_data = data.m_data;
-		m_entries = data.m_entries;
-		m_views = data.m_views;
+		if (const int64_t delta = newSize - oldSize; delta != 0)
+		{
+			for (auto &other: m_entries)
+			{
+				if (other.instructions.iOffset > offset)
+				{
+					other.instructions.iOffset += delta;
+				}
+			}
+		}
+	}
+
+	bool Value::hasProperty(std::string_view propertyName) const
+	{
+		return getEntryIndex(propertyName) >= 0;
 	}
 
-	bool Value::hasProperty(const char *propertyName) const
+	int Value::getEntryIndex(std::string_view propertyName) const
 	{
-		const auto& propName = std::string { propertyName };
-		for (const auto& ent: m_entries)
+		if (m_entriesIndex)
 		{
-			if (ent.name == propName)
+			return m_entriesIndex->find(propertyName);
+		}
+
+		for (std::size_t entryIndex = 0; entryIndex < m_entries.size(); ++entryIndex)
+		{
+			if (m_entries[entryIndex].name == propertyName)
 			{
-				return true;
+				return static_cast<int>(entryIndex);
 			}
 		}
 
-		return false;
+		return ValueEntriesIndex::kNotFound;
+	}
+
+	void Value::setEntriesIndex(std::shared_ptr<const ValueEntriesIndex> index)
+	{
+		assert(!index || index->getEntriesCount() == m_entries.size());
+		m_entriesIndex = std::move(index);
+	}
+
+	const std::shared_ptr<const ValueEntriesIndex> &Value::getEntriesIndex() const
+	{
+		return m_entriesIndex;
+	}
+
+	std::uint64_t Value::getRevision() const
+	{
+		return m_revision.get();
+	}
+
+	void Value::markChanged()
+	{
+		m_revision.bump();
 	}
 }
\ No newline at end of file
@@ -0,0 +1,162 @@
+#include <GameLib/ValueEntriesIndex.h>
+#include <GameLib/Value.h>
+#include <unordered_set>
+#include <algorithm>
+
+
+namespace gamelib
+{
+	namespace
+	{
+		constexpr std::uint32_t kMaxDisplacement = 1u << 20;
+		constexpr std::size_t kNamesPerBucket = 4;
+
+		std::size_t nextPowerOfTwo(std::size_t value)
+		{
+			std::size_t result = 1;
+			while (result < value)
+			{
+				result <<= 1;
+			}
+
+			return result;
+		}
+	}
+
+	ValueEntriesIndex::ValueEntriesIndex(Span<ValueEntry> entries)
+	{
+		m_names.reserve(static_cast<std::size_t>(entries.size()));
+
+		for (const auto &entry: entries)
+		{
+			m_names.push_back(entry.name);
+		}
+
+		// Load factor of slots is 0.5 or less, so displacement found fast. Table grows when it's not enough.
+		for (std::size_t slotsCount = nextPowerOfTwo(m_names.size() * 2); !tryBuild(slotsCount); slotsCount <<= 1)
+		{
+		}
+	}
+
+	int ValueEntriesIndex::find(std::string_view name) const
+	{
+		const std::uint64_t nameHash = hash(name);
+		const std::int32_t entryIndex = m_slots[slotHash(nameHash, m_displacements[nameHash & m_bucketsMask]) & m_slotsMask];
+
+		if (entryIndex == kNotFound || m_names[entryIndex] != name)
+		{
+			return kNotFound;
+		}
+
+		return entryIndex;
+	}
+
+	std::size_t ValueEntriesIndex::getEntriesCount() const
+	{
+		return m_names.size();
+	}
+
+	std::uint64_t ValueEntriesIndex::hash(std::string_view name)
+	{
+		// FNV-1a
+		std::uint64_t result = 0xCBF29CE484222325ull;
+
+		for (const char ch: name)
+		{
+			result ^= static_cast<std::uint8_t>(ch);
+			result *= 0x100000001B3ull;
+		}
+
+		return result;
+	}
+
+	std::uint64_t ValueEntriesIndex::slotHash(std::uint64_t nameHash, std::uint32_t displacement)
+	{
+		std::uint64_t result = nameHash ^ (static_cast<std::uint64_t>(displacement) * 0x9E3779B97F4A7C15ull);
+		result ^= result >> 33;
+		result *= 0xFF51AFD7ED558CCDull;
+		result ^= result >> 33;
+
+		return result;
+	}
+
+	bool ValueEntriesIndex::tryBuild(std::size_t slotsCount)
+	{
+		const std::size_t bucketsCount = nextPowerOfTwo(std::max<std::size_t>(1, m_names.size() / kNamesPerBucket));
+
+		m_slots.assign(slotsCount, kNotFound);
+		m_displacements.assign(bucketsCount, 0u);
+		m_slotsMask = slotsCount - 1;
+		m_bucketsMask = bucketsCount - 1;
+
+		// Split unique names by buckets
+		std::vector<std::vector<std::int32_t>> buckets(bucketsCount);
+		std::unordered_set<std::string_view> seenNames;
+
+		for (std::size_t entryIndex = 0; entryIndex < m_names.size(); ++entryIndex)
+		{
+			if (seenNames.insert(m_names[entryIndex]).second)
+			{
+				buckets[hash(m_names[entryIndex]) & m_bucketsMask].push_back(static_cast<std::int32_t>(entryIndex));
+			}
+		}
+
+		// Place biggest buckets first while table is empty
+		std::vector<std::size_t> order(bucketsCount);
+		for (std::size_t i = 0; i < bucketsCount; ++i)
+		{
+			order[i] = i;
+		}
+
+		std::stable_sort(order.begin(), order.end(), [&buckets](std::size_t a, std::size_t b) { return buckets[a].size() > buckets[b].size(); });
+
+		std::vector<std::uint64_t> bucketSlots;
+
+		for (const std::size_t bucketIndex : order)
+		{
+			const auto &bucket = buckets[bucketIndex];
+			if (bucket.empty())
+			{
+				break;
+			}
+
+			bool isPlaced = false;
+
+			for (std::uint32_t displacement = 0; displacement < kMaxDisplacement && !isPlaced; ++displacement)
+			{
+				bucketSlots.clear();
+				isPlaced = true;
+
+				for (const std::int32_t entryIndex : bucket)
+				{
+					const std::uint64_t slot = slotHash(hash(m_names[entryIndex]), displacement) & m_slotsMask;
+
+					if (m_slots[slot] != kNotFound || std::find(bucketSlots.begin(), bucketSlots.end(), slot) != bucketSlots.end())
+					{
+						isPlaced = false;
+						break;
+					}
+
+					bucketSlots.push_back(slot);
+				}
+
+				if (isPlaced)
+				{
+					m_displacements[bucketIndex] = displacement;
+
+					for (std::size_t i = 0; i < bucket.size(); ++i)
+					{
+						m_slots[bucketSlots[i]] = bucket[i];
+					}
+				}
+			}
+
+			if (!isPlaced)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,291 @@
+#include <GameLib/Workspace.h>
+#include <GameLib/Scene/SceneQueryEngine.h>
+#include <GameLib/PRM/PRMChunkIndex.h>
+#include <GameLib/LevelSnapshot.h>
+#include <GameLib/Profiler.h>
+#include <GameLib/Workers.h>
+#include <GameLib/Level.h>
+#include <unordered_set>
+#include <utility>
+
+
+namespace gamelib
+{
+	Workspace::Workspace() = default;
+	Workspace::~Workspace() = default;
+
+	std::uint32_t Workspace::addLevel(std::unique_ptr<io::IOLevelAssetsProvider> &&levelAssetsProvider)
+	{
+		auto &slot = m_levels.emplace_back(std::make_unique<LevelSlot>());
+		slot->level = std::make_unique<Level>(std::move(levelAssetsProvider));
+
+		return static_cast<std::uint32_t>(m_levels.size() - 1);
+	}
+
+	bool Workspace::loadLevels(int threadsCount, const LevelSnapshotCache *snapshotCache)
+	{
+		GAMELIB_PROFILE_SCOPE("Workspace::loadLevels");
+
+		std::vector<std::uint32_t> pendingLevels;
+		for (std::uint32_t levelIndex = 0; levelIndex < m_levels.size(); ++levelIndex)
+		{
+			if (!m_levels[levelIndex]->isLoaded)
+			{
+				pendingLevels.push_back(levelIndex);
+			}
+		}
+
+		// Each level is loaded by single worker (levels are independent, types database is only read here)
+		runParallelFor(0, pendingLevels.size(), threadsCount, [this, &pendingLevels, snapshotCache](std::size_t pendingIndex)
+		{
+			auto &slot = *m_levels[pendingLevels[pendingIndex]];
+			slot.loadError.clear();
+
+			try
+			{
+				slot.isLoaded = snapshotCache ? slot.level->loadSceneData(*snapshotCache) : slot.level->loadSceneData();
+				if (!slot.isLoaded)
+				{
+					slot.loadError = "unable to load level";
+				}
+			}
+			catch (const std::exception &ex)
+			{
+				slot.isLoaded = false;
+				slot.loadError = ex.what();
+			}
+		});
+
+		// Chunks are shared in order of levels, so the result doesn't depend on order of loading
+		bool isAllLoaded = true;
+
+		for (const auto levelIndex : pendingLevels)
+		{
+			if (m_levels[levelIndex]->isLoaded)
+			{
+				shareChunks(levelIndex, threadsCount);
+			}
+			else
+			{
+				isAllLoaded = false;
+			}
+		}
+
+		return isAllLoaded;
+	}
+
+	void Workspace::removeLevel(std::uint32_t levelIndex)
+	{
+		if (levelIndex >= m_levels.size())
+		{
+			return;
+		}
+
+		m_levels.erase(m_levels.begin() + levelIndex);
+
+		// Removed level could own content which is shared by other levels, so owners are collected again (already shared chunks are matched by pointer)
+		m_chunksByHash.clear();
+
+		for (std::uint32_t remainingLevel = 0; remainingLevel < m_levels.size(); ++remainingLevel)
+		{
+			if (m_levels[remainingLevel]->isLoaded)
+			{
+				shareChunks(remainingLevel, 0);
+			}
+		}
+	}
+
+	void Workspace::clear()
+	{
+		m_chunksByHash.clear();
+		m_levels.clear();
+	}
+
+	std::size_t Workspace::getLevelsCount() const
+	{
+		return m_levels.size();
+	}
+
+	const Level *Workspace::getLevel(std::uint32_t levelIndex) const
+	{
+		return levelIndex < m_levels.size() ? m_levels[levelIndex]->level.get() : nullptr;
+	}
+
+	Level *Workspace::getLevel(std::uint32_t levelIndex)
+	{
+		return levelIndex < m_levels.size() ? m_levels[levelIndex]->level.get() : nullptr;
+	}
+
+	bool Workspace::isLevelLoaded(std::uint32_t levelIndex) const
+	{
+		return levelIndex < m_levels.size() && m_levels[levelIndex]->isLoaded;
+	}
+
+	const std::string &Workspace::getLoadError(std::uint32_t levelIndex) const
+	{
+		static const std::string kNoError {};
+		return levelIndex < m_levels.size() ? m_levels[levelIndex]->loadError : kNoError;
+	}
+
+	void Workspace::findObjects(const scene::SceneQuery &query, std::vector<ObjectRef> &results) const
+	{
+		GAMELIB_PROFILE_SCOPE("Workspace::findObjects");
+
+		results.clear();
+
+		std::vector<std::uint32_t> levelResults;
+		for (std::uint32_t levelIndex = 0; levelIndex < m_levels.size(); ++levelIndex)
+		{
+			const auto &slot = *m_levels[levelIndex];
+			if (!slot.isLoaded)
+			{
+				continue;
+			}
+
+			getQueryEngine(slot).execute(query, levelResults);
+
+			for (const auto objectIndex : levelResults)
+			{
+				results.push_back(ObjectRef { levelIndex, objectIndex });
+			}
+		}
+	}
+
+	void Workspace::findObjectsByName(const std::string &name, std::vector<ObjectRef> &results) const
+	{
+		results.clear();
+
+		for (std::uint32_t levelIndex = 0; levelIndex < m_levels.size(); ++levelIndex)
+		{
+			const auto &slot = *m_levels[levelIndex];
+			if (!slot.isLoaded)
+			{
+				continue;
+			}
+
+			const auto &sceneObjects = slot.level->getSceneObjects();
+			for (std::uint32_t objectIndex = 0; objectIndex < sceneObjects.size(); ++objectIndex)
+			{
+				if (sceneObjects[objectIndex]->getName() == name)
+				{
+					results.push_back(ObjectRef { levelIndex, objectIndex });
+				}
+			}
+		}
+	}
+
+	void Workspace::invalidateQueries(std::uint32_t levelIndex)
+	{
+		if (levelIndex >= m_levels.size())
+		{
+			return;
+		}
+
+		std::lock_guard lock { m_queryEnginesLock };
+		m_levels[levelIndex]->queryEngine.reset();
+	}
+
+	std::size_t Workspace::getSharedChunksCount() const
+	{
+		return getSharedChunksStats().chunksCount;
+	}
+
+	std::size_t Workspace::getSharedBytes() const
+	{
+		return getSharedChunksStats().bytes;
+	}
+
+	MemoryReport Workspace::memoryReport() const
+	{
+		MemoryReport report;
+		std::unordered_set<const uint8_t *> countedBuffers; // Bodies shared between levels are counted once
+
+		for (const auto &slot : m_levels)
+		{
+			if (!slot->isLoaded)
+			{
+				continue;
+			}
+
+			report.merge(slot->level->memoryReport(countedBuffers));
+		}
+
+		return report;
+	}
+
+	void Workspace::shareChunks(std::uint32_t levelIndex, int threadsCount)
+	{
+		GAMELIB_PROFILE_SCOPE("Workspace::shareChunks");
+
+		auto &chunks = m_levels[levelIndex]->level->getLevelGeometry()->chunks;
+
+		prm::PRMChunkIndex chunkIndex;
+		chunkIndex.build(chunks, threadsCount);
+
+		for (std::uint32_t currentChunk = 0; currentChunk < chunks.size(); ++currentChunk)
+		{
+			auto &chunk = chunks[currentChunk];
+			if (chunk.getKind() == prm::PRMChunkRecognizedKind::CRK_ZERO_CHUNK || std::as_const(chunk).getBuffer().empty())
+			{
+				continue;
+			}
+
+			auto &owners = m_chunksByHash[chunkIndex.getChunkHash(currentChunk)];
+			bool isShared = false;
+
+			for (const auto &owner : owners)
+			{
+				const auto &ownerChunk = std::as_const(*m_levels[owner.levelIndex]->level).getLevelGeometry()->chunks[owner.chunkIndex];
+				if (chunk.shareBufferWith(ownerChunk))
+				{
+					isShared = true;
+					break;
+				}
+			}
+
+			if (!isShared)
+			{
+				owners.push_back(ChunkRef { levelIndex, currentChunk });
+			}
+		}
+	}
+
+	Workspace::SharedChunksStats Workspace::getSharedChunksStats() const
+	{
+		SharedChunksStats stats;
+		std::unordered_set<const uint8_t *> seenBuffers;
+
+		for (const auto &slot : m_levels)
+		{
+			if (!slot->isLoaded)
+			{
+				continue;
+			}
+
+			// Every chunk except the first one which refers to body is a saved allocation
+			for (const auto &chunk : std::as_const(*slot->level).getLevelGeometry()->chunks)
+			{
+				if (chunk.isBufferShared() && !seenBuffers.insert(chunk.getBuffer().cbegin()).second)
+				{
+					++stats.chunksCount;
+					stats.bytes += static_cast<std::size_t>(chunk.getBuffer().size());
+				}
+			}
+		}
+
+		return stats;
+	}
+
+	const scene::SceneQueryEngine &Workspace::getQueryEngine(const LevelSlot &slot) const
+	{
+		std::lock_guard lock { m_queryEnginesLock };
+
+		if (!slot.queryEngine)
+		{
+			slot.queryEngine = std::make_unique<scene::SceneQueryEngine>();
+			slot.queryEngine->build(slot.level->getSceneObjects());
+		}
+
+		return *slot.queryEngine;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <GameLib/Scene/SceneObject.h>
+#include <GameLib/Value.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace tests
+{
+	/**
+	 * @brief Flat scenes of untyped objects with Int32 properties, used by tests of level diff & merge.
+	 */
+	using Properties = std::vector<std::pair<std::string, std::int32_t>>;
+
+	/**
+	 * @fn makeValue
+	 * @brief Value with one Int32 entry per property (in given order)
+	 */
+	inline gamelib::Value makeValue(const Properties &properties)
+	{
+		std::vector<gamelib::prp::PRPInstruction> instructions;
+		std::vector<gamelib::ValueEntry> entries;
+
+		for (const auto &[name, value] : properties)
+		{
+			auto &entry = entries.emplace_back();
+			entry.name = name;
+			entry.instructions.iOffset = static_cast<int64_t>(instructions.size());
+			entry.instructions.iSize = 1;
+
+			instructions.emplace_back(gamelib::prp::PRPOpCode::Int32, gamelib::prp::PRPOperandVal(value));
+		}
+
+		return gamelib::Value(nullptr, std::move(instructions), std::move(entries), {});
+	}
+
+	/**
+	 * @fn makeScene
+	 * @brief ROOT with children (name, properties) in given order
+	 */
+	inline std::vector<gamelib::scene::SceneObject::Ptr> makeScene(const std::vector<std::pair<std::string, Properties>> &children)
+	{
+		std::vector<gamelib::scene::SceneObject::Ptr> objects;
+		objects.push_back(std::make_shared<gamelib::scene::SceneObject>("ROOT", 0u, nullptr, gamelib::gms::GMSGeomEntity {}, gamelib::scene::SceneObject::Instructions {}));
+
+		for (const auto &[name, properties] : children)
+		{
+			auto &child = objects.emplace_back(std::make_shared<gamelib::scene::SceneObject>(name, 0u, nullptr, gamelib::gms::GMSGeomEntity {}, gamelib::scene::SceneObject::Instructions {}));
+			child->getProperties() = makeValue(properties);
+			child->setParent(objects.front());
+			objects.front()->addChild(child);
+		}
+
+		return objects;
+	}
+}
\ No newline at end of file
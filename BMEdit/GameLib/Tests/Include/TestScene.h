@@ -0,0 +1,101 @@
+#pragma once
+
+#include <GameLib/Scene/SceneObject.h>
+#include <GameLib/TypeComplex.h>
+#include <GameLib/TypeRegistry.h>
+#include <GameLib/Value.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace tests
+{
+	/**
+	 * @brief Base of small scenes used by tests of scene indexes, queries and dumpers.
+	 * @details Types are registered in TypeRegistry (scene indexes take inheritance and properties tables from it),
+	 *          so registry is reset when scene is created and when it is destroyed.
+	 */
+	class TestScene
+	{
+	public:
+		std::vector<gamelib::scene::SceneObject::Ptr> objects {};
+
+		TestScene()
+		{
+			gamelib::TypeRegistry::getInstance().reset();
+		}
+
+		virtual ~TestScene()
+		{
+			gamelib::TypeRegistry::getInstance().reset();
+		}
+
+		TestScene(const TestScene &) = delete;
+		TestScene &operator=(const TestScene &) = delete;
+
+		/**
+		 * @fn addType
+		 * @brief Register complex type (unexposed instructions are allowed, so objects could have undeclared properties)
+		 */
+		gamelib::TypeComplex *addType(const std::string &typeName, gamelib::TypeComplex *parent = nullptr, std::vector<gamelib::ValueView> &&views = {})
+		{
+			auto &registry = gamelib::TypeRegistry::getInstance();
+			auto *type = registry.registerType(std::make_unique<gamelib::TypeComplex>(typeName, std::move(views), parent, true));
+			registry.linkTypes();
+			return type;
+		}
+
+		/**
+		 * @fn add
+		 * @param parentIndex - index of parent in objects (-1 for root)
+		 */
+		gamelib::scene::SceneObject &add(const std::string &name, const gamelib::Type *type, int parentIndex = -1)
+		{
+			auto &object = objects.emplace_back(std::make_shared<gamelib::scene::SceneObject>(name, 0u, type, gamelib::gms::GMSGeomEntity {}, gamelib::scene::SceneObject::Instructions {}));
+
+			if (parentIndex >= 0)
+			{
+				object->setParent(objects[parentIndex]);
+				objects[parentIndex]->addChild(object);
+			}
+
+			return *object;
+		}
+
+		static void addProperty(gamelib::scene::SceneObject &object, const std::string &name, gamelib::Value &&value)
+		{
+			object.getProperties() += std::make_pair(name, std::move(value));
+		}
+
+		static gamelib::Value makeInt32(std::int32_t value)
+		{
+			return gamelib::Value(nullptr, { gamelib::prp::PRPInstruction(gamelib::prp::PRPOpCode::Int32, gamelib::prp::PRPOperandVal(value)) });
+		}
+
+		static gamelib::Value makeFloat32(float value)
+		{
+			return gamelib::Value(nullptr, { gamelib::prp::PRPInstruction(gamelib::prp::PRPOpCode::Float32, gamelib::prp::PRPOperandVal(value)) });
+		}
+
+		static gamelib::Value makeString(const std::string &value, gamelib::prp::PRPOpCode opCode = gamelib::prp::PRPOpCode::String)
+		{
+			return gamelib::Value(nullptr, { gamelib::prp::PRPInstruction(opCode, gamelib::prp::PRPOperandVal(value)) });
+		}
+
+		static gamelib::Value makeFloatArray(const std::vector<float> &values)
+		{
+			std::vector<gamelib::prp::PRPInstruction> instructions;
+			instructions.emplace_back(gamelib::prp::PRPOpCode::Array, gamelib::prp::PRPOperandVal(static_cast<std::int32_t>(values.size())));
+
+			for (const float component : values)
+			{
+				instructions.emplace_back(gamelib::prp::PRPOpCode::Float32, gamelib::prp::PRPOperandVal(component));
+			}
+
+			instructions.emplace_back(gamelib::prp::PRPOpCode::EndArray);
+			return gamelib::Value(nullptr, std::move(instructions));
+		}
+	};
+}
\ No newline at end of file
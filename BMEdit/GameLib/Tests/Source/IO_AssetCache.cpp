@@ -0,0 +1,257 @@
+#include <gtest/gtest.h>
+
+#include <GameLib/IO/AssetCache.h>
+#include <GameLib/IO/DeflateCodec.h>
+#include <filesystem>
+#include <fstream>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+// Usage
+using gamelib::io::AssetCache;
+using gamelib::io::AssetCacheKey;
+using gamelib::io::DeflateCodec;
+
+// Helpers
+namespace
+{
+	std::vector<uint8_t> makeAsset(std::size_t size, uint8_t filler)
+	{
+		return std::vector<uint8_t>(size, filler);
+	}
+
+	bool isSameAsset(const std::unique_ptr<uint8_t[]> &buffer, const std::vector<uint8_t> &asset)
+	{
+		return buffer && std::memcmp(buffer.get(), asset.data(), asset.size()) == 0;
+	}
+
+	/**
+	 * Key of persisted asset must have real CRC32 of asset
+	 */
+	AssetCacheKey makeKey(std::uint64_t archiveId, const std::vector<uint8_t> &asset)
+	{
+		return AssetCacheKey { archiveId, DeflateCodec::computeCRC32(gamelib::Span<uint8_t>(asset)), asset.size() };
+	}
+
+	std::size_t countAssets(const std::filesystem::path &folder)
+	{
+		std::size_t count = 0;
+		for (const auto &entry : std::filesystem::directory_iterator(folder))
+		{
+			count += entry.path().extension() == AssetCache::kAssetExtension ? 1 : 0;
+		}
+
+		return count;
+	}
+}
+
+// Tests
+TEST(IO_AssetCache, HitsAndMissesAreCounted)
+{
+	AssetCache cache { 1024 };
+	const auto asset = makeAsset(100, 0xAAu);
+	const AssetCacheKey key { 1u, 0xDEADBEEFu, asset.size() };
+
+	ASSERT_EQ(cache.get(key), nullptr);
+	cache.put(key, asset.data(), asset.size());
+	ASSERT_TRUE(isSameAsset(cache.get(key), asset));
+
+	// The same entry of another archive is another asset
+	ASSERT_EQ(cache.get(AssetCacheKey { 2u, 0xDEADBEEFu, asset.size() }), nullptr);
+
+	const auto stats = cache.getStats();
+	ASSERT_EQ(stats.hits, 1);
+	ASSERT_EQ(stats.misses, 2);
+	ASSERT_EQ(stats.entriesCount, 1);
+	ASSERT_EQ(stats.bytes, 100);
+}
+
+TEST(IO_AssetCache, LeastRecentlyUsedAssetIsEvicted)
+{
+	AssetCache cache { 250 };
+	const auto first = makeAsset(100, 0x01u);
+	const auto second = makeAsset(100, 0x02u);
+	const auto third = makeAsset(100, 0x03u);
+
+	const AssetCacheKey firstKey { 1u, 1u, first.size() };
+	const AssetCacheKey secondKey { 1u, 2u, second.size() };
+	const AssetCacheKey thirdKey { 1u, 3u, third.size() };
+
+	cache.put(firstKey, first.data(), first.size());
+	cache.put(secondKey, second.data(), second.size());
+	ASSERT_NE(cache.get(firstKey), nullptr); // first is used recently now
+
+	cache.put(thirdKey, third.data(), third.size());
+	ASSERT_TRUE(isSameAsset(cache.get(firstKey), first));
+	ASSERT_EQ(cache.get(secondKey), nullptr);
+	ASSERT_TRUE(isSameAsset(cache.get(thirdKey), third));
+	ASSERT_EQ(cache.getStats().evictions, 1);
+
+	// Asset bigger than cache is not cached, disabled cache keeps nothing
+	const auto huge = makeAsset(300, 0x04u);
+	cache.put(AssetCacheKey { 1u, 4u, huge.size() }, huge.data(), huge.size());
+	ASSERT_EQ(cache.get(AssetCacheKey { 1u, 4u, huge.size() }), nullptr);
+
+	cache.setCapacity(0);
+	ASSERT_EQ(cache.getStats().bytes, 0);
+	ASSERT_EQ(cache.get(firstKey), nullptr);
+}
+
+TEST(IO_AssetCache, PersistedAssetIsReadByAnotherCache)
+{
+	const auto cacheFolder = std::filesystem::temp_directory_path() / "GameLib_Tests_AssetCache";
+	std::filesystem::remove_all(cacheFolder);
+
+	const auto asset = makeAsset(64, 0x5Au);
+	const auto key = makeKey(7u, asset);
+
+	{
+		AssetCache cache { 1024 };
+		cache.setPersistentFolder(cacheFolder.string());
+		cache.put(key, asset.data(), asset.size());
+	}
+
+	AssetCache cache { 1024 };
+	cache.setPersistentFolder(cacheFolder.string());
+
+	ASSERT_TRUE(isSameAsset(cache.get(key), asset));
+	ASSERT_EQ(cache.getStats().diskHits, 1);
+
+	// Asset is kept in memory after first read from disk
+	ASSERT_TRUE(isSameAsset(cache.get(key), asset));
+	ASSERT_EQ(cache.getStats().hits, 1);
+
+	std::filesystem::remove_all(cacheFolder);
+}
+
+TEST(IO_AssetCache, DamagedPersistedAssetIsRejected)
+{
+	const auto cacheFolder = std::filesystem::temp_directory_path() / "GameLib_Tests_AssetCache_Damaged";
+	std::filesystem::remove_all(cacheFolder);
+
+	const auto asset = makeAsset(64, 0x5Au);
+	const auto key = makeKey(7u, asset);
+
+	{
+		AssetCache cache { 1024 };
+		cache.setPersistentFolder(cacheFolder.string());
+		cache.put(key, asset.data(), asset.size());
+	}
+
+	ASSERT_EQ(countAssets(cacheFolder), 1);
+	const auto persistedPath = std::filesystem::directory_iterator(cacheFolder)->path();
+
+	// Same size, another content
+	{
+		std::fstream file(persistedPath, std::ios::binary | std::ios::in | std::ios::out);
+		file.seekp(10);
+		file.put(static_cast<char>(0xA5));
+	}
+
+	AssetCache cache { 1024 };
+	cache.setPersistentFolder(cacheFolder.string());
+
+	ASSERT_EQ(cache.get(key), nullptr);
+	ASSERT_EQ(cache.getStats().diskHits, 0);
+	ASSERT_FALSE(std::filesystem::exists(persistedPath));
+
+	std::filesystem::remove_all(cacheFolder);
+}
+
+TEST(IO_AssetCache, PersistedAssetBiggerThanCapacityIsNotKeptInMemory)
+{
+	const auto cacheFolder = std::filesystem::temp_directory_path() / "GameLib_Tests_AssetCache_Capacity";
+	std::filesystem::remove_all(cacheFolder);
+
+	const auto asset = makeAsset(200, 0x3Cu);
+	const auto key = makeKey(7u, asset);
+
+	{
+		AssetCache cache { 1024 };
+		cache.setPersistentFolder(cacheFolder.string());
+		cache.put(key, asset.data(), asset.size());
+	}
+
+	AssetCache cache { 100 };
+	cache.setPersistentFolder(cacheFolder.string());
+
+	ASSERT_TRUE(isSameAsset(cache.get(key), asset));
+	ASSERT_EQ(cache.getStats().diskHits, 1);
+	ASSERT_EQ(cache.getStats().entriesCount, 0);
+	ASSERT_EQ(cache.getStats().bytes, 0);
+
+	std::filesystem::remove_all(cacheFolder);
+}
+
+TEST(IO_AssetCache, PersistentFolderIsLimitedBySize)
+{
+	const auto cacheFolder = std::filesystem::temp_directory_path() / "GameLib_Tests_AssetCache_Limit";
+	std::filesystem::remove_all(cacheFolder);
+
+	const auto first = makeAsset(100, 0x01u);
+	const auto second = makeAsset(100, 0x02u);
+	const auto third = makeAsset(100, 0x03u);
+
+	AssetCache cache { 1024 };
+	cache.setPersistentFolder(cacheFolder.string());
+	cache.setPersistentSizeLimit(250);
+
+	cache.put(makeKey(1u, first), first.data(), first.size());
+	cache.put(makeKey(1u, second), second.data(), second.size());
+	ASSERT_EQ(countAssets(cacheFolder), 2);
+
+	// First asset is the least recently used one
+	const auto now = std::filesystem::file_time_type::clock::now();
+	for (const auto &entry : std::filesystem::directory_iterator(cacheFolder))
+	{
+		const bool isFirst = std::ifstream(entry.path(), std::ios::binary).get() == first[0];
+		std::filesystem::last_write_time(entry.path(), now - std::chrono::hours(isFirst ? 2 : 1));
+	}
+
+	cache.put(makeKey(1u, third), third.data(), third.size());
+	ASSERT_EQ(countAssets(cacheFolder), 2);
+
+	cache.clear();
+	ASSERT_EQ(cache.get(makeKey(1u, first)), nullptr);
+	ASSERT_TRUE(isSameAsset(cache.get(makeKey(1u, second)), second));
+	ASSERT_TRUE(isSameAsset(cache.get(makeKey(1u, third)), third));
+
+	std::filesystem::remove_all(cacheFolder);
+}
+
+TEST(IO_AssetCache, ConcurrentWritersOfSameAssetDontClash)
+{
+	const auto cacheFolder = std::filesystem::temp_directory_path() / "GameLib_Tests_AssetCache_Concurrent";
+	std::filesystem::remove_all(cacheFolder);
+
+	constexpr int kWritersCount = 8;
+	const auto asset = makeAsset(256 * 1024, 0x5Au);
+
+	// Each writer has own cache, so all of them may find the asset missing and write it at once
+	std::vector<std::thread> writers;
+	for (int writerIndex = 0; writerIndex < kWritersCount; ++writerIndex)
+	{
+		writers.emplace_back([&cacheFolder, &asset]()
+		{
+			AssetCache cache { 1024 * 1024 };
+			cache.setPersistentFolder(cacheFolder.string());
+			cache.put(makeKey(1u, asset), asset.data(), asset.size());
+		});
+	}
+
+	for (auto &writer : writers)
+	{
+		writer.join();
+	}
+
+	// Only the asset is left (no temporary files) and it's complete
+	ASSERT_EQ(countAssets(cacheFolder), 1);
+	ASSERT_EQ(std::distance(std::filesystem::directory_iterator(cacheFolder), std::filesystem::directory_iterator {}), 1);
+
+	AssetCache reader { 1024 * 1024 };
+	reader.setPersistentFolder(cacheFolder.string());
+	ASSERT_TRUE(isSameAsset(reader.get(makeKey(1u, asset)), asset));
+
+	std::filesystem::remove_all(cacheFolder);
+}
\ No newline at end of file
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <GameLib/IO/DeflateCodec.h>
+#include <zlib.h>
+#include <cstdint>
+#include <vector>
+
+// Usage
+using gamelib::Span;
+using gamelib::io::DeflateCodec;
+using gamelib::io::DeflateOptions;
+
+// Helpers
+namespace
+{
+	/**
+	 * Compressible data with repeated records and noise (like vertex buffers)
+	 */
+	std::vector<uint8_t> makeData(std::size_t size)
+	{
+		std::vector<uint8_t> data(size);
+		std::uint32_t seed = 0x1234567u;
+
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			seed = seed * 1103515245u + 12345u;
+			data[i] = (i % 64 < 48) ? static_cast<uint8_t>(i % 48) : static_cast<uint8_t>(seed >> 24);
+		}
+
+		return data;
+	}
+
+	/**
+	 * Regular zlib stream inflate (the same way as any ZIP reader does)
+	 */
+	bool inflateByZlib(const std::vector<uint8_t> &compressed, std::vector<uint8_t> &output)
+	{
+		z_stream stream {};
+		if (inflateInit2(&stream, -15) != Z_OK)
+		{
+			return false;
+		}
+
+		stream.next_in = const_cast<uint8_t *>(compressed.data());
+		stream.avail_in = static_cast<uInt>(compressed.size());
+		stream.next_out = output.data();
+		stream.avail_out = static_cast<uInt>(output.size());
+
+		const int status = inflate(&stream, Z_FINISH);
+		inflateEnd(&stream);
+		return status == Z_STREAM_END && stream.avail_out == 0;
+	}
+}
+
+// Tests
+TEST(IO_DeflateCodec, BlocksAreSingleDeflateStream)
+{
+	const auto data = makeData(1024 * 1024 + 123);
+
+	DeflateOptions options;
+	options.blockSize = 64 * 1024;
+	options.threadsCount = 4;
+
+	std::vector<uint8_t> compressed;
+	std::uint32_t crc = 0;
+	ASSERT_TRUE(DeflateCodec::compress(Span(data), compressed, crc, options));
+	ASSERT_LT(compressed.size(), data.size() / 2);
+	ASSERT_EQ(crc, static_cast<std::uint32_t>(crc32(0L, data.data(), static_cast<uInt>(data.size()))));
+	ASSERT_EQ(crc, DeflateCodec::computeCRC32(Span(data)));
+
+	std::vector<uint8_t> restored(data.size());
+	ASSERT_TRUE(inflateByZlib(compressed, restored));
+	ASSERT_EQ(restored, data);
+
+	std::vector<uint8_t> restoredByCodec(data.size());
+	ASSERT_TRUE(DeflateCodec::decompress(Span(compressed), restoredByCodec.data(), restoredByCodec.size()));
+	ASSERT_EQ(restoredByCodec, data);
+}
+
+TEST(IO_DeflateCodec, RatioIsCloseToSingleBlock)
+{
+	const auto data = makeData(512 * 1024);
+
+	DeflateOptions singleBlock;
+	singleBlock.blockSize = data.size();
+
+	DeflateOptions smallBlocks;
+	smallBlocks.blockSize = 32 * 1024;
+
+	std::vector<uint8_t> single, blocks;
+	std::uint32_t singleCRC = 0, blocksCRC = 0;
+	ASSERT_TRUE(DeflateCodec::compress(Span(data), single, singleCRC, singleBlock));
+	ASSERT_TRUE(DeflateCodec::compress(Span(data), blocks, blocksCRC, smallBlocks));
+	ASSERT_EQ(singleCRC, blocksCRC);
+
+	// Each block is primed by previous one, only flush markers & block headers are added
+	ASSERT_LT(blocks.size(), single.size() + single.size() / 20);
+}
+
+TEST(IO_DeflateCodec, BrokenOrShortStreamIsRejected)
+{
+	const auto data = makeData(100000);
+
+	std::vector<uint8_t> compressed;
+	std::uint32_t crc = 0;
+	ASSERT_TRUE(DeflateCodec::compress(Span(data), compressed, crc));
+
+	std::vector<uint8_t> output(data.size());
+	ASSERT_FALSE(DeflateCodec::decompress(Span(compressed.data(), static_cast<int64_t>(compressed.size() / 2)), output.data(), output.size()));
+	ASSERT_FALSE(DeflateCodec::decompress(Span(compressed), output.data(), output.size() - 1));
+
+	// Empty input is a valid (empty) stream
+	std::vector<uint8_t> empty;
+	ASSERT_TRUE(DeflateCodec::compress(Span(empty), compressed, crc));
+	ASSERT_EQ(crc, 0u);
+	ASSERT_TRUE(DeflateCodec::decompress(Span(compressed), output.data(), 0));
+}
\ No newline at end of file
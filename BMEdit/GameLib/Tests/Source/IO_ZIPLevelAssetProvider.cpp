@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+
+#include <Include/IO/ZIPLevelAssetProvider.h>
+#include <GameLib/IO/DeflateCodec.h>
+#include <GameLib/IO/AssetCache.h>
+#include <filesystem>
+#include <cstdint>
+#include <vector>
+
+extern "C"
+{
+#include <zip.h>
+}
+
+// Usage
+using gamelib::Span;
+using gamelib::io::AssetKind;
+using gamelib::io::AssetCache;
+using gamelib::io::DeflateCodec;
+using editor::ZIPCompressionBackend;
+using editor::ZIPLevelAssetProvider;
+
+// Helpers
+namespace
+{
+	constexpr const char *kEntryName = "TEST.PRM";
+
+	/**
+	 * Compressible data with repeated records and noise (like vertex buffers), big enough for parallel codec
+	 */
+	std::vector<uint8_t> makeData()
+	{
+		std::vector<uint8_t> data(static_cast<std::size_t>(ZIPLevelAssetProvider::kParallelCodecThreshold) + 12345u);
+		std::uint32_t seed = 0x1234567u;
+
+		for (std::size_t i = 0; i < data.size(); ++i)
+		{
+			seed = seed * 1103515245u + 12345u;
+			data[i] = (i % 64 < 48) ? static_cast<uint8_t>(i % 48) : static_cast<uint8_t>(seed >> 24);
+		}
+
+		return data;
+	}
+
+	/**
+	 * Write archive with single entry by libzip (deflated by libzip itself)
+	 */
+	bool writeArchive(const std::filesystem::path &path, const std::vector<uint8_t> &data)
+	{
+		int errorCode = 0;
+		zip_t *archive = zip_open(path.string().c_str(), ZIP_CREATE | ZIP_TRUNCATE, &errorCode);
+		if (!archive)
+		{
+			return false;
+		}
+
+		zip_source_t *source = zip_source_buffer(archive, data.data(), data.size(), 0);
+		const zip_int64_t entryIndex = source ? zip_file_add(archive, kEntryName, source, ZIP_FL_ENC_UTF_8) : -1;
+		if (entryIndex < 0)
+		{
+			zip_source_free(source);
+			zip_discard(archive);
+			return false;
+		}
+
+		zip_set_file_compression(archive, entryIndex, ZIP_CM_DEFLATE, 0);
+		return zip_close(archive) == 0;
+	}
+
+	/**
+	 * Read the entry by libzip (inflated by libzip itself)
+	 */
+	bool readArchive(const std::filesystem::path &path, zip_stat_t &entryInfo, std::vector<uint8_t> &data)
+	{
+		int errorCode = 0;
+		zip_t *archive = zip_open(path.string().c_str(), ZIP_RDONLY, &errorCode);
+		if (!archive)
+		{
+			return false;
+		}
+
+		bool isOk = false;
+		zip_stat_init(&entryInfo);
+
+		if (zip_stat(archive, kEntryName, 0, &entryInfo) == 0)
+		{
+			data.resize(entryInfo.size);
+
+			if (zip_file_t *file = zip_fopen(archive, kEntryName, 0))
+			{
+				isOk = zip_fread(file, data.data(), data.size()) == static_cast<zip_int64_t>(data.size());
+				zip_fclose(file);
+			}
+		}
+
+		zip_discard(archive);
+		return isOk;
+	}
+}
+
+// Fixture
+class IO_ZIPLevelAssetProviderTest : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		m_archivePath = std::filesystem::temp_directory_path() / "GameLib_Tests_ZIPLevelAssetProvider.zip";
+		std::filesystem::remove(m_archivePath);
+
+		// Assets must be inflated by provider, not taken from cache
+		m_assetCacheCapacity = AssetCache::getInstance().getCapacity();
+		AssetCache::getInstance().setCapacity(0);
+		ZIPLevelAssetProvider::setCompressionBackend(ZIPCompressionBackend::ZCB_PARALLEL);
+	}
+
+	void TearDown() override
+	{
+		ZIPLevelAssetProvider::setCompressionBackend(ZIPCompressionBackend::ZCB_LIBZIP);
+		AssetCache::getInstance().setCapacity(m_assetCacheCapacity);
+		std::filesystem::remove(m_archivePath);
+	}
+
+	std::filesystem::path m_archivePath {};
+	std::size_t m_assetCacheCapacity { 0 };
+};
+
+// Tests
+TEST_F(IO_ZIPLevelAssetProviderTest, ParallelDeflatedEntryIsReadByLibzip)
+{
+	const auto data = makeData();
+	const std::vector<uint8_t> placeholder(16, 0u);
+	ASSERT_TRUE(writeArchive(m_archivePath, placeholder));
+
+	// Provider deflates asset by blocks, libzip stores stream as is (archive is written when provider is destroyed)
+	{
+		ZIPLevelAssetProvider provider { m_archivePath.string() };
+		ASSERT_TRUE(provider.isValid());
+		ASSERT_TRUE(provider.saveAsset(AssetKind::GEOMETRY, Span(data)));
+	}
+
+	zip_stat_t entryInfo;
+	std::vector<uint8_t> restored;
+	ASSERT_TRUE(readArchive(m_archivePath, entryInfo, restored));
+
+	ASSERT_EQ(entryInfo.comp_method, ZIP_CM_DEFLATE);
+	ASSERT_EQ(entryInfo.size, data.size());
+	ASSERT_LT(entryInfo.comp_size, data.size());
+	ASSERT_EQ(entryInfo.crc, DeflateCodec::computeCRC32(Span(data)));
+	ASSERT_EQ(DeflateCodec::computeCRC32(Span(restored)), entryInfo.crc);
+	ASSERT_EQ(restored, data);
+}
+
+TEST_F(IO_ZIPLevelAssetProviderTest, LibzipDeflatedEntryIsReadByParallelInflate)
+{
+	const auto data = makeData();
+	ASSERT_TRUE(writeArchive(m_archivePath, data));
+
+	zip_stat_t entryInfo;
+	std::vector<uint8_t> expected;
+	ASSERT_TRUE(readArchive(m_archivePath, entryInfo, expected));
+	ASSERT_EQ(entryInfo.comp_method, ZIP_CM_DEFLATE);
+	ASSERT_EQ(entryInfo.crc, DeflateCodec::computeCRC32(Span(data)));
+	ASSERT_EQ(expected, data);
+
+	// Provider reads raw stream and inflates it at once
+	ZIPLevelAssetProvider provider { m_archivePath.string() };
+	ASSERT_TRUE(provider.isValid());
+
+	int64_t bufferSize = 0;
+	const auto buffer = provider.getAsset(AssetKind::GEOMETRY, bufferSize);
+	ASSERT_NE(buffer, nullptr);
+	ASSERT_EQ(static_cast<std::uint64_t>(bufferSize), entryInfo.size);
+	ASSERT_EQ(static_cast<std::size_t>(bufferSize), data.size());
+
+	const Span<uint8_t> restored { buffer.get(), bufferSize };
+	ASSERT_EQ(DeflateCodec::computeCRC32(restored), entryInfo.crc);
+	ASSERT_TRUE(std::equal(data.begin(), data.end(), restored.cbegin()));
+}
\ No newline at end of file
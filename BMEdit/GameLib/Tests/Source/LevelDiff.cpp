@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <GameLib/LevelDiff.h>
+#include <GameLib/PRP/PRPZDefines.h>
+#include <GameLib/Value.h>
+#include <TestDiffScene.h>
+#include <utility>
+
+// Usage
+using gamelib::Value;
+using gamelib::DiffKind;
+using gamelib::LevelDiff;
+using gamelib::ObjectDiff;
+using gamelib::scene::SceneObject;
+using gamelib::prp::PRPOpCode;
+using gamelib::prp::PRPOperandVal;
+using gamelib::prp::PRPInstruction;
+using gamelib::prp::PRPDefinition;
+using gamelib::prp::PRPDefinitionType;
+using gamelib::prp::PRPZDefines;
+using tests::makeScene;
+using tests::makeValue;
+
+// Helpers
+namespace
+{
+	const ObjectDiff *findObject(const LevelDiff &diff, const std::string &path)
+	{
+		for (const auto &object : diff.getObjects())
+		{
+			if (object.path == path)
+			{
+				return &object;
+			}
+		}
+
+		return nullptr;
+	}
+}
+
+// Tests
+TEST(LevelDiff, SameScenesHaveNoDifference)
+{
+	const auto oldScene = makeScene({ { "Lamp", { { "PrimId", 1 } } }, { "Door", { { "PrimId", 2 } } } });
+	const auto newScene = makeScene({ { "Lamp", { { "PrimId", 1 } } }, { "Door", { { "PrimId", 2 } } } });
+
+	const auto diff = LevelDiff::compare(oldScene, newScene);
+	ASSERT_TRUE(diff.empty());
+	ASSERT_EQ(diff.getUnchangedObjectsCount(), 3);
+}
+
+TEST(LevelDiff, ObjectsAndPropertiesAreReported)
+{
+	const auto oldScene = makeScene({ { "Lamp", { { "PrimId", 1 }, { "Flags", 0 } } }, { "Door", { { "PrimId", 2 } } }, { "Chair", { { "PrimId", 3 } } } });
+	const auto newScene = makeScene({ { "Lamp", { { "PrimId", 10 }, { "Radius", 5 } } }, { "Chair", { { "PrimId", 3 } } }, { "Table", { { "PrimId", 4 } } } });
+
+	const auto diff = LevelDiff::compare(oldScene, newScene);
+	ASSERT_EQ(diff.getObjectsCount(DiffKind::DK_ADDED), 1);
+	ASSERT_EQ(diff.getObjectsCount(DiffKind::DK_REMOVED), 1);
+	ASSERT_EQ(diff.getObjectsCount(DiffKind::DK_CHANGED), 2); // ROOT (children) & Lamp (properties)
+	ASSERT_EQ(diff.getUnchangedObjectsCount(), 1);
+
+	const auto *root = findObject(diff, "ROOT");
+	ASSERT_NE(root, nullptr);
+	ASSERT_TRUE(root->isChildrenChanged);
+	ASSERT_TRUE(root->properties.empty());
+
+	ASSERT_EQ(findObject(diff, "ROOT\\Door")->kind, DiffKind::DK_REMOVED);
+	ASSERT_EQ(findObject(diff, "ROOT\\Table")->kind, DiffKind::DK_ADDED);
+
+	const auto *lamp = findObject(diff, "ROOT\\Lamp");
+	ASSERT_NE(lamp, nullptr);
+	ASSERT_FALSE(lamp->isParentChanged);
+	ASSERT_FALSE(lamp->isChildrenChanged);
+	ASSERT_EQ(lamp->properties.size(), 3);
+
+	ASSERT_EQ(lamp->properties[0].kind, DiffKind::DK_CHANGED);
+	ASSERT_EQ(lamp->properties[0].name, "PrimId");
+	ASSERT_EQ(lamp->properties[0].oldValue[0].getOperand().get<int32_t>(), 1);
+	ASSERT_EQ(lamp->properties[0].newValue[0].getOperand().get<int32_t>(), 10);
+	ASSERT_EQ(lamp->properties[1].kind, DiffKind::DK_REMOVED);
+	ASSERT_EQ(lamp->properties[1].name, "Flags");
+	ASSERT_EQ(lamp->properties[2].kind, DiffKind::DK_ADDED);
+	ASSERT_EQ(lamp->properties[2].name, "Radius");
+}
+
+TEST(LevelDiff, ControllersAreComparedByName)
+{
+	auto oldScene = makeScene({ { "Guard", { { "PrimId", 1 } } } });
+	auto newScene = makeScene({ { "Guard", { { "PrimId", 1 } } } });
+
+	oldScene[1]->getControllers().push_back(SceneObject::Controller { "CPatrol", makeValue({ { "Speed", 1 } }) });
+	newScene[1]->getControllers().push_back(SceneObject::Controller { "CPatrol", makeValue({ { "Speed", 2 } }) });
+	newScene[1]->getControllers().push_back(SceneObject::Controller { "CAlarm", makeValue({ { "Delay", 3 } }) });
+
+	const auto diff = LevelDiff::compare(oldScene, newScene);
+	ASSERT_EQ(diff.getObjects().size(), 1);
+
+	const auto &guard = diff.getObjects().front();
+	ASSERT_EQ(guard.path, "ROOT\\Guard");
+	ASSERT_EQ(guard.properties.size(), 2);
+	ASSERT_EQ(guard.properties[0].kind, DiffKind::DK_CHANGED);
+	ASSERT_EQ(guard.properties[0].name, "CPatrol.Speed");
+	ASSERT_EQ(guard.properties[1].kind, DiffKind::DK_ADDED);
+	ASSERT_EQ(guard.properties[1].name, "CAlarm");
+}
+
+TEST(LevelDiff, DefinitionsAreComparedByNameAndValue)
+{
+	PRPZDefines oldDefinitions;
+	oldDefinitions.getDefinitions().emplace_back("Lives", PRPDefinitionType::Array_Int32, gamelib::prp::ArrayI32 { 3 });
+	oldDefinitions.getDefinitions().emplace_back("Speed", PRPDefinitionType::Array_Float32, gamelib::prp::ArrayF32 { 1.f });
+	oldDefinitions.getDefinitions().emplace_back("Title", PRPDefinitionType::StringRef_1, gamelib::prp::StringRef { "Hitman" });
+
+	PRPZDefines newDefinitions;
+	newDefinitions.getDefinitions().emplace_back("Title", PRPDefinitionType::StringRef_1, gamelib::prp::StringRef { "Hitman" });
+	newDefinitions.getDefinitions().emplace_back("Lives", PRPDefinitionType::Array_Int32, gamelib::prp::ArrayI32 { 5 });
+	newDefinitions.getDefinitions().emplace_back("Names", PRPDefinitionType::StringRefTab, gamelib::prp::StringRefTab { "A", "B" });
+
+	// Same definitions have no difference
+	ASSERT_TRUE(LevelDiff::compareDefinitions(oldDefinitions, oldDefinitions).empty());
+
+	const auto diffs = LevelDiff::compareDefinitions(oldDefinitions, newDefinitions);
+	ASSERT_EQ(diffs.size(), 3);
+	ASSERT_EQ(diffs[0].kind, DiffKind::DK_CHANGED);
+	ASSERT_EQ(diffs[0].name, "Lives");
+	ASSERT_EQ(diffs[1].kind, DiffKind::DK_REMOVED);
+	ASSERT_EQ(diffs[1].name, "Speed");
+	ASSERT_EQ(diffs[2].kind, DiffKind::DK_ADDED);
+	ASSERT_EQ(diffs[2].name, "Names");
+}
\ No newline at end of file
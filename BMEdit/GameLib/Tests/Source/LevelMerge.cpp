@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <GameLib/LevelMerge.h>
+#include <GameLib/Value.h>
+#include <TestDiffScene.h>
+#include <utility>
+
+// Usage
+using gamelib::Value;
+using gamelib::LevelDiff;
+using gamelib::LevelMerge;
+using gamelib::MergeConflictKind;
+using gamelib::scene::SceneObject;
+using gamelib::prp::PRPOpCode;
+using gamelib::prp::PRPOperandVal;
+using gamelib::prp::PRPInstruction;
+using tests::makeScene;
+using tests::makeValue;
+
+// Helpers
+namespace
+{
+	std::int32_t getProperty(const Value &value, std::string_view name)
+	{
+		const auto &entry = value.getEntries()[value.getEntryIndex(name)];
+		return value.getInstructions()[entry.instructions.offset()].getOperand().get<int32_t>();
+	}
+}
+
+// Tests
+TEST(LevelMerge, NonConflictingChangesAreMerged)
+{
+	const auto base = makeScene({ { "Lamp", { { "PrimId", 1 }, { "Flags", 0 } } }, { "Door", { { "PrimId", 2 } } } });
+	const auto ours = makeScene({ { "Lamp", { { "PrimId", 5 }, { "Flags", 0 } } }, { "Door", { { "PrimId", 2 } } } });
+	const auto theirs = makeScene({ { "Lamp", { { "PrimId", 1 }, { "Flags", 7 } } }, { "Door", { { "PrimId", 9 } } } });
+
+	const auto merge = LevelMerge::merge(base, ours, theirs);
+	ASSERT_FALSE(merge.hasConflicts());
+	ASSERT_EQ(merge.getChanges().size(), 2);
+
+	std::vector<gamelib::MergeConflict> failedChanges;
+	ASSERT_EQ(merge.apply(ours, failedChanges), 2);
+	ASSERT_TRUE(failedChanges.empty());
+
+	ASSERT_EQ(getProperty(ours[1]->getProperties(), "PrimId"), 5);
+	ASSERT_EQ(getProperty(ours[1]->getProperties(), "Flags"), 7);
+	ASSERT_EQ(getProperty(ours[2]->getProperties(), "PrimId"), 9);
+
+	// Only change of ours left
+	const auto diff = LevelDiff::compare(theirs, ours);
+	ASSERT_EQ(diff.getObjects().size(), 1);
+	ASSERT_EQ(diff.getObjects()[0].path, "ROOT\\Lamp");
+	ASSERT_EQ(diff.getObjects()[0].properties.size(), 1);
+	ASSERT_EQ(diff.getObjects()[0].properties[0].name, "PrimId");
+}
+
+TEST(LevelMerge, ConflictsAreReported)
+{
+	const auto base = makeScene({ { "Lamp", { { "PrimId", 1 }, { "Flags", 0 } } }, { "Door", { { "PrimId", 2 } } } });
+	const auto ours = makeScene({ { "Lamp", { { "PrimId", 5 }, { "Flags", 3 } } }, { "Door", { { "PrimId", 4 } } } });
+	const auto theirs = makeScene({ { "Lamp", { { "PrimId", 6 }, { "Flags", 3 } } }, { "Table", { { "PrimId", 8 } } } });
+
+	const auto merge = LevelMerge::merge(base, ours, theirs);
+	ASSERT_TRUE(merge.getChanges().empty());
+	ASSERT_EQ(merge.getAlreadyMergedCount(), 1); // Flags
+
+	const auto &conflicts = merge.getConflicts();
+	auto findConflict = [&conflicts](const std::string &path) -> const gamelib::MergeConflict *
+	{
+		const auto it = std::find_if(conflicts.begin(), conflicts.end(), [&path](const auto &conflict) { return conflict.path == path; });
+		return it != conflicts.end() ? &(*it) : nullptr;
+	};
+
+	const auto *lamp = findConflict("ROOT\\Lamp");
+	ASSERT_NE(lamp, nullptr);
+	ASSERT_EQ(lamp->kind, MergeConflictKind::MCK_PROPERTY);
+	ASSERT_EQ(lamp->property, "PrimId");
+	ASSERT_EQ(lamp->baseValue[0].getOperand().get<int32_t>(), 1);
+	ASSERT_EQ(lamp->oursValue[0].getOperand().get<int32_t>(), 5);
+	ASSERT_EQ(lamp->theirsValue[0].getOperand().get<int32_t>(), 6);
+
+	ASSERT_EQ(findConflict("ROOT\\Door")->kind, MergeConflictKind::MCK_REMOVED_OBJECT);
+	ASSERT_EQ(findConflict("ROOT\\Table")->kind, MergeConflictKind::MCK_STRUCTURE);
+	ASSERT_EQ(findConflict("ROOT")->kind, MergeConflictKind::MCK_STRUCTURE); // Children of ROOT changed
+
+	// Nothing is applied
+	std::vector<gamelib::MergeConflict> failedChanges;
+	ASSERT_EQ(merge.apply(ours, failedChanges), 0);
+	ASSERT_TRUE(failedChanges.empty());
+	ASSERT_EQ(getProperty(ours[1]->getProperties(), "PrimId"), 5);
+}
+
+TEST(LevelMerge, ControllerEntriesAreMerged)
+{
+	const auto base = makeScene({ { "Guard", { { "PrimId", 1 } } } });
+	const auto ours = makeScene({ { "Guard", { { "PrimId", 1 } } } });
+	const auto theirs = makeScene({ { "Guard", { { "PrimId", 1 } } } });
+
+	base[1]->getControllers().push_back(SceneObject::Controller { "CPatrol", makeValue({ { "Speed", 1 }, { "Delay", 2 } }) });
+	ours[1]->getControllers().push_back(SceneObject::Controller { "CPatrol", makeValue({ { "Speed", 1 }, { "Delay", 5 } }) });
+	theirs[1]->getControllers().push_back(SceneObject::Controller { "CPatrol", makeValue({ { "Speed", 3 }, { "Delay", 2 } }) });
+
+	const auto merge = LevelMerge::merge(base, ours, theirs);
+	ASSERT_FALSE(merge.hasConflicts());
+	ASSERT_EQ(merge.getChanges().size(), 1);
+	ASSERT_EQ(merge.getChanges()[0].controller, "CPatrol");
+
+	std::vector<gamelib::MergeConflict> failedChanges;
+	ASSERT_EQ(merge.apply(ours, failedChanges), 1);
+	ASSERT_TRUE(failedChanges.empty());
+
+	const auto &patrol = ours[1]->getControllers()[0].properties;
+	ASSERT_EQ(getProperty(patrol, "Speed"), 3);
+	ASSERT_EQ(getProperty(patrol, "Delay"), 5);
+}
+
+TEST(LevelMerge, FailedChangesAreReported)
+{
+	const auto base = makeScene({ { "Lamp", { { "PrimId", 1 } } }, { "Guard", { { "PrimId", 2 } } }, { "Door", { { "PrimId", 3 } } } });
+	const auto ours = makeScene({ { "Lamp", { { "PrimId", 1 } } }, { "Guard", { { "PrimId", 2 } } }, { "Door", { { "PrimId", 3 } } } });
+	const auto theirs = makeScene({ { "Lamp", { { "PrimId", 4 } } }, { "Guard", { { "PrimId", 2 } } }, { "Door", { { "PrimId", 5 } } } });
+
+	base[2]->getControllers().push_back(SceneObject::Controller { "CPatrol", makeValue({ { "Speed", 1 } }) });
+	ours[2]->getControllers().push_back(SceneObject::Controller { "CPatrol", makeValue({ { "Speed", 1 } }) });
+	theirs[2]->getControllers().push_back(SceneObject::Controller { "CPatrol", makeValue({ { "Speed", 6 } }) });
+
+	const auto merge = LevelMerge::merge(base, ours, theirs);
+	ASSERT_FALSE(merge.hasConflicts());
+	ASSERT_EQ(merge.getChanges().size(), 3);
+
+	// Ours is changed after merge: property of Lamp and controller of Guard are gone
+	ours[1]->getProperties() = makeValue({ { "Flags", 0 } });
+	ours[2]->getControllers().clear();
+
+	std::vector<gamelib::MergeConflict> failedChanges;
+	ASSERT_EQ(merge.apply(ours, failedChanges), 1);
+	ASSERT_EQ(getProperty(ours[3]->getProperties(), "PrimId"), 5);
+
+	ASSERT_EQ(failedChanges.size(), 2);
+	ASSERT_EQ(failedChanges[0].kind, MergeConflictKind::MCK_NOT_APPLIED);
+	ASSERT_EQ(failedChanges[0].path, "ROOT\\Lamp");
+	ASSERT_EQ(failedChanges[0].property, "PrimId");
+	ASSERT_EQ(failedChanges[0].theirsValue[0].getOperand().get<int32_t>(), 4);
+	ASSERT_EQ(failedChanges[1].kind, MergeConflictKind::MCK_NOT_APPLIED);
+	ASSERT_EQ(failedChanges[1].path, "ROOT\\Guard");
+	ASSERT_EQ(failedChanges[1].property, "CPatrol.Speed");
+}
\ No newline at end of file
@@ -0,0 +1,275 @@
+#include <gtest/gtest.h>
+
+#include <GameLib/IO/IOLevelAssetsProvider.h>
+#include <GameLib/LevelSnapshot.h>
+#include <GameLib/TypeRegistry.h>
+#include <GameLib/TypeArray.h>
+#include <GameLib/Level.h>
+#include <SyntheticLevel.h>
+#include <filesystem>
+#include <fstream>
+#include <cstring>
+
+// Usage
+using gamelib::Level;
+using gamelib::LevelSnapshot;
+using gamelib::LevelSnapshotCache;
+using gamelib::TypeArray;
+using gamelib::TypeRegistry;
+using gamelib::prp::PRPOpCode;
+using gamelib::scene::SceneObject;
+using bench::SyntheticLevel;
+using bench::SyntheticLevelOptions;
+using bench::SyntheticLevelAssetsProvider;
+
+// Helpers
+namespace
+{
+	class EmptyAssetsProvider : public gamelib::io::IOLevelAssetsProvider
+	{
+	public:
+		explicit EmptyAssetsProvider(std::uint64_t contentHash) : m_contentHash(contentHash)
+		{
+		}
+
+		[[nodiscard]] const std::string &getLevelName() const override { return m_name; }
+		[[nodiscard]] std::unique_ptr<uint8_t[]> getAsset(gamelib::io::AssetKind, int64_t &bufferSize) const override { bufferSize = 0; return nullptr; }
+		[[nodiscard]] bool hasAssetOfKind(gamelib::io::AssetKind) const override { return false; }
+		bool saveAsset(gamelib::io::AssetKind, gamelib::Span<uint8_t>) override { return false; }
+		[[nodiscard]] bool isValid() const override { return true; }
+		[[nodiscard]] bool isEditable() const override { return false; }
+		[[nodiscard]] std::uint64_t getContentHash() const override { return m_contentHash; }
+
+	private:
+		std::string m_name { "EMPTY" };
+		std::uint64_t m_contentHash { 0 };
+	};
+
+	SyntheticLevel makeSyntheticLevel(std::uint32_t groupsCount)
+	{
+		SyntheticLevelOptions options;
+		options.groupsCount = groupsCount;
+		options.objectsPerGroup = 8;
+		options.controllersInterval = 3;
+		options.primitivesCount = 8;
+		return bench::generateLevel(options);
+	}
+
+	void writeFile(const std::filesystem::path &path, std::size_t size)
+	{
+		std::ofstream file { path, std::ios::binary };
+		const std::vector<char> body(size, 'S');
+		file.write(body.data(), static_cast<std::streamsize>(body.size()));
+	}
+
+	void expectSameValue(const gamelib::Value &restored, const gamelib::Value &original)
+	{
+		ASSERT_EQ(restored, original); // Type, instructions, entries & views
+		ASSERT_EQ(restored.getEntriesIndex() != nullptr, original.getEntriesIndex() != nullptr);
+
+		for (const auto &entry : original.getEntries())
+		{
+			ASSERT_EQ(restored.getEntryIndex(entry.name), original.getEntryIndex(entry.name));
+		}
+	}
+}
+
+// Fixture
+class LevelSnapshotTest : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		TypeRegistry::getInstance().reset();
+		TypeRegistry::getInstance().registerType(std::make_unique<TypeArray>("ZVector3F", PRPOpCode::Float32, 3));
+
+		m_cacheFolder = std::filesystem::temp_directory_path() / "GameLib_LevelSnapshotTest";
+		std::filesystem::remove_all(m_cacheFolder);
+	}
+
+	void TearDown() override
+	{
+		std::filesystem::remove_all(m_cacheFolder);
+		TypeRegistry::getInstance().reset();
+	}
+
+	std::filesystem::path m_cacheFolder {};
+};
+
+// Tests
+TEST_F(LevelSnapshotTest, TypesHashFollowsRegistry)
+{
+	const auto typesHash = TypeRegistry::getInstance().getTypesHash();
+	ASSERT_NE(typesHash, 0);
+
+	TypeRegistry::getInstance().registerType(std::make_unique<TypeArray>("ZMatrix33F", PRPOpCode::Float32, 9));
+	ASSERT_NE(TypeRegistry::getInstance().getTypesHash(), typesHash);
+
+	TypeRegistry::getInstance().reset();
+	ASSERT_EQ(TypeRegistry::getInstance().getTypesHash(), 0);
+
+	TypeRegistry::getInstance().registerType(std::make_unique<TypeArray>("ZVector3F", PRPOpCode::Float32, 3));
+	ASSERT_EQ(TypeRegistry::getInstance().getTypesHash(), typesHash);
+}
+
+TEST_F(LevelSnapshotTest, UnknownLevelIsNotCached)
+{
+	Level level { std::make_unique<EmptyAssetsProvider>(0) };
+	LevelSnapshotCache cache { m_cacheFolder.string() };
+
+	ASSERT_TRUE(cache.getSnapshotPath(level).empty());
+	ASSERT_FALSE(cache.load(level));
+	ASSERT_FALSE(cache.save(level));
+	ASSERT_FALSE(std::filesystem::exists(m_cacheFolder));
+}
+
+TEST_F(LevelSnapshotTest, BrokenSnapshotIsRejected)
+{
+	Level level { std::make_unique<EmptyAssetsProvider>(0xB0BAu) };
+	LevelSnapshotCache cache { m_cacheFolder.string() };
+
+	// Level is not loaded, nothing to save
+	std::vector<uint8_t> buffer;
+	ASSERT_FALSE(LevelSnapshot::write(level, buffer));
+	ASSERT_FALSE(cache.save(level));
+
+	const auto snapshotPath = cache.getSnapshotPath(level);
+	ASSERT_FALSE(snapshotPath.empty());
+
+	// Valid magic & version, but garbage instead of sections
+	buffer.assign(512, 0xCDu);
+	std::memcpy(buffer.data(), &LevelSnapshot::kMagic, sizeof(LevelSnapshot::kMagic));
+	std::memcpy(buffer.data() + sizeof(LevelSnapshot::kMagic), &LevelSnapshot::kVersion, sizeof(LevelSnapshot::kVersion));
+	ASSERT_FALSE(LevelSnapshot::read(level, gamelib::Span<uint8_t>(buffer)));
+
+	std::filesystem::create_directories(m_cacheFolder);
+	{
+		std::ofstream file { snapshotPath, std::ios::binary };
+		file.write(reinterpret_cast<const char *>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+	}
+
+	ASSERT_FALSE(cache.load(level));
+	ASSERT_TRUE(level.getSceneObjects().empty());
+	ASSERT_EQ(level.getLevelProperties(), nullptr);
+}
+
+TEST_F(LevelSnapshotTest, RestoredLevelIsSameAsLoaded)
+{
+	bench::registerSyntheticTypes();
+	const auto synthetic = makeSyntheticLevel(2);
+	const LevelSnapshotCache cache { m_cacheFolder.string() };
+
+	// First load is from assets, it saves snapshot
+	Level original { std::make_unique<SyntheticLevelAssetsProvider>(&synthetic) };
+	ASSERT_TRUE(original.loadSceneData(cache));
+	ASSERT_FALSE(original.isLoadedFromSnapshot());
+	ASSERT_TRUE(std::filesystem::exists(cache.getSnapshotPath(original)));
+
+	Level restored { std::make_unique<SyntheticLevelAssetsProvider>(&synthetic) };
+	ASSERT_TRUE(restored.loadSceneData(cache));
+	ASSERT_TRUE(restored.isLoadedFromSnapshot());
+
+	// Properties
+	ASSERT_EQ(restored.getLevelProperties()->rawProperties, original.getLevelProperties()->rawProperties);
+	ASSERT_EQ(restored.getLevelProperties()->ZDefines.getDefinitions().size(), original.getLevelProperties()->ZDefines.getDefinitions().size());
+	ASSERT_EQ(restored.getLevelProperties()->objectsCount, original.getLevelProperties()->objectsCount);
+
+	// Scene objects
+	const auto &originalObjects = original.getSceneObjects();
+	const auto &restoredObjects = restored.getSceneObjects();
+	ASSERT_EQ(restoredObjects.size(), originalObjects.size());
+
+	std::size_t controllersCount = 0;
+
+	for (std::size_t objectIndex = 0; objectIndex < originalObjects.size(); ++objectIndex)
+	{
+		const SceneObject &originalObject = *originalObjects[objectIndex];
+		const SceneObject &restoredObject = *restoredObjects[objectIndex];
+
+		ASSERT_EQ(restoredObject.getName(), originalObject.getName());
+		ASSERT_EQ(restoredObject.getTypeId(), originalObject.getTypeId());
+		ASSERT_EQ(restoredObject.getType(), originalObject.getType());
+		expectSameValue(restoredObject.getProperties(), originalObject.getProperties());
+
+		ASSERT_EQ(restoredObject.getControllers().size(), originalObject.getControllers().size());
+		for (std::size_t controllerIndex = 0; controllerIndex < originalObject.getControllers().size(); ++controllerIndex)
+		{
+			ASSERT_EQ(restoredObject.getControllers()[controllerIndex].name, originalObject.getControllers()[controllerIndex].name);
+			expectSameValue(restoredObject.getControllers()[controllerIndex].properties, originalObject.getControllers()[controllerIndex].properties);
+			++controllersCount;
+		}
+
+		ASSERT_EQ(restoredObject.getChildren().size(), originalObject.getChildren().size());
+		ASSERT_EQ(restoredObject.getSiblingIndex(), originalObject.getSiblingIndex());
+
+		const auto originalParent = originalObject.getParent().lock();
+		const auto restoredParent = restoredObject.getParent().lock();
+		ASSERT_EQ(restoredParent != nullptr, originalParent != nullptr);
+		if (originalParent)
+		{
+			ASSERT_EQ(restoredParent->getName(), originalParent->getName());
+		}
+	}
+
+	ASSERT_GT(controllersCount, 0);
+
+	// Geometry
+	const auto &originalChunks = original.getLevelGeometry()->chunks;
+	const auto &restoredChunks = restored.getLevelGeometry()->chunks;
+	ASSERT_EQ(restoredChunks.size(), originalChunks.size());
+
+	for (std::size_t chunkIndex = 0; chunkIndex < originalChunks.size(); ++chunkIndex)
+	{
+		const auto originalBody = originalChunks[chunkIndex].getBuffer();
+		const auto restoredBody = restoredChunks[chunkIndex].getBuffer();
+		ASSERT_EQ(restoredBody.size(), originalBody.size());
+		ASSERT_TRUE(std::equal(originalBody.cbegin(), originalBody.cend(), restoredBody.cbegin()));
+	}
+
+	// Snapshot of restored level is the same
+	std::vector<uint8_t> originalSnapshot;
+	std::vector<uint8_t> restoredSnapshot;
+	ASSERT_TRUE(LevelSnapshot::write(original, originalSnapshot));
+	ASSERT_TRUE(LevelSnapshot::write(restored, restoredSnapshot));
+	ASSERT_EQ(restoredSnapshot, originalSnapshot);
+}
+
+TEST_F(LevelSnapshotTest, FolderIsLimitedBySize)
+{
+	std::filesystem::create_directories(m_cacheFolder);
+
+	// Two old snapshots and not a snapshot file
+	const auto oldestPath = m_cacheFolder / "0000000000000001.bmsnap";
+	const auto olderPath = m_cacheFolder / "0000000000000002.bmsnap";
+	const auto otherPath = m_cacheFolder / "notes.txt";
+	writeFile(oldestPath, 4096);
+	writeFile(olderPath, 4096);
+	writeFile(otherPath, 4096);
+
+	const auto now = std::filesystem::file_time_type::clock::now();
+	std::filesystem::last_write_time(oldestPath, now - std::chrono::hours(2));
+	std::filesystem::last_write_time(olderPath, now - std::chrono::hours(1));
+
+	bench::registerSyntheticTypes();
+	const auto synthetic = makeSyntheticLevel(1);
+	Level level { std::make_unique<SyntheticLevelAssetsProvider>(&synthetic) };
+
+	// Limit fits new snapshot and one more file: the oldest one is removed
+	std::vector<uint8_t> snapshot;
+	ASSERT_TRUE(level.loadSceneData());
+	ASSERT_TRUE(LevelSnapshot::write(level, snapshot));
+
+	const LevelSnapshotCache cache { m_cacheFolder.string(), snapshot.size() + 4096 };
+	ASSERT_TRUE(cache.save(level));
+
+	ASSERT_TRUE(std::filesystem::exists(cache.getSnapshotPath(level)));
+	ASSERT_FALSE(std::filesystem::exists(oldestPath));
+	ASSERT_TRUE(std::filesystem::exists(olderPath));
+	ASSERT_TRUE(std::filesystem::exists(otherPath));
+
+	// New snapshot is kept even when it doesn't fit
+	const LevelSnapshotCache tinyCache { m_cacheFolder.string(), 1 };
+	ASSERT_TRUE(tinyCache.save(level));
+	ASSERT_TRUE(std::filesystem::exists(tinyCache.getSnapshotPath(level)));
+	ASSERT_FALSE(std::filesystem::exists(olderPath));
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+
+#include <GameLib/MemoryReport.h>
+#include <string>
+
+// Usage
+using gamelib::MemoryReport;
+using gamelib::MemoryCategory;
+using gamelib::prp::PRPOpCode;
+using gamelib::prp::PRPOperandVal;
+using gamelib::prp::PRPInstruction;
+
+// Tests
+TEST(MemoryReport, SmallStringsAreNotCounted)
+{
+	MemoryReport report;
+	report.addString(MemoryCategory::SCENE_OBJECT_NAMES, std::string("Short"));
+
+	ASSERT_EQ(report.get(MemoryCategory::SCENE_OBJECT_NAMES).bytes, 0);
+	ASSERT_EQ(report.get(MemoryCategory::SCENE_OBJECT_NAMES).allocations, 0);
+
+	const std::string longName(256, 'A');
+	report.addString(MemoryCategory::SCENE_OBJECT_NAMES, longName);
+
+	ASSERT_GT(report.get(MemoryCategory::SCENE_OBJECT_NAMES).bytes, longName.size());
+	ASSERT_EQ(report.get(MemoryCategory::SCENE_OBJECT_NAMES).allocations, 1);
+}
+
+TEST(MemoryReport, InstructionsAndOperandsAreSplit)
+{
+	std::vector<PRPInstruction> instructions;
+	instructions.emplace_back(PRPOpCode::Int32, PRPOperandVal(42));
+	instructions.emplace_back(PRPOpCode::String, PRPOperandVal(std::string(128, 'B')));
+	instructions.shrink_to_fit();
+
+	MemoryReport report;
+	report.addInstructions(MemoryCategory::PROPERTIES_INSTRUCTIONS, MemoryCategory::PROPERTIES_OPERANDS, instructions);
+
+	ASSERT_EQ(report.get(MemoryCategory::PROPERTIES_INSTRUCTIONS).bytes, 2 * sizeof(PRPInstruction));
+	ASSERT_EQ(report.get(MemoryCategory::PROPERTIES_INSTRUCTIONS).allocations, 1);
+	ASSERT_GE(report.get(MemoryCategory::PROPERTIES_OPERANDS).bytes, 128);
+	ASSERT_EQ(report.get(MemoryCategory::PROPERTIES_OPERANDS).allocations, 1);
+
+	const auto total = report.getTotal();
+	ASSERT_EQ(total.allocations, 2);
+	ASSERT_EQ(total.bytes, report.get(MemoryCategory::PROPERTIES_INSTRUCTIONS).bytes + report.get(MemoryCategory::PROPERTIES_OPERANDS).bytes);
+}
\ No newline at end of file
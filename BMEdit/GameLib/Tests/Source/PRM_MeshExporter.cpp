@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#include <GameLib/PRM/PRMMeshExporter.h>
+#include <GameLib/Value.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+
+// Usage
+using gamelib::Value;
+using gamelib::Vector3;
+using gamelib::prm::PRMChunk;
+using gamelib::prm::PRMExportFormat;
+using gamelib::prm::PRMMeshExporter;
+using gamelib::prp::PRPOpCode;
+using gamelib::prp::PRPOperandVal;
+using gamelib::prp::PRPInstruction;
+using gamelib::scene::SceneObject;
+
+// Helpers
+namespace
+{
+	/**
+	 * Chunks of single primitive:
+	 *   #0 - zero chunk
+	 *   #1 - description chunk (objects table is #2)
+	 *   #2 - objects table (one mesh, #3)
+	 *   #3 - mesh (vertex buffer #4, index buffer #5)
+	 *   #4 - vertex buffer: (1, 0, 0), (2, 0, 0), (1, 0, 1)
+	 *   #5 - index buffer: one triangle
+	 */
+	std::vector<PRMChunk> makeChunks()
+	{
+		std::vector<std::vector<uint8_t>> bodies(6);
+		bodies[0] = std::vector<uint8_t>(0x10, 0u);
+		bodies[1] = std::vector<uint8_t>(0x40, 0u);
+		bodies[1][0x18] = 2;
+		bodies[2] = { 3, 0, 0, 0 };
+		bodies[3] = { 4, 0, 0, 0, 5, 0, 0, 0 };
+		bodies[5] = { 0, 0, 3, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0 };
+
+		// 3 vertices of 36 bytes (position is the first)
+		const float positions[3][3] = { { 1.f, 0.f, 0.f }, { 2.f, 0.f, 0.f }, { 1.f, 0.f, 1.f } };
+		bodies[4].resize(3 * 36, 0u);
+		for (int i = 0; i < 3; ++i)
+		{
+			std::memcpy(bodies[4].data() + i * 36, positions[i], sizeof(positions[i]));
+		}
+
+		std::vector<PRMChunk> chunks;
+		for (std::size_t i = 0; i < bodies.size(); ++i)
+		{
+			auto buffer = std::make_unique<uint8_t[]>(bodies[i].size());
+			std::memcpy(buffer.get(), bodies[i].data(), bodies[i].size());
+			chunks.emplace_back(static_cast<std::uint32_t>(i), static_cast<int>(bodies.size()), std::move(buffer), bodies[i].size());
+		}
+
+		return chunks;
+	}
+
+	Value makeFloats(std::initializer_list<float> values)
+	{
+		std::vector<PRPInstruction> instructions;
+		for (const auto value : values)
+		{
+			instructions.emplace_back(PRPOpCode::Float32, PRPOperandVal(value));
+		}
+
+		return Value(nullptr, std::move(instructions));
+	}
+
+	SceneObject::Ptr addObject(std::vector<SceneObject::Ptr> &objects, const std::string &name, int parentIndex)
+	{
+		auto &object = objects.emplace_back(std::make_shared<SceneObject>(name, 0u, nullptr, gamelib::gms::GMSGeomEntity {}, SceneObject::Instructions {}));
+
+		if (parentIndex >= 0)
+		{
+			object->setParent(objects[parentIndex]);
+			objects[parentIndex]->addChild(object);
+		}
+
+		return object;
+	}
+
+	/**
+	 * ROOT
+	 *   Group (rotated by 90 degrees around Z, Position = (10, 0, 0))
+	 *     Crate (PrimId = 1, Position = (1, 0, 0) relative to Group)
+	 */
+	std::vector<SceneObject::Ptr> makeNestedScene()
+	{
+		std::vector<SceneObject::Ptr> objects;
+		addObject(objects, "ROOT", -1);
+
+		auto group = addObject(objects, "Group", 0);
+		group->getProperties() += std::make_pair(std::string("Matrix"), makeFloats({ 0.f, -1.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f }));
+		group->getProperties() += std::make_pair(std::string("Position"), makeFloats({ 10.f, 0.f, 0.f }));
+
+		auto crate = addObject(objects, "Crate", 1);
+		crate->getProperties() += std::make_pair(std::string("PrimId"), Value(nullptr, { PRPInstruction(PRPOpCode::Int32, PRPOperandVal(1)) }));
+		crate->getProperties() += std::make_pair(std::string("Position"), makeFloats({ 1.f, 0.f, 0.f }));
+
+		return objects;
+	}
+
+	std::vector<Vector3> readOBJVertices(const std::filesystem::path &path)
+	{
+		std::vector<Vector3> vertices;
+		std::ifstream file(path);
+		std::string line;
+
+		while (std::getline(file, line))
+		{
+			if (line.rfind("v ", 0) == 0)
+			{
+				std::istringstream stream(line.substr(2));
+				auto &vertex = vertices.emplace_back();
+				stream >> vertex.x >> vertex.y >> vertex.z;
+			}
+		}
+
+		return vertices;
+	}
+}
+
+// Tests
+TEST(PRM, MeshExporter_NestedGeomIsPlacedByWorldTransform)
+{
+	const auto chunks = makeChunks();
+	const auto objects = makeNestedScene();
+
+	const auto entries = PRMMeshExporter::collectGeoms(objects, chunks);
+	ASSERT_EQ(entries.size(), 1);
+	ASSERT_EQ(entries[0].name, "Crate");
+	ASSERT_EQ(entries[0].primitiveIndex, 1);
+
+	// Local position of Crate is rotated by Group and moved by its position
+	ASSERT_FLOAT_EQ(entries[0].position.x, 10.f);
+	ASSERT_FLOAT_EQ(entries[0].position.y, 1.f);
+	ASSERT_FLOAT_EQ(entries[0].position.z, 0.f);
+	ASSERT_EQ(entries[0].rotation, (std::array<float, 9> { 0.f, -1.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f }));
+
+	const auto outputPath = std::filesystem::temp_directory_path() / "GameLib_Tests_MeshExporter.obj";
+
+	PRMMeshExporter::Options options;
+	options.format = PRMExportFormat::EF_WAVEFRONT_OBJ;
+
+	PRMMeshExporter::Stats stats;
+	ASSERT_TRUE(PRMMeshExporter::exportToFile(chunks, entries, options, outputPath.string(), &stats));
+	ASSERT_EQ(stats.exportedEntries, 1);
+	ASSERT_EQ(stats.trianglesCount, 1);
+
+	// (1, 0, 0) -> (10, 2, 0), (2, 0, 0) -> (10, 3, 0), (1, 0, 1) -> (10, 2, 1)
+	const auto vertices = readOBJVertices(outputPath);
+	std::filesystem::remove(outputPath);
+
+	ASSERT_EQ(vertices.size(), 3);
+	ASSERT_FLOAT_EQ(vertices[0].x, 10.f);
+	ASSERT_FLOAT_EQ(vertices[0].y, 2.f);
+	ASSERT_FLOAT_EQ(vertices[0].z, 0.f);
+	ASSERT_FLOAT_EQ(vertices[1].x, 10.f);
+	ASSERT_FLOAT_EQ(vertices[1].y, 3.f);
+	ASSERT_FLOAT_EQ(vertices[2].z, 1.f);
+}
+
+TEST(PRM, MeshExporter_GLBSharesPrimitiveBetweenNodes)
+{
+	const auto chunks = makeChunks();
+	auto entries = PRMMeshExporter::collectPrimitives(chunks);
+	ASSERT_EQ(entries.size(), 1);
+
+	auto moved = entries[0];
+	moved.name = "Moved";
+	moved.position = Vector3 { 5.f, 0.f, 0.f };
+	entries.push_back(moved);
+
+	const auto outputPath = std::filesystem::temp_directory_path() / "GameLib_Tests_MeshExporter.glb";
+
+	PRMMeshExporter::Stats stats;
+	ASSERT_TRUE(PRMMeshExporter::exportToFile(chunks, entries, {}, outputPath.string(), &stats));
+	ASSERT_EQ(stats.exportedEntries, 2);
+	ASSERT_EQ(stats.encodedPrimitives, 1);
+	ASSERT_EQ(std::filesystem::file_size(outputPath), stats.bytesWritten);
+	ASSERT_FALSE(std::filesystem::exists(outputPath.string() + ".bin.part"));
+
+	std::filesystem::remove(outputPath);
+}
\ No newline at end of file
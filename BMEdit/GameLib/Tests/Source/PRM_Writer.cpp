@@ -0,0 +1,234 @@
+#include <gtest/gtest.h>
+
+#include <GameLib/PRM/PRMReader.h>
+#include <GameLib/PRM/PRMWriter.h>
+#include <GameLib/PRM/PRMChunkIndex.h>
+#include <GameLib/Level.h>
+#include <cstring>
+
+// Usage
+using gamelib::LevelGeometry;
+using gamelib::prm::PRMReader;
+using gamelib::prm::PRMWriter;
+using gamelib::prm::PRMWriterLayout;
+using gamelib::prm::PRMWriterOptions;
+using gamelib::prm::PRMChunkIndex;
+using gamelib::prm::PRMChunkRecognizedKind;
+
+// Helpers
+namespace
+{
+	using Body = std::vector<uint8_t>;
+
+	void writeU32(std::vector<uint8_t> &buffer, size_t offset, uint32_t value)
+	{
+		for (int i = 0; i < 4; ++i)
+		{
+			buffer[offset + i] = static_cast<uint8_t>((value >> (i * 8)) & 0xFFu);
+		}
+	}
+
+	/**
+	 * Chunks which are recognized by PRMChunk:
+	 *   #0 - zero chunk
+	 *   #1 - description chunk (objects table is #2)
+	 *   #2, #3, #4 - vertex buffers
+	 *   #5 - index buffer
+	 */
+	std::vector<Body> makeBodies()
+	{
+		std::vector<Body> bodies(6);
+		bodies[0] = Body(0x10, 0u);
+		bodies[1] = Body(0x40, 0u);
+		bodies[1][0x18] = 2; // ptrObjects
+		bodies[2] = Body(0x20, 1u);
+		bodies[3] = Body(0x30, 2u);
+		bodies[4] = Body(0x6C, 1u);
+		bodies[5] = { 0, 0, 3, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0 };
+		return bodies;
+	}
+
+	/**
+	 * Build PRM file like the game does: header, aligned bodies, descriptors table.
+	 * When reversed is true bodies are placed in reverse order and the table is placed before them.
+	 */
+	std::vector<uint8_t> makePRMFile(const std::vector<Body> &bodies, uint32_t alignment, bool reversed)
+	{
+		auto alignUp = [alignment](size_t value) { return (value + alignment - 1) / alignment * alignment; };
+
+		std::vector<uint8_t> file(0x10, 0u);
+		std::vector<uint32_t> offsets(bodies.size(), 0u);
+		const uint32_t tableSize = static_cast<uint32_t>(bodies.size() * 0x10);
+		uint32_t tableOffset = 0u;
+
+		if (reversed)
+		{
+			tableOffset = static_cast<uint32_t>(alignUp(file.size()));
+			file.resize(tableOffset + tableSize, 0u);
+		}
+
+		for (size_t i = 0; i < bodies.size(); ++i)
+		{
+			const size_t chunkIndex = reversed ? (bodies.size() - 1 - i) : i;
+			offsets[chunkIndex] = static_cast<uint32_t>(alignUp(file.size()));
+			file.resize(offsets[chunkIndex], 0u);
+			file.insert(file.end(), bodies[chunkIndex].begin(), bodies[chunkIndex].end());
+		}
+
+		if (!reversed)
+		{
+			tableOffset = static_cast<uint32_t>(alignUp(file.size()));
+			file.resize(tableOffset + tableSize, 0u);
+		}
+
+		writeU32(file, 0x0, tableOffset);
+		writeU32(file, 0x4, static_cast<uint32_t>(bodies.size()));
+		writeU32(file, 0x8, tableOffset);
+
+		for (size_t i = 0; i < bodies.size(); ++i)
+		{
+			const size_t descriptorOffset = tableOffset + i * 0x10;
+			writeU32(file, descriptorOffset + 0x0, offsets[i]);
+			writeU32(file, descriptorOffset + 0x4, static_cast<uint32_t>(bodies[i].size()));
+			writeU32(file, descriptorOffset + 0x8, static_cast<uint32_t>(i % 3));
+			writeU32(file, descriptorOffset + 0xC, 0xCDCDCDCDu);
+		}
+
+		return file;
+	}
+
+	bool readGeometry(std::vector<uint8_t> &file, LevelGeometry &geometry)
+	{
+		PRMReader reader { geometry.header, geometry.chunkDescriptors, geometry.chunks };
+		return reader.read(gamelib::Span<uint8_t>(file.data(), static_cast<int64_t>(file.size())));
+	}
+
+	bool isSameBody(const gamelib::prm::PRMChunk &chunk, const Body &body)
+	{
+		const auto buffer = chunk.getBuffer();
+		return buffer.size() == static_cast<int64_t>(body.size()) && (body.empty() || std::memcmp(buffer.cbegin(), body.data(), body.size()) == 0);
+	}
+}
+
+// Our tests
+TEST(PRM, Writer_RoundTripIsByteIdentical)
+{
+	for (const bool reversed : { false, true })
+	{
+		for (const uint32_t alignment : { 0x10u, 0x20u, 0x800u })
+		{
+			auto source = makePRMFile(makeBodies(), alignment, reversed);
+
+			LevelGeometry geometry;
+			ASSERT_TRUE(readGeometry(source, geometry)) << "Failed to read PRM";
+			ASSERT_EQ(geometry.chunks.size(), 6);
+
+			std::vector<uint8_t> result;
+			PRMWriter::write(geometry.header, geometry.chunkDescriptors, geometry.chunks, PRMWriterOptions {}, result);
+
+			ASSERT_EQ(result.size(), source.size()) << "Alignment " << alignment << (reversed ? " (reversed)" : "");
+			ASSERT_TRUE(result == source) << "Alignment " << alignment << (reversed ? " (reversed)" : "");
+		}
+	}
+}
+
+TEST(PRM, Writer_SequentialLayoutIsAligned)
+{
+	const auto bodies = makeBodies();
+	auto source = makePRMFile(bodies, 0x20u, true);
+
+	LevelGeometry geometry;
+	ASSERT_TRUE(readGeometry(source, geometry));
+	ASSERT_EQ(PRMWriter::detectAlignment(geometry.chunkDescriptors), 0x20u);
+
+	PRMWriterOptions options;
+	options.layout = PRMWriterLayout::WL_SEQUENTIAL;
+
+	std::vector<uint8_t> result;
+	PRMWriter::write(geometry.header, geometry.chunkDescriptors, geometry.chunks, options, result);
+
+	// Same layout as generated by makePRMFile with the same alignment
+	ASSERT_TRUE(result == makePRMFile(bodies, 0x20u, false));
+}
+
+TEST(PRM, Writer_DeduplicatedChunksShareBody)
+{
+	auto bodies = makeBodies();
+	bodies.push_back(bodies[4]); // #6 is a copy of #4
+	bodies.push_back(bodies[5]); // #7 is a copy of #5
+
+	auto source = makePRMFile(bodies, 0x10u, false);
+
+	LevelGeometry geometry;
+	ASSERT_TRUE(readGeometry(source, geometry));
+
+	PRMChunkIndex index;
+	index.build(geometry.chunks, 2);
+
+	ASSERT_EQ(index.getDuplicateChunksCount(), 2);
+	ASSERT_EQ(index.getReclaimableBytes(), bodies[4].size() + bodies[5].size());
+	ASSERT_EQ(index.getCanonicalChunk(6), 4);
+	ASSERT_EQ(index.getCanonicalChunk(7), 5);
+	ASSERT_EQ(index.findChunk(geometry.chunks, geometry.chunks[7].getBuffer()), 5);
+
+	PRMWriterOptions options;
+	options.layout = PRMWriterLayout::WL_SEQUENTIAL;
+	options.deduplicationIndex = &index;
+
+	std::vector<uint8_t> result;
+	PRMWriter::write(geometry.header, geometry.chunkDescriptors, geometry.chunks, options, result);
+	ASSERT_LT(result.size(), source.size());
+
+	LevelGeometry deduplicated;
+	ASSERT_TRUE(readGeometry(result, deduplicated));
+	ASSERT_EQ(deduplicated.chunks.size(), bodies.size());
+	ASSERT_EQ(deduplicated.chunkDescriptors[6].declarationOffset, deduplicated.chunkDescriptors[4].declarationOffset);
+	ASSERT_EQ(deduplicated.chunkDescriptors[7].declarationOffset, deduplicated.chunkDescriptors[5].declarationOffset);
+
+	for (size_t i = 0; i < bodies.size(); ++i)
+	{
+		ASSERT_TRUE(isSameBody(deduplicated.chunks[i], bodies[i])) << "Chunk #" << i;
+		ASSERT_EQ(deduplicated.chunkDescriptors[i].declarationKind, geometry.chunkDescriptors[i].declarationKind);
+		ASSERT_EQ(deduplicated.chunkDescriptors[i].unkC, geometry.chunkDescriptors[i].unkC);
+	}
+}
+
+TEST(PRM, Writer_CompactionKeepsReachableChunks)
+{
+	const auto bodies = makeBodies();
+	auto source = makePRMFile(bodies, 0x10u, false);
+
+	LevelGeometry geometry;
+	ASSERT_TRUE(readGeometry(source, geometry));
+
+	std::vector<bool> isUsed;
+	PRMWriter::collectUsedChunks(geometry.chunks, isUsed);
+	ASSERT_EQ(isUsed, std::vector<bool>({ true, true, true, false, false, false }));
+
+	PRMWriterOptions options;
+	options.layout = PRMWriterLayout::WL_SEQUENTIAL;
+	options.compactUnusedChunks = true;
+
+	std::vector<uint8_t> result;
+	PRMWriter::write(geometry.header, geometry.chunkDescriptors, geometry.chunks, options, result);
+	ASSERT_LT(result.size(), source.size());
+
+	LevelGeometry compacted;
+	ASSERT_TRUE(readGeometry(result, compacted));
+	ASSERT_EQ(compacted.chunks.size(), bodies.size()) << "Indices of chunks must be kept";
+
+	for (size_t i = 0; i < bodies.size(); ++i)
+	{
+		if (isUsed[i])
+		{
+			ASSERT_TRUE(isSameBody(compacted.chunks[i], bodies[i])) << "Chunk #" << i;
+		}
+		else
+		{
+			ASSERT_EQ(compacted.chunks[i].getKind(), PRMChunkRecognizedKind::CRK_INDEX_BUFFER) << "Chunk #" << i;
+			ASSERT_EQ(compacted.chunkDescriptors[i].declarationOffset, compacted.chunkDescriptors[3].declarationOffset);
+			ASSERT_EQ(compacted.chunkDescriptors[i].declarationKind, geometry.chunkDescriptors[0].declarationKind) << "Placeholder must not keep kind of original chunk";
+			ASSERT_EQ(compacted.chunkDescriptors[i].unkC, geometry.chunkDescriptors[0].unkC);
+		}
+	}
+}
\ No newline at end of file
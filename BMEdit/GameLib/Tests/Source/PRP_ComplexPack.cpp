@@ -17,6 +17,8 @@
 #include <GameLib/TypeAlias.h>
 #include <GameLib/TypeComplex.h>
 #include <GameLib/TypeRegistry.h>
+#include <algorithm>
+#include <stdexcept>
 
 // Usage
 using gamelib::Span;
@@ -35,6 +37,28 @@ using gamelib::prp::PRPOpCode;
 using gamelib::scene::SceneObject;
 using gamelib::scene::SceneObjectPropertiesLoader;
 
+// Helpers
+namespace
+{
+	bool hasController(const SceneObject::Ptr &object, const std::string &name)
+	{
+		const auto &controllers = object->getControllers();
+		return std::find(controllers.begin(), controllers.end(), name) != controllers.end();
+	}
+
+	const gamelib::Value &getController(const SceneObject::Ptr &object, const std::string &name)
+	{
+		const auto &controllers = object->getControllers();
+		const auto it = std::find(controllers.begin(), controllers.end(), name);
+		if (it == controllers.end())
+		{
+			throw std::out_of_range("Controller not found");
+		}
+
+		return it->properties;
+	}
+}
+
 
 class PRP_ComplexPack : public ::testing::Test
 {
@@ -235,7 +259,7 @@ TEST_F(PRP_ComplexPack, TrivialDecl)
 
 	ASSERT_TRUE(sceneObjects[0]->getControllers().empty());
 
-	ASSERT_EQ(sceneObjects[0]->getProperties().getEntries().size, 6);
+	ASSERT_EQ(sceneObjects[0]->getProperties().getEntries().size(), 6);
 
 	auto stdobjType = TypeRegistry::getInstance().findTypeByName("ZSTDOBJ");
 	ASSERT_NE(stdobjType, nullptr);
@@ -255,7 +279,7 @@ TEST_F(PRP_ComplexPack, TrivialDecl)
 	ASSERT_NE(pEBoundingBoxType, nullptr);
 
 	const auto& entries = sceneObjects[0]->getProperties().getEntries();
-	ASSERT_EQ(entries.size, 6);
+	ASSERT_EQ(entries.size(), 6);
 
 	ASSERT_EQ(entries[0].instructions.size(), 1);
 	ASSERT_EQ(entries[0].views.size(), 1);
@@ -387,16 +411,16 @@ TEST_F(PRP_ComplexPack, DeclWithController)
 	ASSERT_NO_THROW(SceneObjectPropertiesLoader::load(Span(sceneObjects), ip));
 
 	// I think there no need to check properties, we will check only controllers here
-	ASSERT_TRUE(sceneObjects[0]->getControllers().contains("Inventory"));
+	ASSERT_TRUE(hasController(sceneObjects[0], "Inventory"));
 
 	const Type *inventory = TypeRegistry::getInstance().findTypeByShortName("Inventory");
 	ASSERT_NE(inventory, nullptr);
 
-	ASSERT_EQ(sceneObjects[0]->getControllers()["Inventory"].getType(), inventory);
-	ASSERT_EQ(sceneObjects[0]->getControllers()["Inventory"].getInstructions().size(), 1);
-	ASSERT_TRUE(sceneObjects[0]->getControllers()["Inventory"].getInstructions()[0].isTrivialValue());
-	ASSERT_EQ(sceneObjects[0]->getControllers()["Inventory"].getInstructions()[0].getOpCode(), PRPOpCode::Int32);
-	ASSERT_EQ(sceneObjects[0]->getControllers()["Inventory"].getInstructions()[0].getOperand().trivial.i32, 42);
+	ASSERT_EQ(getController(sceneObjects[0], "Inventory").getType(), inventory);
+	ASSERT_EQ(getController(sceneObjects[0], "Inventory").getInstructions().size(), 1);
+	ASSERT_TRUE(getController(sceneObjects[0], "Inventory").getInstructions()[0].isTrivialValue());
+	ASSERT_EQ(getController(sceneObjects[0], "Inventory").getInstructions()[0].getOpCode(), PRPOpCode::Int32);
+	ASSERT_EQ(getController(sceneObjects[0], "Inventory").getInstructions()[0].getOperand().trivial.i32, 42);
 }
 
 TEST_F(PRP_ComplexPack, DeclWithMultipleControllers)
@@ -497,8 +521,8 @@ TEST_F(PRP_ComplexPack, DeclWithMultipleControllers)
 	ASSERT_NO_THROW(SceneObjectPropertiesLoader::load(Span(sceneObjects), ip));
 
 	// I think there no need to check properties, we will check only controllers here
-	ASSERT_TRUE(sceneObjects[0]->getControllers().contains("Inventory"));
-	ASSERT_TRUE(sceneObjects[0]->getControllers().contains("Tie"));
+	ASSERT_TRUE(hasController(sceneObjects[0], "Inventory"));
+	ASSERT_TRUE(hasController(sceneObjects[0], "Tie"));
 
 	const Type *inventory = TypeRegistry::getInstance().findTypeByShortName("Inventory");
 	ASSERT_NE(inventory, nullptr);
@@ -506,20 +530,20 @@ TEST_F(PRP_ComplexPack, DeclWithMultipleControllers)
 	const Type *tie = TypeRegistry::getInstance().findTypeByShortName("Tie");
 	ASSERT_NE(tie, nullptr);
 
-	ASSERT_EQ(sceneObjects[0]->getControllers()["Inventory"].getType(), inventory);
-	ASSERT_EQ(sceneObjects[0]->getControllers()["Inventory"].getInstructions().size(), 1);
-	ASSERT_TRUE(sceneObjects[0]->getControllers()["Inventory"].getInstructions()[0].isTrivialValue());
-	ASSERT_EQ(sceneObjects[0]->getControllers()["Inventory"].getInstructions()[0].getOpCode(), PRPOpCode::Int32);
-	ASSERT_EQ(sceneObjects[0]->getControllers()["Inventory"].getInstructions()[0].getOperand().trivial.i32, 42);
-
-	ASSERT_EQ(sceneObjects[0]->getControllers()["Tie"].getType(), tie);
-	ASSERT_EQ(sceneObjects[0]->getControllers()["Tie"].getInstructions().size(), 2);
-	ASSERT_TRUE(sceneObjects[0]->getControllers()["Tie"].getInstructions()[0].isTrivialValue());
-	ASSERT_EQ(sceneObjects[0]->getControllers()["Tie"].getInstructions()[0].getOpCode(), PRPOpCode::Bool);
-	ASSERT_TRUE(sceneObjects[0]->getControllers()["Tie"].getInstructions()[0].getOperand().trivial.b);
-	ASSERT_TRUE(sceneObjects[0]->getControllers()["Tie"].getInstructions()[1].isTrivialValue());
-	ASSERT_EQ(sceneObjects[0]->getControllers()["Tie"].getInstructions()[1].getOpCode(), PRPOpCode::Int32);
-	ASSERT_EQ(sceneObjects[0]->getControllers()["Tie"].getInstructions()[1].getOperand().trivial.i32, 255);
+	ASSERT_EQ(getController(sceneObjects[0], "Inventory").getType(), inventory);
+	ASSERT_EQ(getController(sceneObjects[0], "Inventory").getInstructions().size(), 1);
+	ASSERT_TRUE(getController(sceneObjects[0], "Inventory").getInstructions()[0].isTrivialValue());
+	ASSERT_EQ(getController(sceneObjects[0], "Inventory").getInstructions()[0].getOpCode(), PRPOpCode::Int32);
+	ASSERT_EQ(getController(sceneObjects[0], "Inventory").getInstructions()[0].getOperand().trivial.i32, 42);
+
+	ASSERT_EQ(getController(sceneObjects[0], "Tie").getType(), tie);
+	ASSERT_EQ(getController(sceneObjects[0], "Tie").getInstructions().size(), 2);
+	ASSERT_TRUE(getController(sceneObjects[0], "Tie").getInstructions()[0].isTrivialValue());
+	ASSERT_EQ(getController(sceneObjects[0], "Tie").getInstructions()[0].getOpCode(), PRPOpCode::Bool);
+	ASSERT_TRUE(getController(sceneObjects[0], "Tie").getInstructions()[0].getOperand().trivial.b);
+	ASSERT_TRUE(getController(sceneObjects[0], "Tie").getInstructions()[1].isTrivialValue());
+	ASSERT_EQ(getController(sceneObjects[0], "Tie").getInstructions()[1].getOpCode(), PRPOpCode::Int32);
+	ASSERT_EQ(getController(sceneObjects[0], "Tie").getInstructions()[1].getOperand().trivial.i32, 255);
 }
 
 TEST_F(PRP_ComplexPack, UnexposedTypeDecl)
@@ -629,29 +653,29 @@ TEST_F(PRP_ComplexPack, UnexposedTypeDecl)
 	const Type *scriptC = TypeRegistry::getInstance().findTypeByShortName("ScriptC");
 	ASSERT_NE(scriptC, nullptr);
 
-	ASSERT_EQ(sceneObjects[0]->getControllers()["ScriptC"].getType(), scriptC);
-	ASSERT_EQ(sceneObjects[0]->getControllers()["ScriptC"].getInstructions().size(), 4);
+	ASSERT_EQ(getController(sceneObjects[0], "ScriptC").getType(), scriptC);
+	ASSERT_EQ(getController(sceneObjects[0], "ScriptC").getInstructions().size(), 4);
 
-	ASSERT_TRUE(sceneObjects[0]->getControllers()["ScriptC"].getInstructions()[0].isTrivialValue());
-	ASSERT_EQ(sceneObjects[0]->getControllers()["ScriptC"].getInstructions()[0].getOpCode(), PRPOpCode::String);
-	ASSERT_EQ(sceneObjects[0]->getControllers()["ScriptC"].getInstructions()[0].getOperand().str, "AllLevels\\GenericNPC");
+	ASSERT_TRUE(getController(sceneObjects[0], "ScriptC").getInstructions()[0].isTrivialValue());
+	ASSERT_EQ(getController(sceneObjects[0], "ScriptC").getInstructions()[0].getOpCode(), PRPOpCode::String);
+	ASSERT_EQ(getController(sceneObjects[0], "ScriptC").getInstructions()[0].getOperand().str, "AllLevels\\GenericNPC");
 
-	ASSERT_TRUE(sceneObjects[0]->getControllers()["ScriptC"].getInstructions()[1].isTrivialValue());
-	ASSERT_EQ(sceneObjects[0]->getControllers()["ScriptC"].getInstructions()[1].getOpCode(), PRPOpCode::Int32);
-	ASSERT_EQ(sceneObjects[0]->getControllers()["ScriptC"].getInstructions()[1].getOperand().trivial.i32, 95);
+	ASSERT_TRUE(getController(sceneObjects[0], "ScriptC").getInstructions()[1].isTrivialValue());
+	ASSERT_EQ(getController(sceneObjects[0], "ScriptC").getInstructions()[1].getOpCode(), PRPOpCode::Int32);
+	ASSERT_EQ(getController(sceneObjects[0], "ScriptC").getInstructions()[1].getOperand().trivial.i32, 95);
 
-	ASSERT_TRUE(sceneObjects[0]->getControllers()["ScriptC"].getInstructions()[2].isTrivialValue());
-	ASSERT_EQ(sceneObjects[0]->getControllers()["ScriptC"].getInstructions()[2].getOpCode(), PRPOpCode::Bool);
-	ASSERT_EQ(sceneObjects[0]->getControllers()["ScriptC"].getInstructions()[2].getOperand().trivial.b, false);
+	ASSERT_TRUE(getController(sceneObjects[0], "ScriptC").getInstructions()[2].isTrivialValue());
+	ASSERT_EQ(getController(sceneObjects[0], "ScriptC").getInstructions()[2].getOpCode(), PRPOpCode::Bool);
+	ASSERT_EQ(getController(sceneObjects[0], "ScriptC").getInstructions()[2].getOperand().trivial.b, false);
 
-	ASSERT_TRUE(sceneObjects[0]->getControllers()["ScriptC"].getInstructions()[3].isTrivialValue());
-	ASSERT_EQ(sceneObjects[0]->getControllers()["ScriptC"].getInstructions()[3].getOpCode(), PRPOpCode::Bool);
-	ASSERT_EQ(sceneObjects[0]->getControllers()["ScriptC"].getInstructions()[3].getOperand().trivial.b, true);
+	ASSERT_TRUE(getController(sceneObjects[0], "ScriptC").getInstructions()[3].isTrivialValue());
+	ASSERT_EQ(getController(sceneObjects[0], "ScriptC").getInstructions()[3].getOpCode(), PRPOpCode::Bool);
+	ASSERT_EQ(getController(sceneObjects[0], "ScriptC").getInstructions()[3].getOperand().trivial.b, true);
 
-	ASSERT_EQ(sceneObjects[0]->getControllers()["ScriptC"].getEntries().size, 1);
-	ASSERT_EQ(sceneObjects[0]->getControllers()["ScriptC"].getEntries()[0].name, "ScriptName");
-	ASSERT_EQ(sceneObjects[0]->getControllers()["ScriptC"].getEntries()[0].instructions.iSize, 1);
-	ASSERT_EQ(sceneObjects[0]->getControllers()["ScriptC"].getEntries()[0].instructions.iOffset, 0);
+	ASSERT_EQ(getController(sceneObjects[0], "ScriptC").getEntries().size(), 1);
+	ASSERT_EQ(getController(sceneObjects[0], "ScriptC").getEntries()[0].name, "ScriptName");
+	ASSERT_EQ(getController(sceneObjects[0], "ScriptC").getEntries()[0].instructions.iSize, 1);
+	ASSERT_EQ(getController(sceneObjects[0], "ScriptC").getEntries()[0].instructions.iOffset, 0);
 }
 
 TEST_F(PRP_ComplexPack, ObjectsHierarchySimple)
@@ -817,7 +841,7 @@ TEST_F(PRP_ComplexPack, ObjectsHierarchySimple)
 
 	{
 		const auto& entries = sceneObjects[0]->getProperties().getEntries();
-		ASSERT_EQ(entries.size, 6);
+		ASSERT_EQ(entries.size(), 6);
 
 		ASSERT_EQ(entries[0].instructions.size(), 1);
 		ASSERT_EQ(entries[0].views.size(), 1);
@@ -861,7 +885,7 @@ TEST_F(PRP_ComplexPack, ObjectsHierarchySimple)
 
 	{
 		const auto& entries = sceneObjects[1]->getProperties().getEntries();
-		ASSERT_EQ(entries.size, 5);
+		ASSERT_EQ(entries.size(), 5);
 
 		ASSERT_EQ(entries[0].instructions.size(), 1);
 		ASSERT_EQ(entries[0].views.size(), 1);
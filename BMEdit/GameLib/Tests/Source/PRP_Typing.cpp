@@ -150,7 +150,7 @@ TEST_F(PRP_Typing, SimpleTypeRecognition)
 	ASSERT_TRUE(value.has_value());
 
 	const auto& entries = value.value().getEntries();
-	ASSERT_EQ(entries.size, 5);
+	ASSERT_EQ(entries.size(), 5);
 
 	const Type* pVector3FType = TypeRegistry::getInstance().findTypeByName("ZVector3F");
 	const Type* pZMatrix33FType = TypeRegistry::getInstance().findTypeByName("ZMatrix33F");
@@ -184,7 +184,7 @@ TEST_F(PRP_Typing, SimpleTypeRecognition)
 	ASSERT_EQ(entries[4].views[0].getTrivialType(), PRPOpCode::Int32);
 
 	ASSERT_TRUE(newSpan);
-	ASSERT_EQ(newSpan.size, 1);
+	ASSERT_EQ(newSpan.size(), 1);
 	ASSERT_EQ(newSpan[0].getOpCode(), PRPOpCode::EndOfStream);
 }
 
@@ -263,7 +263,7 @@ TEST_F(PRP_Typing, TypeRecognitionWithInheritance)
 	ASSERT_TRUE(value.has_value());
 
 	const auto& entries = value->getEntries();
-	ASSERT_EQ(entries.size, 6);
+	ASSERT_EQ(entries.size(), 6);
 
 	ASSERT_EQ(entries[0].instructions.size(), 1);
 	ASSERT_EQ(entries[0].views.size(), 1);
@@ -305,7 +305,7 @@ TEST_F(PRP_Typing, TypeRecognitionWithInheritance)
 	ASSERT_EQ(entries[5].views[0].getOwnerType(), stdobjType);
 
 	ASSERT_TRUE(newSpan);
-	ASSERT_EQ(newSpan.size, 1);
+	ASSERT_EQ(newSpan.size(), 1);
 	ASSERT_EQ(newSpan[0].getOpCode(), PRPOpCode::EndOfStream);
 
 }
\ No newline at end of file
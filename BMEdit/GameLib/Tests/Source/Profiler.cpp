@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <GameLib/Profiler.h>
+#include <nlohmann/json.hpp>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+// Usage
+using gamelib::Profiler;
+using gamelib::ProfilerScope;
+
+// Helpers
+namespace
+{
+	struct ProfilerSession
+	{
+		ProfilerSession()
+		{
+			Profiler::getInstance().reset();
+			Profiler::getInstance().setEnabled(true);
+		}
+
+		~ProfilerSession()
+		{
+			Profiler::getInstance().setEnabled(false);
+			Profiler::getInstance().reset();
+		}
+	};
+}
+
+// Tests
+TEST(Profiler, NothingCollectedWhenDisabled)
+{
+	Profiler::getInstance().reset();
+	Profiler::getInstance().setEnabled(false);
+
+	{
+		ProfilerScope scope { "Disabled" };
+	}
+
+	GAMELIB_PROFILE_SCOPE("Disabled macro");
+	GAMELIB_PROFILE_COUNTER("Disabled counter", 1);
+
+	ASSERT_TRUE(Profiler::getInstance().getSummary().empty());
+}
+
+TEST(Profiler, SummaryAggregatesScopesAndCounters)
+{
+	ProfilerSession session;
+
+	for (int i = 0; i < 3; ++i)
+	{
+		ProfilerScope scope { "Fast" };
+	}
+
+	{
+		ProfilerScope scope { "Slow" };
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	}
+
+	Profiler::getInstance().addCounter("Bytes", 100);
+	Profiler::getInstance().addCounter("Bytes", 28);
+
+	const auto summary = Profiler::getInstance().getSummary();
+	ASSERT_EQ(summary.size(), 3);
+
+	// Slowest scope first, counters at the end
+	ASSERT_EQ(summary[0].name, "Slow");
+	ASSERT_EQ(summary[0].callsCount, 1);
+	ASSERT_GE(summary[0].totalMs, 4.0);
+	ASSERT_EQ(summary[1].name, "Fast");
+	ASSERT_EQ(summary[1].callsCount, 3);
+	ASSERT_TRUE(summary[2].isCounter);
+	ASSERT_EQ(summary[2].name, "Bytes");
+	ASSERT_EQ(summary[2].callsCount, 2);
+	ASSERT_EQ(summary[2].total, 128);
+}
+
+TEST(Profiler, ChromeTraceContainsAllEvents)
+{
+	ProfilerSession session;
+
+	{
+		ProfilerScope outer { "Outer" };
+		std::thread([]() { ProfilerScope inner { "Worker" }; }).join();
+	}
+
+	Profiler::getInstance().addCounter("Objects", 10);
+	Profiler::getInstance().addCounter("Objects", 5);
+
+	const auto tracePath = std::filesystem::temp_directory_path() / "GameLib_ProfilerTest.json";
+	ASSERT_TRUE(Profiler::getInstance().writeChromeTrace(tracePath.string()));
+
+	nlohmann::json trace;
+	{
+		std::ifstream file { tracePath };
+		trace = nlohmann::json::parse(file);
+	}
+	std::filesystem::remove(tracePath);
+
+	const auto &events = trace["traceEvents"];
+	ASSERT_EQ(events.size(), 4);
+
+	int scopesCount = 0;
+	for (const auto &event : events)
+	{
+		if (event["ph"] == "X")
+		{
+			++scopesCount;
+			ASSERT_TRUE(event.contains("dur"));
+		}
+	}
+
+	ASSERT_EQ(scopesCount, 2);
+	ASSERT_NE(events[0]["tid"], events[1]["tid"]); // Worker scope finished first on its own thread
+	ASSERT_EQ(events[3]["args"]["value"], 15); // Running total
+}
\ No newline at end of file
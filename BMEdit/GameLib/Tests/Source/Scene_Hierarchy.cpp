@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <GameLib/Scene/SceneObject.h>
+
+// Usage
+using gamelib::scene::SceneObject;
+
+// Helpers
+namespace
+{
+	void expectSiblingIndicesAreValid(const SceneObject::Ptr &parent)
+	{
+		for (std::size_t i = 0; i < parent->getChildren().size(); ++i)
+		{
+			auto child = parent->getChildren()[i].lock();
+			ASSERT_NE(child, nullptr);
+			ASSERT_EQ(child->getSiblingIndex(), static_cast<int>(i));
+		}
+	}
+}
+
+// Our tests
+TEST(Scene, SiblingIndexIsMaintainedOnStructuralEdits)
+{
+	auto root = std::make_shared<SceneObject>();
+	std::vector<SceneObject::Ptr> children;
+
+	for (int i = 0; i < 8; ++i)
+	{
+		children.push_back(std::make_shared<SceneObject>());
+		children.back()->setParent(root);
+		root->addChild(children.back());
+	}
+
+	ASSERT_EQ(root->getSiblingIndex(), SceneObject::kNoSiblingIndex);
+	expectSiblingIndicesAreValid(root);
+
+	// Remove from the middle
+	ASSERT_TRUE(root->removeChild(children[3]));
+	ASSERT_EQ(children[3]->getSiblingIndex(), SceneObject::kNoSiblingIndex);
+	ASSERT_EQ(root->getChildren().size(), 7);
+	ASSERT_EQ(children[4]->getSiblingIndex(), 3);
+	expectSiblingIndicesAreValid(root);
+
+	// Removed object is not a child anymore
+	ASSERT_FALSE(root->removeChild(children[3]));
+
+	// Insert to the beginning
+	root->insertChild(0, children[3]);
+	ASSERT_EQ(children[3]->getSiblingIndex(), 0);
+	ASSERT_EQ(children[0]->getSiblingIndex(), 1);
+	expectSiblingIndicesAreValid(root);
+
+	// Position is clamped
+	auto last = std::make_shared<SceneObject>();
+	root->insertChild(1000, last);
+	ASSERT_EQ(last->getSiblingIndex(), 8);
+	expectSiblingIndicesAreValid(root);
+}
+
+TEST(Scene, ParentIsMaintainedOnReparent)
+{
+	auto first = std::make_shared<SceneObject>();
+	auto second = std::make_shared<SceneObject>();
+	auto child = std::make_shared<SceneObject>();
+	auto sibling = std::make_shared<SceneObject>();
+
+	first->addChild(child);
+	first->addChild(sibling);
+	ASSERT_EQ(child->getParent().lock(), first);
+	ASSERT_EQ(sibling->getSiblingIndex(), 1);
+
+	// Reparent: child leaves children list of previous parent
+	second->insertChild(0, child);
+	ASSERT_EQ(child->getParent().lock(), second);
+	ASSERT_EQ(child->getSiblingIndex(), 0);
+	ASSERT_EQ(first->getChildren().size(), 1);
+	ASSERT_EQ(sibling->getSiblingIndex(), 0);
+	expectSiblingIndicesAreValid(first);
+	expectSiblingIndicesAreValid(second);
+
+	// Removed child has no parent
+	ASSERT_TRUE(second->removeChild(child));
+	ASSERT_EQ(child->getParent().lock(), nullptr);
+	ASSERT_TRUE(second->getChildren().empty());
+}
\ No newline at end of file
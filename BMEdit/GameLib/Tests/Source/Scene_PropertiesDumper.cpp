@@ -0,0 +1,246 @@
+#include <gtest/gtest.h>
+
+#include <GameLib/Scene/SceneObjectPropertiesDumper.h>
+#include <GameLib/PRP/PRPZDefines.h>
+#include <GameLib/PRP/PRPWriter.h>
+#include <GameLib/PRP/PRPReader.h>
+#include <TestScene.h>
+
+// Usage
+using gamelib::Value;
+using gamelib::prp::PRPOpCode;
+using gamelib::prp::PRPWriter;
+using gamelib::prp::PRPReader;
+using gamelib::prp::PRPZDefines;
+using gamelib::prp::PRPOperandVal;
+using gamelib::prp::PRPInstruction;
+using gamelib::prp::PRPDefinitionType;
+using gamelib::prp::StringRef;
+using gamelib::scene::SceneObject;
+using gamelib::scene::SceneObjectPropertiesDumper;
+
+// Helpers
+namespace
+{
+	/**
+	 * ZDefines: DefaultLamp=Lamp
+	 * ROOT
+	 *  Lamp01 (PrimId=10, Radius=1.5, Name=Lamp, controller CLight)
+	 *  Group
+	 *   Lamp02 (PrimId=20, Radius=2.5, Name=Lamp)
+	 */
+	struct LampsScene : tests::TestScene
+	{
+		PRPZDefines definitions;
+
+		LampsScene()
+		{
+			auto *geomType = addType("ZGEOM");
+			definitions.getDefinitions().emplace_back("DefaultLamp", PRPDefinitionType::StringRef_1, StringRef("Lamp"));
+
+			add("ROOT", geomType);
+			auto &lamp01 = addLamp(add("Lamp01", geomType, 0), 10, 1.5f);
+			add("Group", geomType, 0);
+			addLamp(add("Lamp02", geomType, 2), 20, 2.5f);
+
+			lamp01.getControllers().emplace_back(SceneObject::Controller { "CLight", Value(nullptr, { PRPInstruction(PRPOpCode::Bool, PRPOperandVal(true)) }) });
+		}
+
+		static SceneObject &addLamp(SceneObject &object, int32_t primId, float radius)
+		{
+			addProperty(object, "PrimId", makeInt32(primId));
+			addProperty(object, "Radius", makeFloat32(radius));
+			addProperty(object, "Name", makeString("Lamp"));
+			return object;
+		}
+
+		/**
+		 * Reference: build whole stream and write it via PRPWriter
+		 */
+		[[nodiscard]] std::vector<uint8_t> write() const
+		{
+			std::vector<PRPInstruction> instructions;
+
+			std::function<void(const SceneObject::Ptr &)> visit = [&](const SceneObject::Ptr &object)
+			{
+				instructions.emplace_back(PRPOpCode::BeginObject);
+				for (const auto &instruction : object->getProperties().getInstructions())
+				{
+					instructions.emplace_back(instruction);
+				}
+				instructions.emplace_back(PRPOpCode::EndObject);
+
+				instructions.emplace_back(PRPOpCode::Container, PRPOperandVal(static_cast<int>(object->getControllers().size())));
+				for (const auto &controller : object->getControllers())
+				{
+					instructions.emplace_back(PRPOpCode::String, PRPOperandVal(controller.name));
+					instructions.emplace_back(PRPOpCode::BeginObject);
+					for (const auto &instruction : controller.properties.getInstructions())
+					{
+						instructions.emplace_back(instruction);
+					}
+					instructions.emplace_back(PRPOpCode::EndObject);
+				}
+
+				instructions.emplace_back(PRPOpCode::Container, PRPOperandVal(static_cast<int>(object->getChildren().size())));
+				for (const auto &child : object->getChildren())
+				{
+					visit(child.lock());
+				}
+			};
+
+			visit(objects[0]);
+			instructions.emplace_back(PRPOpCode::Bool, PRPOperandVal(false));
+			instructions.emplace_back(PRPOpCode::EndOfStream);
+
+			std::vector<uint8_t> result;
+			PRPWriter::write(definitions, instructions, false, result);
+			return result;
+		}
+
+		[[nodiscard]] std::vector<uint8_t> dumpFresh() const
+		{
+			SceneObjectPropertiesDumper dumper;
+			std::vector<uint8_t> result;
+			dumper.dump(objects, definitions, false, &result);
+			return result;
+		}
+	};
+
+	std::vector<PRPInstruction> parse(const std::vector<uint8_t> &bytes)
+	{
+		PRPReader reader;
+		if (!reader.parse(bytes.data(), static_cast<int64_t>(bytes.size())))
+		{
+			return {};
+		}
+
+		return reader.getByteCode().getInstructions();
+	}
+}
+
+// Tests
+TEST(Scene, PropertiesDumper_FirstDumpSameAsWriter)
+{
+	LampsScene scene;
+
+	SceneObjectPropertiesDumper dumper;
+	std::vector<uint8_t> dumped;
+	dumper.dump(scene.objects, scene.definitions, false, &dumped);
+
+	ASSERT_EQ(dumper.getLastEncodedObjectsCount(), scene.objects.size());
+	ASSERT_EQ(dumped, scene.write());
+}
+
+TEST(Scene, PropertiesDumper_ReencodesOnlyChangedObjects)
+{
+	LampsScene scene;
+
+	SceneObjectPropertiesDumper dumper;
+	std::vector<uint8_t> dumped;
+	dumper.dump(scene.objects, scene.definitions, false, &dumped);
+
+	// Nothing changed
+	dumped.clear();
+	dumper.dump(scene.objects, scene.definitions, false, &dumped);
+	ASSERT_EQ(dumper.getLastEncodedObjectsCount(), 0);
+	ASSERT_EQ(dumped, scene.write());
+
+	// Change Radius of Lamp02 in place
+	auto &lamp02 = scene.objects[3]->getProperties();
+	lamp02.getInstructions()[1] = PRPInstruction(PRPOpCode::Float32, PRPOperandVal(42.f));
+	lamp02.markChanged();
+
+	dumped.clear();
+	dumper.dump(scene.objects, scene.definitions, false, &dumped);
+	ASSERT_EQ(dumper.getLastEncodedObjectsCount(), 1);
+	ASSERT_EQ(dumped, scene.write());
+	ASSERT_EQ(dumped, scene.dumpFresh());
+}
+
+TEST(Scene, PropertiesDumper_NewStringExtendsTokenTable)
+{
+	LampsScene scene;
+
+	SceneObjectPropertiesDumper dumper;
+	std::vector<uint8_t> dumped;
+	dumper.dump(scene.objects, scene.definitions, false, &dumped);
+	const auto initialSize = dumped.size();
+
+	// New string in Lamp01
+	auto &lamp01 = scene.objects[1]->getProperties();
+	lamp01.getInstructions()[2] = PRPInstruction(PRPOpCode::String, PRPOperandVal(std::string("Torch")));
+	lamp01.markChanged();
+
+	dumped.clear();
+	dumper.dump(scene.objects, scene.definitions, false, &dumped);
+	ASSERT_EQ(dumper.getLastEncodedObjectsCount(), 1);
+	ASSERT_EQ(dumped.size(), initialSize + std::string("Torch").length() + 1);
+
+	// Order of tokens differs from compact table, but stream is the same
+	const auto fresh = scene.dumpFresh();
+	ASSERT_EQ(dumped.size(), fresh.size());
+	ASSERT_EQ(parse(dumped), parse(fresh));
+
+	// Removed object drops its chunk
+	scene.objects[2]->removeChild(scene.objects[3]);
+	scene.objects.pop_back();
+
+	dumped.clear();
+	dumper.dump(scene.objects, scene.definitions, false, &dumped);
+	ASSERT_EQ(dumper.getLastEncodedObjectsCount(), 1);
+	ASSERT_EQ(parse(dumped), parse(scene.write())); // 'Lamp' is not used anymore, but still in token table
+}
+
+TEST(Scene, PropertiesDumper_ReencodesEditedController)
+{
+	LampsScene scene;
+	auto &lamp01 = *scene.objects[1];
+	const Value enabled(nullptr, { PRPInstruction(PRPOpCode::Bool, PRPOperandVal(true)) }); // Older than any change below
+	const Value disabled(nullptr, { PRPInstruction(PRPOpCode::Bool, PRPOperandVal(false)) });
+
+	SceneObjectPropertiesDumper dumper;
+	std::vector<uint8_t> dumped;
+	dumper.dump(scene.objects, scene.definitions, false, &dumped);
+	const auto initial = dumped;
+
+	// Rename & replace properties
+	ASSERT_TRUE(lamp01.updateController(0, "CLamp", disabled));
+	ASSERT_FALSE(lamp01.updateController(1, "CLamp", disabled));
+
+	dumped.clear();
+	dumper.dump(scene.objects, scene.definitions, false, &dumped);
+	ASSERT_EQ(dumper.getLastEncodedObjectsCount(), 1);
+	ASSERT_NE(dumped, initial);
+	ASSERT_EQ(parse(dumped), parse(scene.write()));
+	const auto renamed = dumped;
+
+	// Assignment of value which was created before last dump is a change too
+	lamp01.getControllers()[0].properties = enabled;
+
+	dumped.clear();
+	dumper.dump(scene.objects, scene.definitions, false, &dumped);
+	ASSERT_EQ(dumper.getLastEncodedObjectsCount(), 1);
+	ASSERT_NE(dumped, renamed);
+	ASSERT_EQ(parse(dumped), parse(scene.write()));
+}
+
+TEST(Scene, PropertiesDumper_CacheIsReported)
+{
+	LampsScene scene;
+
+	SceneObjectPropertiesDumper dumper;
+	ASSERT_EQ(dumper.memoryReport().getTotal().bytes, 0);
+
+	std::vector<uint8_t> dumped;
+	dumper.dump(scene.objects, scene.definitions, false, &dumped);
+
+	// Cache keeps at least encoded bytes of each object (everything except header & tail)
+	const auto usage = dumper.memoryReport().get(gamelib::MemoryCategory::SCENE_PROPERTIES_DUMPER);
+	ASSERT_GT(usage.bytes, dumped.size() / 2);
+	ASSERT_GE(usage.allocations, scene.objects.size());
+	ASSERT_EQ(dumper.memoryReport().getTotal().bytes, usage.bytes);
+
+	dumper.reset();
+	ASSERT_EQ(dumper.memoryReport().getTotal().bytes, 0);
+}
\ No newline at end of file
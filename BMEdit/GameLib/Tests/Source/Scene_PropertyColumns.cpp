@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <GameLib/Scene/ScenePropertyColumns.h>
+#include <GameLib/TypeRegistry.h>
+#include <GameLib/TypeArray.h>
+#include <TestScene.h>
+
+// Usage
+using gamelib::TypeArray;
+using gamelib::TypeRegistry;
+using gamelib::prp::PRPOpCode;
+using gamelib::prp::PRPOperandVal;
+using gamelib::prp::PRPInstruction;
+using gamelib::scene::ScenePropertyColumn;
+using gamelib::scene::ScenePropertyColumns;
+using gamelib::scene::ScenePropertyColumnKind;
+
+// Helpers
+namespace
+{
+	/**
+	 * ROOT (ZGROUP)
+	 * Guard01 (ZActor, PrimId=150, Position=(1,2,3), Weapon=Pistol)
+	 * Tree (ZGEOM, PrimId=20, Position=(4,5,6))
+	 * Guard02 (ZActor, PrimId=300, Position=(7,8) - broken, Weapon=Pistol)
+	 */
+	struct ColumnsScene : tests::TestScene
+	{
+		ColumnsScene()
+		{
+			TypeRegistry::getInstance().registerType(std::make_unique<TypeArray>("ZVector3F", PRPOpCode::Float32, 3));
+
+			auto *geomType = addType("ZGEOM");
+			auto *groupType = addType("ZGROUP", geomType);
+
+			// Properties of ZActor are declared, so rows of actors take entries by position in properties table
+			std::vector<gamelib::ValueView> actorViews;
+			actorViews.emplace_back("PrimId", PRPOpCode::Int32, nullptr);
+			actorViews.emplace_back("Position", "ZVector3F", nullptr);
+			actorViews.emplace_back("Weapon", PRPOpCode::StringOrArray_E, nullptr);
+			auto *actorType = addType("ZActor", geomType, std::move(actorViews));
+
+			add("ROOT", groupType);
+			addGeomProperties(add("Guard01", actorType), 150, { 1.f, 2.f, 3.f }, "Pistol");
+			addGeomProperties(add("Tree", geomType), 20, { 4.f, 5.f, 6.f }, {});
+			addGeomProperties(add("Guard02", actorType), 300, { 7.f, 8.f }, "Pistol");
+		}
+
+		static void addGeomProperties(gamelib::scene::SceneObject &object, int32_t primId, const std::vector<float> &position, const std::string &weapon)
+		{
+			addProperty(object, "PrimId", makeInt32(primId));
+			addProperty(object, "Position", makeFloatArray(position));
+
+			if (!weapon.empty())
+			{
+				addProperty(object, "Weapon", makeString(weapon, PRPOpCode::StringOrArray_E));
+			}
+		}
+	};
+}
+
+// Tests
+TEST(Scene, PropertyColumns_Extract)
+{
+	ColumnsScene scene;
+
+	ScenePropertyColumns columns;
+	columns.build(scene.objects, 2);
+
+	// Base type includes objects of all inherited types
+	auto primIds = columns.getColumn("ZGEOM", "PrimId");
+	ASSERT_NE(primIds, nullptr);
+	ASSERT_EQ(primIds->kind, ScenePropertyColumnKind::PCK_INT32);
+	ASSERT_EQ(primIds->stride, 1);
+	ASSERT_EQ(primIds->objects, std::vector<std::uint32_t>({ 0, 1, 2, 3 }));
+	ASSERT_FALSE(primIds->isPresent(0));
+	ASSERT_EQ(primIds->getInt(1), 150);
+	ASSERT_EQ(primIds->getInt(2), 20);
+	ASSERT_EQ(primIds->getInt(3), 300);
+
+	// Vectors: shape is taken from first object, Guard02 has only 2 components
+	auto positions = columns.getColumn("ZGEOM", "Position");
+	ASSERT_EQ(positions->kind, ScenePropertyColumnKind::PCK_FLOAT32);
+	ASSERT_EQ(positions->stride, 3);
+	ASSERT_TRUE(positions->isPresent(1));
+	ASSERT_FLOAT_EQ(positions->getFloat(1, 2), 3.f);
+	ASSERT_FLOAT_EQ(positions->getFloat(2, 0), 4.f);
+	ASSERT_FALSE(positions->isPresent(3));
+
+	// Strings are shared
+	auto weapons = columns.getColumn("ZActor", "Weapon");
+	ASSERT_EQ(weapons->kind, ScenePropertyColumnKind::PCK_STRING);
+	ASSERT_EQ(weapons->objects, std::vector<std::uint32_t>({ 1, 3 }));
+	ASSERT_EQ(weapons->getString(0), "Pistol");
+	ASSERT_EQ(weapons->stringHandles[0], weapons->stringHandles[1]);
+
+	// Unknown stuff
+	ASSERT_EQ(columns.getColumn("ZUnknown", "PrimId"), nullptr);
+	ASSERT_EQ(columns.getColumn("ZActor", "Unknown")->kind, ScenePropertyColumnKind::PCK_NONE);
+}
+
+TEST(Scene, PropertyColumns_Invalidate)
+{
+	ColumnsScene scene;
+
+	ScenePropertyColumns columns;
+	columns.build(scene.objects, 1);
+
+	auto geomPrimIds = columns.getColumn("ZGEOM", "PrimId");
+	auto groupPrimIds = columns.getColumn("ZGROUP", "PrimId");
+	ASSERT_EQ(geomPrimIds, columns.getColumn("ZGEOM", "PrimId")); // Cached
+
+	// Edit Guard01: columns of ZActor and ZGEOM are dropped, ZGROUP is untouched
+	scene.objects[1]->getProperties().getInstructions()[0] = PRPInstruction(PRPOpCode::Int32, PRPOperandVal(static_cast<int32_t>(151)));
+	columns.invalidateObject(1);
+
+	ASSERT_EQ(groupPrimIds, columns.getColumn("ZGROUP", "PrimId"));
+
+	auto newPrimIds = columns.getColumn("ZGEOM", "PrimId");
+	ASSERT_NE(geomPrimIds, newPrimIds);
+	ASSERT_EQ(geomPrimIds->getInt(1), 150);
+	ASSERT_EQ(newPrimIds->getInt(1), 151);
+
+	columns.invalidate();
+	ASSERT_NE(newPrimIds, columns.getColumn("ZGEOM", "PrimId"));
+}
\ No newline at end of file
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <GameLib/Scene/SceneQueryEngine.h>
+#include <GameLib/Scene/SceneQueryException.h>
+#include <TestScene.h>
+
+// Usage
+using gamelib::Value;
+using gamelib::prp::PRPOpCode;
+using gamelib::prp::PRPOperandVal;
+using gamelib::prp::PRPInstruction;
+using gamelib::scene::SceneObject;
+using gamelib::scene::SceneQuery;
+using gamelib::scene::SceneQueryField;
+using gamelib::scene::SceneQueryOperator;
+using gamelib::scene::SceneQueryEngine;
+using gamelib::scene::SceneQueryException;
+
+// Helpers
+namespace
+{
+	/**
+	 * ROOT (ZGROUP)
+	 *   Outside (ZGROUP)
+	 *     Guard01 (ZActor, CPatrol, PrimId=150, Weapon=Pistol)
+	 *     Tree (ZGEOM, PrimId=20)
+	 *   Inside (ZGROUP)
+	 *     Guard02 (ZActor, PrimId=300, Weapon=Shotgun)
+	 */
+	struct QueryScene : tests::TestScene
+	{
+		QueryScene()
+		{
+			auto *geomType = addType("ZGEOM");
+			auto *groupType = addType("ZGROUP", geomType);
+			auto *actorType = addType("ZActor", geomType);
+
+			add("ROOT", groupType);
+			add("Outside", groupType, 0);
+
+			auto &guard01 = add("Guard01", actorType, 1);
+			addProperty(guard01, "PrimId", makeInt32(150));
+			addProperty(guard01, "Weapon", makeString("Pistol", PRPOpCode::StringOrArray_E));
+			guard01.getControllers().push_back(SceneObject::Controller { "CPatrol", Value {} });
+
+			addProperty(add("Tree", geomType, 1), "PrimId", makeInt32(20));
+			add("Inside", groupType, 0);
+
+			auto &guard02 = add("Guard02", actorType, 4);
+			addProperty(guard02, "PrimId", makeInt32(300));
+			addProperty(guard02, "Weapon", makeString("Shotgun", PRPOpCode::StringOrArray_E));
+		}
+	};
+
+	std::vector<std::uint32_t> execute(const SceneQueryEngine &engine, std::string_view query)
+	{
+		std::vector<std::uint32_t> results;
+		engine.execute(SceneQuery::parse(query), results);
+		return results;
+	}
+}
+
+// Our tests
+TEST(Scene, Query_Parse)
+{
+	auto query = SceneQuery::parse(R"(type:ZHM3Actor controller:CPatrol prop:PrimId>100 under:"ROOT\\Outside" -Guard)");
+	const auto &terms = query.getTerms();
+
+	ASSERT_EQ(terms.size(), 5);
+	ASSERT_EQ(terms[0].field, SceneQueryField::QF_TYPE);
+	ASSERT_EQ(terms[0].value, "ZHM3Actor");
+	ASSERT_EQ(terms[1].field, SceneQueryField::QF_CONTROLLER);
+	ASSERT_EQ(terms[2].field, SceneQueryField::QF_PROPERTY);
+	ASSERT_EQ(terms[2].property, "PrimId");
+	ASSERT_EQ(terms[2].op, SceneQueryOperator::QO_GREATER);
+	ASSERT_EQ(terms[2].value, "100");
+	ASSERT_EQ(terms[3].field, SceneQueryField::QF_UNDER);
+	ASSERT_EQ(terms[3].value, "ROOT\\Outside");
+	ASSERT_EQ(terms[4].field, SceneQueryField::QF_NAME);
+	ASSERT_TRUE(terms[4].isNegated);
+
+	ASSERT_THROW((void)SceneQuery::parse("unknown:value"), SceneQueryException);
+	ASSERT_THROW((void)SceneQuery::parse("name:\"unterminated"), SceneQueryException);
+	ASSERT_THROW((void)SceneQuery::parse("prop:PrimId>"), SceneQueryException);
+	ASSERT_TRUE(SceneQuery::parse("   ").empty());
+}
+
+TEST(Scene, Query_Execute)
+{
+	QueryScene scene;
+
+	SceneQueryEngine engine;
+	engine.build(scene.objects, 2);
+
+	ASSERT_EQ(execute(engine, "guard"), std::vector<std::uint32_t>({ 2, 5 }));
+	ASSERT_EQ(execute(engine, "type:ZActor"), std::vector<std::uint32_t>({ 2, 5 }));
+	ASSERT_EQ(execute(engine, "type:ZGEOM"), std::vector<std::uint32_t>({ 0, 1, 2, 3, 4, 5 }));
+	ASSERT_EQ(execute(engine, "-type:ZGROUP"), std::vector<std::uint32_t>({ 2, 3, 5 }));
+	ASSERT_EQ(execute(engine, "controller:patrol"), std::vector<std::uint32_t>({ 2 }));
+	ASSERT_EQ(execute(engine, "prop:PrimId"), std::vector<std::uint32_t>({ 2, 3, 5 }));
+	ASSERT_EQ(execute(engine, "prop:PrimId>100"), std::vector<std::uint32_t>({ 2, 5 }));
+	ASSERT_EQ(execute(engine, "prop:primid<=150"), std::vector<std::uint32_t>({ 2, 3 }));
+	ASSERT_EQ(execute(engine, R"(under:"ROOT\\Outside")"), std::vector<std::uint32_t>({ 2, 3 }));
+	ASSERT_EQ(execute(engine, "under:Inside"), std::vector<std::uint32_t>({ 5 }));
+	ASSERT_EQ(execute(engine, R"(type:ZActor prop:PrimId>100 under:"ROOT\\Outside")"), std::vector<std::uint32_t>({ 2 }));
+	ASSERT_EQ(execute(engine, "prop:weapon=pistol"), std::vector<std::uint32_t>({ 2 }));
+	ASSERT_EQ(execute(engine, "prop:Weapon~GUN"), std::vector<std::uint32_t>({ 5 }));
+	ASSERT_TRUE(execute(engine, "prop:PrimId=pistol").empty());
+	ASSERT_TRUE(execute(engine, "type:Unknown").empty());
+	ASSERT_TRUE(execute(engine, "").empty());
+}
+
+TEST(Scene, Query_InvalidateEditedObject)
+{
+	QueryScene scene;
+
+	SceneQueryEngine engine;
+	engine.build(scene.objects, 1);
+	ASSERT_EQ(execute(engine, "prop:PrimId>200"), std::vector<std::uint32_t>({ 5 }));
+
+	// Edit PrimId of Tree: cached columns are still used until object is invalidated
+	auto &treeProperties = scene.objects[3]->getProperties();
+	treeProperties.getInstructions()[0] = PRPInstruction(PRPOpCode::Int32, PRPOperandVal(static_cast<int32_t>(250)));
+	treeProperties.markChanged();
+	ASSERT_EQ(execute(engine, "prop:PrimId>200"), std::vector<std::uint32_t>({ 5 }));
+
+	ASSERT_TRUE(engine.invalidateValue(&treeProperties));
+	ASSERT_EQ(execute(engine, "prop:PrimId>200"), std::vector<std::uint32_t>({ 3, 5 }));
+
+	// Values of controllers are not indexed
+	ASSERT_FALSE(engine.invalidateValue(&scene.objects[2]->getControllers()[0].properties));
+}
\ No newline at end of file
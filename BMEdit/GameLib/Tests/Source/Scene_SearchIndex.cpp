@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <GameLib/Scene/SceneSearchIndex.h>
+
+// Usage
+using gamelib::scene::SceneObject;
+using gamelib::scene::SceneSearchIndex;
+using gamelib::scene::SceneSearchField;
+
+// Helpers
+namespace
+{
+	/**
+	 * ROOT
+	 *   Outside
+	 *     Car_Red
+	 *     Car_Blue
+	 *   Inside
+	 *     Lamp
+	 *     Room
+	 *       RedLamp
+	 */
+	std::vector<SceneObject::Ptr> makeScene()
+	{
+		std::vector<SceneObject::Ptr> objects;
+		const std::vector<std::pair<std::string, int>> layout = {
+			{ "ROOT", -1 }, { "Outside", 0 }, { "Car_Red", 1 }, { "Car_Blue", 1 }, { "Inside", 0 }, { "Lamp", 4 }, { "Room", 4 }, { "RedLamp", 6 }
+		};
+
+		for (const auto &[name, parentIndex] : layout)
+		{
+			objects.push_back(std::make_shared<SceneObject>(name, 0u, nullptr, gamelib::gms::GMSGeomEntity {}, SceneObject::Instructions {}));
+
+			if (parentIndex >= 0)
+			{
+				objects.back()->setParent(objects[parentIndex]);
+				objects[parentIndex]->addChild(objects.back());
+			}
+		}
+
+		return objects;
+	}
+}
+
+// Our tests
+TEST(Scene, SearchIndex_FindByName)
+{
+	auto objects = makeScene();
+
+	SceneSearchIndex index;
+	index.build(objects, 2);
+
+	std::vector<std::uint32_t> matches;
+
+	index.find("red", SceneSearchField::SSF_NAME, matches);
+	ASSERT_EQ(matches, std::vector<std::uint32_t>({ 2, 7 }));
+
+	// Refine previous results
+	const auto previous = matches;
+	index.find("redl", SceneSearchField::SSF_NAME, matches, &previous);
+	ASSERT_EQ(matches, std::vector<std::uint32_t>({ 7 }));
+
+	// Short query (without trigrams)
+	index.find("a", SceneSearchField::SSF_NAME, matches);
+	ASSERT_EQ(matches, std::vector<std::uint32_t>({ 2, 3, 5, 7 }));
+
+	// Unknown trigram
+	index.find("xyz", SceneSearchField::SSF_NAME, matches);
+	ASSERT_TRUE(matches.empty());
+
+	index.find("", SceneSearchField::SSF_NAME, matches);
+	ASSERT_TRUE(matches.empty());
+}
+
+TEST(Scene, SearchIndex_FindByPath)
+{
+	auto objects = makeScene();
+
+	SceneSearchIndex index;
+	index.build(objects, 1);
+
+	ASSERT_EQ(index.getName(7), "redlamp");
+	ASSERT_EQ(index.getPath(7), "root\\inside\\room\\redlamp");
+	ASSERT_EQ(index.getParentIndex(7), 6);
+	ASSERT_EQ(index.getObjectIndex(objects[5].get()), 5);
+
+	std::vector<std::uint32_t> matches;
+	index.find("Inside\\", SceneSearchField::SSF_PATH, matches);
+	ASSERT_EQ(matches, std::vector<std::uint32_t>({ 5, 6, 7 }));
+}
+
+TEST(Scene, SearchIndex_AncestorsAreVisible)
+{
+	auto objects = makeScene();
+
+	SceneSearchIndex index;
+	index.build(objects);
+
+	std::vector<std::uint32_t> matches;
+	std::vector<bool> visible;
+
+	index.find("lamp", SceneSearchField::SSF_NAME, matches);
+	index.collectVisible(matches, visible);
+
+	ASSERT_EQ(visible, std::vector<bool>({ true, false, false, false, true, true, true, true }));
+}
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <GameLib/Type.h>
+#include <GameLib/TypeEnum.h>
+#include <GameLib/TypeArray.h>
+#include <GameLib/TypeComplex.h>
+#include <GameLib/TypeRegistry.h>
+
+// Usage
+using gamelib::Type;
+using gamelib::TypeEnum;
+using gamelib::TypeArray;
+using gamelib::TypeComplex;
+using gamelib::TypeRegistry;
+using gamelib::prp::PRPOpCode;
+
+// Fixture
+class TypeRegistry_Tables : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		auto &registry = TypeRegistry::getInstance();
+		registry.reset();
+
+		registry.registerType(std::make_unique<TypeArray>("ZVector3F", PRPOpCode::Float32, 3));
+		registry.registerType(std::make_unique<TypeArray>("ZMatrix33F", PRPOpCode::Float32, 9));
+
+		// Register EBoundingBox
+		{
+			TypeEnum::Entries entries;
+			entries.emplace_back("BOUNDING_Static", 0);
+			entries.emplace_back("BOUNDING_Dynamic", 1);
+
+			registry.registerType(std::make_unique<TypeEnum>("EBoundingBox", entries));
+		}
+
+		// Register ZGEOM
+		{
+			std::vector<gamelib::ValueView> views;
+			views.emplace_back(gamelib::ValueView("BoundingBox", "EBoundingBox", nullptr));
+			views.emplace_back(gamelib::ValueView("Matrix", "ZMatrix33F", nullptr));
+			views.emplace_back(gamelib::ValueView("Position", "ZVector3F", nullptr));
+			views.emplace_back(gamelib::ValueView("IsInactive", PRPOpCode::Bool, nullptr));
+			views.emplace_back(gamelib::ValueView("PrimId", PRPOpCode::Int32, nullptr));
+
+			registry.registerType(std::make_unique<TypeComplex>("ZGEOM", std::move(views), nullptr, false));
+		}
+
+		// Register ZSTDOBJ (inherited of ZGEOM)
+		{
+			std::vector<gamelib::ValueView> views;
+			views.emplace_back(gamelib::ValueView("Invisible", PRPOpCode::Bool, nullptr));
+
+			registry.registerType(std::make_unique<TypeComplex>("ZSTDOBJ", std::move(views), std::string("ZGEOM"), false));
+		}
+
+		registry.linkTypes();
+	}
+
+	void TearDown() override
+	{
+		TypeRegistry::getInstance().reset();
+	}
+};
+
+// Tests
+TEST_F(TypeRegistry_Tables, FlattenedPropertiesTable)
+{
+	const auto& registry = TypeRegistry::getInstance();
+	auto geomType = registry.findTypeByName("ZGEOM");
+	auto stdobjType = registry.findTypeByName("ZSTDOBJ");
+	ASSERT_NE(geomType, nullptr);
+	ASSERT_NE(stdobjType, nullptr);
+
+	// Parent properties first
+	const auto& table = registry.getPropertiesTable(stdobjType);
+	ASSERT_EQ(table.size(), 6);
+	ASSERT_EQ(table[0]->getName(), "BoundingBox");
+	ASSERT_EQ(table[0]->getOwnerType(), geomType);
+	ASSERT_EQ(table[4]->getName(), "PrimId");
+	ASSERT_EQ(table[4]->getOwnerType(), geomType);
+	ASSERT_EQ(table[5]->getName(), "Invisible");
+	ASSERT_EQ(table[5]->getOwnerType(), stdobjType);
+
+	// Table is cached
+	ASSERT_EQ(&registry.getPropertiesTable(stdobjType), &table);
+	ASSERT_EQ(registry.getPropertiesTable(geomType).size(), 5);
+
+	// Not complex types has no properties
+	ASSERT_TRUE(registry.getPropertiesTable(registry.findTypeByName("ZVector3F")).empty());
+	ASSERT_TRUE(registry.getPropertiesTable(nullptr).empty());
+
+	// Search reports each property at type where it declared
+	std::vector<const gamelib::ValueView*> found;
+	registry.findProperties("primid", found);
+	ASSERT_EQ(found.size(), 1);
+	ASSERT_EQ(found[0]->getName(), "PrimId");
+	ASSERT_EQ(found[0]->getOwnerType(), geomType);
+
+	registry.findProperties("IS", found);
+	ASSERT_EQ(found.size(), 2); // IsInactive, Invisible
+
+	registry.findProperties("NotAProperty", found);
+	ASSERT_TRUE(found.empty());
+}
+
+TEST_F(TypeRegistry_Tables, TypeHierarchy)
+{
+	const auto& registry = TypeRegistry::getInstance();
+	auto geomType = registry.findTypeByName("ZGEOM");
+	auto stdobjType = registry.findTypeByName("ZSTDOBJ");
+
+	// Type itself first, root parent last
+	ASSERT_EQ(registry.getTypeHierarchy(stdobjType), (TypeRegistry::TypeHierarchy { stdobjType, geomType }));
+	ASSERT_EQ(registry.getTypeHierarchy(geomType), (TypeRegistry::TypeHierarchy { geomType }));
+
+	// Not complex types has no hierarchy
+	ASSERT_TRUE(registry.getTypeHierarchy(registry.findTypeByName("ZMatrix33F")).empty());
+	ASSERT_TRUE(registry.getTypeHierarchy(nullptr).empty());
+
+	// Tables are dropped with types
+	TypeRegistry::getInstance().reset();
+	ASSERT_TRUE(registry.getTypeHierarchy(stdobjType).empty());
+	ASSERT_TRUE(registry.getPropertiesTable(stdobjType).empty());
+}
\ No newline at end of file
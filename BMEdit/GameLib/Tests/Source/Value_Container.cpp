@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <GameLib/TypeComplex.h>
+#include <GameLib/TypeContainer.h>
+#include <GameLib/Value.h>
+#include <stdexcept>
+
+// Usage
+using gamelib::Span;
+using gamelib::Value;
+using gamelib::ValueView;
+using gamelib::TypeComplex;
+using gamelib::TypeContainer;
+using gamelib::prp::PRPOpCode;
+using gamelib::prp::PRPOperandVal;
+using gamelib::prp::PRPInstruction;
+
+// Helpers
+namespace
+{
+	/**
+	 * ZHolder { PrimId: Int32, Items: ZREFTAB, Enabled: Bool }
+	 */
+	struct TestTypes
+	{
+		std::unique_ptr<TypeContainer> refTabType;
+		std::unique_ptr<TypeComplex> holderType;
+
+		TestTypes()
+		{
+			refTabType = std::make_unique<TypeContainer>("ZREFTAB");
+
+			std::vector<ValueView> views;
+			views.emplace_back("PrimId", PRPOpCode::Int32, nullptr);
+			views.emplace_back("Items", refTabType.get(), nullptr);
+			views.emplace_back("Enabled", PRPOpCode::Bool, nullptr);
+			holderType = std::make_unique<TypeComplex>("ZHolder", std::move(views), nullptr, false);
+		}
+
+		[[nodiscard]] Value map(const std::vector<PRPInstruction> &instructions) const
+		{
+			auto [value, _rest] = holderType->map(Span(instructions));
+			if (!value.has_value())
+			{
+				throw std::runtime_error("Unable to map test data");
+			}
+
+			return value.value();
+		}
+	};
+
+	std::vector<PRPInstruction> makeItems(int count)
+	{
+		std::vector<PRPInstruction> items;
+		items.emplace_back(PRPOpCode::Container, PRPOperandVal(static_cast<int32_t>(count)));
+
+		for (int i = 0; i < count; ++i)
+		{
+			items.emplace_back(PRPOpCode::String, PRPOperandVal(std::string("Item") + std::to_string(i)));
+		}
+
+		return items;
+	}
+
+	std::vector<PRPInstruction> makeHolder(int itemsCount)
+	{
+		std::vector<PRPInstruction> instructions;
+		instructions.emplace_back(PRPOpCode::Int32, PRPOperandVal(static_cast<int32_t>(42)));
+
+		for (const auto &item: makeItems(itemsCount))
+		{
+			instructions.push_back(item);
+		}
+
+		instructions.emplace_back(PRPOpCode::Bool, PRPOperandVal(true));
+		return instructions;
+	}
+}
+
+// Tests
+TEST(Value_Container, UpdateContainerGrowAndShrink)
+{
+	TestTypes types;
+	Value value = types.map(makeHolder(2));
+
+	ASSERT_EQ(value.getEntries().size(), 3);
+	ASSERT_EQ(value.getEntries()[2].instructions.iOffset, 4);
+
+	// Grow
+	value.updateContainer(1, makeItems(5));
+	ASSERT_EQ(value.getInstructions().size(), 1 + 6 + 1);
+	ASSERT_EQ(value.getEntries()[1].instructions.iSize, 6);
+	ASSERT_EQ(value.getEntries()[2].instructions.iOffset, 7);
+	ASSERT_TRUE(value.getInstructions()[7].isBool());
+
+	// Result must be the same as full re-map of new data
+	ASSERT_EQ(value, types.map(makeHolder(5)));
+
+	// Shrink to empty container
+	value.updateContainer(1, makeItems(0));
+	ASSERT_EQ(value.getInstructions().size(), 1 + 1 + 1);
+	ASSERT_EQ(value.getEntries()[2].instructions.iOffset, 2);
+	ASSERT_EQ(value, types.map(makeHolder(0)));
+
+	// Other entries are untouched
+	ASSERT_EQ(value.getInstructions()[0].getOperand().trivial.i32, 42);
+	ASSERT_EQ(value.getEntries()[0].name, "PrimId");
+	ASSERT_EQ(value.getEntries()[2].name, "Enabled");
+}
+
+TEST(Value_Container, UpdateContainerRejectsInvalidData)
+{
+	TestTypes types;
+	Value value = types.map(makeHolder(2));
+	const Value original = value;
+
+	// Capacity says 3 but only one item declared
+	std::vector<PRPInstruction> broken;
+	broken.emplace_back(PRPOpCode::Container, PRPOperandVal(static_cast<int32_t>(3)));
+	broken.emplace_back(PRPOpCode::String, PRPOperandVal(std::string("Item0")));
+	ASSERT_THROW(value.updateContainer(1, broken), std::runtime_error);
+
+	// Extra instructions after container
+	auto tooLong = makeItems(1);
+	tooLong.emplace_back(PRPOpCode::Bool, PRPOperandVal(false));
+	ASSERT_THROW(value.updateContainer(1, tooLong), std::runtime_error);
+
+	// Trivial property has no type to verify container
+	ASSERT_THROW(value.updateContainer(0, makeItems(1)), std::runtime_error);
+
+	ASSERT_EQ(value, original);
+}
\ No newline at end of file
@@ -0,0 +1,248 @@
+#include <gtest/gtest.h>
+
+#include <GameLib/EditJournal.h>
+#include <GameLib/TypeComplex.h>
+#include <GameLib/TypeContainer.h>
+#include <GameLib/Value.h>
+#include <stdexcept>
+
+// Usage
+using gamelib::Span;
+using gamelib::Value;
+using gamelib::ValueView;
+using gamelib::EditJournal;
+using gamelib::TypeComplex;
+using gamelib::TypeContainer;
+using gamelib::prp::PRPOpCode;
+using gamelib::prp::PRPOperandVal;
+using gamelib::prp::PRPInstruction;
+
+// Helpers
+namespace
+{
+	/**
+	 * ZHolder { Position: Float32 x 3, Items: ZREFTAB }
+	 */
+	struct TestObject
+	{
+		std::unique_ptr<TypeContainer> refTabType;
+		std::unique_ptr<TypeComplex> holderType;
+		Value value;
+
+		TestObject()
+		{
+			refTabType = std::make_unique<TypeContainer>("ZREFTAB");
+
+			std::vector<ValueView> views;
+			views.emplace_back("X", PRPOpCode::Float32, nullptr);
+			views.emplace_back("Items", refTabType.get(), nullptr);
+			views.emplace_back("Y", PRPOpCode::Float32, nullptr);
+			holderType = std::make_unique<TypeComplex>("ZHolder", std::move(views), nullptr, false);
+
+			std::vector<PRPInstruction> instructions;
+			instructions.emplace_back(PRPOpCode::Float32, PRPOperandVal(1.f));
+			for (const auto &item : makeItems({ 10, 20 }))
+			{
+				instructions.push_back(item);
+			}
+			instructions.emplace_back(PRPOpCode::Float32, PRPOperandVal(2.f));
+
+			auto [mapped, _rest] = holderType->map(Span(instructions));
+			if (!mapped.has_value())
+			{
+				throw std::runtime_error("Unable to map test data");
+			}
+
+			value = mapped.value();
+		}
+
+		static std::vector<PRPInstruction> makeItems(const std::vector<int32_t> &items)
+		{
+			std::vector<PRPInstruction> result;
+			result.emplace_back(PRPOpCode::Container, PRPOperandVal(static_cast<int32_t>(items.size())));
+
+			for (const auto item : items)
+			{
+				result.emplace_back(PRPOpCode::Int32, PRPOperandVal(item));
+			}
+
+			return result;
+		}
+
+		static std::vector<PRPInstruction> makeFloat(float v)
+		{
+			return { PRPInstruction(PRPOpCode::Float32, PRPOperandVal(v)) };
+		}
+
+		[[nodiscard]] float getX() const { return value.getInstructions()[0].getOperand().trivial.f32; }
+	};
+
+	const auto kT0 = EditJournal::Clock::time_point {};
+	const auto kLongAfter = std::chrono::seconds(10);
+}
+
+// Tests
+TEST(Value_EditJournal, UndoRedoOfTrivialAndContainer)
+{
+	TestObject object;
+	const Value original = object.value;
+
+	EditJournal journal;
+	ASSERT_FALSE(journal.canUndo());
+
+	ASSERT_TRUE(journal.setEntry(object.value, 0, TestObject::makeFloat(5.f), kT0));
+	ASSERT_TRUE(journal.setEntry(object.value, 1, TestObject::makeItems({ 10, 20, 30 }), kT0 + kLongAfter));
+	ASSERT_FALSE(journal.setEntry(object.value, 2, TestObject::makeFloat(2.f), kT0 + kLongAfter * 2)); // Same value
+	ASSERT_EQ(journal.getRecordsCount(), 2);
+
+	const Value edited = object.value;
+	ASSERT_FLOAT_EQ(object.getX(), 5.f);
+	ASSERT_EQ(object.value.getInstructions().size(), 1 + 4 + 1);
+
+	// Undo container change, then trivial
+	auto change = journal.undo();
+	ASSERT_TRUE(change.has_value());
+	ASSERT_EQ(change->value, &object.value);
+	ASSERT_EQ(change->entryIndex, 1);
+	ASSERT_EQ(object.value.getEntries()[2].instructions.iOffset, 4);
+
+	ASSERT_TRUE(journal.undo().has_value());
+	ASSERT_EQ(object.value, original);
+	ASSERT_FALSE(journal.undo().has_value());
+
+	// Redo everything back
+	ASSERT_TRUE(journal.redo().has_value());
+	ASSERT_TRUE(journal.redo().has_value());
+	ASSERT_FALSE(journal.redo().has_value());
+	ASSERT_EQ(object.value, edited);
+
+	// New edit drops redo tail
+	journal.undo();
+	ASSERT_TRUE(journal.canRedo());
+	journal.setEntry(object.value, 2, TestObject::makeFloat(7.f), kT0 + kLongAfter * 3);
+	ASSERT_FALSE(journal.canRedo());
+	ASSERT_EQ(journal.getRecordsCount(), 2);
+}
+
+TEST(Value_EditJournal, DeltaKeepsOnlyChangedInstructions)
+{
+	TestObject object;
+
+	EditJournal journal;
+	journal.setEntry(object.value, 1, TestObject::makeItems({ 10, 20 }), kT0);
+	ASSERT_EQ(journal.getRecordsCount(), 0);
+
+	// Only one item changed: record keeps only it
+	journal.setEntry(object.value, 1, TestObject::makeItems({ 10, 25 }), kT0);
+	const auto oneItemUsage = journal.getMemoryUsage();
+
+	journal.clear();
+	journal.setEntry(object.value, 1, TestObject::makeItems({ 11, 26 }), kT0);
+	ASSERT_GT(journal.getMemoryUsage(), oneItemUsage);
+
+	// Invalid container is not recorded
+	std::vector<PRPInstruction> broken { PRPInstruction(PRPOpCode::Container, PRPOperandVal(static_cast<int32_t>(5))) };
+	ASSERT_THROW(journal.setEntry(object.value, 1, broken, kT0), std::runtime_error);
+	ASSERT_EQ(journal.getRecordsCount(), 1);
+}
+
+TEST(Value_EditJournal, RapidEditsAreCoalesced)
+{
+	TestObject object;
+	EditJournal journal;
+
+	// Slider: 1 -> 2 -> ... -> 100 within coalesce window
+	for (int i = 2; i <= 100; ++i)
+	{
+		journal.setEntry(object.value, 0, TestObject::makeFloat(static_cast<float>(i)), kT0 + std::chrono::milliseconds(10 * i));
+	}
+
+	ASSERT_EQ(journal.getRecordsCount(), 1);
+	ASSERT_FLOAT_EQ(object.getX(), 100.f);
+
+	// Sealed journal does not merge
+	journal.seal();
+	journal.setEntry(object.value, 0, TestObject::makeFloat(101.f), kT0 + std::chrono::milliseconds(1010));
+	ASSERT_EQ(journal.getRecordsCount(), 2);
+
+	// Slow edits are not merged too
+	journal.setEntry(object.value, 0, TestObject::makeFloat(102.f), kT0 + kLongAfter);
+	ASSERT_EQ(journal.getRecordsCount(), 3);
+
+	journal.undo();
+	journal.undo();
+	ASSERT_FLOAT_EQ(object.getX(), 100.f);
+	journal.undo();
+	ASSERT_FLOAT_EQ(object.getX(), 1.f);
+
+	// Slider returned back to original value: record removed
+	journal.clear();
+	journal.setEntry(object.value, 0, TestObject::makeFloat(3.f), kT0);
+	journal.setEntry(object.value, 0, TestObject::makeFloat(1.f), kT0 + std::chrono::milliseconds(10));
+	ASSERT_EQ(journal.getRecordsCount(), 0);
+}
+
+TEST(Value_EditJournal, MemoryIsBounded)
+{
+	TestObject object;
+	EditJournal journal { 4096 };
+
+	for (int i = 0; i < 10000; ++i)
+	{
+		journal.setEntry(object.value, 0, TestObject::makeFloat(static_cast<float>(i + 2)), kT0 + kLongAfter * i);
+		ASSERT_LE(journal.getMemoryUsage(), 4096);
+	}
+
+	ASSERT_GT(journal.getRecordsCount(), 1);
+	ASSERT_LT(journal.getRecordsCount(), 100);
+
+	// Oldest records are lost, newest are alive
+	const auto recordsCount = journal.getRecordsCount();
+	for (std::size_t i = 0; i < recordsCount; ++i)
+	{
+		ASSERT_TRUE(journal.undo().has_value());
+	}
+
+	ASSERT_FALSE(journal.canUndo());
+	ASSERT_FLOAT_EQ(object.getX(), static_cast<float>(10001 - recordsCount));
+}
+
+TEST(Value_EditJournal, ListenerIsNotifiedOnEachChange)
+{
+	TestObject object;
+	EditJournal journal;
+
+	std::vector<int> changedEntries;
+	journal.setChangeListener([&changedEntries, &object](const EditJournal::Change &change)
+	{
+		ASSERT_EQ(change.value, &object.value);
+		changedEntries.push_back(change.entryIndex);
+	});
+
+	journal.setEntry(object.value, 0, TestObject::makeFloat(5.f), kT0);
+	journal.setEntry(object.value, 0, TestObject::makeFloat(6.f), kT0 + std::chrono::milliseconds(10)); // Coalesced, but applied
+	journal.setEntry(object.value, 2, TestObject::makeFloat(2.f), kT0 + kLongAfter); // Same value
+	journal.setEntry(object.value, 1, TestObject::makeItems({ 10 }), kT0 + kLongAfter);
+	journal.undo();
+	journal.redo();
+
+	ASSERT_EQ(changedEntries, std::vector<int>({ 0, 0, 1, 1, 1 }));
+}
+
+TEST(Value_EditJournal, EntryIndexIsChecked)
+{
+	TestObject object;
+	EditJournal journal;
+
+	ASSERT_THROW(journal.setEntry(object.value, -1, TestObject::makeFloat(5.f), kT0), std::out_of_range);
+	ASSERT_THROW(journal.setEntry(object.value, 3, TestObject::makeFloat(5.f), kT0), std::out_of_range);
+	ASSERT_EQ(journal.getRecordsCount(), 0);
+
+	// Value replaced by one without recorded entry: history is dropped instead of restoring into wrong memory
+	journal.setEntry(object.value, 2, TestObject::makeFloat(5.f), kT0);
+	object.value = Value(nullptr, { PRPInstruction(PRPOpCode::Float32, PRPOperandVal(1.f)) });
+
+	ASSERT_FALSE(journal.undo().has_value());
+	ASSERT_FALSE(journal.canUndo());
+	ASSERT_EQ(journal.getRecordsCount(), 0);
+}
\ No newline at end of file
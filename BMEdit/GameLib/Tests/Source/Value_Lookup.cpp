@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <GameLib/ValueEntriesIndex.h>
+#include <GameLib/TypeComplex.h>
+#include <GameLib/Value.h>
+#include <stdexcept>
+#include <string>
+
+// Usage
+using gamelib::Span;
+using gamelib::Value;
+using gamelib::ValueView;
+using gamelib::ValueEntry;
+using gamelib::ValueEntriesIndex;
+using gamelib::TypeComplex;
+using gamelib::prp::PRPOpCode;
+using gamelib::prp::PRPOperandVal;
+using gamelib::prp::PRPInstruction;
+
+// Helpers
+namespace
+{
+	constexpr int kPropertiesCount = 64;
+
+	std::unique_ptr<TypeComplex> makeType()
+	{
+		std::vector<ValueView> views;
+		for (int i = 0; i < kPropertiesCount; ++i)
+		{
+			views.emplace_back("Property" + std::to_string(i), PRPOpCode::Int32, nullptr);
+		}
+
+		return std::make_unique<TypeComplex>("ZWide", std::move(views), nullptr, false);
+	}
+
+	Value map(const TypeComplex &type, int32_t base)
+	{
+		std::vector<PRPInstruction> instructions;
+		for (int i = 0; i < kPropertiesCount; ++i)
+		{
+			instructions.emplace_back(PRPOpCode::Int32, PRPOperandVal(base + i));
+		}
+
+		auto [value, _rest] = type.map(Span(instructions));
+		if (!value.has_value())
+		{
+			throw std::runtime_error("Unable to map test data");
+		}
+
+		return value.value();
+	}
+}
+
+// Tests
+TEST(Value_Lookup, IndexSharedBetweenValuesOfType)
+{
+	auto type = makeType();
+
+	Value first = map(*type, 0);
+	Value second = map(*type, 1000);
+
+	ASSERT_NE(first.getEntriesIndex(), nullptr);
+	ASSERT_EQ(first.getEntriesIndex(), second.getEntriesIndex());
+
+	for (int i = 0; i < kPropertiesCount; ++i)
+	{
+		const std::string name = "Property" + std::to_string(i);
+
+		ASSERT_EQ(first.getEntryIndex(name), i);
+		ASSERT_TRUE(second.hasProperty(name));
+		ASSERT_EQ(second[name][0].getOperand().trivial.i32, 1000 + i);
+	}
+
+	ASSERT_EQ(first.getEntryIndex("Property"), ValueEntriesIndex::kNotFound);
+	ASSERT_EQ(first.getEntryIndex("property0"), ValueEntriesIndex::kNotFound);
+	ASSERT_EQ(first.getEntryIndex(""), ValueEntriesIndex::kNotFound);
+	ASSERT_FALSE(first.hasProperty("Property64"));
+	ASSERT_THROW(first["Property64"], std::out_of_range);
+}
+
+TEST(Value_Lookup, IndexDroppedWhenLayoutChanged)
+{
+	auto type = makeType();
+	Value value = map(*type, 0);
+
+	ASSERT_NE(value.getEntriesIndex(), nullptr);
+
+	value += std::make_pair(std::string("Extra"), Value(type.get(), { PRPInstruction(PRPOpCode::Bool, PRPOperandVal(true)) }));
+
+	ASSERT_EQ(value.getEntriesIndex(), nullptr);
+	ASSERT_EQ(value.getEntryIndex("Extra"), kPropertiesCount);
+	ASSERT_EQ(value.getEntryIndex("Property3"), 3);
+}
+
+TEST(Value_Lookup, DuplicatedNamesResolvedToFirstEntry)
+{
+	std::vector<ValueEntry> entries(4);
+	entries[0].name = "A";
+	entries[1].name = "B";
+	entries[2].name = "A";
+	entries[3].name = "C";
+
+	ValueEntriesIndex index { Span(entries) };
+
+	ASSERT_EQ(index.getEntriesCount(), 4);
+	ASSERT_EQ(index.find("A"), 0);
+	ASSERT_EQ(index.find("B"), 1);
+	ASSERT_EQ(index.find("C"), 3);
+	ASSERT_EQ(index.find("D"), ValueEntriesIndex::kNotFound);
+
+	ValueEntriesIndex emptyIndex { Span<ValueEntry>() };
+	ASSERT_EQ(emptyIndex.find("A"), ValueEntriesIndex::kNotFound);
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <GameLib/Workers.h>
+#include <stdexcept>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// Usage
+using gamelib::runWorkers;
+using gamelib::runParallelFor;
+
+// Tests
+TEST(Workers, ExceptionOfCallerWorkerIsRethrownAfterJoin)
+{
+	constexpr int kWorkersCount = 4;
+	std::atomic<int> finishedWorkers { 0 };
+
+	// Worker #0 runs on caller thread, other workers must be joined before exception leaves runWorkers
+	ASSERT_THROW(runWorkers(kWorkersCount, [&finishedWorkers](int workerIndex)
+	{
+		if (workerIndex == 0)
+		{
+			throw std::runtime_error("worker #0");
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		++finishedWorkers;
+	}), std::runtime_error);
+
+	ASSERT_EQ(finishedWorkers.load(), kWorkersCount - 1);
+}
+
+TEST(Workers, ExceptionOfThreadWorkerIsRethrownOnCaller)
+{
+	std::atomic<int> finishedWorkers { 0 };
+
+	ASSERT_THROW(runWorkers(4, [&finishedWorkers](int workerIndex)
+	{
+		if (workerIndex == 3)
+		{
+			throw std::logic_error("worker #3");
+		}
+
+		++finishedWorkers;
+	}), std::logic_error);
+
+	ASSERT_EQ(finishedWorkers.load(), 3);
+}
+
+TEST(Workers, ParallelForStopsAfterException)
+{
+	constexpr std::size_t kJobsCount = 100000;
+	constexpr std::size_t kFailedJob = 10;
+	std::atomic<std::size_t> startedJobs { 0 };
+
+	ASSERT_THROW(runParallelFor(0, kJobsCount, 4, [&startedJobs](std::size_t index)
+	{
+		++startedJobs;
+
+		if (index == kFailedJob)
+		{
+			throw std::runtime_error("job");
+		}
+	}), std::runtime_error);
+
+	// Jobs after the failed one are not handed out (except those which were taken by other workers already)
+	ASSERT_GT(startedJobs.load(), kFailedJob);
+	ASSERT_LT(startedJobs.load(), kJobsCount);
+}
+
+TEST(Workers, ParallelForRunsEachJobOnce)
+{
+	constexpr std::size_t kJobsCount = 1000;
+	std::vector<std::atomic<int>> runs(kJobsCount);
+
+	runParallelFor(0, kJobsCount, 4, [&runs](std::size_t index)
+	{
+		++runs[index];
+	});
+
+	for (const auto &run : runs)
+	{
+		ASSERT_EQ(run.load(), 1);
+	}
+}
\ No newline at end of file
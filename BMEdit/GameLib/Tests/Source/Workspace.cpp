@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+
+#include <GameLib/IO/IOLevelAssetsProvider.h>
+#include <GameLib/PRM/PRMChunk.h>
+#include <GameLib/Workspace.h>
+#include <GameLib/Level.h>
+#include <GameLib/TypeRegistry.h>
+#include <SyntheticLevel.h>
+#include <unordered_set>
+#include <cstring>
+#include <utility>
+
+// Usage
+using gamelib::Workspace;
+using gamelib::Level;
+using gamelib::MemoryCategory;
+using gamelib::prm::PRMChunk;
+using gamelib::prm::PRMChunkRecognizedKind;
+using gamelib::scene::SceneQuery;
+using bench::SyntheticLevel;
+using bench::SyntheticLevelOptions;
+using bench::SyntheticLevelAssetsProvider;
+
+// Helpers
+namespace
+{
+	PRMChunk makeChunk(std::uint32_t chunkIndex, std::size_t size, uint8_t filler)
+	{
+		auto buffer = std::make_unique<uint8_t[]>(size);
+		std::memset(buffer.get(), filler, size);
+		return PRMChunk(chunkIndex, 16, std::move(buffer), size);
+	}
+
+	class MissingAssetsProvider : public gamelib::io::IOLevelAssetsProvider
+	{
+	public:
+		[[nodiscard]] const std::string &getLevelName() const override { return m_name; }
+		[[nodiscard]] std::unique_ptr<uint8_t[]> getAsset(gamelib::io::AssetKind, int64_t &bufferSize) const override { bufferSize = 0; return nullptr; }
+		[[nodiscard]] bool hasAssetOfKind(gamelib::io::AssetKind) const override { return false; }
+		bool saveAsset(gamelib::io::AssetKind, gamelib::Span<uint8_t>) override { return false; }
+		[[nodiscard]] bool isValid() const override { return true; }
+		[[nodiscard]] bool isEditable() const override { return false; }
+		[[nodiscard]] std::uint64_t getContentHash() const override { return 0; }
+
+	private:
+		std::string m_name { "MISSING" };
+	};
+
+	/**
+	 * Levels with different scenes and the same geometry (so all chunk bodies of them could be shared)
+	 */
+	SyntheticLevel makeSyntheticLevel(std::uint32_t groupsCount)
+	{
+		SyntheticLevelOptions options;
+		options.groupsCount = groupsCount;
+		options.objectsPerGroup = 4;
+		options.controllersInterval = 0;
+		options.primitivesCount = 8;
+		return bench::generateLevel(options);
+	}
+
+	/**
+	 * Size of distinct chunk bodies of level (zero chunk is never shared)
+	 */
+	std::size_t getBodiesSize(const Level &level, bool isSharedOnly)
+	{
+		std::unordered_set<const uint8_t *> buffers;
+		std::size_t size = 0;
+
+		for (const auto &chunk : level.getLevelGeometry()->chunks)
+		{
+			if (isSharedOnly && !chunk.isBufferShared())
+			{
+				continue;
+			}
+
+			if (const auto buffer = chunk.getBuffer(); buffer.size() > 0 && buffers.insert(buffer.cbegin()).second)
+			{
+				size += static_cast<std::size_t>(buffer.size());
+			}
+		}
+
+		return size;
+	}
+}
+
+// Tests
+TEST(Workspace, ChunkBufferIsSharedOnlyWithSameContent)
+{
+	auto first = makeChunk(1, 0x30, 0xAAu);
+	auto same = makeChunk(2, 0x30, 0xAAu);
+	auto other = makeChunk(3, 0x30, 0xBBu);
+
+	ASSERT_FALSE(other.shareBufferWith(first));
+	ASSERT_FALSE(other.isBufferShared());
+
+	ASSERT_TRUE(same.shareBufferWith(first));
+	ASSERT_TRUE(same.isBufferShared());
+	ASSERT_TRUE(first.isBufferShared());
+	ASSERT_EQ(std::as_const(same).getBuffer().cbegin(), std::as_const(first).getBuffer().cbegin());
+}
+
+TEST(Workspace, SharedChunkBufferIsCopiedOnWrite)
+{
+	auto first = makeChunk(1, 0x30, 0xAAu);
+	auto second = makeChunk(2, 0x30, 0xAAu);
+	ASSERT_TRUE(second.shareBufferWith(first));
+
+	// Non-const access detaches buffer, content stays the same
+	const auto writable = second.getBuffer();
+	ASSERT_FALSE(second.isBufferShared());
+	ASSERT_FALSE(first.isBufferShared());
+	ASSERT_NE(writable.cbegin(), std::as_const(first).getBuffer().cbegin());
+	ASSERT_EQ(std::memcmp(writable.cbegin(), std::as_const(first).getBuffer().cbegin(), 0x30), 0);
+}
+
+TEST(Workspace, FailedLevelsAreReported)
+{
+	Workspace workspace;
+	const auto firstLevel = workspace.addLevel(std::make_unique<MissingAssetsProvider>());
+	const auto secondLevel = workspace.addLevel(std::make_unique<MissingAssetsProvider>());
+
+	ASSERT_EQ(workspace.getLevelsCount(), 2);
+	ASSERT_FALSE(workspace.loadLevels(2));
+	ASSERT_FALSE(workspace.isLevelLoaded(firstLevel));
+	ASSERT_FALSE(workspace.isLevelLoaded(secondLevel));
+	ASSERT_FALSE(workspace.getLoadError(firstLevel).empty());
+
+	std::vector<Workspace::ObjectRef> results;
+	workspace.findObjectsByName("ROOT", results);
+	ASSERT_TRUE(results.empty());
+	ASSERT_EQ(workspace.getSharedBytes(), 0);
+	ASSERT_EQ(workspace.memoryReport().getTotal().bytes, 0);
+
+	workspace.removeLevel(firstLevel);
+	ASSERT_EQ(workspace.getLevelsCount(), 1);
+	ASSERT_EQ(workspace.getLevel(1), nullptr);
+}
+
+TEST(Workspace, LevelsShareChunksBetweenEachOther)
+{
+	bench::registerSyntheticTypes();
+	const auto firstSynthetic = makeSyntheticLevel(1);
+	const auto secondSynthetic = makeSyntheticLevel(2);
+
+	Workspace workspace;
+	const auto firstLevel = workspace.addLevel(std::make_unique<SyntheticLevelAssetsProvider>(&firstSynthetic));
+	const auto secondLevel = workspace.addLevel(std::make_unique<SyntheticLevelAssetsProvider>(&secondSynthetic));
+
+	ASSERT_TRUE(workspace.loadLevels(2));
+	ASSERT_TRUE(workspace.isLevelLoaded(firstLevel));
+	ASSERT_TRUE(workspace.isLevelLoaded(secondLevel));
+	ASSERT_TRUE(workspace.getLoadError(secondLevel).empty());
+
+	const auto &first = *std::as_const(workspace).getLevel(firstLevel);
+	const auto &second = *std::as_const(workspace).getLevel(secondLevel);
+	const auto &firstChunks = first.getLevelGeometry()->chunks;
+	const auto &secondChunks = second.getLevelGeometry()->chunks;
+	ASSERT_EQ(secondChunks.size(), firstChunks.size());
+
+	// Every body of second level refers to body of first level
+	for (std::size_t chunkIndex = 0; chunkIndex < firstChunks.size(); ++chunkIndex)
+	{
+		if (firstChunks[chunkIndex].getKind() == PRMChunkRecognizedKind::CRK_ZERO_CHUNK || firstChunks[chunkIndex].getBuffer().empty())
+		{
+			continue;
+		}
+
+		ASSERT_TRUE(secondChunks[chunkIndex].isBufferShared());
+		ASSERT_EQ(secondChunks[chunkIndex].getBuffer().cbegin(), firstChunks[chunkIndex].getBuffer().cbegin());
+	}
+
+	ASSERT_GT(workspace.getSharedChunksCount(), 0);
+	ASSERT_GE(workspace.getSharedBytes(), getBodiesSize(second, true));
+
+	// Level alone counts all bodies it refers to, workspace counts bodies of second level once (by first level)
+	const auto firstReport = first.memoryReport();
+	const auto secondReport = second.memoryReport();
+	ASSERT_GT(getBodiesSize(second, true), 0);
+	ASSERT_GE(secondReport.get(MemoryCategory::PRM_CHUNKS).bytes, getBodiesSize(second, false));
+
+	const auto report = workspace.memoryReport();
+	ASSERT_EQ(report.get(MemoryCategory::PRM_CHUNKS).bytes, firstReport.get(MemoryCategory::PRM_CHUNKS).bytes + secondReport.get(MemoryCategory::PRM_CHUNKS).bytes - getBodiesSize(second, true));
+
+	gamelib::TypeRegistry::getInstance().reset();
+}
+
+TEST(Workspace, ObjectsAreFoundInAllLevels)
+{
+	bench::registerSyntheticTypes();
+	const auto firstSynthetic = makeSyntheticLevel(1);
+	const auto secondSynthetic = makeSyntheticLevel(2);
+
+	Workspace workspace;
+	const auto firstLevel = workspace.addLevel(std::make_unique<SyntheticLevelAssetsProvider>(&firstSynthetic));
+	const auto secondLevel = workspace.addLevel(std::make_unique<SyntheticLevelAssetsProvider>(&secondSynthetic));
+	ASSERT_TRUE(workspace.loadLevels(2));
+
+	// One group in first level, two groups in second one (ordered by level, then by object)
+	std::vector<Workspace::ObjectRef> results;
+	workspace.findObjects(SceneQuery::parse("type:ZGROUP"), results);
+	ASSERT_EQ(results.size(), 3);
+	ASSERT_EQ(results[0].levelIndex, firstLevel);
+	ASSERT_EQ(results[1].levelIndex, secondLevel);
+	ASSERT_EQ(results[2].levelIndex, secondLevel);
+	ASSERT_LT(results[1].objectIndex, results[2].objectIndex);
+
+	for (const auto &result : results)
+	{
+		const auto &object = std::as_const(workspace).getLevel(result.levelIndex)->getSceneObjects()[result.objectIndex];
+		ASSERT_EQ(object->getName().rfind("Group", 0), 0);
+	}
+
+	workspace.findObjectsByName("ROOT", results);
+	ASSERT_EQ(results, (std::vector<Workspace::ObjectRef> { { firstLevel, 0 }, { secondLevel, 0 } }));
+
+	// Removed level is not searched
+	workspace.removeLevel(firstLevel);
+	workspace.findObjects(SceneQuery::parse("type:ZGROUP"), results);
+	ASSERT_EQ(results.size(), 2);
+
+	gamelib::TypeRegistry::getInstance().reset();
+}
\ No newline at end of file
@@ -0,0 +1,306 @@
+#include <GameLib/PRM/PRMReader.h>
+#include <GameLib/PRM/PRMWriter.h>
+#include <GameLib/PRM/PRMChunkIndex.h>
+#include <GameLib/PRM/PRMException.h>
+#include <GameLib/Level.h>
+#include <unordered_map>
+#include <string_view>
+#include <filesystem>
+#include <algorithm>
+#include <fstream>
+#include <cstdlib>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <utility>
+
+extern "C"
+{
+#include <zip.h>
+}
+
+
+namespace
+{
+	struct ReportTotals
+	{
+		std::size_t levels { 0 };
+		std::size_t failedLevels { 0 };
+		std::size_t chunks { 0 };
+		std::size_t duplicateChunks { 0 };
+		std::size_t totalBytes { 0 };
+		std::size_t reclaimableBytes { 0 };
+		std::size_t crossLevelBytes { 0 };
+	};
+
+	bool hasExtension(const std::filesystem::path &path, std::string_view extension)
+	{
+		auto pathExtension = path.extension().string();
+		std::transform(pathExtension.begin(), pathExtension.end(), pathExtension.begin(), [](unsigned char ch) { return static_cast<char>(std::toupper(ch)); });
+		return pathExtension == extension;
+	}
+
+	bool readFile(const std::filesystem::path &path, std::vector<uint8_t> &buffer)
+	{
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file)
+		{
+			return false;
+		}
+
+		buffer.resize(static_cast<std::size_t>(file.tellg()));
+		file.seekg(0);
+		return static_cast<bool>(file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size())));
+	}
+
+	/**
+	 * @brief Read PRM entry of level archive (each level of game is a ZIP with GMS, PRP, PRM, etc.)
+	 */
+	bool readPRMFromArchive(const std::filesystem::path &path, std::vector<uint8_t> &buffer)
+	{
+		int errorCode = 0;
+		zip_t *archive = zip_open(path.string().c_str(), ZIP_RDONLY, &errorCode);
+		if (!archive)
+		{
+			return false;
+		}
+
+		bool isRead = false;
+		const zip_int64_t entriesCount = zip_get_num_entries(archive, 0);
+
+		for (zip_int64_t entryIndex = 0; entryIndex < entriesCount && !isRead; ++entryIndex)
+		{
+			const char *entryName = zip_get_name(archive, entryIndex, ZIP_FL_ENC_GUESS);
+			zip_stat_t entryInfo;
+
+			if (!entryName || !hasExtension(entryName, ".PRM") || zip_stat_index(archive, entryIndex, ZIP_STAT_SIZE, &entryInfo) < 0)
+			{
+				continue;
+			}
+
+			zip_file_t *entry = zip_fopen_index(archive, entryIndex, 0);
+			if (!entry)
+			{
+				break;
+			}
+
+			buffer.resize(static_cast<std::size_t>(entryInfo.size));
+			isRead = zip_fread(entry, buffer.data(), entryInfo.size) == static_cast<zip_int64_t>(entryInfo.size);
+			zip_fclose(entry);
+		}
+
+		zip_close(archive);
+		return isRead;
+	}
+
+	void collectLevels(const std::filesystem::path &path, std::vector<std::filesystem::path> &levels)
+	{
+		std::error_code ec;
+
+		if (std::filesystem::is_regular_file(path, ec))
+		{
+			levels.push_back(path);
+			return;
+		}
+
+		for (const auto &entry : std::filesystem::recursive_directory_iterator(path, std::filesystem::directory_options::skip_permission_denied, ec))
+		{
+			if (entry.is_regular_file(ec) && (hasExtension(entry.path(), ".PRM") || hasExtension(entry.path(), ".ZIP")))
+			{
+				levels.push_back(entry.path());
+			}
+		}
+
+		std::sort(levels.begin(), levels.end());
+	}
+
+	const char *kindToString(gamelib::prm::PRMChunkRecognizedKind kind)
+	{
+		switch (kind)
+		{
+			case gamelib::prm::PRMChunkRecognizedKind::CRK_ZERO_CHUNK: return "zero";
+			case gamelib::prm::PRMChunkRecognizedKind::CRK_INDEX_BUFFER: return "index";
+			case gamelib::prm::PRMChunkRecognizedKind::CRK_VERTEX_BUFFER: return "vertex";
+			case gamelib::prm::PRMChunkRecognizedKind::CRK_DESCRIPTION_BUFFER: return "description";
+			case gamelib::prm::PRMChunkRecognizedKind::CRK_UNKNOWN_BUFFER: return "unknown";
+		}
+
+		return "unknown";
+	}
+
+	double toPercents(std::size_t part, std::size_t total)
+	{
+		return total ? (100.0 * static_cast<double>(part) / static_cast<double>(total)) : 0.0;
+	}
+}
+
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		printf("Usage: %s <PRM file, level ZIP or game folder> [--threads N] [--write-deduplicated <output folder>] [--compact] [--verbose]\n", argv[0]);
+		return -1;
+	}
+
+	const std::filesystem::path inputPath { argv[1] };
+	std::filesystem::path outputPath {};
+	int threadsCount = 0;
+	bool isVerbose = false;
+	bool isCompactionEnabled = false;
+
+	for (int i = 2; i < argc; ++i)
+	{
+		const std::string_view arg { argv[i] };
+
+		if (arg == "--threads" && i + 1 < argc)
+		{
+			threadsCount = std::atoi(argv[++i]);
+		}
+		else if (arg == "--write-deduplicated" && i + 1 < argc)
+		{
+			outputPath = argv[++i];
+		}
+		else if (arg == "--compact")
+		{
+			isCompactionEnabled = true;
+		}
+		else if (arg == "--verbose")
+		{
+			isVerbose = true;
+		}
+	}
+
+	std::vector<std::filesystem::path> levels;
+	collectLevels(inputPath, levels);
+
+	if (levels.empty())
+	{
+		printf("No PRM files or level archives found at %s\n", inputPath.string().c_str());
+		return -1;
+	}
+
+	if (!outputPath.empty())
+	{
+		std::error_code ec;
+		std::filesystem::create_directories(outputPath, ec);
+	}
+
+	ReportTotals totals;
+	std::unordered_map<std::uint64_t, std::size_t> contentSeenInLevels; // hash -> size of canonical chunk
+
+	for (const auto &levelPath : levels)
+	{
+		std::vector<uint8_t> prmBuffer;
+		const bool isArchive = hasExtension(levelPath, ".ZIP");
+
+		if (!(isArchive ? readPRMFromArchive(levelPath, prmBuffer) : readFile(levelPath, prmBuffer)))
+		{
+			if (!isArchive)
+			{
+				printf("%s: unable to read file\n", levelPath.string().c_str());
+				++totals.failedLevels;
+			}
+
+			continue; // Archives without PRM are not levels
+		}
+
+		gamelib::LevelGeometry geometry;
+
+		try
+		{
+			gamelib::prm::PRMReader reader { geometry.header, geometry.chunkDescriptors, geometry.chunks };
+			if (!reader.read(gamelib::Span(prmBuffer.data(), static_cast<int64_t>(prmBuffer.size()))))
+			{
+				printf("%s: unable to read PRM\n", levelPath.string().c_str());
+				++totals.failedLevels;
+				continue;
+			}
+		}
+		catch (const gamelib::prm::PRMException &ex)
+		{
+			printf("%s: bad PRM file (%s)\n", levelPath.string().c_str(), ex.what());
+			++totals.failedLevels;
+			continue;
+		}
+
+		gamelib::prm::PRMChunkIndex index;
+		index.build(geometry.chunks, threadsCount);
+
+		std::size_t levelBytes = 0;
+		for (const auto &chunk : geometry.chunks)
+		{
+			levelBytes += static_cast<std::size_t>(chunk.getBuffer().size());
+		}
+
+		// Content which was already seen in another level (by hash only)
+		for (std::uint32_t chunkIndex = 0; chunkIndex < geometry.chunks.size(); ++chunkIndex)
+		{
+			const auto chunkSize = static_cast<std::size_t>(std::as_const(geometry.chunks[chunkIndex]).getBuffer().size());
+			if (index.isDuplicate(chunkIndex) || !chunkSize || !chunkIndex)
+			{
+				continue;
+			}
+
+			auto [it, isNew] = contentSeenInLevels.try_emplace(index.getChunkHash(chunkIndex), chunkSize);
+			if (!isNew && it->second == chunkSize)
+			{
+				totals.crossLevelBytes += chunkSize;
+			}
+		}
+
+		printf("%s: %zu chunks, %zu duplicates in %zu groups, %zu of %zu bytes reclaimable (%.2f%%)\n",
+			   levelPath.filename().string().c_str(),
+			   geometry.chunks.size(),
+			   index.getDuplicateChunksCount(),
+			   index.getDuplicateGroups().size(),
+			   index.getReclaimableBytes(),
+			   levelBytes,
+			   toPercents(index.getReclaimableBytes(), levelBytes));
+
+		if (isVerbose)
+		{
+			for (const auto &group : index.getDuplicateGroups())
+			{
+				printf("\t%016llx %s, %zu bytes: chunk #%u has %zu duplicates\n",
+					   static_cast<unsigned long long>(group.hash),
+					   kindToString(group.kind),
+					   group.chunkSize,
+					   group.canonicalChunk,
+					   group.duplicates.size());
+			}
+		}
+
+		if (!outputPath.empty())
+		{
+			gamelib::prm::PRMWriterOptions writerOptions;
+			writerOptions.layout = gamelib::prm::PRMWriterLayout::WL_SEQUENTIAL;
+			writerOptions.compactUnusedChunks = isCompactionEnabled;
+			writerOptions.deduplicationIndex = &index;
+
+			std::vector<uint8_t> deduplicated;
+			gamelib::prm::PRMWriter::write(geometry.header, geometry.chunkDescriptors, geometry.chunks, writerOptions, deduplicated);
+
+			auto outputFilePath = outputPath / levelPath.filename();
+			outputFilePath.replace_extension(".PRM");
+
+			std::ofstream outputFile(outputFilePath, std::ios::binary | std::ios::trunc);
+			outputFile.write(reinterpret_cast<const char*>(deduplicated.data()), static_cast<std::streamsize>(deduplicated.size()));
+
+			printf("\tdeduplicated PRM: %s (%zu -> %zu bytes)\n", outputFilePath.string().c_str(), prmBuffer.size(), deduplicated.size());
+		}
+
+		++totals.levels;
+		totals.chunks += geometry.chunks.size();
+		totals.duplicateChunks += index.getDuplicateChunksCount();
+		totals.totalBytes += levelBytes;
+		totals.reclaimableBytes += index.getReclaimableBytes();
+	}
+
+	printf("\nLevels: %zu (failed: %zu)\n", totals.levels, totals.failedLevels);
+	printf("Chunks: %zu, duplicates: %zu\n", totals.chunks, totals.duplicateChunks);
+	printf("Reclaimable inside of levels: %zu of %zu bytes (%.2f%%)\n", totals.reclaimableBytes, totals.totalBytes, toPercents(totals.reclaimableBytes, totals.totalBytes));
+	printf("Content shared between levels: %zu bytes\n", totals.crossLevelBytes);
+
+	return totals.failedLevels ? 1 : 0;
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace rasterizer
+{
+	/**
+	 * @brief RGBA8 image (row major, top-down)
+	 */
+	struct Image
+	{
+		static constexpr int kBytesPerPixel = 4;
+
+		int width { 0 };
+		int height { 0 };
+		std::vector<std::uint8_t> pixels {};
+
+		Image() = default;
+		Image(int w, int h, std::uint32_t fillColor = 0u);
+
+		[[nodiscard]] bool empty() const;
+		[[nodiscard]] std::uint32_t getPixel(int x, int y) const;
+		void setPixel(int x, int y, std::uint32_t color);
+
+		/**
+		 * @fn saveAsTGA
+		 * @param path - output file path
+		 * @return true when file was written
+		 * @note Writes uncompressed 32 bit TGA, no extra dependencies required
+		 */
+		bool saveAsTGA(const std::string &path) const;
+
+		/**
+		 * @fn makeColor
+		 * @return packed color (R in lowest byte, so in-memory layout is R, G, B, A)
+		 */
+		[[nodiscard]] static constexpr std::uint32_t makeColor(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a = 0xFF)
+		{
+			return static_cast<std::uint32_t>(r) | (static_cast<std::uint32_t>(g) << 8) | (static_cast<std::uint32_t>(b) << 16) | (static_cast<std::uint32_t>(a) << 24);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <GameLib/PRM/PRMChunk.h>
+#include <Rasterizer/RenderOptions.h>
+#include <Rasterizer/Image.h>
+#include <cstdint>
+#include <vector>
+
+
+namespace rasterizer
+{
+	class PrimitiveRenderer
+	{
+	public:
+		PrimitiveRenderer() = delete;
+
+		/**
+		 * @fn render
+		 * @param chunks - all chunks of PRM file (see gamelib::LevelGeometry::chunks)
+		 * @param primitiveIndex - index of description chunk
+		 * @param options - render options
+		 * @param image - output image
+		 * @return true when primitive has any geometry and was rendered
+		 */
+		static bool render(const std::vector<gamelib::prm::PRMChunk> &chunks, std::uint32_t primitiveIndex, const RenderOptions &options, Image &image);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <GameLib/PRM/PRMMesh.h>
+#include <Rasterizer/RenderOptions.h>
+#include <Rasterizer/Image.h>
+#include <vector>
+
+
+namespace rasterizer
+{
+	/**
+	 * @brief Multi-threaded tile based software rasterizer
+	 * @details Pipeline:
+	 *           1. Triangle setup (parallel by ranges of triangles): vertices are projected by orthographic camera which fits bounding box of all meshes,
+	 *              triangle color is calculated from face normal, triangle is binned into every screen tile which overlaps its bounding rectangle.
+	 *           2. Rasterization (parallel by tiles): every worker takes next free tile and rasterizes binned triangles with depth test.
+	 *          Workers never write to the same tile, so no synchronization required except tile counter.
+	 *          Result does not depend on threads count.
+	 */
+	class Rasterizer
+	{
+	public:
+		Rasterizer() = delete;
+
+		/**
+		 * @fn render
+		 * @param meshes - meshes to render (in the same model space)
+		 * @param options - render options
+		 * @param image - output image (will be re-created with options.width x options.height size)
+		 * @return true when at least one triangle was processed
+		 */
+		static bool render(const std::vector<gamelib::prm::PRMMesh> &meshes, const RenderOptions &options, Image &image);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <Rasterizer/Image.h>
+#include <cstdint>
+
+
+namespace rasterizer
+{
+	enum class ShadingMode
+	{
+		SM_FLAT,   ///< Base color lit by directional light (face normal)
+		SM_NORMAL  ///< Face normal in view space as color
+	};
+
+	struct RenderOptions
+	{
+		int width { 256 };
+		int height { 256 };
+		ShadingMode shadingMode { ShadingMode::SM_FLAT };
+		int tileSize { 32 };
+		int threadsCount { 0 }; ///< 0 - use all hardware threads, 1 - render on caller thread
+		float yawDegrees { 45.f };
+		float pitchDegrees { 30.f };
+		std::uint32_t backgroundColor { Image::makeColor(0x2B, 0x2B, 0x2B) };
+		std::uint32_t baseColor { Image::makeColor(0xC8, 0xC8, 0xC8) };
+	};
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <GameLib/PRM/PRMChunk.h>
+#include <Rasterizer/ThumbnailCache.h>
+#include <Rasterizer/RenderOptions.h>
+#include <Rasterizer/Image.h>
+#include <unordered_map>
+#include <cstdint>
+#include <vector>
+
+
+namespace rasterizer
+{
+	/**
+	 * @brief Single image with thumbnails of all primitives of level (every thumbnail is a cell of grid)
+	 */
+	class ThumbnailAtlas
+	{
+	public:
+		struct Cell
+		{
+			int x { 0 };
+			int y { 0 };
+			int width { 0 };
+			int height { 0 };
+		};
+
+		struct Stats
+		{
+			std::size_t totalPrimitives { 0 };
+			std::size_t fromCache { 0 };
+			std::size_t rendered { 0 };
+			std::size_t withoutGeometry { 0 };
+		};
+
+		ThumbnailAtlas() = default;
+
+		/**
+		 * @fn build
+		 * @param chunks - all chunks of PRM file
+		 * @param options - render options, options.width & options.height are size of the cell
+		 * @param cache - optional cache of thumbnails. Primitives with known content hash are not rendered, new thumbnails are added to cache.
+		 * @return true when atlas contains at least one thumbnail
+		 * @note Content hashes & thumbnails are computed in parallel (options.threadsCount workers)
+		 */
+		bool build(const std::vector<gamelib::prm::PRMChunk> &chunks, const RenderOptions &options, ThumbnailCache *cache = nullptr);
+
+		void clear();
+
+		[[nodiscard]] const Image &getImage() const;
+		[[nodiscard]] const Cell *getCell(std::uint32_t primitiveIndex) const;
+		[[nodiscard]] const std::unordered_map<std::uint32_t, Cell> &getCells() const;
+		[[nodiscard]] const Stats &getStats() const;
+
+	private:
+		Image m_image {};
+		std::unordered_map<std::uint32_t, Cell> m_cells {};
+		Stats m_stats {};
+	};
+}
\ No newline at end of file
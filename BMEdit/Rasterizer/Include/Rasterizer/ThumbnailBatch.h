@@ -0,0 +1,40 @@
+#pragma once
+
+#include <GameLib/PRM/PRMChunk.h>
+#include <Rasterizer/RenderOptions.h>
+#include <Rasterizer/Image.h>
+#include <functional>
+#include <cstdint>
+#include <vector>
+
+
+namespace rasterizer
+{
+	class ThumbnailBatch
+	{
+	public:
+		/**
+		 * @brief Called for every rendered primitive.
+		 * @note Called from worker threads! Callback must be thread safe.
+		 */
+		using OnThumbnailReady = std::function<void(std::uint32_t /* primitiveIndex */, const Image& /* thumbnail */)>;
+
+		ThumbnailBatch() = delete;
+
+		/**
+		 * @fn collectPrimitives
+		 * @return indices of all description chunks (primitives which could be rendered)
+		 */
+		[[nodiscard]] static std::vector<std::uint32_t> collectPrimitives(const std::vector<gamelib::prm::PRMChunk> &chunks);
+
+		/**
+		 * @fn renderAll
+		 * @param chunks - all chunks of PRM file
+		 * @param primitives - indices of description chunks to render
+		 * @param options - render options (options.threadsCount used as count of workers, every primitive rendered on single thread)
+		 * @param onReady - callback
+		 * @return count of rendered primitives
+		 */
+		static std::size_t renderAll(const std::vector<gamelib::prm::PRMChunk> &chunks, const std::vector<std::uint32_t> &primitives, const RenderOptions &options, const OnThumbnailReady &onReady);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <GameLib/PRM/PRMChunk.h>
+#include <Rasterizer/Image.h>
+#include <unordered_map>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <mutex>
+
+
+namespace rasterizer
+{
+	/**
+	 * @brief Thread safe storage of rendered thumbnails keyed by content hash of primitive.
+	 * @note Empty image is a valid value: it means that primitive has no geometry (so we don't need to try to render it again)
+	 * @details Cache is bounded by capacity (bytes of pixels): least recently used thumbnails are evicted. Entries are saved from the most recently used one,
+	 *          so order of use survives between runs.
+	 */
+	class ThumbnailCache
+	{
+	public:
+		static constexpr std::uint32_t kMagic = 0x43544D42; // BMTC
+		static constexpr std::uint32_t kVersion = 2;
+		static constexpr std::size_t kDefaultCapacity = 64u * 1024u * 1024u;
+
+		explicit ThumbnailCache(std::size_t capacity = kDefaultCapacity);
+
+		/**
+		 * @fn find
+		 * @note Found thumbnail becomes the most recently used one
+		 */
+		[[nodiscard]] bool find(std::uint64_t contentHash, Image &image);
+		void insert(std::uint64_t contentHash, const Image &image);
+		void clear();
+		[[nodiscard]] std::size_t size() const;
+
+		void setCapacity(std::size_t capacity);
+		[[nodiscard]] std::size_t getCapacity() const;
+		[[nodiscard]] std::size_t getBytes() const;
+
+		/**
+		 * @fn isDirty
+		 * @return true when entries were added, changed or evicted since last load/save (cache file should be written)
+		 */
+		[[nodiscard]] bool isDirty() const;
+
+		/**
+		 * @fn loadFromFile
+		 * @note Cache file of different version (or broken file) is ignored
+		 * @return true when file was loaded
+		 */
+		bool loadFromFile(const std::string &path);
+		bool saveToFile(const std::string &path);
+
+		/**
+		 * @fn computePrimitiveHash
+		 * @return 64 bit hash of description chunk & all vertex/index buffers referenced by it (0 when primitive is invalid)
+		 */
+		[[nodiscard]] static std::uint64_t computePrimitiveHash(const std::vector<gamelib::prm::PRMChunk> &chunks, std::uint32_t primitiveIndex);
+
+	private:
+		struct Entry
+		{
+			Image image {};
+			std::uint64_t lastUse { 0 };
+		};
+
+		void evictOverCapacity();
+
+	private:
+		mutable std::mutex m_lock;
+		std::unordered_map<std::uint64_t, Entry> m_thumbnails;
+		std::size_t m_capacity { kDefaultCapacity };
+		std::size_t m_bytes { 0 };
+		std::uint64_t m_useCounter { 0 };
+		bool m_isDirty { false };
+	};
+}
\ No newline at end of file
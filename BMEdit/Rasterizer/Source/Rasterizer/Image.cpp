@@ -0,0 +1,88 @@
+#include <Rasterizer/Image.h>
+#include <fstream>
+#include <array>
+
+
+namespace rasterizer
+{
+	Image::Image(int w, int h, std::uint32_t fillColor)
+		: width(w)
+		, height(h)
+	{
+		pixels.resize(static_cast<std::size_t>(w) * h * kBytesPerPixel);
+
+		for (int y = 0; y < height; ++y)
+		{
+			for (int x = 0; x < width; ++x)
+			{
+				setPixel(x, y, fillColor);
+			}
+		}
+	}
+
+	bool Image::empty() const
+	{
+		return width <= 0 || height <= 0 || pixels.empty();
+	}
+
+	std::uint32_t Image::getPixel(int x, int y) const
+	{
+		const auto offset = (static_cast<std::size_t>(y) * width + x) * kBytesPerPixel;
+		return makeColor(pixels[offset + 0], pixels[offset + 1], pixels[offset + 2], pixels[offset + 3]);
+	}
+
+	void Image::setPixel(int x, int y, std::uint32_t color)
+	{
+		const auto offset = (static_cast<std::size_t>(y) * width + x) * kBytesPerPixel;
+		pixels[offset + 0] = static_cast<std::uint8_t>(color & 0xFFu);
+		pixels[offset + 1] = static_cast<std::uint8_t>((color >> 8) & 0xFFu);
+		pixels[offset + 2] = static_cast<std::uint8_t>((color >> 16) & 0xFFu);
+		pixels[offset + 3] = static_cast<std::uint8_t>((color >> 24) & 0xFFu);
+	}
+
+	bool Image::saveAsTGA(const std::string &path) const
+	{
+		if (empty() || width > 0xFFFF || height > 0xFFFF)
+		{
+			return false;
+		}
+
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		if (!file)
+		{
+			return false;
+		}
+
+		// Uncompressed true-color image, 32 bpp, 8 bits of alpha, top-left origin
+		std::array<std::uint8_t, 18> header {};
+		header[2] = 2;
+		header[12] = static_cast<std::uint8_t>(width & 0xFF);
+		header[13] = static_cast<std::uint8_t>((width >> 8) & 0xFF);
+		header[14] = static_cast<std::uint8_t>(height & 0xFF);
+		header[15] = static_cast<std::uint8_t>((height >> 8) & 0xFF);
+		header[16] = 32;
+		header[17] = 0x28;
+
+		file.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+
+		// TGA stores pixels as BGRA
+		std::vector<std::uint8_t> row(static_cast<std::size_t>(width) * kBytesPerPixel);
+
+		for (int y = 0; y < height; ++y)
+		{
+			const auto *src = &pixels[static_cast<std::size_t>(y) * width * kBytesPerPixel];
+
+			for (int x = 0; x < width; ++x)
+			{
+				row[x * kBytesPerPixel + 0] = src[x * kBytesPerPixel + 2];
+				row[x * kBytesPerPixel + 1] = src[x * kBytesPerPixel + 1];
+				row[x * kBytesPerPixel + 2] = src[x * kBytesPerPixel + 0];
+				row[x * kBytesPerPixel + 3] = src[x * kBytesPerPixel + 3];
+			}
+
+			file.write(reinterpret_cast<const char*>(row.data()), static_cast<std::streamsize>(row.size()));
+		}
+
+		return file.good();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,18 @@
+#include <Rasterizer/PrimitiveRenderer.h>
+#include <Rasterizer/Rasterizer.h>
+#include <GameLib/PRM/PRMMeshExtractor.h>
+
+
+namespace rasterizer
+{
+	bool PrimitiveRenderer::render(const std::vector<gamelib::prm::PRMChunk> &chunks, std::uint32_t primitiveIndex, const RenderOptions &options, Image &image)
+	{
+		std::vector<gamelib::prm::PRMMesh> meshes;
+		if (!gamelib::prm::PRMMeshExtractor::extract(chunks, primitiveIndex, meshes))
+		{
+			return false;
+		}
+
+		return Rasterizer::render(meshes, options, image);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,343 @@
+#include <Rasterizer/Rasterizer.h>
+#include <GameLib/Workers.h>
+#include <GameLib/PRM/PRMMeshExtractor.h>
+#include <algorithm>
+#include <numbers>
+#include <limits>
+#include <atomic>
+#include <cmath>
+
+
+namespace rasterizer
+{
+	namespace
+	{
+		struct ViewVertex
+		{
+			float x { .0f }; ///< screen space X (pixels)
+			float y { .0f }; ///< screen space Y (pixels)
+			float z { .0f }; ///< depth [0; 1], 0 - near
+		};
+
+		struct SetupTriangle
+		{
+			ViewVertex v[3];
+			std::uint32_t color { 0u };
+		};
+
+		struct Camera
+		{
+			gamelib::Vector3 center {};
+			float invRadius { 1.f };
+			float yawSin { .0f }, yawCos { 1.f };
+			float pitchSin { .0f }, pitchCos { 1.f };
+			float scale { 1.f };
+			float offsetX { .0f }, offsetY { .0f };
+
+			/**
+			 * @brief Transform model space point into normalized view space ([-1; 1] for bounding sphere, X - right, Y - up, Z - forward)
+			 */
+			[[nodiscard]] gamelib::Vector3 toView(const gamelib::Vector3 &p) const
+			{
+				const auto local = (p - center) * invRadius;
+
+				// Glacier uses Z up, so yaw rotates around Z and pitch tilts camera down
+				const float x1 = local.x * yawCos - local.y * yawSin;
+				const float y1 = local.x * yawSin + local.y * yawCos;
+				const float z1 = local.z;
+
+				return gamelib::Vector3 { x1, z1 * pitchCos - y1 * pitchSin, y1 * pitchCos + z1 * pitchSin };
+			}
+
+			[[nodiscard]] ViewVertex toScreen(const gamelib::Vector3 &view) const
+			{
+				return ViewVertex {
+				    offsetX + (view.x * 0.5f + 0.5f) * scale,
+				    offsetY + (-view.y * 0.5f + 0.5f) * scale,
+				    std::clamp(view.z * 0.5f + 0.5f, .0f, 1.f)
+				};
+			}
+		};
+
+		Camera makeCamera(const gamelib::BoundingBox &boundingBox, const RenderOptions &options)
+		{
+			constexpr float kDegToRad = std::numbers::pi_v<float> / 180.f;
+			constexpr float kFitFactor = 0.95f;
+
+			Camera camera;
+			camera.center = boundingBox.getCenter();
+
+			const auto extent = boundingBox.max - boundingBox.min;
+			const float radius = 0.5f * std::sqrt(extent.x * extent.x + extent.y * extent.y + extent.z * extent.z);
+			camera.invRadius = radius > std::numeric_limits<float>::epsilon() ? 1.f / radius : 1.f;
+
+			camera.yawSin = std::sin(options.yawDegrees * kDegToRad);
+			camera.yawCos = std::cos(options.yawDegrees * kDegToRad);
+			camera.pitchSin = std::sin(options.pitchDegrees * kDegToRad);
+			camera.pitchCos = std::cos(options.pitchDegrees * kDegToRad);
+
+			const float side = static_cast<float>(std::min(options.width, options.height));
+			camera.scale = side * kFitFactor;
+			camera.offsetX = (static_cast<float>(options.width) - camera.scale) * 0.5f;
+			camera.offsetY = (static_cast<float>(options.height) - camera.scale) * 0.5f;
+			return camera;
+		}
+
+		std::uint8_t toColorChannel(float value)
+		{
+			return static_cast<std::uint8_t>(std::clamp(value, .0f, 1.f) * 255.f + 0.5f);
+		}
+
+		std::uint32_t shadeTriangle(const gamelib::Vector3 &a, const gamelib::Vector3 &b, const gamelib::Vector3 &c, const RenderOptions &options)
+		{
+			const auto e1 = b - a;
+			const auto e2 = c - a;
+
+			gamelib::Vector3 normal {
+			    e1.y * e2.z - e1.z * e2.y,
+			    e1.z * e2.x - e1.x * e2.z,
+			    e1.x * e2.y - e1.y * e2.x
+			};
+
+			const float length = std::sqrt(normal.x * normal.x + normal.y * normal.y + normal.z * normal.z);
+			normal = length > std::numeric_limits<float>::epsilon() ? normal / length : gamelib::Vector3 { .0f, .0f, -1.f };
+
+			// We don't know winding order of primitives, so every face is two-sided (normal must look to camera)
+			if (normal.z > .0f)
+			{
+				normal = normal * -1.f;
+			}
+
+			if (options.shadingMode == ShadingMode::SM_NORMAL)
+			{
+				return Image::makeColor(toColorChannel(normal.x * 0.5f + 0.5f), toColorChannel(normal.y * 0.5f + 0.5f), toColorChannel(-normal.z * 0.5f + 0.5f));
+			}
+
+			// Directional light from top-left-front (already normalized)
+			constexpr gamelib::Vector3 kLightDir { -0.3f, 0.5f, -0.812404f };
+			constexpr float kAmbient = 0.25f;
+
+			const float diffuse = std::max(.0f, normal.x * kLightDir.x + normal.y * kLightDir.y + normal.z * kLightDir.z);
+			const float intensity = kAmbient + (1.f - kAmbient) * diffuse;
+
+			const auto base = options.baseColor;
+			return Image::makeColor(
+			    toColorChannel(static_cast<float>(base & 0xFFu) / 255.f * intensity),
+			    toColorChannel(static_cast<float>((base >> 8) & 0xFFu) / 255.f * intensity),
+			    toColorChannel(static_cast<float>((base >> 16) & 0xFFu) / 255.f * intensity));
+		}
+
+		float edgeFunction(const ViewVertex &a, const ViewVertex &b, float px, float py)
+		{
+			return (b.x - a.x) * (py - a.y) - (b.y - a.y) * (px - a.x);
+		}
+	}
+
+	bool Rasterizer::render(const std::vector<gamelib::prm::PRMMesh> &meshes, const RenderOptions &options, Image &image)
+	{
+		if (options.width <= 0 || options.height <= 0 || options.tileSize <= 0)
+		{
+			return false;
+		}
+
+		image = Image(options.width, options.height, options.backgroundColor);
+
+		// Collect triangles
+		std::vector<std::size_t> trianglesPrefix; // first triangle of each mesh in global numbering
+		trianglesPrefix.reserve(meshes.size());
+
+		std::size_t totalTriangles = 0;
+		for (const auto &mesh : meshes)
+		{
+			trianglesPrefix.push_back(totalTriangles);
+			totalTriangles += mesh.getTrianglesCount();
+		}
+
+		if (!totalTriangles)
+		{
+			return false;
+		}
+
+		const auto camera = makeCamera(gamelib::prm::PRMMeshExtractor::calculateBoundingBox(meshes), options);
+
+		const int tilesX = (options.width + options.tileSize - 1) / options.tileSize;
+		const int tilesY = (options.height + options.tileSize - 1) / options.tileSize;
+		const int tilesCount = tilesX * tilesY;
+
+		const int threadsCount = gamelib::resolveWorkersCount(options.threadsCount, tilesCount);
+
+		// Stage 1: Setup & binning. Every worker owns its own triangles & bins, so no locks here.
+		struct WorkerBins
+		{
+			std::vector<SetupTriangle> triangles;
+			std::vector<std::vector<std::uint32_t>> tiles;
+		};
+
+		std::vector<WorkerBins> bins(threadsCount);
+
+		gamelib::runWorkers(threadsCount, [&](int workerIndex)
+		{
+			auto &workerBins = bins[workerIndex];
+			workerBins.tiles.resize(tilesCount);
+
+			const std::size_t rangeSize = (totalTriangles + threadsCount - 1) / threadsCount;
+			const std::size_t rangeBegin = std::min(totalTriangles, rangeSize * workerIndex);
+			const std::size_t rangeEnd = std::min(totalTriangles, rangeBegin + rangeSize);
+
+			if (rangeBegin >= rangeEnd)
+			{
+				return;
+			}
+
+			workerBins.triangles.reserve(rangeEnd - rangeBegin);
+
+			auto meshIt = std::upper_bound(trianglesPrefix.begin(), trianglesPrefix.end(), rangeBegin);
+			std::size_t meshIndex = std::distance(trianglesPrefix.begin(), meshIt) - 1;
+
+			for (std::size_t triangleIndex = rangeBegin; triangleIndex < rangeEnd; ++triangleIndex)
+			{
+				while (meshIndex + 1 < meshes.size() && triangleIndex >= trianglesPrefix[meshIndex + 1])
+				{
+					++meshIndex;
+				}
+
+				const auto &mesh = meshes[meshIndex];
+				const auto local = (triangleIndex - trianglesPrefix[meshIndex]) * 3;
+
+				const auto a = camera.toView(mesh.vertices[mesh.indices[local + 0]]);
+				const auto b = camera.toView(mesh.vertices[mesh.indices[local + 1]]);
+				const auto c = camera.toView(mesh.vertices[mesh.indices[local + 2]]);
+
+				SetupTriangle triangle;
+				triangle.v[0] = camera.toScreen(a);
+				triangle.v[1] = camera.toScreen(b);
+				triangle.v[2] = camera.toScreen(c);
+
+				const float area = edgeFunction(triangle.v[0], triangle.v[1], triangle.v[2].x, triangle.v[2].y);
+				if (std::abs(area) <= std::numeric_limits<float>::epsilon())
+				{
+					continue; // Degenerated
+				}
+
+				if (area < .0f)
+				{
+					std::swap(triangle.v[1], triangle.v[2]);
+				}
+
+				triangle.color = shadeTriangle(a, b, c, options);
+
+				const float minX = std::min({ triangle.v[0].x, triangle.v[1].x, triangle.v[2].x });
+				const float maxX = std::max({ triangle.v[0].x, triangle.v[1].x, triangle.v[2].x });
+				const float minY = std::min({ triangle.v[0].y, triangle.v[1].y, triangle.v[2].y });
+				const float maxY = std::max({ triangle.v[0].y, triangle.v[1].y, triangle.v[2].y });
+
+				if (maxX < .0f || maxY < .0f || minX >= static_cast<float>(options.width) || minY >= static_cast<float>(options.height))
+				{
+					continue; // Out of screen
+				}
+
+				const int tileMinX = std::clamp(static_cast<int>(minX) / options.tileSize, 0, tilesX - 1);
+				const int tileMaxX = std::clamp(static_cast<int>(maxX) / options.tileSize, 0, tilesX - 1);
+				const int tileMinY = std::clamp(static_cast<int>(minY) / options.tileSize, 0, tilesY - 1);
+				const int tileMaxY = std::clamp(static_cast<int>(maxY) / options.tileSize, 0, tilesY - 1);
+
+				const auto setupIndex = static_cast<std::uint32_t>(workerBins.triangles.size());
+				workerBins.triangles.emplace_back(triangle);
+
+				for (int ty = tileMinY; ty <= tileMaxY; ++ty)
+				{
+					for (int tx = tileMinX; tx <= tileMaxX; ++tx)
+					{
+						workerBins.tiles[ty * tilesX + tx].push_back(setupIndex);
+					}
+				}
+			}
+		});
+
+		// Stage 2: Rasterization
+		std::vector<float> depthBuffer(static_cast<std::size_t>(options.width) * options.height, std::numeric_limits<float>::max());
+		std::atomic<int> nextTile { 0 };
+
+		gamelib::runWorkers(threadsCount, [&](int)
+		{
+			for (int tileIndex = nextTile.fetch_add(1); tileIndex < tilesCount; tileIndex = nextTile.fetch_add(1))
+			{
+				const int tileX0 = (tileIndex % tilesX) * options.tileSize;
+				const int tileY0 = (tileIndex / tilesX) * options.tileSize;
+				const int tileX1 = std::min(tileX0 + options.tileSize, options.width);
+				const int tileY1 = std::min(tileY0 + options.tileSize, options.height);
+
+				// Bins are visited in order of workers, so triangles are visited in original order
+				for (const auto &workerBins : bins)
+				{
+					if (workerBins.tiles.empty())
+					{
+						continue;
+					}
+
+					for (const auto setupIndex : workerBins.tiles[tileIndex])
+					{
+						const auto &triangle = workerBins.triangles[setupIndex];
+						const auto &v0 = triangle.v[0];
+						const auto &v1 = triangle.v[1];
+						const auto &v2 = triangle.v[2];
+
+						const int x0 = std::max(tileX0, static_cast<int>(std::floor(std::min({ v0.x, v1.x, v2.x }))));
+						const int x1 = std::min(tileX1, static_cast<int>(std::ceil(std::max({ v0.x, v1.x, v2.x }))) + 1);
+						const int y0 = std::max(tileY0, static_cast<int>(std::floor(std::min({ v0.y, v1.y, v2.y }))));
+						const int y1 = std::min(tileY1, static_cast<int>(std::ceil(std::max({ v0.y, v1.y, v2.y }))) + 1);
+
+						if (x0 >= x1 || y0 >= y1)
+						{
+							continue;
+						}
+
+						const float invArea = 1.f / edgeFunction(v0, v1, v2.x, v2.y);
+
+						// Edge functions are linear, so we could step them
+						const float w0StepX = -(v2.y - v1.y), w0StepY = (v2.x - v1.x);
+						const float w1StepX = -(v0.y - v2.y), w1StepY = (v0.x - v2.x);
+						const float w2StepX = -(v1.y - v0.y), w2StepY = (v1.x - v0.x);
+
+						const float startX = static_cast<float>(x0) + 0.5f;
+						const float startY = static_cast<float>(y0) + 0.5f;
+
+						float w0Row = edgeFunction(v1, v2, startX, startY);
+						float w1Row = edgeFunction(v2, v0, startX, startY);
+						float w2Row = edgeFunction(v0, v1, startX, startY);
+
+						for (int y = y0; y < y1; ++y)
+						{
+							float w0 = w0Row, w1 = w1Row, w2 = w2Row;
+
+							for (int x = x0; x < x1; ++x)
+							{
+								if (w0 >= .0f && w1 >= .0f && w2 >= .0f)
+								{
+									const float z = (w0 * v0.z + w1 * v1.z + w2 * v2.z) * invArea;
+									auto &depth = depthBuffer[static_cast<std::size_t>(y) * options.width + x];
+
+									if (z < depth)
+									{
+										depth = z;
+										image.setPixel(x, y, triangle.color);
+									}
+								}
+
+								w0 += w0StepX;
+								w1 += w1StepX;
+								w2 += w2StepX;
+							}
+
+							w0Row += w0StepY;
+							w1Row += w1StepY;
+							w2Row += w2StepY;
+						}
+					}
+				}
+			}
+		});
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,196 @@
+#include <Rasterizer/ThumbnailAtlas.h>
+#include <Rasterizer/ThumbnailBatch.h>
+#include <GameLib/Workers.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+
+namespace rasterizer
+{
+	namespace
+	{
+		/**
+		 * @brief Same primitive rendered with different options is a different thumbnail
+		 */
+		std::uint64_t makeCacheKey(std::uint64_t contentHash, const RenderOptions &options)
+		{
+			auto mix = [](std::uint64_t hash, std::uint64_t value) -> std::uint64_t
+			{
+				return hash ^ (value + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2));
+			};
+
+			auto key = contentHash;
+			key = mix(key, static_cast<std::uint64_t>(options.width));
+			key = mix(key, static_cast<std::uint64_t>(options.height));
+			key = mix(key, static_cast<std::uint64_t>(options.shadingMode));
+			key = mix(key, static_cast<std::uint64_t>(std::lround(options.yawDegrees * 100.f)));
+			key = mix(key, static_cast<std::uint64_t>(std::lround(options.pitchDegrees * 100.f)));
+			key = mix(key, options.backgroundColor);
+			key = mix(key, options.baseColor);
+			return key;
+		}
+	}
+
+	bool ThumbnailAtlas::build(const std::vector<gamelib::prm::PRMChunk> &chunks, const RenderOptions &options, ThumbnailCache *cache)
+	{
+		clear();
+
+		if (options.width <= 0 || options.height <= 0)
+		{
+			return false;
+		}
+
+		const auto primitives = ThumbnailBatch::collectPrimitives(chunks);
+		m_stats.totalPrimitives = primitives.size();
+
+		if (primitives.empty())
+		{
+			return false;
+		}
+
+		// Stage 1: content hashes & cache lookup (parallel)
+		std::vector<std::uint64_t> cacheKeys(primitives.size(), 0);
+		std::vector<Image> thumbnails(primitives.size());
+		std::vector<std::uint8_t> isResolved(primitives.size(), 0);
+		std::atomic<std::size_t> nextPrimitive { 0 };
+
+		gamelib::runWorkers(gamelib::resolveWorkersCount(options.threadsCount, primitives.size()), [&](int)
+		{
+			for (auto index = nextPrimitive.fetch_add(1); index < primitives.size(); index = nextPrimitive.fetch_add(1))
+			{
+				const auto contentHash = ThumbnailCache::computePrimitiveHash(chunks, primitives[index]);
+				if (!contentHash)
+				{
+					isResolved[index] = 1; // Nothing to render
+					continue;
+				}
+
+				cacheKeys[index] = makeCacheKey(contentHash, options);
+
+				Image cached;
+				if (cache && cache->find(cacheKeys[index], cached) && (cached.empty() || (cached.width == options.width && cached.height == options.height)))
+				{
+					thumbnails[index] = std::move(cached);
+					isResolved[index] = 1;
+				}
+			}
+		});
+
+		// Stage 2: render missing thumbnails
+		std::vector<std::uint32_t> toRender;
+		std::unordered_map<std::uint32_t, std::size_t> slotByPrimitive;
+
+		for (std::size_t i = 0; i < primitives.size(); ++i)
+		{
+			if (!isResolved[i])
+			{
+				toRender.push_back(primitives[i]);
+				slotByPrimitive[primitives[i]] = i;
+			}
+			else if (cacheKeys[i])
+			{
+				++m_stats.fromCache;
+			}
+		}
+
+		if (!toRender.empty())
+		{
+			// Every slot is written by single worker, map is read only here
+			m_stats.rendered = ThumbnailBatch::renderAll(chunks, toRender, options, [&thumbnails, &slotByPrimitive](std::uint32_t primitiveIndex, const Image &thumbnail)
+			{
+				thumbnails[slotByPrimitive.at(primitiveIndex)] = thumbnail;
+			});
+
+			if (cache)
+			{
+				for (const auto primitiveIndex : toRender)
+				{
+					const auto slot = slotByPrimitive.at(primitiveIndex);
+					cache->insert(cacheKeys[slot], thumbnails[slot]); // Empty image means 'no geometry'
+				}
+			}
+		}
+
+		// Stage 3: compose atlas
+		std::size_t cellsCount = 0;
+		for (const auto &thumbnail : thumbnails)
+		{
+			if (!thumbnail.empty())
+			{
+				++cellsCount;
+			}
+		}
+
+		m_stats.withoutGeometry = primitives.size() - cellsCount;
+
+		if (!cellsCount)
+		{
+			return false;
+		}
+
+		const int columns = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(cellsCount))));
+		const int rows = static_cast<int>((cellsCount + columns - 1) / columns);
+
+		m_image = Image(columns * options.width, rows * options.height, options.backgroundColor);
+		m_cells.reserve(cellsCount);
+
+		int cellIndex = 0;
+		for (std::size_t i = 0; i < primitives.size(); ++i)
+		{
+			const auto &thumbnail = thumbnails[i];
+			if (thumbnail.empty())
+			{
+				continue;
+			}
+
+			Cell cell;
+			cell.x = (cellIndex % columns) * options.width;
+			cell.y = (cellIndex / columns) * options.height;
+			cell.width = thumbnail.width;
+			cell.height = thumbnail.height;
+
+			const auto rowSize = static_cast<std::size_t>(thumbnail.width) * Image::kBytesPerPixel;
+
+			for (int y = 0; y < thumbnail.height; ++y)
+			{
+				const auto *src = &thumbnail.pixels[static_cast<std::size_t>(y) * rowSize];
+				auto *dst = &m_image.pixels[((static_cast<std::size_t>(cell.y) + y) * m_image.width + cell.x) * Image::kBytesPerPixel];
+				std::copy(src, src + rowSize, dst);
+			}
+
+			m_cells[primitives[i]] = cell;
+			++cellIndex;
+		}
+
+		return true;
+	}
+
+	void ThumbnailAtlas::clear()
+	{
+		m_image = Image();
+		m_cells.clear();
+		m_stats = Stats();
+	}
+
+	const Image &ThumbnailAtlas::getImage() const
+	{
+		return m_image;
+	}
+
+	const ThumbnailAtlas::Cell *ThumbnailAtlas::getCell(std::uint32_t primitiveIndex) const
+	{
+		auto it = m_cells.find(primitiveIndex);
+		return it != m_cells.end() ? &it->second : nullptr;
+	}
+
+	const std::unordered_map<std::uint32_t, ThumbnailAtlas::Cell> &ThumbnailAtlas::getCells() const
+	{
+		return m_cells;
+	}
+
+	const ThumbnailAtlas::Stats &ThumbnailAtlas::getStats() const
+	{
+		return m_stats;
+	}
+}
\ No newline at end of file
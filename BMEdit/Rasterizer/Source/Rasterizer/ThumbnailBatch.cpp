@@ -0,0 +1,60 @@
+#include <Rasterizer/ThumbnailBatch.h>
+#include <Rasterizer/PrimitiveRenderer.h>
+#include <GameLib/Workers.h>
+#include <atomic>
+
+
+namespace rasterizer
+{
+	std::vector<std::uint32_t> ThumbnailBatch::collectPrimitives(const std::vector<gamelib::prm::PRMChunk> &chunks)
+	{
+		std::vector<std::uint32_t> primitives;
+
+		for (const auto &chunk : chunks)
+		{
+			if (chunk.getKind() == gamelib::prm::PRMChunkRecognizedKind::CRK_DESCRIPTION_BUFFER)
+			{
+				primitives.push_back(chunk.getIndex());
+			}
+		}
+
+		return primitives;
+	}
+
+	std::size_t ThumbnailBatch::renderAll(const std::vector<gamelib::prm::PRMChunk> &chunks, const std::vector<std::uint32_t> &primitives, const RenderOptions &options, const OnThumbnailReady &onReady)
+	{
+		if (primitives.empty())
+		{
+			return 0;
+		}
+
+		// Thumbnails are small, so it's cheaper to render each of them on single thread and parallelize by primitives
+		RenderOptions primitiveOptions = options;
+		primitiveOptions.threadsCount = 1;
+
+		std::atomic<std::size_t> nextPrimitive { 0 };
+		std::atomic<std::size_t> renderedCount { 0 };
+
+		gamelib::runWorkers(gamelib::resolveWorkersCount(options.threadsCount, primitives.size()), [&](int)
+		{
+			Image image;
+
+			for (auto index = nextPrimitive.fetch_add(1); index < primitives.size(); index = nextPrimitive.fetch_add(1))
+			{
+				if (!PrimitiveRenderer::render(chunks, primitives[index], primitiveOptions, image))
+				{
+					continue;
+				}
+
+				++renderedCount;
+
+				if (onReady)
+				{
+					onReady(primitives[index], image);
+				}
+			}
+		});
+
+		return renderedCount.load();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,306 @@
+#include <Rasterizer/ThumbnailCache.h>
+#include <GameLib/PRM/PRMMeshExtractor.h>
+#include <GameLib/ContentHash.h>
+#include <algorithm>
+#include <fstream>
+
+
+namespace rasterizer
+{
+	namespace
+	{
+		template <typename T>
+		void writeLE(std::ostream &stream, T value)
+		{
+			for (std::size_t i = 0; i < sizeof(T); ++i)
+			{
+				stream.put(static_cast<char>((static_cast<std::uint64_t>(value) >> (i * 8)) & 0xFFu));
+			}
+		}
+
+		template <typename T>
+		bool readLE(std::istream &stream, T &value)
+		{
+			std::uint64_t result = 0;
+
+			for (std::size_t i = 0; i < sizeof(T); ++i)
+			{
+				const auto ch = stream.get();
+				if (ch == std::char_traits<char>::eof())
+				{
+					return false;
+				}
+
+				result |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(ch)) << (i * 8);
+			}
+
+			value = static_cast<T>(result);
+			return true;
+		}
+
+		constexpr std::size_t kEntryHeaderSize = sizeof(std::uint64_t) + 2 * sizeof(std::uint16_t);
+
+		std::size_t getEntrySize(const Image &image)
+		{
+			return kEntryHeaderSize + image.pixels.size();
+		}
+	}
+
+	ThumbnailCache::ThumbnailCache(std::size_t capacity) : m_capacity(capacity)
+	{
+	}
+
+	bool ThumbnailCache::find(std::uint64_t contentHash, Image &image)
+	{
+		std::lock_guard<std::mutex> guard { m_lock };
+
+		auto it = m_thumbnails.find(contentHash);
+		if (it == m_thumbnails.end())
+		{
+			return false;
+		}
+
+		it->second.lastUse = ++m_useCounter;
+		image = it->second.image;
+		return true;
+	}
+
+	void ThumbnailCache::insert(std::uint64_t contentHash, const Image &image)
+	{
+		std::lock_guard<std::mutex> guard { m_lock };
+
+		auto [it, isNew] = m_thumbnails.try_emplace(contentHash);
+		auto &entry = it->second;
+		entry.lastUse = ++m_useCounter;
+
+		if (!isNew && entry.image.width == image.width && entry.image.height == image.height && entry.image.pixels == image.pixels)
+		{
+			return; // Same thumbnail, nothing to save
+		}
+
+		m_bytes -= std::min(m_bytes, getEntrySize(entry.image));
+		entry.image = image;
+		m_bytes += getEntrySize(entry.image);
+		m_isDirty = true;
+
+		evictOverCapacity();
+	}
+
+	void ThumbnailCache::clear()
+	{
+		std::lock_guard<std::mutex> guard { m_lock };
+		m_isDirty = m_isDirty || !m_thumbnails.empty();
+		m_thumbnails.clear();
+		m_bytes = 0;
+	}
+
+	std::size_t ThumbnailCache::size() const
+	{
+		std::lock_guard<std::mutex> guard { m_lock };
+		return m_thumbnails.size();
+	}
+
+	void ThumbnailCache::setCapacity(std::size_t capacity)
+	{
+		std::lock_guard<std::mutex> guard { m_lock };
+		m_capacity = capacity;
+		evictOverCapacity();
+	}
+
+	std::size_t ThumbnailCache::getCapacity() const
+	{
+		std::lock_guard<std::mutex> guard { m_lock };
+		return m_capacity;
+	}
+
+	std::size_t ThumbnailCache::getBytes() const
+	{
+		std::lock_guard<std::mutex> guard { m_lock };
+		return m_bytes;
+	}
+
+	bool ThumbnailCache::isDirty() const
+	{
+		std::lock_guard<std::mutex> guard { m_lock };
+		return m_isDirty;
+	}
+
+	bool ThumbnailCache::loadFromFile(const std::string &path)
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file)
+		{
+			return false;
+		}
+
+		std::uint32_t magic = 0, version = 0, count = 0;
+		if (!readLE(file, magic) || !readLE(file, version) || !readLE(file, count) || magic != kMagic || version != kVersion)
+		{
+			return false;
+		}
+
+		// Each entry takes at least its header, so broken count rejects the file before any allocation
+		const auto dataOffset = file.tellg();
+		file.seekg(0, std::ios::end);
+		const auto fileSize = file.tellg();
+		file.seekg(dataOffset);
+
+		if (!file || dataOffset < 0 || fileSize < dataOffset || static_cast<std::uint64_t>(fileSize - dataOffset) / kEntryHeaderSize < count)
+		{
+			return false;
+		}
+
+		// Entries are stored from the most recently used one
+		std::vector<std::pair<std::uint64_t, Image>> thumbnails;
+		thumbnails.reserve(count);
+
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			std::uint64_t hash = 0;
+			std::uint16_t width = 0, height = 0;
+
+			if (!readLE(file, hash) || !readLE(file, width) || !readLE(file, height))
+			{
+				return false;
+			}
+
+			Image image;
+			if (width && height)
+			{
+				image.width = width;
+				image.height = height;
+				image.pixels.resize(static_cast<std::size_t>(width) * height * Image::kBytesPerPixel);
+
+				if (!file.read(reinterpret_cast<char*>(image.pixels.data()), static_cast<std::streamsize>(image.pixels.size())))
+				{
+					return false;
+				}
+			}
+
+			thumbnails.emplace_back(hash, std::move(image));
+		}
+
+		std::lock_guard<std::mutex> guard { m_lock };
+
+		// Loaded entries are older than entries which are already in memory
+		const bool wasEmpty = m_thumbnails.empty();
+		for (auto it = thumbnails.rbegin(); it != thumbnails.rend(); ++it)
+		{
+			if (m_thumbnails.contains(it->first))
+			{
+				continue;
+			}
+
+			auto &entry = m_thumbnails[it->first];
+			entry.image = std::move(it->second);
+			entry.lastUse = ++m_useCounter;
+			m_bytes += getEntrySize(entry.image);
+		}
+
+		m_isDirty = !wasEmpty;
+		evictOverCapacity();
+		return true;
+	}
+
+	bool ThumbnailCache::saveToFile(const std::string &path)
+	{
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		if (!file)
+		{
+			return false;
+		}
+
+		std::lock_guard<std::mutex> guard { m_lock };
+
+		std::vector<std::pair<std::uint64_t, const Entry *>> entries;
+		entries.reserve(m_thumbnails.size());
+
+		for (const auto &[hash, entry] : m_thumbnails)
+		{
+			entries.emplace_back(hash, &entry);
+		}
+
+		std::sort(entries.begin(), entries.end(), [](const auto &a, const auto &b) { return a.second->lastUse > b.second->lastUse; });
+
+		writeLE<std::uint32_t>(file, kMagic);
+		writeLE<std::uint32_t>(file, kVersion);
+		writeLE<std::uint32_t>(file, static_cast<std::uint32_t>(entries.size()));
+
+		for (const auto &[hash, entry] : entries)
+		{
+			const auto &image = entry->image;
+			const bool isEmpty = image.empty() || image.width > 0xFFFF || image.height > 0xFFFF;
+
+			writeLE<std::uint64_t>(file, hash);
+			writeLE<std::uint16_t>(file, isEmpty ? 0 : static_cast<std::uint16_t>(image.width));
+			writeLE<std::uint16_t>(file, isEmpty ? 0 : static_cast<std::uint16_t>(image.height));
+
+			if (!isEmpty)
+			{
+				file.write(reinterpret_cast<const char*>(image.pixels.data()), static_cast<std::streamsize>(image.pixels.size()));
+			}
+		}
+
+		if (!file.good())
+		{
+			return false;
+		}
+
+		m_isDirty = false;
+		return true;
+	}
+
+	void ThumbnailCache::evictOverCapacity()
+	{
+		if (m_bytes <= m_capacity)
+		{
+			return;
+		}
+
+		// Evict down to 3/4 of capacity, so next inserts don't evict entries one by one
+		std::vector<std::pair<std::uint64_t, std::uint64_t>> entriesByUse;
+		entriesByUse.reserve(m_thumbnails.size());
+
+		for (const auto &[hash, entry] : m_thumbnails)
+		{
+			entriesByUse.emplace_back(entry.lastUse, hash);
+		}
+
+		std::sort(entriesByUse.begin(), entriesByUse.end());
+
+		const auto targetBytes = m_capacity - m_capacity / 4;
+		for (const auto &[lastUse, hash] : entriesByUse)
+		{
+			if (m_bytes <= targetBytes)
+			{
+				break;
+			}
+
+			auto it = m_thumbnails.find(hash);
+			m_bytes -= std::min(m_bytes, getEntrySize(it->second.image));
+			m_thumbnails.erase(it);
+		}
+
+		m_isDirty = true;
+	}
+
+	std::uint64_t ThumbnailCache::computePrimitiveHash(const std::vector<gamelib::prm::PRMChunk> &chunks, std::uint32_t primitiveIndex)
+	{
+		std::vector<std::pair<std::uint32_t, std::uint32_t>> meshReferences;
+		if (!gamelib::prm::PRMMeshExtractor::collectMeshReferences(chunks, primitiveIndex, meshReferences))
+		{
+			return 0;
+		}
+
+		// Thumbnail depends only on description chunk & referenced buffers
+		auto hash = gamelib::ContentHash::compute(chunks[primitiveIndex].getBuffer());
+
+		for (const auto &[vertexChunk, indexChunk] : meshReferences)
+		{
+			hash = gamelib::ContentHash::combine(hash, gamelib::ContentHash::compute(chunks[vertexChunk].getBuffer()));
+			hash = gamelib::ContentHash::combine(hash, gamelib::ContentHash::compute(chunks[indexChunk].getBuffer()));
+		}
+
+		return hash;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include <GameLib/PRM/PRMReader.h>
+#include <GameLib/PRM/PRMException.h>
+#include <GameLib/Level.h>
+#include <Rasterizer/ThumbnailBatch.h>
+#include <Rasterizer/ThumbnailAtlas.h>
+#include <Rasterizer/ThumbnailCache.h>
+#include <fmt/format.h>
+#include <filesystem>
+#include <fstream>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+#include <atomic>
+#include <string>
+#include <string_view>
+
+
+int main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		printf("Usage: %s <path to PRM file> <output folder> [thumbnail size] [--atlas]\n", argv[0]);
+		return -1;
+	}
+
+	const std::filesystem::path prmPath { argv[1] };
+	const std::filesystem::path outputPath { argv[2] };
+
+	rasterizer::RenderOptions options;
+	bool buildAtlas = false;
+
+	for (int i = 3; i < argc; ++i)
+	{
+		if (std::string_view(argv[i]) == "--atlas")
+		{
+			buildAtlas = true;
+		}
+		else
+		{
+			options.width = options.height = std::max(16, std::atoi(argv[i]));
+		}
+	}
+
+	// Read PRM file
+	std::ifstream prmFile(prmPath, std::ios::binary | std::ios::ate);
+	if (!prmFile)
+	{
+		printf("Unable to open file %s\n", prmPath.string().c_str());
+		return -1;
+	}
+
+	const auto prmFileSize = static_cast<int64_t>(prmFile.tellg());
+	auto prmFileBuffer = std::make_unique<uint8_t[]>(prmFileSize);
+	prmFile.seekg(0);
+	prmFile.read(reinterpret_cast<char*>(prmFileBuffer.get()), prmFileSize);
+
+	gamelib::LevelGeometry geometry;
+
+	try
+	{
+		gamelib::prm::PRMReader reader { geometry.header, geometry.chunkDescriptors, geometry.chunks };
+		if (!reader.read(gamelib::Span(prmFileBuffer.get(), prmFileSize)))
+		{
+			printf("Unable to read PRM file %s\n", prmPath.string().c_str());
+			return -1;
+		}
+	}
+	catch (const gamelib::prm::PRMException &ex)
+	{
+		printf("Bad PRM file %s: %s\n", prmPath.string().c_str(), ex.what());
+		return -1;
+	}
+
+	std::error_code ec;
+	std::filesystem::create_directories(outputPath, ec);
+
+	if (buildAtlas)
+	{
+		// Atlas mode: reuse thumbnails from previous runs
+		const auto cachePath = (outputPath / "thumbnails.cache").string();
+
+		rasterizer::ThumbnailCache cache;
+		cache.loadFromFile(cachePath);
+
+		rasterizer::ThumbnailAtlas atlas;
+		const bool hasAnyThumbnail = atlas.build(geometry.chunks, options, &cache);
+		const auto &stats = atlas.getStats();
+
+		printf("Primitives: %zu, from cache: %zu, rendered: %zu, without geometry: %zu\n", stats.totalPrimitives, stats.fromCache, stats.rendered, stats.withoutGeometry);
+
+		if (cache.isDirty() && !cache.saveToFile(cachePath))
+		{
+			printf("Unable to save cache to %s\n", cachePath.c_str());
+		}
+
+		if (hasAnyThumbnail && !atlas.getImage().saveAsTGA((outputPath / "atlas.tga").string()))
+		{
+			printf("Unable to save atlas\n");
+			return -1;
+		}
+
+		return 0;
+	}
+
+	// Render
+	const auto primitives = rasterizer::ThumbnailBatch::collectPrimitives(geometry.chunks);
+	std::atomic<int> failedToSave { 0 };
+
+	const auto renderedCount = rasterizer::ThumbnailBatch::renderAll(geometry.chunks, primitives, options, [&outputPath, &failedToSave](std::uint32_t primitiveIndex, const rasterizer::Image &thumbnail)
+	{
+		const auto thumbnailPath = outputPath / fmt::format("prim_{:05}.tga", primitiveIndex);
+		if (!thumbnail.saveAsTGA(thumbnailPath.string()))
+		{
+			++failedToSave;
+		}
+	});
+
+	printf("Primitives: %zu, rendered: %zu, failed to save: %d\n", primitives.size(), renderedCount, failedToSave.load());
+	return failedToSave.load() == 0 ? 0 : -1;
+}
\ No newline at end of file